@@ -2,7 +2,9 @@
 # Automatically generated by qmake (3.1) Tue Aug 24 13:18:30 2021
 ######################################################################
 
-QT += widgets
+QT += widgets concurrent
+CONFIG += c++17
+LIBS += -lz
 TEMPLATE = app
 TARGET = ../egs_brachy_GUI
 INCLUDEPATH += .
@@ -39,24735 +39,4213 @@
 
 #include "parse_dicom.h"
 
-database::database() {
-    Reference *x;
+// The data dictionary is a constant table, so it costs nothing to set up and
+// lookups never allocate.  Entries must stay sorted by tag (this is checked at
+// compile time), the hash index used by find is built by the compiler.
+// Repeating groups (50xx, 60xx, 7Fxx, ...) are not included.
+namespace {
 
-    validVR << "AE" << "AS" << "AT" << "CS" << "DA" << "DS" << "DT" << "FL"
-            << "FD" << "IS" << "LO" << "LT" << "OB" << "OF" << "OW" << "PN"
-            << "SH" << "SL" << "SQ" << "SS" << "ST" << "TM" << "UI" << "UL"
-            << "UN" << "US" << "UT";
-    implicitVR << "OB" << "OW" << "OF" << "SQ" << "UT" << "UN";
+constexpr Reference dictionary[] = {
+    {0x00020000, VR_UL, "File Meta Information Group Length"},
+    {0x00020001, VR_OB, "File Meta Information Version"},
+    {0x00020002, VR_UI, "Media Storage SOP Class UID"},
+    {0x00020003, VR_UI, "Media Storage SOP Instance UID"},
+    {0x00020010, VR_UI, "Transfer Syntax UID"},
+    {0x00020012, VR_UI, "Implementation Class UID"},
+    {0x00020013, VR_SH, "Implementation Version Name"},
+    {0x00020016, VR_AE, "Source Application Entity Title"},
+    {0x00020017, VR_AE, "Sending Application Entity Title"},
+    {0x00020018, VR_AE, "Receiving Application Entity Title"},
+    {0x00020100, VR_UI, "Private Information Creator UID"},
+    {0x00020102, VR_OB, "Private Information"},
+    {0x00041130, VR_CS, "File-set ID"},
+    {0x00041141, VR_CS, "File-set Descriptor File ID"},
+    {0x00041142, VR_CS, "Specific Character Set of File-set Descriptor File"},
+    {0x00041200, VR_UL, "Offset of the First Directory Record of the Root Directory Entity"},
+    {0x00041202, VR_UL, "Offset of the Last Directory Record of the Root Directory Entity"},
+    {0x00041212, VR_US, "File-set Consistency Flag"},
+    {0x00041220, VR_SQ, "Directory Record Sequence"},
+    {0x00041400, VR_UL, "Offset of the Next Directory Record"},
+    {0x00041410, VR_US, "Record In-use Flag"},
+    {0x00041420, VR_UL, "Offset of Referenced Lower-Level Directory Entity"},
+    {0x00041430, VR_CS, "Directory Record Type"},
+    {0x00041432, VR_UI, "Private Record UID"},
+    {0x00041500, VR_CS, "Referenced File ID"},
+    {0x00041504, VR_UL, "MRDR Directory Record Offset"},
+    {0x00041510, VR_UI, "Referenced SOP Class UID in File"},
+    {0x00041511, VR_UI, "Referenced SOP Instance UID in File"},
+    {0x00041512, VR_UI, "Referenced Transfer Syntax UID in File"},
+    {0x0004151A, VR_UI, "Referenced Related General SOP Class UID in File"},
+    {0x00041600, VR_UL, "Number of References"},
+    {0x00080001, VR_UL, "Length to End"},
+    {0x00080005, VR_CS, "Specific Character Set"},
+    {0x00080006, VR_SQ, "Language Code Sequence"},
+    {0x00080008, VR_CS, "Image Type"},
+    {0x00080010, VR_SH, "Recognition Code"},
+    {0x00080012, VR_DA, "Instance Creation Date"},
+    {0x00080013, VR_TM, "Instance Creation Time"},
+    {0x00080014, VR_UI, "Instance Creator UID"},
+    {0x00080015, VR_DT, "Instance Coercion DateTime"},
+    {0x00080016, VR_UI, "SOP Class UID"},
+    {0x00080018, VR_UI, "SOP Instance UID"},
+    {0x0008001A, VR_UI, "Related General SOP Class UID"},
+    {0x0008001B, VR_UI, "Original Specialized SOP Class UID"},
+    {0x00080020, VR_DA, "Study Date"},
+    {0x00080021, VR_DA, "Series Date"},
+    {0x00080022, VR_DA, "Acquisition Date"},
+    {0x00080023, VR_DA, "Content Date"},
+    {0x00080024, VR_DA, "Overlay Date"},
+    {0x00080025, VR_DA, "Curve Date"},
+    {0x0008002A, VR_DT, "Acquisition DateTime"},
+    {0x00080030, VR_TM, "Study Time"},
+    {0x00080031, VR_TM, "Series Time"},
+    {0x00080032, VR_TM, "Acquisition Time"},
+    {0x00080033, VR_TM, "Content Time"},
+    {0x00080034, VR_TM, "Overlay Time"},
+    {0x00080035, VR_TM, "Curve Time"},
+    {0x00080040, VR_US, "Data Set Type"},
+    {0x00080041, VR_LO, "Data Set Subtype"},
+    {0x00080042, VR_CS, "Nuclear Medicine Series Type"},
+    {0x00080050, VR_SH, "Accession Number"},
+    {0x00080051, VR_SQ, "Issuer of Accession Number Sequence"},
+    {0x00080052, VR_CS, "Query/Retrieve Level"},
+    {0x00080053, VR_CS, "Query/Retrieve View"},
+    {0x00080054, VR_AE, "Retrieve AE Title"},
+    {0x00080055, VR_AE, "Station AE Title"},
+    {0x00080056, VR_CS, "Instance Availability"},
+    {0x00080058, VR_UI, "Failed SOP Instance UID List"},
+    {0x00080060, VR_CS, "Modality"},
+    {0x00080061, VR_CS, "Modalities in Study"},
+    {0x00080062, VR_UI, "SOP Classes in Study"},
+    {0x00080064, VR_CS, "Conversion Type"},
+    {0x00080068, VR_CS, "Presentation Intent Type"},
+    {0x00080070, VR_LO, "Manufacturer"},
+    {0x00080080, VR_LO, "Institution Name"},
+    {0x00080081, VR_ST, "Institution Address"},
+    {0x00080082, VR_SQ, "Institution Code Sequence"},
+    {0x00080090, VR_PN, "Referring Physician's Name"},
+    {0x00080092, VR_ST, "Referring Physician's Address"},
+    {0x00080094, VR_SH, "Referring Physician's Telephone Numbers"},
+    {0x00080096, VR_SQ, "Referring Physician Identification Sequence"},
+    {0x0008009C, VR_PN, "Consulting Physician's Name"},
+    {0x0008009D, VR_SQ, "Consulting Physician Identification Sequence"},
+    {0x00080100, VR_SH, "Code Value"},
+    {0x00080101, VR_LO, "Extended Code Value"},
+    {0x00080102, VR_SH, "Coding Scheme Designator"},
+    {0x00080103, VR_SH, "Coding Scheme Version"},
+    {0x00080104, VR_LO, "Code Meaning"},
+    {0x00080105, VR_CS, "Mapping Resource"},
+    {0x00080106, VR_DT, "Context Group Version"},
+    {0x00080107, VR_DT, "Context Group Local Version"},
+    {0x00080108, VR_LT, "Extended Code Meaning"},
+    {0x0008010B, VR_CS, "Context Group Extension Flag"},
+    {0x0008010C, VR_UI, "Coding Scheme UID"},
+    {0x0008010D, VR_UI, "Context Group Extension Creator UID"},
+    {0x0008010F, VR_CS, "Context Identifier"},
+    {0x00080110, VR_SQ, "Coding Scheme Identification Sequence"},
+    {0x00080112, VR_LO, "Coding Scheme Registry"},
+    {0x00080114, VR_ST, "Coding Scheme External ID"},
+    {0x00080115, VR_ST, "Coding Scheme Name"},
+    {0x00080116, VR_ST, "Coding Scheme Responsible Organization"},
+    {0x00080117, VR_UI, "Context UID"},
+    {0x00080118, VR_UI, "Mapping Resource UID"},
+    {0x00080119, VR_UC, "Long Code Value"},
+    {0x00080120, VR_UR, "URN Code Value"},
+    {0x00080121, VR_SQ, "Equivalent Code Sequence"},
+    {0x00080122, VR_LO, "Mapping Resource Name"},
+    {0x00080123, VR_SQ, "Context Group Identification Sequence"},
+    {0x00080124, VR_SQ, "Mapping Resource Identification Sequence"},
+    {0x00080201, VR_SH, "Timezone Offset From UTC"},
+    {0x00080300, VR_SQ, "Private Data Element Characteristics Sequence"},
+    {0x00080301, VR_US, "Private Group Reference"},
+    {0x00080302, VR_LO, "Private Creator Reference"},
+    {0x00080303, VR_CS, "Block Identifying Information Status"},
+    {0x00080304, VR_US, "Nonidentifying Private Elements"},
+    {0x00080305, VR_SQ, "Deidentification Action Sequence"},
+    {0x00080306, VR_US, "Identifying Private Elements"},
+    {0x00080307, VR_CS, "Deidentification Action"},
+    {0x00081000, VR_AE, "Network ID"},
+    {0x00081010, VR_SH, "Station Name"},
+    {0x00081030, VR_LO, "Study Description"},
+    {0x00081032, VR_SQ, "Procedure Code Sequence"},
+    {0x0008103E, VR_LO, "Series Description"},
+    {0x0008103F, VR_SQ, "Series Description Code Sequence"},
+    {0x00081040, VR_LO, "Institutional Department Name"},
+    {0x00081048, VR_PN, "Physician(s) of Record"},
+    {0x00081049, VR_SQ, "Physician(s) of Record Identification Sequence"},
+    {0x00081050, VR_PN, "Performing Physician's Name"},
+    {0x00081052, VR_SQ, "Performing Physician Identification Sequence"},
+    {0x00081060, VR_PN, "Name of Physician(s) Reading Study"},
+    {0x00081062, VR_SQ, "Physician(s) Reading Study Identification Sequence"},
+    {0x00081070, VR_PN, "Operators' Name"},
+    {0x00081072, VR_SQ, "Operator Identification Sequence"},
+    {0x00081080, VR_LO, "Admitting Diagnoses Description"},
+    {0x00081084, VR_SQ, "Admitting Diagnoses Code Sequence"},
+    {0x00081090, VR_LO, "Manufacturer's Model Name"},
+    {0x00081100, VR_SQ, "Referenced Results Sequence"},
+    {0x00081110, VR_SQ, "Referenced Study Sequence"},
+    {0x00081111, VR_SQ, "Referenced Performed Procedure Step Sequence"},
+    {0x00081115, VR_SQ, "Referenced Series Sequence"},
+    {0x00081120, VR_SQ, "Referenced Patient Sequence"},
+    {0x00081125, VR_SQ, "Referenced Visit Sequence"},
+    {0x00081130, VR_SQ, "Referenced Overlay Sequence"},
+    {0x00081134, VR_SQ, "Referenced Stereometric Instance Sequence"},
+    {0x0008113A, VR_SQ, "Referenced Waveform Sequence"},
+    {0x00081140, VR_SQ, "Referenced Image Sequence"},
+    {0x00081145, VR_SQ, "Referenced Curve Sequence"},
+    {0x0008114A, VR_SQ, "Referenced Instance Sequence"},
+    {0x0008114B, VR_SQ, "Referenced Real World Value Mapping Instance Sequence"},
+    {0x00081150, VR_UI, "Referenced SOP Class UID"},
+    {0x00081155, VR_UI, "Referenced SOP Instance UID"},
+    {0x0008115A, VR_UI, "SOP Classes Supported"},
+    {0x00081160, VR_IS, "Referenced Frame Number"},
+    {0x00081161, VR_UL, "Simple Frame List"},
+    {0x00081162, VR_UL, "Calculated Frame List"},
+    {0x00081163, VR_FD, "Time Range"},
+    {0x00081164, VR_SQ, "Frame Extraction Sequence"},
+    {0x00081167, VR_UI, "Multi-frame Source SOP Instance UID"},
+    {0x00081190, VR_UR, "Retrieve URL"},
+    {0x00081195, VR_UI, "Transaction UID"},
+    {0x00081196, VR_US, "Warning Reason"},
+    {0x00081197, VR_US, "Failure Reason"},
+    {0x00081198, VR_SQ, "Failed SOP Sequence"},
+    {0x00081199, VR_SQ, "Referenced SOP Sequence"},
+    {0x0008119A, VR_SQ, "Other Failures Sequence"},
+    {0x00081200, VR_SQ, "Studies Containing Other Referenced Instances Sequence"},
+    {0x00081250, VR_SQ, "Related Series Sequence"},
+    {0x00082110, VR_CS, "Lossy Image Compression (Retired)"},
+    {0x00082111, VR_ST, "Derivation Description"},
+    {0x00082112, VR_SQ, "Source Image Sequence"},
+    {0x00082120, VR_SH, "Stage Name"},
+    {0x00082122, VR_IS, "Stage Number"},
+    {0x00082124, VR_IS, "Number of Stages"},
+    {0x00082127, VR_SH, "View Name"},
+    {0x00082128, VR_IS, "View Number"},
+    {0x00082129, VR_IS, "Number of Event Timers"},
+    {0x0008212A, VR_IS, "Number of Views in Stage"},
+    {0x00082130, VR_DS, "Event Elapsed Time(s)"},
+    {0x00082132, VR_LO, "Event Timer Name(s)"},
+    {0x00082133, VR_SQ, "Event Timer Sequence"},
+    {0x00082134, VR_FD, "Event Time Offset"},
+    {0x00082135, VR_SQ, "Event Code Sequence"},
+    {0x00082142, VR_IS, "Start Trim"},
+    {0x00082143, VR_IS, "Stop Trim"},
+    {0x00082144, VR_IS, "Recommended Display Frame Rate"},
+    {0x00082200, VR_CS, "Transducer Position"},
+    {0x00082204, VR_CS, "Transducer Orientation"},
+    {0x00082208, VR_CS, "Anatomic Structure"},
+    {0x00082218, VR_SQ, "Anatomic Region Sequence"},
+    {0x00082220, VR_SQ, "Anatomic Region Modifier Sequence"},
+    {0x00082228, VR_SQ, "Primary Anatomic Structure Sequence"},
+    {0x00082229, VR_SQ, "Anatomic Structure, Space or Region Sequence"},
+    {0x00082230, VR_SQ, "Primary Anatomic Structure Modifier Sequence"},
+    {0x00082240, VR_SQ, "Transducer Position Sequence"},
+    {0x00082242, VR_SQ, "Transducer Position Modifier Sequence"},
+    {0x00082244, VR_SQ, "Transducer Orientation Sequence"},
+    {0x00082246, VR_SQ, "Transducer Orientation Modifier Sequence"},
+    {0x00082251, VR_SQ, "Anatomic Structure Space Or Region Code Sequence (Trial)"},
+    {0x00082253, VR_SQ, "Anatomic Portal Of Entrance Code Sequence (Trial)"},
+    {0x00082255, VR_SQ, "Anatomic Approach Direction Code Sequence (Trial)"},
+    {0x00082256, VR_ST, "Anatomic Perspective Description (Trial)"},
+    {0x00082257, VR_SQ, "Anatomic Perspective Code Sequence (Trial)"},
+    {0x00082258, VR_ST, "Anatomic Location Of Examining Instrument Description (Trial)"},
+    {0x00082259, VR_SQ, "Anatomic Location Of Examining Instrument Code Sequence (Trial)"},
+    {0x0008225A, VR_SQ, "Anatomic Structure Space Or Region Modifier Code Sequence (Trial)"},
+    {0x0008225C, VR_SQ, "On Axis Background Anatomic Structure Code Sequence (Trial)"},
+    {0x00083001, VR_SQ, "Alternate Representation Sequence"},
+    {0x00083010, VR_UI, "Irradiation Event UID"},
+    {0x00083011, VR_SQ, "Source Irradiation Event Sequence"},
+    {0x00083012, VR_UI, "Radiopharmaceutical Administration Event UID"},
+    {0x00084000, VR_LT, "Identifying Comments"},
+    {0x00089007, VR_CS, "Frame Type"},
+    {0x00089092, VR_SQ, "Referenced Image Evidence Sequence"},
+    {0x00089121, VR_SQ, "Referenced Raw Data Sequence"},
+    {0x00089123, VR_UI, "Creator-Version UID"},
+    {0x00089124, VR_SQ, "Derivation Image Sequence"},
+    {0x00089154, VR_SQ, "Source Image Evidence Sequence"},
+    {0x00089205, VR_CS, "Pixel Presentation"},
+    {0x00089206, VR_CS, "Volumetric Properties"},
+    {0x00089207, VR_CS, "Volume Based Calculation Technique"},
+    {0x00089208, VR_CS, "Complex Image Component"},
+    {0x00089209, VR_CS, "Acquisition Contrast"},
+    {0x00089215, VR_SQ, "Derivation Code Sequence"},
+    {0x00089237, VR_SQ, "Referenced Presentation State Sequence"},
+    {0x00089410, VR_SQ, "Referenced Other Plane Sequence"},
+    {0x00089458, VR_SQ, "Frame Display Sequence"},
+    {0x00089459, VR_FL, "Recommended Display Frame Rate in Float"},
+    {0x00089460, VR_CS, "Skip Frame Range Flag"},
+    {0x00100010, VR_PN, "Patient's Name"},
+    {0x00100020, VR_LO, "Patient ID"},
+    {0x00100021, VR_LO, "Issuer of Patient ID"},
+    {0x00100022, VR_CS, "Type of Patient ID"},
+    {0x00100024, VR_SQ, "Issuer of Patient ID Qualifiers Sequence"},
+    {0x00100026, VR_SQ, "Source Patient Group Identification Sequence"},
+    {0x00100027, VR_SQ, "Group of Patients Identification Sequence"},
+    {0x00100028, VR_US, "Subject Relative Position in Image"},
+    {0x00100030, VR_DA, "Patient's Birth Date"},
+    {0x00100032, VR_TM, "Patient's Birth Time"},
+    {0x00100033, VR_LO, "Patient's Birth Date in Alternative Calendar"},
+    {0x00100034, VR_LO, "Patient's Death Date in Alternative Calendar"},
+    {0x00100035, VR_CS, "Patient's Alternative Calendar"},
+    {0x00100040, VR_CS, "Patient's Sex"},
+    {0x00100050, VR_SQ, "Patient's Insurance Plan Code Sequence"},
+    {0x00100101, VR_SQ, "Patient's Primary Language Code Sequence"},
+    {0x00100102, VR_SQ, "Patient's Primary Language Modifier Code Sequence"},
+    {0x00100200, VR_CS, "Quality Control Subject"},
+    {0x00100201, VR_SQ, "Quality Control Subject Type Code Sequence"},
+    {0x00100212, VR_UC, "Strain Description"},
+    {0x00100213, VR_LO, "Strain Nomenclature"},
+    {0x00100214, VR_LO, "Strain Stock Number"},
+    {0x00100215, VR_SQ, "Strain Source Registry Code Sequence"},
+    {0x00100216, VR_SQ, "Strain Stock Sequence"},
+    {0x00100217, VR_LO, "Strain Source"},
+    {0x00100218, VR_UT, "Strain Additional Information"},
+    {0x00100219, VR_SQ, "Strain Code Sequence"},
+    {0x00101000, VR_LO, "Other Patient IDs"},
+    {0x00101001, VR_PN, "Other Patient Names"},
+    {0x00101002, VR_SQ, "Other Patient IDs Sequence"},
+    {0x00101005, VR_PN, "Patient's Birth Name"},
+    {0x00101010, VR_AS, "Patient's Age"},
+    {0x00101020, VR_DS, "Patient's Size"},
+    {0x00101021, VR_SQ, "Patient's Size Code Sequence"},
+    {0x00101030, VR_DS, "Patient's Weight"},
+    {0x00101040, VR_LO, "Patient's Address"},
+    {0x00101050, VR_LO, "Insurance Plan Identification"},
+    {0x00101060, VR_PN, "Patient's Mother's Birth Name"},
+    {0x00101080, VR_LO, "Military Rank"},
+    {0x00101081, VR_LO, "Branch of Service"},
+    {0x00101090, VR_LO, "Medical Record Locator"},
+    {0x00101100, VR_SQ, "Referenced Patient Photo Sequence"},
+    {0x00102000, VR_LO, "Medical Alerts"},
+    {0x00102110, VR_LO, "Allergies"},
+    {0x00102150, VR_LO, "Country of Residence"},
+    {0x00102152, VR_LO, "Region of Residence"},
+    {0x00102154, VR_SH, "Patient's Telephone Numbers"},
+    {0x00102155, VR_LT, "Patient's Telecom Information"},
+    {0x00102160, VR_SH, "Ethnic Group"},
+    {0x00102180, VR_SH, "Occupation"},
+    {0x001021A0, VR_CS, "Smoking Status"},
+    {0x001021B0, VR_LT, "Additional Patient History"},
+    {0x001021C0, VR_US, "Pregnancy Status"},
+    {0x001021D0, VR_DA, "Last Menstrual Date"},
+    {0x001021F0, VR_LO, "Patient's Religious Preference"},
+    {0x00102201, VR_LO, "Patient Species Description"},
+    {0x00102202, VR_SQ, "Patient Species Code Sequence"},
+    {0x00102203, VR_CS, "Patient's Sex Neutered"},
+    {0x00102210, VR_CS, "Anatomical Orientation Type"},
+    {0x00102292, VR_LO, "Patient Breed Description"},
+    {0x00102293, VR_SQ, "Patient Breed Code Sequence"},
+    {0x00102294, VR_SQ, "Breed Registration Sequence"},
+    {0x00102295, VR_LO, "Breed Registration Number"},
+    {0x00102296, VR_SQ, "Breed Registry Code Sequence"},
+    {0x00102297, VR_PN, "Responsible Person"},
+    {0x00102298, VR_CS, "Responsible Person Role"},
+    {0x00102299, VR_LO, "Responsible Organization"},
+    {0x00104000, VR_LT, "Patient Comments"},
+    {0x00109431, VR_FL, "Examined Body Thickness"},
+    {0x00120010, VR_LO, "Clinical Trial Sponsor Name"},
+    {0x00120020, VR_LO, "Clinical Trial Protocol ID"},
+    {0x00120021, VR_LO, "Clinical Trial Protocol Name"},
+    {0x00120030, VR_LO, "Clinical Trial Site ID"},
+    {0x00120031, VR_LO, "Clinical Trial Site Name"},
+    {0x00120040, VR_LO, "Clinical Trial Subject ID"},
+    {0x00120042, VR_LO, "Clinical Trial Subject Reading ID"},
+    {0x00120050, VR_LO, "Clinical Trial Time Point ID"},
+    {0x00120051, VR_ST, "Clinical Trial Time Point Description"},
+    {0x00120060, VR_LO, "Clinical Trial Coordinating Center Name"},
+    {0x00120062, VR_CS, "Patient Identity Removed"},
+    {0x00120063, VR_LO, "De-identification Method"},
+    {0x00120064, VR_SQ, "De-identification Method Code Sequence"},
+    {0x00120071, VR_LO, "Clinical Trial Series ID"},
+    {0x00120072, VR_LO, "Clinical Trial Series Description"},
+    {0x00120081, VR_LO, "Clinical Trial Protocol Ethics Committee Name"},
+    {0x00120082, VR_LO, "Clinical Trial Protocol Ethics Committee Approval Number"},
+    {0x00120083, VR_SQ, "Consent for Clinical Trial Use Sequence"},
+    {0x00120084, VR_CS, "Distribution Type"},
+    {0x00120085, VR_CS, "Consent for Distribution Flag"},
+    {0x00140023, VR_ST, "CAD File Format"},
+    {0x00140024, VR_ST, "Component Reference System"},
+    {0x00140025, VR_ST, "Component Manufacturing Procedure"},
+    {0x00140028, VR_ST, "Component Manufacturer"},
+    {0x00140030, VR_DS, "Material Thickness"},
+    {0x00140032, VR_DS, "Material Pipe Diameter"},
+    {0x00140034, VR_DS, "Material Isolation Diameter"},
+    {0x00140042, VR_ST, "Material Grade"},
+    {0x00140044, VR_ST, "Material Properties Description"},
+    {0x00140045, VR_ST, "Material Properties File Format (Retired)"},
+    {0x00140046, VR_LT, "Material Notes"},
+    {0x00140050, VR_CS, "Component Shape"},
+    {0x00140052, VR_CS, "Curvature Type"},
+    {0x00140054, VR_DS, "Outer Diameter"},
+    {0x00140056, VR_DS, "Inner Diameter"},
+    {0x00140100, VR_LO, "Component Welder IDs"},
+    {0x00140101, VR_CS, "Secondary Approval Status"},
+    {0x00140102, VR_DA, "Secondary Review Date"},
+    {0x00140103, VR_TM, "Secondary Review Time"},
+    {0x00140104, VR_PN, "Secondary Reviewer Name"},
+    {0x00140105, VR_ST, "Repair ID"},
+    {0x00140106, VR_SQ, "Multiple Component Approval Sequence"},
+    {0x00140107, VR_CS, "Other Approval Status"},
+    {0x00140108, VR_CS, "Other Secondary Approval Status"},
+    {0x00141010, VR_ST, "Actual Environmental Conditions"},
+    {0x00141020, VR_DA, "Expiry Date"},
+    {0x00141040, VR_ST, "Environmental Conditions"},
+    {0x00142002, VR_SQ, "Evaluator Sequence"},
+    {0x00142004, VR_IS, "Evaluator Number"},
+    {0x00142006, VR_PN, "Evaluator Name"},
+    {0x00142008, VR_IS, "Evaluation Attempt"},
+    {0x00142012, VR_SQ, "Indication Sequence"},
+    {0x00142014, VR_IS, "Indication Number"},
+    {0x00142016, VR_SH, "Indication Label"},
+    {0x00142018, VR_ST, "Indication Description"},
+    {0x0014201A, VR_CS, "Indication Type"},
+    {0x0014201C, VR_CS, "Indication Disposition"},
+    {0x0014201E, VR_SQ, "Indication ROI Sequence"},
+    {0x00142030, VR_SQ, "Indication Physical Property Sequence"},
+    {0x00142032, VR_SH, "Property Label"},
+    {0x00142202, VR_IS, "Coordinate System Number of Axes"},
+    {0x00142204, VR_SQ, "Coordinate System Axes Sequence"},
+    {0x00142206, VR_ST, "Coordinate System Axis Description"},
+    {0x00142208, VR_CS, "Coordinate System Data Set Mapping"},
+    {0x0014220A, VR_IS, "Coordinate System Axis Number"},
+    {0x0014220C, VR_CS, "Coordinate System Axis Type"},
+    {0x0014220E, VR_CS, "Coordinate System Axis Units"},
+    {0x00142210, VR_OB, "Coordinate System Axis Values"},
+    {0x00142220, VR_SQ, "Coordinate System Transform Sequence"},
+    {0x00142222, VR_ST, "Transform Description"},
+    {0x00142224, VR_IS, "Transform Number of Axes"},
+    {0x00142226, VR_IS, "Transform Order of Axes"},
+    {0x00142228, VR_CS, "Transformed Axis Units"},
+    {0x0014222A, VR_DS, "Coordinate System Transform Rotation and Scale Matrix"},
+    {0x0014222C, VR_DS, "Coordinate System Transform Translation Matrix"},
+    {0x00143011, VR_DS, "Internal Detector Frame Time"},
+    {0x00143012, VR_DS, "Number of Frames Integrated"},
+    {0x00143020, VR_SQ, "Detector Temperature Sequence"},
+    {0x00143022, VR_ST, "Sensor Name"},
+    {0x00143024, VR_DS, "Horizontal Offset of Sensor"},
+    {0x00143026, VR_DS, "Vertical Offset of Sensor"},
+    {0x00143028, VR_DS, "Sensor Temperature"},
+    {0x00143040, VR_SQ, "Dark Current Sequence"},
+    {0x00143050, VR_OB, "Dark Current Counts"},
+    {0x00143060, VR_SQ, "Gain Correction Reference Sequence"},
+    {0x00143070, VR_OB, "Air Counts"},
+    {0x00143071, VR_DS, "KV Used in Gain Calibration"},
+    {0x00143072, VR_DS, "MA Used in Gain Calibration"},
+    {0x00143073, VR_DS, "Number of Frames Used for Integration"},
+    {0x00143074, VR_LO, "Filter Material Used in Gain Calibration"},
+    {0x00143075, VR_DS, "Filter Thickness Used in Gain Calibration"},
+    {0x00143076, VR_DA, "Date of Gain Calibration"},
+    {0x00143077, VR_TM, "Time of Gain Calibration"},
+    {0x00143080, VR_OB, "Bad Pixel Image"},
+    {0x00143099, VR_LT, "Calibration Notes"},
+    {0x00144002, VR_SQ, "Pulser Equipment Sequence"},
+    {0x00144004, VR_CS, "Pulser Type"},
+    {0x00144006, VR_LT, "Pulser Notes"},
+    {0x00144008, VR_SQ, "Receiver Equipment Sequence"},
+    {0x0014400A, VR_CS, "Amplifier Type"},
+    {0x0014400C, VR_LT, "Receiver Notes"},
+    {0x0014400E, VR_SQ, "Pre-Amplifier Equipment Sequence"},
+    {0x0014400F, VR_LT, "Pre-Amplifier Notes"},
+    {0x00144010, VR_SQ, "Transmit Transducer Sequence"},
+    {0x00144011, VR_SQ, "Receive Transducer Sequence"},
+    {0x00144012, VR_US, "Number of Elements"},
+    {0x00144013, VR_CS, "Element Shape"},
+    {0x00144014, VR_DS, "Element Dimension A"},
+    {0x00144015, VR_DS, "Element Dimension B"},
+    {0x00144016, VR_DS, "Element Pitch A"},
+    {0x00144017, VR_DS, "Measured Beam Dimension A"},
+    {0x00144018, VR_DS, "Measured Beam Dimension B"},
+    {0x00144019, VR_DS, "Location of Measured Beam Diameter"},
+    {0x0014401A, VR_DS, "Nominal Frequency"},
+    {0x0014401B, VR_DS, "Measured Center Frequency"},
+    {0x0014401C, VR_DS, "Measured Bandwidth"},
+    {0x0014401D, VR_DS, "Element Pitch B"},
+    {0x00144020, VR_SQ, "Pulser Settings Sequence"},
+    {0x00144022, VR_DS, "Pulse Width"},
+    {0x00144024, VR_DS, "Excitation Frequency"},
+    {0x00144026, VR_CS, "Modulation Type"},
+    {0x00144028, VR_DS, "Damping"},
+    {0x00144030, VR_SQ, "Receiver Settings Sequence"},
+    {0x00144031, VR_DS, "Acquired Soundpath Length"},
+    {0x00144032, VR_CS, "Acquisition Compression Type"},
+    {0x00144033, VR_IS, "Acquisition Sample Size"},
+    {0x00144034, VR_DS, "Rectifier Smoothing"},
+    {0x00144035, VR_SQ, "DAC Sequence"},
+    {0x00144036, VR_CS, "DAC Type"},
+    {0x00144038, VR_DS, "DAC Gain Points"},
+    {0x0014403A, VR_DS, "DAC Time Points"},
+    {0x0014403C, VR_DS, "DAC Amplitude"},
+    {0x00144040, VR_SQ, "Pre-Amplifier Settings Sequence"},
+    {0x00144050, VR_SQ, "Transmit Transducer Settings Sequence"},
+    {0x00144051, VR_SQ, "Receive Transducer Settings Sequence"},
+    {0x00144052, VR_DS, "Incident Angle"},
+    {0x00144054, VR_ST, "Coupling Technique"},
+    {0x00144056, VR_ST, "Coupling Medium"},
+    {0x00144057, VR_DS, "Coupling Velocity"},
+    {0x00144058, VR_DS, "Probe Center Location X"},
+    {0x00144059, VR_DS, "Probe Center Location Z"},
+    {0x0014405A, VR_DS, "Sound Path Length"},
+    {0x0014405C, VR_ST, "Delay Law Identifier"},
+    {0x00144060, VR_SQ, "Gate Settings Sequence"},
+    {0x00144062, VR_DS, "Gate Threshold"},
+    {0x00144064, VR_DS, "Velocity of Sound"},
+    {0x00144070, VR_SQ, "Calibration Settings Sequence"},
+    {0x00144072, VR_ST, "Calibration Procedure"},
+    {0x00144074, VR_SH, "Procedure Version"},
+    {0x00144076, VR_DA, "Procedure Creation Date"},
+    {0x00144078, VR_DA, "Procedure Expiration Date"},
+    {0x0014407A, VR_DA, "Procedure Last Modified Date"},
+    {0x0014407C, VR_TM, "Calibration Time"},
+    {0x0014407E, VR_DA, "Calibration Date"},
+    {0x00144080, VR_SQ, "Probe Drive Equipment Sequence"},
+    {0x00144081, VR_CS, "Drive Type"},
+    {0x00144082, VR_LT, "Probe Drive Notes"},
+    {0x00144083, VR_SQ, "Drive Probe Sequence"},
+    {0x00144084, VR_DS, "Probe Inductance"},
+    {0x00144085, VR_DS, "Probe Resistance"},
+    {0x00144086, VR_SQ, "Receive Probe Sequence"},
+    {0x00144087, VR_SQ, "Probe Drive Settings Sequence"},
+    {0x00144088, VR_DS, "Bridge Resistors"},
+    {0x00144089, VR_DS, "Probe Orientation Angle"},
+    {0x0014408B, VR_DS, "User Selected Gain Y"},
+    {0x0014408C, VR_DS, "User Selected Phase"},
+    {0x0014408D, VR_DS, "User Selected Offset X"},
+    {0x0014408E, VR_DS, "User Selected Offset Y"},
+    {0x00144091, VR_SQ, "Channel Settings Sequence"},
+    {0x00144092, VR_DS, "Channel Threshold"},
+    {0x0014409A, VR_SQ, "Scanner Settings Sequence"},
+    {0x0014409B, VR_ST, "Scan Procedure"},
+    {0x0014409C, VR_DS, "Translation Rate X"},
+    {0x0014409D, VR_DS, "Translation Rate Y"},
+    {0x0014409F, VR_DS, "Channel Overlap"},
+    {0x001440A0, VR_LO, "Image Quality Indicator Type"},
+    {0x001440A1, VR_LO, "Image Quality Indicator Material"},
+    {0x001440A2, VR_LO, "Image Quality Indicator Size"},
+    {0x00145002, VR_IS, "LINAC Energy"},
+    {0x00145004, VR_IS, "LINAC Output"},
+    {0x00145100, VR_US, "Active Aperture"},
+    {0x00145101, VR_DS, "Total Aperture"},
+    {0x00145102, VR_DS, "Aperture Elevation"},
+    {0x00145103, VR_DS, "Main Lobe Angle"},
+    {0x00145104, VR_DS, "Main Roof Angle"},
+    {0x00145105, VR_CS, "Connector Type"},
+    {0x00145106, VR_SH, "Wedge Model Number"},
+    {0x00145107, VR_DS, "Wedge Angle Float"},
+    {0x00145108, VR_DS, "Wedge Roof Angle"},
+    {0x00145109, VR_CS, "Wedge Element 1 Position"},
+    {0x0014510A, VR_DS, "Wedge Material Velocity"},
+    {0x0014510B, VR_SH, "Wedge Material"},
+    {0x0014510C, VR_DS, "Wedge Offset Z"},
+    {0x0014510D, VR_DS, "Wedge Origin Offset X"},
+    {0x0014510E, VR_DS, "Wedge Time Delay"},
+    {0x0014510F, VR_SH, "Wedge Name"},
+    {0x00145110, VR_SH, "Wedge Manufacturer Name"},
+    {0x00145111, VR_LO, "Wedge Description"},
+    {0x00145112, VR_DS, "Nominal Beam Angle"},
+    {0x00145113, VR_DS, "Wedge Offset X"},
+    {0x00145114, VR_DS, "Wedge Offset Y"},
+    {0x00145115, VR_DS, "Wedge Total Length"},
+    {0x00145116, VR_DS, "Wedge In Contact Length"},
+    {0x00145117, VR_DS, "Wedge Front Gap"},
+    {0x00145118, VR_DS, "Wedge Total Height"},
+    {0x00145119, VR_DS, "Wedge Front Height"},
+    {0x0014511A, VR_DS, "Wedge Rear Height"},
+    {0x0014511B, VR_DS, "Wedge Total Width"},
+    {0x0014511C, VR_DS, "Wedge In Contact Width"},
+    {0x0014511D, VR_DS, "Wedge Chamfer Height"},
+    {0x0014511E, VR_CS, "Wedge Curve"},
+    {0x0014511F, VR_DS, "Radius Along the Wedge"},
+    {0x00180010, VR_LO, "Contrast/Bolus Agent"},
+    {0x00180012, VR_SQ, "Contrast/Bolus Agent Sequence"},
+    {0x00180013, VR_FL, "Contrast/Bolus T1 Relaxivity"},
+    {0x00180014, VR_SQ, "Contrast/Bolus Administration Route Sequence"},
+    {0x00180015, VR_CS, "Body Part Examined"},
+    {0x00180020, VR_CS, "Scanning Sequence"},
+    {0x00180021, VR_CS, "Sequence Variant"},
+    {0x00180022, VR_CS, "Scan Options"},
+    {0x00180023, VR_CS, "MR Acquisition Type"},
+    {0x00180024, VR_SH, "Sequence Name"},
+    {0x00180025, VR_CS, "Angio Flag"},
+    {0x00180026, VR_SQ, "Intervention Drug Information Sequence"},
+    {0x00180027, VR_TM, "Intervention Drug Stop Time"},
+    {0x00180028, VR_DS, "Intervention Drug Dose"},
+    {0x00180029, VR_SQ, "Intervention Drug Code Sequence"},
+    {0x0018002A, VR_SQ, "Additional Drug Sequence"},
+    {0x00180030, VR_LO, "Radionuclide"},
+    {0x00180031, VR_LO, "Radiopharmaceutical"},
+    {0x00180032, VR_DS, "Energy Window Centerline"},
+    {0x00180033, VR_DS, "Energy Window Total Width"},
+    {0x00180034, VR_LO, "Intervention Drug Name"},
+    {0x00180035, VR_TM, "Intervention Drug Start Time"},
+    {0x00180036, VR_SQ, "Intervention Sequence"},
+    {0x00180037, VR_CS, "Therapy Type"},
+    {0x00180038, VR_CS, "Intervention Status"},
+    {0x00180039, VR_CS, "Therapy Description"},
+    {0x0018003A, VR_ST, "Intervention Description"},
+    {0x00180040, VR_IS, "Cine Rate"},
+    {0x00180042, VR_CS, "Initial Cine Run State"},
+    {0x00180050, VR_DS, "Slice Thickness"},
+    {0x00180060, VR_DS, "KVP"},
+    {0x00180061, VR_DS, ""},
+    {0x00180070, VR_IS, "Counts Accumulated"},
+    {0x00180071, VR_CS, "Acquisition Termination Condition"},
+    {0x00180072, VR_DS, "Effective Duration"},
+    {0x00180073, VR_CS, "Acquisition Start Condition"},
+    {0x00180074, VR_IS, "Acquisition Start Condition Data"},
+    {0x00180075, VR_IS, "Acquisition Termination Condition Data"},
+    {0x00180080, VR_DS, "Repetition Time"},
+    {0x00180081, VR_DS, "Echo Time"},
+    {0x00180082, VR_DS, "Inversion Time"},
+    {0x00180083, VR_DS, "Number of Averages"},
+    {0x00180084, VR_DS, "Imaging Frequency"},
+    {0x00180085, VR_SH, "Imaged Nucleus"},
+    {0x00180086, VR_IS, "Echo Number(s)"},
+    {0x00180087, VR_DS, "Magnetic Field Strength"},
+    {0x00180088, VR_DS, "Spacing Between Slices"},
+    {0x00180089, VR_IS, "Number of Phase Encoding Steps"},
+    {0x00180090, VR_DS, "Data Collection Diameter"},
+    {0x00180091, VR_IS, "Echo Train Length"},
+    {0x00180093, VR_DS, "Percent Sampling"},
+    {0x00180094, VR_DS, "Percent Phase Field of View"},
+    {0x00180095, VR_DS, "Pixel Bandwidth"},
+    {0x00181000, VR_LO, "Device Serial Number"},
+    {0x00181002, VR_UI, "Device UID"},
+    {0x00181003, VR_LO, "Device ID"},
+    {0x00181004, VR_LO, "Plate ID"},
+    {0x00181005, VR_LO, "Generator ID"},
+    {0x00181006, VR_LO, "Grid ID"},
+    {0x00181007, VR_LO, "Cassette ID"},
+    {0x00181008, VR_LO, "Gantry ID"},
+    {0x00181010, VR_LO, "Secondary Capture Device ID"},
+    {0x00181011, VR_LO, "Hardcopy Creation Device ID"},
+    {0x00181012, VR_DA, "Date of Secondary Capture"},
+    {0x00181014, VR_TM, "Time of Secondary Capture"},
+    {0x00181016, VR_LO, "Secondary Capture Device Manufacturer"},
+    {0x00181017, VR_LO, "Hardcopy Device Manufacturer"},
+    {0x00181018, VR_LO, "Secondary Capture Device Manufacturer's Model Name"},
+    {0x00181019, VR_LO, "Secondary Capture Device Software Versions"},
+    {0x0018101A, VR_LO, "Hardcopy Device Software Version"},
+    {0x0018101B, VR_LO, "Hardcopy Device Manufacturer's Model Name"},
+    {0x00181020, VR_LO, "Software Version(s)"},
+    {0x00181022, VR_SH, "Video Image Format Acquired"},
+    {0x00181023, VR_LO, "Digital Image Format Acquired"},
+    {0x00181030, VR_LO, "Protocol Name"},
+    {0x00181040, VR_LO, "Contrast/Bolus Route"},
+    {0x00181041, VR_DS, "Contrast/Bolus Volume"},
+    {0x00181042, VR_TM, "Contrast/Bolus Start Time"},
+    {0x00181043, VR_TM, "Contrast/Bolus Stop Time"},
+    {0x00181044, VR_DS, "Contrast/Bolus Total Dose"},
+    {0x00181045, VR_IS, "Syringe Counts"},
+    {0x00181046, VR_DS, "Contrast Flow Rate"},
+    {0x00181047, VR_DS, "Contrast Flow Duration"},
+    {0x00181048, VR_CS, "Contrast/Bolus Ingredient"},
+    {0x00181049, VR_DS, "Contrast/Bolus Ingredient Concentration"},
+    {0x00181050, VR_DS, "Spatial Resolution"},
+    {0x00181060, VR_DS, "Trigger Time"},
+    {0x00181061, VR_LO, "Trigger Source or Type"},
+    {0x00181062, VR_IS, "Nominal Interval"},
+    {0x00181063, VR_DS, "Frame Time"},
+    {0x00181064, VR_LO, "Cardiac Framing Type"},
+    {0x00181065, VR_DS, "Frame Time Vector"},
+    {0x00181066, VR_DS, "Frame Delay"},
+    {0x00181067, VR_DS, "Image Trigger Delay"},
+    {0x00181068, VR_DS, "Multiplex Group Time Offset"},
+    {0x00181069, VR_DS, "Trigger Time Offset"},
+    {0x0018106A, VR_CS, "Synchronization Trigger"},
+    {0x0018106C, VR_US, "Synchronization Channel"},
+    {0x0018106E, VR_UL, "Trigger Sample Position"},
+    {0x00181070, VR_LO, "Radiopharmaceutical Route"},
+    {0x00181071, VR_DS, "Radiopharmaceutical Volume"},
+    {0x00181072, VR_TM, "Radiopharmaceutical Start Time"},
+    {0x00181073, VR_TM, "Radiopharmaceutical Stop Time"},
+    {0x00181074, VR_DS, "Radionuclide Total Dose"},
+    {0x00181075, VR_DS, "Radionuclide Half Life"},
+    {0x00181076, VR_DS, "Radionuclide Positron Fraction"},
+    {0x00181077, VR_DS, "Radiopharmaceutical Specific Activity"},
+    {0x00181078, VR_DT, "Radiopharmaceutical Start DateTime"},
+    {0x00181079, VR_DT, "Radiopharmaceutical Stop DateTime"},
+    {0x00181080, VR_CS, "Beat Rejection Flag"},
+    {0x00181081, VR_IS, "Low R-R Value"},
+    {0x00181082, VR_IS, "High R-R Value"},
+    {0x00181083, VR_IS, "Intervals Acquired"},
+    {0x00181084, VR_IS, "Intervals Rejected"},
+    {0x00181085, VR_LO, "PVC Rejection"},
+    {0x00181086, VR_IS, "Skip Beats"},
+    {0x00181088, VR_IS, "Heart Rate"},
+    {0x00181090, VR_IS, "Cardiac Number of Images"},
+    {0x00181094, VR_IS, "Trigger Window"},
+    {0x00181100, VR_DS, "Reconstruction Diameter"},
+    {0x00181110, VR_DS, "Distance Source to Detector"},
+    {0x00181111, VR_DS, "Distance Source to Patient"},
+    {0x00181114, VR_DS, "Estimated Radiographic Magnification Factor"},
+    {0x00181120, VR_DS, "Gantry/Detector Tilt"},
+    {0x00181121, VR_DS, "Gantry/Detector Slew"},
+    {0x00181130, VR_DS, "Table Height"},
+    {0x00181131, VR_DS, "Table Traverse"},
+    {0x00181134, VR_CS, "Table Motion"},
+    {0x00181135, VR_DS, "Table Vertical Increment"},
+    {0x00181136, VR_DS, "Table Lateral Increment"},
+    {0x00181137, VR_DS, "Table Longitudinal Increment"},
+    {0x00181138, VR_DS, "Table Angle"},
+    {0x0018113A, VR_CS, "Table Type"},
+    {0x00181140, VR_CS, "Rotation Direction"},
+    {0x00181141, VR_DS, "Angular Position"},
+    {0x00181142, VR_DS, "Radial Position"},
+    {0x00181143, VR_DS, "Scan Arc"},
+    {0x00181144, VR_DS, "Angular Step"},
+    {0x00181145, VR_DS, "Center of Rotation Offset"},
+    {0x00181146, VR_DS, "Rotation Offset"},
+    {0x00181147, VR_CS, "Field of View Shape"},
+    {0x00181149, VR_IS, "Field of View Dimension(s)"},
+    {0x00181150, VR_IS, "Exposure Time"},
+    {0x00181151, VR_IS, "X-Ray Tube Current"},
+    {0x00181152, VR_IS, "Exposure"},
+    {0x00181153, VR_IS, "Exposure in µAs"},
+    {0x00181154, VR_DS, "Average Pulse Width"},
+    {0x00181155, VR_CS, "Radiation Setting"},
+    {0x00181156, VR_CS, "Rectification Type"},
+    {0x0018115A, VR_CS, "Radiation Mode"},
+    {0x0018115E, VR_DS, "Image and Fluoroscopy Area Dose Product"},
+    {0x00181160, VR_SH, "Filter Type"},
+    {0x00181161, VR_LO, "Type of Filters"},
+    {0x00181162, VR_DS, "Intensifier Size"},
+    {0x00181164, VR_DS, "Imager Pixel Spacing"},
+    {0x00181166, VR_CS, "Grid"},
+    {0x00181170, VR_IS, "Generator Power"},
+    {0x00181180, VR_SH, "Collimator/grid Name"},
+    {0x00181181, VR_CS, "Collimator Type"},
+    {0x00181182, VR_IS, "Focal Distance"},
+    {0x00181183, VR_DS, "X Focus Center"},
+    {0x00181184, VR_DS, "Y Focus Center"},
+    {0x00181190, VR_DS, "Focal Spot(s)"},
+    {0x00181191, VR_CS, "Anode Target Material"},
+    {0x001811A0, VR_DS, "Body Part Thickness"},
+    {0x001811A2, VR_DS, "Compression Force"},
+    {0x001811A4, VR_LO, "Paddle Description"},
+    {0x00181200, VR_DA, "Date of Last Calibration"},
+    {0x00181201, VR_TM, "Time of Last Calibration"},
+    {0x00181202, VR_DT, "DateTime of Last Calibration"},
+    {0x00181210, VR_SH, "Convolution Kernel"},
+    {0x00181240, VR_IS, "Upper/Lower Pixel Values"},
+    {0x00181242, VR_IS, "Actual Frame Duration"},
+    {0x00181243, VR_IS, "Count Rate"},
+    {0x00181244, VR_US, "Preferred Playback Sequencing"},
+    {0x00181250, VR_SH, "Receive Coil Name"},
+    {0x00181251, VR_SH, "Transmit Coil Name"},
+    {0x00181260, VR_SH, "Plate Type"},
+    {0x00181261, VR_LO, "Phosphor Type"},
+    {0x00181271, VR_FD, "Water Equivalent Diameter"},
+    {0x00181272, VR_SQ, "Water Equivalent Diameter Calculation Method Code Sequence"},
+    {0x00181300, VR_DS, "Scan Velocity"},
+    {0x00181301, VR_CS, "Whole Body Technique"},
+    {0x00181302, VR_IS, "Scan Length"},
+    {0x00181310, VR_US, "Acquisition Matrix"},
+    {0x00181312, VR_CS, "In-plane Phase Encoding Direction"},
+    {0x00181314, VR_DS, "Flip Angle"},
+    {0x00181315, VR_CS, "Variable Flip Angle Flag"},
+    {0x00181316, VR_DS, "SAR"},
+    {0x00181318, VR_DS, "dB/dt"},
+    {0x00181320, VR_FL, "B1rms"},
+    {0x00181400, VR_LO, "Acquisition Device Processing Description"},
+    {0x00181401, VR_LO, "Acquisition Device Processing Code"},
+    {0x00181402, VR_CS, "Cassette Orientation"},
+    {0x00181403, VR_CS, "Cassette Size"},
+    {0x00181404, VR_US, "Exposures on Plate"},
+    {0x00181405, VR_IS, "Relative X-Ray Exposure"},
+    {0x00181411, VR_DS, "Exposure Index"},
+    {0x00181412, VR_DS, "Target Exposure Index"},
+    {0x00181413, VR_DS, "Deviation Index"},
+    {0x00181450, VR_DS, "Column Angulation"},
+    {0x00181460, VR_DS, "Tomo Layer Height"},
+    {0x00181470, VR_DS, "Tomo Angle"},
+    {0x00181480, VR_DS, "Tomo Time"},
+    {0x00181490, VR_CS, "Tomo Type"},
+    {0x00181491, VR_CS, "Tomo Class"},
+    {0x00181495, VR_IS, "Number of Tomosynthesis Source Images"},
+    {0x00181500, VR_CS, "Positioner Motion"},
+    {0x00181508, VR_CS, "Positioner Type"},
+    {0x00181510, VR_DS, "Positioner Primary Angle"},
+    {0x00181511, VR_DS, "Positioner Secondary Angle"},
+    {0x00181520, VR_DS, "Positioner Primary Angle Increment"},
+    {0x00181521, VR_DS, "Positioner Secondary Angle Increment"},
+    {0x00181530, VR_DS, "Detector Primary Angle"},
+    {0x00181531, VR_DS, "Detector Secondary Angle"},
+    {0x00181600, VR_CS, "Shutter Shape"},
+    {0x00181602, VR_IS, "Shutter Left Vertical Edge"},
+    {0x00181604, VR_IS, "Shutter Right Vertical Edge"},
+    {0x00181606, VR_IS, "Shutter Upper Horizontal Edge"},
+    {0x00181608, VR_IS, "Shutter Lower Horizontal Edge"},
+    {0x00181610, VR_IS, "Center of Circular Shutter"},
+    {0x00181612, VR_IS, "Radius of Circular Shutter"},
+    {0x00181620, VR_IS, "Vertices of the Polygonal Shutter"},
+    {0x00181622, VR_US, "Shutter Presentation Value"},
+    {0x00181623, VR_US, "Shutter Overlay Group"},
+    {0x00181624, VR_US, "Shutter Presentation Color CIELab Value"},
+    {0x00181700, VR_CS, "Collimator Shape"},
+    {0x00181702, VR_IS, "Collimator Left Vertical Edge"},
+    {0x00181704, VR_IS, "Collimator Right Vertical Edge"},
+    {0x00181706, VR_IS, "Collimator Upper Horizontal Edge"},
+    {0x00181708, VR_IS, "Collimator Lower Horizontal Edge"},
+    {0x00181710, VR_IS, "Center of Circular Collimator"},
+    {0x00181712, VR_IS, "Radius of Circular Collimator"},
+    {0x00181720, VR_IS, "Vertices of the Polygonal Collimator"},
+    {0x00181800, VR_CS, "Acquisition Time Synchronized"},
+    {0x00181801, VR_SH, "Time Source"},
+    {0x00181802, VR_CS, "Time Distribution Protocol"},
+    {0x00181803, VR_LO, "NTP Source Address"},
+    {0x00182001, VR_IS, "Page Number Vector"},
+    {0x00182002, VR_SH, "Frame Label Vector"},
+    {0x00182003, VR_DS, "Frame Primary Angle Vector"},
+    {0x00182004, VR_DS, "Frame Secondary Angle Vector"},
+    {0x00182005, VR_DS, "Slice Location Vector"},
+    {0x00182006, VR_SH, "Display Window Label Vector"},
+    {0x00182010, VR_DS, "Nominal Scanned Pixel Spacing"},
+    {0x00182020, VR_CS, "Digitizing Device Transport Direction"},
+    {0x00182030, VR_DS, "Rotation of Scanned Film"},
+    {0x00182041, VR_SQ, "Biopsy Target Sequence"},
+    {0x00182042, VR_UI, "Target UID"},
+    {0x00182043, VR_FL, "Localizing Cursor Position"},
+    {0x00182044, VR_FL, "Calculated Target Position"},
+    {0x00182045, VR_SH, "Target Label"},
+    {0x00182046, VR_FL, "Displayed Z Value"},
+    {0x00183100, VR_CS, "IVUS Acquisition"},
+    {0x00183101, VR_DS, "IVUS Pullback Rate"},
+    {0x00183102, VR_DS, "IVUS Gated Rate"},
+    {0x00183103, VR_IS, "IVUS Pullback Start Frame Number"},
+    {0x00183104, VR_IS, "IVUS Pullback Stop Frame Number"},
+    {0x00183105, VR_IS, "Lesion Number"},
+    {0x00184000, VR_LT, "Acquisition Comments"},
+    {0x00185000, VR_SH, "Output Power"},
+    {0x00185010, VR_LO, "Transducer Data"},
+    {0x00185012, VR_DS, "Focus Depth"},
+    {0x00185020, VR_LO, "Processing Function"},
+    {0x00185021, VR_LO, "Postprocessing Function"},
+    {0x00185022, VR_DS, "Mechanical Index"},
+    {0x00185024, VR_DS, "Bone Thermal Index"},
+    {0x00185026, VR_DS, "Cranial Thermal Index"},
+    {0x00185027, VR_DS, "Soft Tissue Thermal Index"},
+    {0x00185028, VR_DS, "Soft Tissue-focus Thermal Index"},
+    {0x00185029, VR_DS, "Soft Tissue-surface Thermal Index"},
+    {0x00185030, VR_DS, "Dynamic Range"},
+    {0x00185040, VR_DS, "Total Gain"},
+    {0x00185050, VR_IS, "Depth of Scan Field"},
+    {0x00185100, VR_CS, "Patient Position"},
+    {0x00185101, VR_CS, "View Position"},
+    {0x00185104, VR_SQ, "Projection Eponymous Name Code Sequence"},
+    {0x00185210, VR_DS, "Image Transformation Matrix"},
+    {0x00185212, VR_DS, "Image Translation Vector"},
+    {0x00186000, VR_DS, "Sensitivity"},
+    {0x00186011, VR_SQ, "Sequence of Ultrasound Regions"},
+    {0x00186012, VR_US, "Region Spatial Format"},
+    {0x00186014, VR_US, "Region Data Type"},
+    {0x00186016, VR_UL, "Region Flags"},
+    {0x00186018, VR_UL, "Region Location Min X0"},
+    {0x0018601A, VR_UL, "Region Location Min Y0"},
+    {0x0018601C, VR_UL, "Region Location Max X1"},
+    {0x0018601E, VR_UL, "Region Location Max Y1"},
+    {0x00186020, VR_SL, "Reference Pixel X0"},
+    {0x00186022, VR_SL, "Reference Pixel Y0"},
+    {0x00186024, VR_US, "Physical Units X Direction"},
+    {0x00186026, VR_US, "Physical Units Y Direction"},
+    {0x00186028, VR_FD, "Reference Pixel Physical Value X"},
+    {0x0018602A, VR_FD, "Reference Pixel Physical Value Y"},
+    {0x0018602C, VR_FD, "Physical Delta X"},
+    {0x0018602E, VR_FD, "Physical Delta Y"},
+    {0x00186030, VR_UL, "Transducer Frequency"},
+    {0x00186031, VR_CS, "Transducer Type"},
+    {0x00186032, VR_UL, "Pulse Repetition Frequency"},
+    {0x00186034, VR_FD, "Doppler Correction Angle"},
+    {0x00186036, VR_FD, "Steering Angle"},
+    {0x00186038, VR_UL, "Doppler Sample Volume X Position (Retired)"},
+    {0x00186039, VR_SL, "Doppler Sample Volume X Position"},
+    {0x0018603A, VR_UL, "Doppler Sample Volume Y Position (Retired)"},
+    {0x0018603B, VR_SL, "Doppler Sample Volume Y Position"},
+    {0x0018603C, VR_UL, "TM-Line Position X0 (Retired)"},
+    {0x0018603D, VR_SL, "TM-Line Position X0"},
+    {0x0018603E, VR_UL, "TM-Line Position Y0 (Retired)"},
+    {0x0018603F, VR_SL, "TM-Line Position Y0"},
+    {0x00186040, VR_UL, "TM-Line Position X1 (Retired)"},
+    {0x00186041, VR_SL, "TM-Line Position X1"},
+    {0x00186042, VR_UL, "TM-Line Position Y1 (Retired)"},
+    {0x00186043, VR_SL, "TM-Line Position Y1"},
+    {0x00186044, VR_US, "Pixel Component Organization"},
+    {0x00186046, VR_UL, "Pixel Component Mask"},
+    {0x00186048, VR_UL, "Pixel Component Range Start"},
+    {0x0018604A, VR_UL, "Pixel Component Range Stop"},
+    {0x0018604C, VR_US, "Pixel Component Physical Units"},
+    {0x0018604E, VR_US, "Pixel Component Data Type"},
+    {0x00186050, VR_UL, "Number of Table Break Points"},
+    {0x00186052, VR_UL, "Table of X Break Points"},
+    {0x00186054, VR_FD, "Table of Y Break Points"},
+    {0x00186056, VR_UL, "Number of Table Entries"},
+    {0x00186058, VR_UL, "Table of Pixel Values"},
+    {0x0018605A, VR_FL, "Table of Parameter Values"},
+    {0x00186060, VR_FL, "R Wave Time Vector"},
+    {0x00187000, VR_CS, "Detector Conditions Nominal Flag"},
+    {0x00187001, VR_DS, "Detector Temperature"},
+    {0x00187004, VR_CS, "Detector Type"},
+    {0x00187005, VR_CS, "Detector Configuration"},
+    {0x00187006, VR_LT, "Detector Description"},
+    {0x00187008, VR_LT, "Detector Mode"},
+    {0x0018700A, VR_SH, "Detector ID"},
+    {0x0018700C, VR_DA, "Date of Last Detector Calibration"},
+    {0x0018700E, VR_TM, "Time of Last Detector Calibration"},
+    {0x00187010, VR_IS, "Exposures on Detector Since Last Calibration"},
+    {0x00187011, VR_IS, "Exposures on Detector Since Manufactured"},
+    {0x00187012, VR_DS, "Detector Time Since Last Exposure"},
+    {0x00187014, VR_DS, "Detector Active Time"},
+    {0x00187016, VR_DS, "Detector Activation Offset From Exposure"},
+    {0x0018701A, VR_DS, "Detector Binning"},
+    {0x00187020, VR_DS, "Detector Element Physical Size"},
+    {0x00187022, VR_DS, "Detector Element Spacing"},
+    {0x00187024, VR_CS, "Detector Active Shape"},
+    {0x00187026, VR_DS, "Detector Active Dimension(s)"},
+    {0x00187028, VR_DS, "Detector Active Origin"},
+    {0x0018702A, VR_LO, "Detector Manufacturer Name"},
+    {0x0018702B, VR_LO, "Detector Manufacturer's Model Name"},
+    {0x00187030, VR_DS, "Field of View Origin"},
+    {0x00187032, VR_DS, "Field of View Rotation"},
+    {0x00187034, VR_CS, "Field of View Horizontal Flip"},
+    {0x00187036, VR_FL, "Pixel Data Area Origin Relative To FOV"},
+    {0x00187038, VR_FL, "Pixel Data Area Rotation Angle Relative To FOV"},
+    {0x00187040, VR_LT, "Grid Absorbing Material"},
+    {0x00187041, VR_LT, "Grid Spacing Material"},
+    {0x00187042, VR_DS, "Grid Thickness"},
+    {0x00187044, VR_DS, "Grid Pitch"},
+    {0x00187046, VR_IS, "Grid Aspect Ratio"},
+    {0x00187048, VR_DS, "Grid Period"},
+    {0x0018704C, VR_DS, "Grid Focal Distance"},
+    {0x00187050, VR_CS, "Filter Material"},
+    {0x00187052, VR_DS, "Filter Thickness Minimum"},
+    {0x00187054, VR_DS, "Filter Thickness Maximum"},
+    {0x00187056, VR_FL, "Filter Beam Path Length Minimum"},
+    {0x00187058, VR_FL, "Filter Beam Path Length Maximum"},
+    {0x00187060, VR_CS, "Exposure Control Mode"},
+    {0x00187062, VR_LT, "Exposure Control Mode Description"},
+    {0x00187064, VR_CS, "Exposure Status"},
+    {0x00187065, VR_DS, "Phototimer Setting"},
+    {0x00188150, VR_DS, "Exposure Time in µS"},
+    {0x00188151, VR_DS, "X-Ray Tube Current in µA"},
+    {0x00189004, VR_CS, "Content Qualification"},
+    {0x00189005, VR_SH, "Pulse Sequence Name"},
+    {0x00189006, VR_SQ, "MR Imaging Modifier Sequence"},
+    {0x00189008, VR_CS, "Echo Pulse Sequence"},
+    {0x00189009, VR_CS, "Inversion Recovery"},
+    {0x00189010, VR_CS, "Flow Compensation"},
+    {0x00189011, VR_CS, "Multiple Spin Echo"},
+    {0x00189012, VR_CS, "Multi-planar Excitation"},
+    {0x00189014, VR_CS, "Phase Contrast"},
+    {0x00189015, VR_CS, "Time of Flight Contrast"},
+    {0x00189016, VR_CS, "Spoiling"},
+    {0x00189017, VR_CS, "Steady State Pulse Sequence"},
+    {0x00189018, VR_CS, "Echo Planar Pulse Sequence"},
+    {0x00189019, VR_FD, "Tag Angle First Axis"},
+    {0x00189020, VR_CS, "Magnetization Transfer"},
+    {0x00189021, VR_CS, "T2 Preparation"},
+    {0x00189022, VR_CS, "Blood Signal Nulling"},
+    {0x00189024, VR_CS, "Saturation Recovery"},
+    {0x00189025, VR_CS, "Spectrally Selected Suppression"},
+    {0x00189026, VR_CS, "Spectrally Selected Excitation"},
+    {0x00189027, VR_CS, "Spatial Pre-saturation"},
+    {0x00189028, VR_CS, "Tagging"},
+    {0x00189029, VR_CS, "Oversampling Phase"},
+    {0x00189030, VR_FD, "Tag Spacing First Dimension"},
+    {0x00189032, VR_CS, "Geometry of k-Space Traversal"},
+    {0x00189033, VR_CS, "Segmented k-Space Traversal"},
+    {0x00189034, VR_CS, "Rectilinear Phase Encode Reordering"},
+    {0x00189035, VR_FD, "Tag Thickness"},
+    {0x00189036, VR_CS, "Partial Fourier Direction"},
+    {0x00189037, VR_CS, "Cardiac Synchronization Technique"},
+    {0x00189041, VR_LO, "Receive Coil Manufacturer Name"},
+    {0x00189042, VR_SQ, "MR Receive Coil Sequence"},
+    {0x00189043, VR_CS, "Receive Coil Type"},
+    {0x00189044, VR_CS, "Quadrature Receive Coil"},
+    {0x00189045, VR_SQ, "Multi-Coil Definition Sequence"},
+    {0x00189046, VR_LO, "Multi-Coil Configuration"},
+    {0x00189047, VR_SH, "Multi-Coil Element Name"},
+    {0x00189048, VR_CS, "Multi-Coil Element Used"},
+    {0x00189049, VR_SQ, "MR Transmit Coil Sequence"},
+    {0x00189050, VR_LO, "Transmit Coil Manufacturer Name"},
+    {0x00189051, VR_CS, "Transmit Coil Type"},
+    {0x00189052, VR_FD, "Spectral Width"},
+    {0x00189053, VR_FD, "Chemical Shift Reference"},
+    {0x00189054, VR_CS, "Volume Localization Technique"},
+    {0x00189058, VR_US, "MR Acquisition Frequency Encoding Steps"},
+    {0x00189059, VR_CS, "De-coupling"},
+    {0x00189060, VR_CS, "De-coupled Nucleus"},
+    {0x00189061, VR_FD, "De-coupling Frequency"},
+    {0x00189062, VR_CS, "De-coupling Method"},
+    {0x00189063, VR_FD, "De-coupling Chemical Shift Reference"},
+    {0x00189064, VR_CS, "k-space Filtering"},
+    {0x00189065, VR_CS, "Time Domain Filtering"},
+    {0x00189066, VR_US, "Number of Zero Fills"},
+    {0x00189067, VR_CS, "Baseline Correction"},
+    {0x00189069, VR_FD, "Parallel Reduction Factor In-plane"},
+    {0x00189070, VR_FD, "Cardiac R-R Interval Specified"},
+    {0x00189073, VR_FD, "Acquisition Duration"},
+    {0x00189074, VR_DT, "Frame Acquisition DateTime"},
+    {0x00189075, VR_CS, "Diffusion Directionality"},
+    {0x00189076, VR_SQ, "Diffusion Gradient Direction Sequence"},
+    {0x00189077, VR_CS, "Parallel Acquisition"},
+    {0x00189078, VR_CS, "Parallel Acquisition Technique"},
+    {0x00189079, VR_FD, "Inversion Times"},
+    {0x00189080, VR_ST, "Metabolite Map Description"},
+    {0x00189081, VR_CS, "Partial Fourier"},
+    {0x00189082, VR_FD, "Effective Echo Time"},
+    {0x00189083, VR_SQ, "Metabolite Map Code Sequence"},
+    {0x00189084, VR_SQ, "Chemical Shift Sequence"},
+    {0x00189085, VR_CS, "Cardiac Signal Source"},
+    {0x00189087, VR_FD, "Diffusion b-value"},
+    {0x00189089, VR_FD, "Diffusion Gradient Orientation"},
+    {0x00189090, VR_FD, "Velocity Encoding Direction"},
+    {0x00189091, VR_FD, "Velocity Encoding Minimum Value"},
+    {0x00189092, VR_SQ, "Velocity Encoding Acquisition Sequence"},
+    {0x00189093, VR_US, "Number of k-Space Trajectories"},
+    {0x00189094, VR_CS, "Coverage of k-Space"},
+    {0x00189095, VR_UL, "Spectroscopy Acquisition Phase Rows"},
+    {0x00189096, VR_FD, "Parallel Reduction Factor In-plane (Retired)"},
+    {0x00189098, VR_FD, "Transmitter Frequency"},
+    {0x00189100, VR_CS, "Resonant Nucleus"},
+    {0x00189101, VR_CS, "Frequency Correction"},
+    {0x00189103, VR_SQ, "MR Spectroscopy FOV/Geometry Sequence"},
+    {0x00189104, VR_FD, "Slab Thickness"},
+    {0x00189105, VR_FD, "Slab Orientation"},
+    {0x00189106, VR_FD, "Mid Slab Position"},
+    {0x00189107, VR_SQ, "MR Spatial Saturation Sequence"},
+    {0x00189112, VR_SQ, "MR Timing and Related Parameters Sequence"},
+    {0x00189114, VR_SQ, "MR Echo Sequence"},
+    {0x00189115, VR_SQ, "MR Modifier Sequence"},
+    {0x00189117, VR_SQ, "MR Diffusion Sequence"},
+    {0x00189118, VR_SQ, "Cardiac Synchronization Sequence"},
+    {0x00189119, VR_SQ, "MR Averages Sequence"},
+    {0x00189125, VR_SQ, "MR FOV/Geometry Sequence"},
+    {0x00189126, VR_SQ, "Volume Localization Sequence"},
+    {0x00189127, VR_UL, "Spectroscopy Acquisition Data Columns"},
+    {0x00189147, VR_CS, "Diffusion Anisotropy Type"},
+    {0x00189151, VR_DT, "Frame Reference DateTime"},
+    {0x00189152, VR_SQ, "MR Metabolite Map Sequence"},
+    {0x00189155, VR_FD, "Parallel Reduction Factor out-of-plane"},
+    {0x00189159, VR_UL, "Spectroscopy Acquisition Out-of-plane Phase Steps"},
+    {0x00189166, VR_CS, "Bulk Motion Status"},
+    {0x00189168, VR_FD, "Parallel Reduction Factor Second In-plane"},
+    {0x00189169, VR_CS, "Cardiac Beat Rejection Technique"},
+    {0x00189170, VR_CS, "Respiratory Motion Compensation Technique"},
+    {0x00189171, VR_CS, "Respiratory Signal Source"},
+    {0x00189172, VR_CS, "Bulk Motion Compensation Technique"},
+    {0x00189173, VR_CS, "Bulk Motion Signal Source"},
+    {0x00189174, VR_CS, "Applicable Safety Standard Agency"},
+    {0x00189175, VR_LO, "Applicable Safety Standard Description"},
+    {0x00189176, VR_SQ, "Operating Mode Sequence"},
+    {0x00189177, VR_CS, "Operating Mode Type"},
+    {0x00189178, VR_CS, "Operating Mode"},
+    {0x00189179, VR_CS, "Specific Absorption Rate Definition"},
+    {0x00189180, VR_CS, "Gradient Output Type"},
+    {0x00189181, VR_FD, "Specific Absorption Rate Value"},
+    {0x00189182, VR_FD, "Gradient Output"},
+    {0x00189183, VR_CS, "Flow Compensation Direction"},
+    {0x00189184, VR_FD, "Tagging Delay"},
+    {0x00189185, VR_ST, "Respiratory Motion Compensation Technique Description"},
+    {0x00189186, VR_SH, "Respiratory Signal Source ID"},
+    {0x00189195, VR_FD, "Chemical Shift Minimum Integration Limit in Hz"},
+    {0x00189196, VR_FD, "Chemical Shift Maximum Integration Limit in Hz"},
+    {0x00189197, VR_SQ, "MR Velocity Encoding Sequence"},
+    {0x00189198, VR_CS, "First Order Phase Correction"},
+    {0x00189199, VR_CS, "Water Referenced Phase Correction"},
+    {0x00189200, VR_CS, "MR Spectroscopy Acquisition Type"},
+    {0x00189214, VR_CS, "Respiratory Cycle Position"},
+    {0x00189217, VR_FD, "Velocity Encoding Maximum Value"},
+    {0x00189218, VR_FD, "Tag Spacing Second Dimension"},
+    {0x00189219, VR_SS, "Tag Angle Second Axis"},
+    {0x00189220, VR_FD, "Frame Acquisition Duration"},
+    {0x00189226, VR_SQ, "MR Image Frame Type Sequence"},
+    {0x00189227, VR_SQ, "MR Spectroscopy Frame Type Sequence"},
+    {0x00189231, VR_US, "MR Acquisition Phase Encoding Steps in-plane"},
+    {0x00189232, VR_US, "MR Acquisition Phase Encoding Steps out-of-plane"},
+    {0x00189234, VR_UL, "Spectroscopy Acquisition Phase Columns"},
+    {0x00189236, VR_CS, "Cardiac Cycle Position"},
+    {0x00189239, VR_SQ, "Specific Absorption Rate Sequence"},
+    {0x00189240, VR_US, "RF Echo Train Length"},
+    {0x00189241, VR_US, "Gradient Echo Train Length"},
+    {0x00189250, VR_CS, "Arterial Spin Labeling Contrast"},
+    {0x00189251, VR_SQ, "MR Arterial Spin Labeling Sequence"},
+    {0x00189252, VR_LO, "ASL Technique Description"},
+    {0x00189253, VR_US, "ASL Slab Number"},
+    {0x00189254, VR_FD, "ASL Slab Thickness"},
+    {0x00189255, VR_FD, "ASL Slab Orientation"},
+    {0x00189256, VR_FD, "ASL Mid Slab Position"},
+    {0x00189257, VR_CS, "ASL Context"},
+    {0x00189258, VR_UL, "ASL Pulse Train Duration"},
+    {0x00189259, VR_CS, "ASL Crusher Flag"},
+    {0x0018925A, VR_FD, "ASL Crusher Flow Limit"},
+    {0x0018925B, VR_LO, "ASL Crusher Description"},
+    {0x0018925C, VR_CS, "ASL Bolus Cut-off Flag"},
+    {0x0018925D, VR_SQ, "ASL Bolus Cut-off Timing Sequence"},
+    {0x0018925E, VR_LO, "ASL Bolus Cut-off Technique"},
+    {0x0018925F, VR_UL, "ASL Bolus Cut-off Delay Time"},
+    {0x00189260, VR_SQ, "ASL Slab Sequence"},
+    {0x00189295, VR_FD, "Chemical Shift Minimum Integration Limit in ppm"},
+    {0x00189296, VR_FD, "Chemical Shift Maximum Integration Limit in ppm"},
+    {0x00189297, VR_CS, "Water Reference Acquisition"},
+    {0x00189298, VR_IS, "Echo Peak Position"},
+    {0x00189301, VR_SQ, "CT Acquisition Type Sequence"},
+    {0x00189302, VR_CS, "Acquisition Type"},
+    {0x00189303, VR_FD, "Tube Angle"},
+    {0x00189304, VR_SQ, "CT Acquisition Details Sequence"},
+    {0x00189305, VR_FD, "Revolution Time"},
+    {0x00189306, VR_FD, "Single Collimation Width"},
+    {0x00189307, VR_FD, "Total Collimation Width"},
+    {0x00189308, VR_SQ, "CT Table Dynamics Sequence"},
+    {0x00189309, VR_FD, "Table Speed"},
+    {0x00189310, VR_FD, "Table Feed per Rotation"},
+    {0x00189311, VR_FD, "Spiral Pitch Factor"},
+    {0x00189312, VR_SQ, "CT Geometry Sequence"},
+    {0x00189313, VR_FD, "Data Collection Center (Patient)"},
+    {0x00189314, VR_SQ, "CT Reconstruction Sequence"},
+    {0x00189315, VR_CS, "Reconstruction Algorithm"},
+    {0x00189316, VR_CS, "Convolution Kernel Group"},
+    {0x00189317, VR_FD, "Reconstruction Field of View"},
+    {0x00189318, VR_FD, "Reconstruction Target Center (Patient)"},
+    {0x00189319, VR_FD, "Reconstruction Angle"},
+    {0x00189320, VR_SH, "Image Filter"},
+    {0x00189321, VR_SQ, "CT Exposure Sequence"},
+    {0x00189322, VR_FD, "Reconstruction Pixel Spacing"},
+    {0x00189323, VR_CS, "Exposure Modulation Type"},
+    {0x00189324, VR_FD, "Estimated Dose Saving"},
+    {0x00189325, VR_SQ, "CT X-Ray Details Sequence"},
+    {0x00189326, VR_SQ, "CT Position Sequence"},
+    {0x00189327, VR_FD, "Table Position"},
+    {0x00189328, VR_FD, "Exposure Time in ms"},
+    {0x00189329, VR_SQ, "CT Image Frame Type Sequence"},
+    {0x00189330, VR_FD, "X-Ray Tube Current in mA"},
+    {0x00189332, VR_FD, "Exposure in mAs"},
+    {0x00189333, VR_CS, "Constant Volume Flag"},
+    {0x00189334, VR_CS, "Fluoroscopy Flag"},
+    {0x00189335, VR_FD, "Distance Source to Data Collection Center"},
+    {0x00189337, VR_US, "Contrast/Bolus Agent Number"},
+    {0x00189338, VR_SQ, "Contrast/Bolus Ingredient Code Sequence"},
+    {0x00189340, VR_SQ, "Contrast Administration Profile Sequence"},
+    {0x00189341, VR_SQ, "Contrast/Bolus Usage Sequence"},
+    {0x00189342, VR_CS, "Contrast/Bolus Agent Administered"},
+    {0x00189343, VR_CS, "Contrast/Bolus Agent Detected"},
+    {0x00189344, VR_CS, "Contrast/Bolus Agent Phase"},
+    {0x00189345, VR_FD, "CTDIvol"},
+    {0x00189346, VR_SQ, "CTDI Phantom Type Code Sequence"},
+    {0x00189351, VR_FL, "Calcium Scoring Mass Factor Patient"},
+    {0x00189352, VR_FL, "Calcium Scoring Mass Factor Device"},
+    {0x00189353, VR_FL, "Energy Weighting Factor"},
+    {0x00189360, VR_SQ, "CT Additional X-Ray Source Sequence"},
+    {0x00189401, VR_SQ, "Projection Pixel Calibration Sequence"},
+    {0x00189402, VR_FL, "Distance Source to Isocenter"},
+    {0x00189403, VR_FL, "Distance Object to Table Top"},
+    {0x00189404, VR_FL, "Object Pixel Spacing in Center of Beam"},
+    {0x00189405, VR_SQ, "Positioner Position Sequence"},
+    {0x00189406, VR_SQ, "Table Position Sequence"},
+    {0x00189407, VR_SQ, "Collimator Shape Sequence"},
+    {0x00189410, VR_CS, "Planes in Acquisition"},
+    {0x00189412, VR_SQ, "XA/XRF Frame Characteristics Sequence"},
+    {0x00189417, VR_SQ, "Frame Acquisition Sequence"},
+    {0x00189420, VR_CS, "X-Ray Receptor Type"},
+    {0x00189423, VR_LO, "Acquisition Protocol Name"},
+    {0x00189424, VR_LT, "Acquisition Protocol Description"},
+    {0x00189425, VR_CS, "Contrast/Bolus Ingredient Opaque"},
+    {0x00189426, VR_FL, "Distance Receptor Plane to Detector Housing"},
+    {0x00189427, VR_CS, "Intensifier Active Shape"},
+    {0x00189428, VR_FL, "Intensifier Active Dimension(s)"},
+    {0x00189429, VR_FL, "Physical Detector Size"},
+    {0x00189430, VR_FL, "Position of Isocenter Projection"},
+    {0x00189432, VR_SQ, "Field of View Sequence"},
+    {0x00189433, VR_LO, "Field of View Description"},
+    {0x00189434, VR_SQ, "Exposure Control Sensing Regions Sequence"},
+    {0x00189435, VR_CS, "Exposure Control Sensing Region Shape"},
+    {0x00189436, VR_SS, "Exposure Control Sensing Region Left Vertical Edge"},
+    {0x00189437, VR_SS, "Exposure Control Sensing Region Right Vertical Edge"},
+    {0x00189438, VR_SS, "Exposure Control Sensing Region Upper Horizontal Edge"},
+    {0x00189439, VR_SS, "Exposure Control Sensing Region Lower Horizontal Edge"},
+    {0x00189440, VR_SS, "Center of Circular Exposure Control Sensing Region"},
+    {0x00189441, VR_US, "Radius of Circular Exposure Control Sensing Region"},
+    {0x00189442, VR_SS, "Vertices of the Polygonal Exposure Control Sensing Region"},
+    {0x00189445, VR_NONE, ""},
+    {0x00189447, VR_FL, "Column Angulation (Patient)"},
+    {0x00189449, VR_FL, "Beam Angle"},
+    {0x00189451, VR_SQ, "Frame Detector Parameters Sequence"},
+    {0x00189452, VR_FL, "Calculated Anatomy Thickness"},
+    {0x00189455, VR_SQ, "Calibration Sequence"},
+    {0x00189456, VR_SQ, "Object Thickness Sequence"},
+    {0x00189457, VR_CS, "Plane Identification"},
+    {0x00189461, VR_FL, "Field of View Dimension(s) in Float"},
+    {0x00189462, VR_SQ, "Isocenter Reference System Sequence"},
+    {0x00189463, VR_FL, "Positioner Isocenter Primary Angle"},
+    {0x00189464, VR_FL, "Positioner Isocenter Secondary Angle"},
+    {0x00189465, VR_FL, "Positioner Isocenter Detector Rotation Angle"},
+    {0x00189466, VR_FL, "Table X Position to Isocenter"},
+    {0x00189467, VR_FL, "Table Y Position to Isocenter"},
+    {0x00189468, VR_FL, "Table Z Position to Isocenter"},
+    {0x00189469, VR_FL, "Table Horizontal Rotation Angle"},
+    {0x00189470, VR_FL, "Table Head Tilt Angle"},
+    {0x00189471, VR_FL, "Table Cradle Tilt Angle"},
+    {0x00189472, VR_SQ, "Frame Display Shutter Sequence"},
+    {0x00189473, VR_FL, "Acquired Image Area Dose Product"},
+    {0x00189474, VR_CS, "C-arm Positioner Tabletop Relationship"},
+    {0x00189476, VR_SQ, "X-Ray Geometry Sequence"},
+    {0x00189477, VR_SQ, "Irradiation Event Identification Sequence"},
+    {0x00189504, VR_SQ, "X-Ray 3D Frame Type Sequence"},
+    {0x00189506, VR_SQ, "Contributing Sources Sequence"},
+    {0x00189507, VR_SQ, "X-Ray 3D Acquisition Sequence"},
+    {0x00189508, VR_FL, "Primary Positioner Scan Arc"},
+    {0x00189509, VR_FL, "Secondary Positioner Scan Arc"},
+    {0x00189510, VR_FL, "Primary Positioner Scan Start Angle"},
+    {0x00189511, VR_FL, "Secondary Positioner Scan Start Angle"},
+    {0x00189514, VR_FL, "Primary Positioner Increment"},
+    {0x00189515, VR_FL, "Secondary Positioner Increment"},
+    {0x00189516, VR_DT, "Start Acquisition DateTime"},
+    {0x00189517, VR_DT, "End Acquisition DateTime"},
+    {0x00189518, VR_SS, "Primary Positioner Increment Sign"},
+    {0x00189519, VR_SS, "Secondary Positioner Increment Sign"},
+    {0x00189524, VR_LO, "Application Name"},
+    {0x00189525, VR_LO, "Application Version"},
+    {0x00189526, VR_LO, "Application Manufacturer"},
+    {0x00189527, VR_CS, "Algorithm Type"},
+    {0x00189528, VR_LO, "Algorithm Description"},
+    {0x00189530, VR_SQ, "X-Ray 3D Reconstruction Sequence"},
+    {0x00189531, VR_LO, "Reconstruction Description"},
+    {0x00189538, VR_SQ, "Per Projection Acquisition Sequence"},
+    {0x00189541, VR_SQ, "Detector Position Sequence"},
+    {0x00189542, VR_SQ, "X-Ray Acquisition Dose Sequence"},
+    {0x00189543, VR_FD, "X-Ray Source Isocenter Primary Angle"},
+    {0x00189544, VR_FD, "X-Ray Source Isocenter Secondary Angle"},
+    {0x00189545, VR_FD, "Breast Support Isocenter Primary Angle"},
+    {0x00189546, VR_FD, "Breast Support Isocenter Secondary Angle"},
+    {0x00189547, VR_FD, "Breast Support X Position to Isocenter"},
+    {0x00189548, VR_FD, "Breast Support Y Position to Isocenter"},
+    {0x00189549, VR_FD, "Breast Support Z Position to Isocenter"},
+    {0x00189550, VR_FD, "Detector Isocenter Primary Angle"},
+    {0x00189551, VR_FD, "Detector Isocenter Secondary Angle"},
+    {0x00189552, VR_FD, "Detector X Position to Isocenter"},
+    {0x00189553, VR_FD, "Detector Y Position to Isocenter"},
+    {0x00189554, VR_FD, "Detector Z Position to Isocenter"},
+    {0x00189555, VR_SQ, "X-Ray Grid Sequence"},
+    {0x00189556, VR_SQ, "X-Ray Filter Sequence"},
+    {0x00189557, VR_FD, "Detector Active Area TLHC Position"},
+    {0x00189558, VR_FD, "Detector Active Area Orientation"},
+    {0x00189559, VR_CS, "Positioner Primary Angle Direction"},
+    {0x00189601, VR_SQ, "Diffusion b-matrix Sequence"},
+    {0x00189602, VR_FD, "Diffusion b-value XX"},
+    {0x00189603, VR_FD, "Diffusion b-value XY"},
+    {0x00189604, VR_FD, "Diffusion b-value XZ"},
+    {0x00189605, VR_FD, "Diffusion b-value YY"},
+    {0x00189606, VR_FD, "Diffusion b-value YZ"},
+    {0x00189607, VR_FD, "Diffusion b-value ZZ"},
+    {0x00189621, VR_SQ, "Functional MR Sequence"},
+    {0x00189622, VR_CS, "Functional Settling Phase Frames Present"},
+    {0x00189623, VR_DT, "Functional Sync Pulse"},
+    {0x00189624, VR_CS, "Settling Phase Frame"},
+    {0x00189701, VR_DT, "Decay Correction DateTime"},
+    {0x00189715, VR_FD, "Start Density Threshold"},
+    {0x00189716, VR_FD, "Start Relative Density Difference Threshold"},
+    {0x00189717, VR_FD, "Start Cardiac Trigger Count Threshold"},
+    {0x00189718, VR_FD, "Start Respiratory Trigger Count Threshold"},
+    {0x00189719, VR_FD, "Termination Counts Threshold"},
+    {0x00189720, VR_FD, "Termination Density Threshold"},
+    {0x00189721, VR_FD, "Termination Relative Density Threshold"},
+    {0x00189722, VR_FD, "Termination Time Threshold"},
+    {0x00189723, VR_FD, "Termination Cardiac Trigger Count Threshold"},
+    {0x00189724, VR_FD, "Termination Respiratory Trigger Count Threshold"},
+    {0x00189725, VR_CS, "Detector Geometry"},
+    {0x00189726, VR_FD, "Transverse Detector Separation"},
+    {0x00189727, VR_FD, "Axial Detector Dimension"},
+    {0x00189729, VR_US, "Radiopharmaceutical Agent Number"},
+    {0x00189732, VR_SQ, "PET Frame Acquisition Sequence"},
+    {0x00189733, VR_SQ, "PET Detector Motion Details Sequence"},
+    {0x00189734, VR_SQ, "PET Table Dynamics Sequence"},
+    {0x00189735, VR_SQ, "PET Position Sequence"},
+    {0x00189736, VR_SQ, "PET Frame Correction Factors Sequence"},
+    {0x00189737, VR_SQ, "Radiopharmaceutical Usage Sequence"},
+    {0x00189738, VR_CS, "Attenuation Correction Source"},
+    {0x00189739, VR_US, "Number of Iterations"},
+    {0x00189740, VR_US, "Number of Subsets"},
+    {0x00189749, VR_SQ, "PET Reconstruction Sequence"},
+    {0x00189751, VR_SQ, "PET Frame Type Sequence"},
+    {0x00189755, VR_CS, "Time of Flight Information Used"},
+    {0x00189756, VR_CS, "Reconstruction Type"},
+    {0x00189758, VR_CS, "Decay Corrected"},
+    {0x00189759, VR_CS, "Attenuation Corrected"},
+    {0x00189760, VR_CS, "Scatter Corrected"},
+    {0x00189761, VR_CS, "Dead Time Corrected"},
+    {0x00189762, VR_CS, "Gantry Motion Corrected"},
+    {0x00189763, VR_CS, "Patient Motion Corrected"},
+    {0x00189764, VR_CS, "Count Loss Normalization Corrected"},
+    {0x00189765, VR_CS, "Randoms Corrected"},
+    {0x00189766, VR_CS, "Non-uniform Radial Sampling Corrected"},
+    {0x00189767, VR_CS, "Sensitivity Calibrated"},
+    {0x00189768, VR_CS, "Detector Normalization Correction"},
+    {0x00189769, VR_CS, "Iterative Reconstruction Method"},
+    {0x00189770, VR_CS, "Attenuation Correction Temporal Relationship"},
+    {0x00189771, VR_SQ, "Patient Physiological State Sequence"},
+    {0x00189772, VR_SQ, "Patient Physiological State Code Sequence"},
+    {0x00189801, VR_FD, "Depth(s) of Focus"},
+    {0x00189803, VR_SQ, "Excluded Intervals Sequence"},
+    {0x00189804, VR_DT, "Exclusion Start DateTime"},
+    {0x00189805, VR_FD, "Exclusion Duration"},
+    {0x00189806, VR_SQ, "US Image Description Sequence"},
+    {0x00189807, VR_SQ, "Image Data Type Sequence"},
+    {0x00189808, VR_CS, "Data Type"},
+    {0x00189809, VR_SQ, "Transducer Scan Pattern Code Sequence"},
+    {0x0018980B, VR_CS, "Aliased Data Type"},
+    {0x0018980C, VR_CS, "Position Measuring Device Used"},
+    {0x0018980D, VR_SQ, "Transducer Geometry Code Sequence"},
+    {0x0018980E, VR_SQ, "Transducer Beam Steering Code Sequence"},
+    {0x0018980F, VR_SQ, "Transducer Application Code Sequence"},
+    {0x00189810, VR_US, "Zero Velocity Pixel Value"},
+    {0x0018A001, VR_SQ, "Contributing Equipment Sequence"},
+    {0x0018A002, VR_DT, "Contribution DateTime"},
+    {0x0018A003, VR_ST, "Contribution Description"},
+    {0x0020000D, VR_UI, "Study Instance UID"},
+    {0x0020000E, VR_UI, "Series Instance UID"},
+    {0x00200010, VR_SH, "Study ID"},
+    {0x00200011, VR_IS, "Series Number"},
+    {0x00200012, VR_IS, "Acquisition Number"},
+    {0x00200013, VR_IS, "Instance Number"},
+    {0x00200014, VR_IS, "Isotope Number"},
+    {0x00200015, VR_IS, "Phase Number"},
+    {0x00200016, VR_IS, "Interval Number"},
+    {0x00200017, VR_IS, "Time Slot Number"},
+    {0x00200018, VR_IS, "Angle Number"},
+    {0x00200019, VR_IS, "Item Number"},
+    {0x00200020, VR_CS, "Patient Orientation"},
+    {0x00200022, VR_IS, "Overlay Number"},
+    {0x00200024, VR_IS, "Curve Number"},
+    {0x00200026, VR_IS, "LUT Number"},
+    {0x00200030, VR_DS, "Image Position"},
+    {0x00200032, VR_DS, "Image Position (Patient)"},
+    {0x00200035, VR_DS, "Image Orientation"},
+    {0x00200037, VR_DS, "Image Orientation (Patient)"},
+    {0x00200050, VR_DS, "Location"},
+    {0x00200052, VR_UI, "Frame of Reference UID"},
+    {0x00200060, VR_CS, "Laterality"},
+    {0x00200062, VR_CS, "Image Laterality"},
+    {0x00200070, VR_LO, "Image Geometry Type"},
+    {0x00200080, VR_CS, "Masking Image"},
+    {0x002000AA, VR_IS, "Report Number"},
+    {0x00200100, VR_IS, "Temporal Position Identifier"},
+    {0x00200105, VR_IS, "Number of Temporal Positions"},
+    {0x00200110, VR_DS, "Temporal Resolution"},
+    {0x00200200, VR_UI, "Synchronization Frame of Reference UID"},
+    {0x00200242, VR_UI, "SOP Instance UID of Concatenation Source"},
+    {0x00201000, VR_IS, "Series in Study"},
+    {0x00201001, VR_IS, "Acquisitions in Series"},
+    {0x00201002, VR_IS, "Images in Acquisition"},
+    {0x00201003, VR_IS, "Images in Series"},
+    {0x00201004, VR_IS, "Acquisitions in Study"},
+    {0x00201005, VR_IS, "Images in Study"},
+    {0x00201020, VR_LO, "Reference"},
+    {0x00201040, VR_LO, "Position Reference Indicator"},
+    {0x00201041, VR_DS, "Slice Location"},
+    {0x00201070, VR_IS, "Other Study Numbers"},
+    {0x00201200, VR_IS, "Number of Patient Related Studies"},
+    {0x00201202, VR_IS, "Number of Patient Related Series"},
+    {0x00201204, VR_IS, "Number of Patient Related Instances"},
+    {0x00201206, VR_IS, "Number of Study Related Series"},
+    {0x00201208, VR_IS, "Number of Study Related Instances"},
+    {0x00201209, VR_IS, "Number of Series Related Instances"},
+    {0x00203401, VR_CS, "Modifying Device ID"},
+    {0x00203402, VR_CS, "Modified Image ID"},
+    {0x00203403, VR_DA, "Modified Image Date"},
+    {0x00203404, VR_LO, "Modifying Device Manufacturer"},
+    {0x00203405, VR_TM, "Modified Image Time"},
+    {0x00203406, VR_LO, "Modified Image Description"},
+    {0x00204000, VR_LT, "Image Comments"},
+    {0x00205000, VR_AT, "Original Image Identification"},
+    {0x00205002, VR_LO, "Original Image Identification Nomenclature"},
+    {0x00209056, VR_SH, "Stack ID"},
+    {0x00209057, VR_UL, "In-Stack Position Number"},
+    {0x00209071, VR_SQ, "Frame Anatomy Sequence"},
+    {0x00209072, VR_CS, "Frame Laterality"},
+    {0x00209111, VR_SQ, "Frame Content Sequence"},
+    {0x00209113, VR_SQ, "Plane Position Sequence"},
+    {0x00209116, VR_SQ, "Plane Orientation Sequence"},
+    {0x00209128, VR_UL, "Temporal Position Index"},
+    {0x00209153, VR_FD, "Nominal Cardiac Trigger Delay Time"},
+    {0x00209154, VR_FL, "Nominal Cardiac Trigger Time Prior To R-Peak"},
+    {0x00209155, VR_FL, "Actual Cardiac Trigger Time Prior To R-Peak"},
+    {0x00209156, VR_US, "Frame Acquisition Number"},
+    {0x00209157, VR_UL, "Dimension Index Values"},
+    {0x00209158, VR_LT, "Frame Comments"},
+    {0x00209161, VR_UI, "Concatenation UID"},
+    {0x00209162, VR_US, "In-concatenation Number"},
+    {0x00209163, VR_US, "In-concatenation Total Number"},
+    {0x00209164, VR_UI, "Dimension Organization UID"},
+    {0x00209165, VR_AT, "Dimension Index Pointer"},
+    {0x00209167, VR_AT, "Functional Group Pointer"},
+    {0x00209170, VR_SQ, "Unassigned Shared Converted Attributes Sequence"},
+    {0x00209171, VR_SQ, "Unassigned Per-Frame Converted Attributes Sequence"},
+    {0x00209172, VR_SQ, "Conversion Source Attributes Sequence"},
+    {0x00209213, VR_LO, "Dimension Index Private Creator"},
+    {0x00209221, VR_SQ, "Dimension Organization Sequence"},
+    {0x00209222, VR_SQ, "Dimension Index Sequence"},
+    {0x00209228, VR_UL, "Concatenation Frame Offset Number"},
+    {0x00209238, VR_LO, "Functional Group Private Creator"},
+    {0x00209241, VR_FL, "Nominal Percentage of Cardiac Phase"},
+    {0x00209245, VR_FL, "Nominal Percentage of Respiratory Phase"},
+    {0x00209246, VR_FL, "Starting Respiratory Amplitude"},
+    {0x00209247, VR_CS, "Starting Respiratory Phase"},
+    {0x00209248, VR_FL, "Ending Respiratory Amplitude"},
+    {0x00209249, VR_CS, "Ending Respiratory Phase"},
+    {0x00209250, VR_CS, "Respiratory Trigger Type"},
+    {0x00209251, VR_FD, "R-R Interval Time Nominal"},
+    {0x00209252, VR_FD, "Actual Cardiac Trigger Delay Time"},
+    {0x00209253, VR_SQ, "Respiratory Synchronization Sequence"},
+    {0x00209254, VR_FD, "Respiratory Interval Time"},
+    {0x00209255, VR_FD, "Nominal Respiratory Trigger Delay Time"},
+    {0x00209256, VR_FD, "Respiratory Trigger Delay Threshold"},
+    {0x00209257, VR_FD, "Actual Respiratory Trigger Delay Time"},
+    {0x00209301, VR_FD, "Image Position (Volume)"},
+    {0x00209302, VR_FD, "Image Orientation (Volume)"},
+    {0x00209307, VR_CS, "Ultrasound Acquisition Geometry"},
+    {0x00209308, VR_FD, "Apex Position"},
+    {0x00209309, VR_FD, "Volume to Transducer Mapping Matrix"},
+    {0x0020930A, VR_FD, "Volume to Table Mapping Matrix"},
+    {0x0020930B, VR_CS, "Volume to Transducer Relationship"},
+    {0x0020930C, VR_CS, "Patient Frame of Reference Source"},
+    {0x0020930D, VR_FD, "Temporal Position Time Offset"},
+    {0x0020930E, VR_SQ, "Plane Position (Volume) Sequence"},
+    {0x0020930F, VR_SQ, "Plane Orientation (Volume) Sequence"},
+    {0x00209310, VR_SQ, "Temporal Position Sequence"},
+    {0x00209311, VR_CS, "Dimension Organization Type"},
+    {0x00209312, VR_UI, "Volume Frame of Reference UID"},
+    {0x00209313, VR_UI, "Table Frame of Reference UID"},
+    {0x00209421, VR_LO, "Dimension Description Label"},
+    {0x00209450, VR_SQ, "Patient Orientation in Frame Sequence"},
+    {0x00209453, VR_LO, "Frame Label"},
+    {0x00209518, VR_US, "Acquisition Index"},
+    {0x00209529, VR_SQ, "Contributing SOP Instances Reference Sequence"},
+    {0x00209536, VR_US, "Reconstruction Index"},
+    {0x00220001, VR_US, "Light Path Filter Pass-Through Wavelength"},
+    {0x00220002, VR_US, "Light Path Filter Pass Band"},
+    {0x00220003, VR_US, "Image Path Filter Pass-Through Wavelength"},
+    {0x00220004, VR_US, "Image Path Filter Pass Band"},
+    {0x00220005, VR_CS, "Patient Eye Movement Commanded"},
+    {0x00220006, VR_SQ, "Patient Eye Movement Command Code Sequence"},
+    {0x00220007, VR_FL, "Spherical Lens Power"},
+    {0x00220008, VR_FL, "Cylinder Lens Power"},
+    {0x00220009, VR_FL, "Cylinder Axis"},
+    {0x0022000A, VR_FL, "Emmetropic Magnification"},
+    {0x0022000B, VR_FL, "Intra Ocular Pressure"},
+    {0x0022000C, VR_FL, "Horizontal Field of View"},
+    {0x0022000D, VR_CS, "Pupil Dilated"},
+    {0x0022000E, VR_FL, "Degree of Dilation"},
+    {0x00220010, VR_FL, "Stereo Baseline Angle"},
+    {0x00220011, VR_FL, "Stereo Baseline Displacement"},
+    {0x00220012, VR_FL, "Stereo Horizontal Pixel Offset"},
+    {0x00220013, VR_FL, "Stereo Vertical Pixel Offset"},
+    {0x00220014, VR_FL, "Stereo Rotation"},
+    {0x00220015, VR_SQ, "Acquisition Device Type Code Sequence"},
+    {0x00220016, VR_SQ, "Illumination Type Code Sequence"},
+    {0x00220017, VR_SQ, "Light Path Filter Type Stack Code Sequence"},
+    {0x00220018, VR_SQ, "Image Path Filter Type Stack Code Sequence"},
+    {0x00220019, VR_SQ, "Lenses Code Sequence"},
+    {0x0022001A, VR_SQ, "Channel Description Code Sequence"},
+    {0x0022001B, VR_SQ, "Refractive State Sequence"},
+    {0x0022001C, VR_SQ, "Mydriatic Agent Code Sequence"},
+    {0x0022001D, VR_SQ, "Relative Image Position Code Sequence"},
+    {0x0022001E, VR_FL, "Camera Angle of View"},
+    {0x00220020, VR_SQ, "Stereo Pairs Sequence"},
+    {0x00220021, VR_SQ, "Left Image Sequence"},
+    {0x00220022, VR_SQ, "Right Image Sequence"},
+    {0x00220028, VR_CS, "Stereo Pairs Present"},
+    {0x00220030, VR_FL, "Axial Length of the Eye"},
+    {0x00220031, VR_SQ, "Ophthalmic Frame Location Sequence"},
+    {0x00220032, VR_FL, "Reference Coordinates"},
+    {0x00220035, VR_FL, "Depth Spatial Resolution"},
+    {0x00220036, VR_FL, "Maximum Depth Distortion"},
+    {0x00220037, VR_FL, "Along-scan Spatial Resolution"},
+    {0x00220038, VR_FL, "Maximum Along-scan Distortion"},
+    {0x00220039, VR_CS, "Ophthalmic Image Orientation"},
+    {0x00220041, VR_FL, "Depth of Transverse Image"},
+    {0x00220042, VR_SQ, "Mydriatic Agent Concentration Units Sequence"},
+    {0x00220048, VR_FL, "Across-scan Spatial Resolution"},
+    {0x00220049, VR_FL, "Maximum Across-scan Distortion"},
+    {0x0022004E, VR_DS, "Mydriatic Agent Concentration"},
+    {0x00220055, VR_FL, "Illumination Wave Length"},
+    {0x00220056, VR_FL, "Illumination Power"},
+    {0x00220057, VR_FL, "Illumination Bandwidth"},
+    {0x00220058, VR_SQ, "Mydriatic Agent Sequence"},
+    {0x00221007, VR_SQ, "Ophthalmic Axial Measurements Right Eye Sequence"},
+    {0x00221008, VR_SQ, "Ophthalmic Axial Measurements Left Eye Sequence"},
+    {0x00221009, VR_CS, "Ophthalmic Axial Measurements Device Type"},
+    {0x00221010, VR_CS, "Ophthalmic Axial Length Measurements Type"},
+    {0x00221012, VR_SQ, "Ophthalmic Axial Length Sequence"},
+    {0x00221019, VR_FL, "Ophthalmic Axial Length"},
+    {0x00221024, VR_SQ, "Lens Status Code Sequence"},
+    {0x00221025, VR_SQ, "Vitreous Status Code Sequence"},
+    {0x00221028, VR_SQ, "IOL Formula Code Sequence"},
+    {0x00221029, VR_LO, "IOL Formula Detail"},
+    {0x00221033, VR_FL, "Keratometer Index"},
+    {0x00221035, VR_SQ, "Source of Ophthalmic Axial Length Code Sequence"},
+    {0x00221037, VR_FL, "Target Refraction"},
+    {0x00221039, VR_CS, "Refractive Procedure Occurred"},
+    {0x00221040, VR_SQ, "Refractive Surgery Type Code Sequence"},
+    {0x00221044, VR_SQ, "Ophthalmic Ultrasound Method Code Sequence"},
+    {0x00221050, VR_SQ, "Ophthalmic Axial Length Measurements Sequence"},
+    {0x00221053, VR_FL, "IOL Power"},
+    {0x00221054, VR_FL, "Predicted Refractive Error"},
+    {0x00221059, VR_FL, "Ophthalmic Axial Length Velocity"},
+    {0x00221065, VR_LO, "Lens Status Description"},
+    {0x00221066, VR_LO, "Vitreous Status Description"},
+    {0x00221090, VR_SQ, "IOL Power Sequence"},
+    {0x00221092, VR_SQ, "Lens Constant Sequence"},
+    {0x00221093, VR_LO, "IOL Manufacturer"},
+    {0x00221094, VR_LO, "Lens Constant Description"},
+    {0x00221095, VR_LO, "Implant Name"},
+    {0x00221096, VR_SQ, "Keratometry Measurement Type Code Sequence"},
+    {0x00221097, VR_LO, "Implant Part Number"},
+    {0x00221100, VR_SQ, "Referenced Ophthalmic Axial Measurements Sequence"},
+    {0x00221101, VR_SQ, "Ophthalmic Axial Length Measurements Segment Name Code Sequence"},
+    {0x00221103, VR_SQ, "Refractive Error Before Refractive Surgery Code Sequence"},
+    {0x00221121, VR_FL, "IOL Power For Exact Emmetropia"},
+    {0x00221122, VR_FL, "IOL Power For Exact Target Refraction"},
+    {0x00221125, VR_SQ, "Anterior Chamber Depth Definition Code Sequence"},
+    {0x00221127, VR_SQ, "Lens Thickness Sequence"},
+    {0x00221128, VR_SQ, "Anterior Chamber Depth Sequence"},
+    {0x00221130, VR_FL, "Lens Thickness"},
+    {0x00221131, VR_FL, "Anterior Chamber Depth"},
+    {0x00221132, VR_SQ, "Source of Lens Thickness Data Code Sequence"},
+    {0x00221133, VR_SQ, "Source of Anterior Chamber Depth Data Code Sequence"},
+    {0x00221134, VR_SQ, "Source of Refractive Measurements Sequence"},
+    {0x00221135, VR_SQ, "Source of Refractive Measurements Code Sequence"},
+    {0x00221140, VR_CS, "Ophthalmic Axial Length Measurement Modified"},
+    {0x00221150, VR_SQ, "Ophthalmic Axial Length Data Source Code Sequence"},
+    {0x00221153, VR_SQ, "Ophthalmic Axial Length Acquisition Method Code Sequence"},
+    {0x00221155, VR_FL, "Signal to Noise Ratio"},
+    {0x00221159, VR_LO, "Ophthalmic Axial Length Data Source Description"},
+    {0x00221210, VR_SQ, "Ophthalmic Axial Length Measurements Total Length Sequence"},
+    {0x00221211, VR_SQ, "Ophthalmic Axial Length Measurements Segmental Length Sequence"},
+    {0x00221212, VR_SQ, "Ophthalmic Axial Length Measurements Length Summation Sequence"},
+    {0x00221220, VR_SQ, "Ultrasound Ophthalmic Axial Length Measurements Sequence"},
+    {0x00221225, VR_SQ, "Optical Ophthalmic Axial Length Measurements Sequence"},
+    {0x00221230, VR_SQ, "Ultrasound Selected Ophthalmic Axial Length Sequence"},
+    {0x00221250, VR_SQ, "Ophthalmic Axial Length Selection Method Code Sequence"},
+    {0x00221255, VR_SQ, "Optical Selected Ophthalmic Axial Length Sequence"},
+    {0x00221257, VR_SQ, "Selected Segmental Ophthalmic Axial Length Sequence"},
+    {0x00221260, VR_SQ, "Selected Total Ophthalmic Axial Length Sequence"},
+    {0x00221262, VR_SQ, "Ophthalmic Axial Length Quality Metric Sequence"},
+    {0x00221265, VR_SQ, "Ophthalmic Axial Length Quality Metric Type Code Sequence"},
+    {0x00221273, VR_LO, "Ophthalmic Axial Length Quality Metric Type Description"},
+    {0x00221300, VR_SQ, "Intraocular Lens Calculations Right Eye Sequence"},
+    {0x00221310, VR_SQ, "Intraocular Lens Calculations Left Eye Sequence"},
+    {0x00221330, VR_SQ, "Referenced Ophthalmic Axial Length Measurement QC Image Sequence"},
+    {0x00221415, VR_CS, "Ophthalmic Mapping Device Type"},
+    {0x00221420, VR_SQ, "Acquisition Method Code Sequence"},
+    {0x00221423, VR_SQ, "Acquisition Method Algorithm Sequence"},
+    {0x00221436, VR_SQ, "Ophthalmic Thickness Map Type Code Sequence"},
+    {0x00221443, VR_SQ, "Ophthalmic Thickness Mapping Normals Sequence"},
+    {0x00221445, VR_SQ, "Retinal Thickness Definition Code Sequence"},
+    {0x00221450, VR_SQ, "Pixel Value Mapping to Coded Concept Sequence"},
+    {0x00221452, VR_SS, "Mapped Pixel Value"},
+    {0x00221454, VR_LO, "Pixel Value Mapping Explanation"},
+    {0x00221458, VR_SQ, "Ophthalmic Thickness Map Quality Threshold Sequence"},
+    {0x00221460, VR_FL, "Ophthalmic Thickness Map Threshold Quality Rating"},
+    {0x00221463, VR_FL, "Anatomic Structure Reference Point"},
+    {0x00221465, VR_SQ, "Registration to Localizer Sequence"},
+    {0x00221466, VR_CS, "Registered Localizer Units"},
+    {0x00221467, VR_FL, "Registered Localizer Top Left Hand Corner"},
+    {0x00221468, VR_FL, "Registered Localizer Bottom Right Hand Corner"},
+    {0x00221470, VR_SQ, "Ophthalmic Thickness Map Quality Rating Sequence"},
+    {0x00221472, VR_SQ, "Relevant OPT Attributes Sequence"},
+    {0x00221512, VR_SQ, "Transformation Method Code Sequence"},
+    {0x00221513, VR_SQ, "Transformation Algorithm Sequence"},
+    {0x00221515, VR_CS, "Ophthalmic Axial Length Method"},
+    {0x00221517, VR_FL, "Ophthalmic FOV"},
+    {0x00221518, VR_SQ, "Two Dimensional to Three Dimensional Map Sequence"},
+    {0x00221525, VR_SQ, "Wide Field Ophthalmic Photography Quality Rating Sequence"},
+    {0x00221526, VR_SQ, "Wide Field Ophthalmic Photography Quality Threshold Sequence"},
+    {0x00221527, VR_FL, "Wide Field Ophthalmic Photography Threshold Quality Rating"},
+    {0x00221528, VR_FL, "X Coordinates Center Pixel View Angle"},
+    {0x00221529, VR_FL, "Y Coordinates Center Pixel View Angle"},
+    {0x00221530, VR_UL, "Number of Map Points"},
+    {0x00221531, VR_OF, "Two Dimensional to Three Dimensional Map Data"},
+    {0x00240010, VR_FL, "Visual Field Horizontal Extent"},
+    {0x00240011, VR_FL, "Visual Field Vertical Extent"},
+    {0x00240012, VR_CS, "Visual Field Shape"},
+    {0x00240016, VR_SQ, "Screening Test Mode Code Sequence"},
+    {0x00240018, VR_FL, "Maximum Stimulus Luminance"},
+    {0x00240020, VR_FL, "Background Luminance"},
+    {0x00240021, VR_SQ, "Stimulus Color Code Sequence"},
+    {0x00240024, VR_SQ, "Background Illumination Color Code Sequence"},
+    {0x00240025, VR_FL, "Stimulus Area"},
+    {0x00240028, VR_FL, "Stimulus Presentation Time"},
+    {0x00240032, VR_SQ, "Fixation Sequence"},
+    {0x00240033, VR_SQ, "Fixation Monitoring Code Sequence"},
+    {0x00240034, VR_SQ, "Visual Field Catch Trial Sequence"},
+    {0x00240035, VR_US, "Fixation Checked Quantity"},
+    {0x00240036, VR_US, "Patient Not Properly Fixated Quantity"},
+    {0x00240037, VR_CS, "Presented Visual Stimuli Data Flag"},
+    {0x00240038, VR_US, "Number of Visual Stimuli"},
+    {0x00240039, VR_CS, "Excessive Fixation Losses Data Flag"},
+    {0x00240040, VR_CS, "Excessive Fixation Losses"},
+    {0x00240042, VR_US, "Stimuli Retesting Quantity"},
+    {0x00240044, VR_LT, "Comments on Patient's Performance of Visual Field"},
+    {0x00240045, VR_CS, "False Negatives Estimate Flag"},
+    {0x00240046, VR_FL, "False Negatives Estimate"},
+    {0x00240048, VR_US, "Negative Catch Trials Quantity"},
+    {0x00240050, VR_US, "False Negatives Quantity"},
+    {0x00240051, VR_CS, "Excessive False Negatives Data Flag"},
+    {0x00240052, VR_CS, "Excessive False Negatives"},
+    {0x00240053, VR_CS, "False Positives Estimate Flag"},
+    {0x00240054, VR_FL, "False Positives Estimate"},
+    {0x00240055, VR_CS, "Catch Trials Data Flag"},
+    {0x00240056, VR_US, "Positive Catch Trials Quantity"},
+    {0x00240057, VR_CS, "Test Point Normals Data Flag"},
+    {0x00240058, VR_SQ, "Test Point Normals Sequence"},
+    {0x00240059, VR_CS, "Global Deviation Probability Normals Flag"},
+    {0x00240060, VR_US, "False Positives Quantity"},
+    {0x00240061, VR_CS, "Excessive False Positives Data Flag"},
+    {0x00240062, VR_CS, "Excessive False Positives"},
+    {0x00240063, VR_CS, "Visual Field Test Normals Flag"},
+    {0x00240064, VR_SQ, "Results Normals Sequence"},
+    {0x00240065, VR_SQ, "Age Corrected Sensitivity Deviation Algorithm Sequence"},
+    {0x00240066, VR_FL, "Global Deviation From Normal"},
+    {0x00240067, VR_SQ, "Generalized Defect Sensitivity Deviation Algorithm Sequence"},
+    {0x00240068, VR_FL, "Localized Deviation From Normal"},
+    {0x00240069, VR_LO, "Patient Reliability Indicator"},
+    {0x00240070, VR_FL, "Visual Field Mean Sensitivity"},
+    {0x00240071, VR_FL, "Global Deviation Probability"},
+    {0x00240072, VR_CS, "Local Deviation Probability Normals Flag"},
+    {0x00240073, VR_FL, "Localized Deviation Probability"},
+    {0x00240074, VR_CS, "Short Term Fluctuation Calculated"},
+    {0x00240075, VR_FL, "Short Term Fluctuation"},
+    {0x00240076, VR_CS, "Short Term Fluctuation Probability Calculated"},
+    {0x00240077, VR_FL, "Short Term Fluctuation Probability"},
+    {0x00240078, VR_CS, "Corrected Localized Deviation From Normal Calculated"},
+    {0x00240079, VR_FL, "Corrected Localized Deviation From Normal"},
+    {0x00240080, VR_CS, "Corrected Localized Deviation From Normal Probability Calculated"},
+    {0x00240081, VR_FL, "Corrected Localized Deviation From Normal Probability"},
+    {0x00240083, VR_SQ, "Global Deviation Probability Sequence"},
+    {0x00240085, VR_SQ, "Localized Deviation Probability Sequence"},
+    {0x00240086, VR_CS, "Foveal Sensitivity Measured"},
+    {0x00240087, VR_FL, "Foveal Sensitivity"},
+    {0x00240088, VR_FL, "Visual Field Test Duration"},
+    {0x00240089, VR_SQ, "Visual Field Test Point Sequence"},
+    {0x00240090, VR_FL, "Visual Field Test Point X-Coordinate"},
+    {0x00240091, VR_FL, "Visual Field Test Point Y-Coordinate"},
+    {0x00240092, VR_FL, "Age Corrected Sensitivity Deviation Value"},
+    {0x00240093, VR_CS, "Stimulus Results"},
+    {0x00240094, VR_FL, "Sensitivity Value"},
+    {0x00240095, VR_CS, "Retest Stimulus Seen"},
+    {0x00240096, VR_FL, "Retest Sensitivity Value"},
+    {0x00240097, VR_SQ, "Visual Field Test Point Normals Sequence"},
+    {0x00240098, VR_FL, "Quantified Defect"},
+    {0x00240100, VR_FL, "Age Corrected Sensitivity Deviation Probability Value"},
+    {0x00240102, VR_CS, "Generalized Defect Corrected Sensitivity Deviation Flag"},
+    {0x00240103, VR_FL, "Generalized Defect Corrected Sensitivity Deviation Value"},
+    {0x00240104, VR_FL, "Generalized Defect Corrected Sensitivity Deviation Probability Value"},
+    {0x00240105, VR_FL, "Minimum Sensitivity Value"},
+    {0x00240106, VR_CS, "Blind Spot Localized"},
+    {0x00240107, VR_FL, "Blind Spot X-Coordinate"},
+    {0x00240108, VR_FL, "Blind Spot Y-Coordinate"},
+    {0x00240110, VR_SQ, "Visual Acuity Measurement Sequence"},
+    {0x00240112, VR_SQ, "Refractive Parameters Used on Patient Sequence"},
+    {0x00240113, VR_CS, "Measurement Laterality"},
+    {0x00240114, VR_SQ, "Ophthalmic Patient Clinical Information Left Eye Sequence"},
+    {0x00240115, VR_SQ, "Ophthalmic Patient Clinical Information Right Eye Sequence"},
+    {0x00240117, VR_CS, "Foveal Point Normative Data Flag"},
+    {0x00240118, VR_FL, "Foveal Point Probability Value"},
+    {0x00240120, VR_CS, "Screening Baseline Measured"},
+    {0x00240122, VR_SQ, "Screening Baseline Measured Sequence"},
+    {0x00240124, VR_CS, "Screening Baseline Type"},
+    {0x00240126, VR_FL, "Screening Baseline Value"},
+    {0x00240202, VR_LO, "Algorithm Source"},
+    {0x00240306, VR_LO, "Data Set Name"},
+    {0x00240307, VR_LO, "Data Set Version"},
+    {0x00240308, VR_LO, "Data Set Source"},
+    {0x00240309, VR_LO, "Data Set Description"},
+    {0x00240317, VR_SQ, "Visual Field Test Reliability Global Index Sequence"},
+    {0x00240320, VR_SQ, "Visual Field Global Results Index Sequence"},
+    {0x00240325, VR_SQ, "Data Observation Sequence"},
+    {0x00240338, VR_CS, "Index Normals Flag"},
+    {0x00240341, VR_FL, "Index Probability"},
+    {0x00240344, VR_SQ, "Index Probability Sequence"},
+    {0x00280002, VR_US, "Samples per Pixel"},
+    {0x00280003, VR_US, "Samples per Pixel Used"},
+    {0x00280004, VR_CS, "Photometric Interpretation"},
+    {0x00280005, VR_US, "Image Dimensions"},
+    {0x00280006, VR_US, "Planar Configuration"},
+    {0x00280008, VR_IS, "Number of Frames"},
+    {0x00280009, VR_AT, "Frame Increment Pointer"},
+    {0x0028000A, VR_AT, "Frame Dimension Pointer"},
+    {0x00280010, VR_US, "Rows"},
+    {0x00280011, VR_US, "Columns"},
+    {0x00280012, VR_US, "Planes"},
+    {0x00280014, VR_US, "Ultrasound Color Data Present"},
+    {0x00280020, VR_NONE, ""},
+    {0x00280030, VR_DS, "Pixel Spacing"},
+    {0x00280031, VR_DS, "Zoom Factor"},
+    {0x00280032, VR_DS, "Zoom Center"},
+    {0x00280034, VR_IS, "Pixel Aspect Ratio"},
+    {0x00280040, VR_CS, "Image Format"},
+    {0x00280050, VR_LO, "Manipulated Image"},
+    {0x00280051, VR_CS, "Corrected Image"},
+    {0x0028005F, VR_LO, "Compression Recognition Code"},
+    {0x00280060, VR_CS, "Compression Code"},
+    {0x00280061, VR_SH, "Compression Originator"},
+    {0x00280062, VR_LO, "Compression Label"},
+    {0x00280063, VR_SH, "Compression Description"},
+    {0x00280065, VR_CS, "Compression Sequence"},
+    {0x00280066, VR_AT, "Compression Step Pointers"},
+    {0x00280068, VR_US, "Repeat Interval"},
+    {0x00280069, VR_US, "Bits Grouped"},
+    {0x00280070, VR_US, "Perimeter Table"},
+    {0x00280071, VR_US, "Perimeter Value"},
+    {0x00280080, VR_US, "Predictor Rows"},
+    {0x00280081, VR_US, "Predictor Columns"},
+    {0x00280082, VR_US, "Predictor Constants"},
+    {0x00280090, VR_CS, "Blocked Pixels"},
+    {0x00280091, VR_US, "Block Rows"},
+    {0x00280092, VR_US, "Block Columns"},
+    {0x00280093, VR_US, "Row Overlap"},
+    {0x00280094, VR_US, "Column Overlap"},
+    {0x00280100, VR_US, "Bits Allocated"},
+    {0x00280101, VR_US, "Bits Stored"},
+    {0x00280102, VR_US, "High Bit"},
+    {0x00280103, VR_US, "Pixel Representation"},
+    {0x00280104, VR_SS, "Smallest Valid Pixel Value"},
+    {0x00280105, VR_SS, "Largest Valid Pixel Value"},
+    {0x00280106, VR_SS, "Smallest Image Pixel Value"},
+    {0x00280107, VR_SS, "Largest Image Pixel Value"},
+    {0x00280108, VR_SS, "Smallest Pixel Value in Series"},
+    {0x00280109, VR_SS, "Largest Pixel Value in Series"},
+    {0x00280110, VR_SS, "Smallest Image Pixel Value in Plane"},
+    {0x00280111, VR_SS, "Largest Image Pixel Value in Plane"},
+    {0x00280120, VR_US, "Pixel Padding Value"},
+    {0x00280121, VR_US, "Pixel Padding Range Limit"},
+    {0x00280122, VR_FL, "Float Pixel Padding Value"},
+    {0x00280123, VR_FD, "Double Float Pixel Padding Value"},
+    {0x00280124, VR_FL, "Float Pixel Padding Range Limit"},
+    {0x00280125, VR_FD, "Double Float Pixel Padding Range Limit"},
+    {0x00280200, VR_US, "Image Location"},
+    {0x00280300, VR_CS, "Quality Control Image"},
+    {0x00280301, VR_CS, "Burned In Annotation"},
+    {0x00280302, VR_CS, "Recognizable Visual Features"},
+    {0x00280303, VR_CS, "Longitudinal Temporal Information Modified"},
+    {0x00280304, VR_UI, "Referenced Color Palette Instance UID"},
+    {0x00280400, VR_LO, "Transform Label"},
+    {0x00280401, VR_LO, "Transform Version Number"},
+    {0x00280402, VR_US, "Number of Transform Steps"},
+    {0x00280403, VR_LO, "Sequence of Compressed Data"},
+    {0x00280404, VR_AT, "Details of Coefficients"},
+    {0x00280700, VR_LO, "DCT Label"},
+    {0x00280701, VR_CS, "Data Block Description"},
+    {0x00280702, VR_AT, "Data Block"},
+    {0x00280710, VR_US, "Normalization Factor Format"},
+    {0x00280720, VR_US, "Zonal Map Number Format"},
+    {0x00280721, VR_AT, "Zonal Map Location"},
+    {0x00280722, VR_US, "Zonal Map Format"},
+    {0x00280730, VR_US, "Adaptive Map Format"},
+    {0x00280740, VR_US, "Code Number Format"},
+    {0x00280A02, VR_CS, "Pixel Spacing Calibration Type"},
+    {0x00280A04, VR_LO, "Pixel Spacing Calibration Description"},
+    {0x00281040, VR_CS, "Pixel Intensity Relationship"},
+    {0x00281041, VR_SS, "Pixel Intensity Relationship Sign"},
+    {0x00281050, VR_DS, "Window Center"},
+    {0x00281051, VR_DS, "Window Width"},
+    {0x00281052, VR_DS, "Rescale Intercept"},
+    {0x00281053, VR_DS, "Rescale Slope"},
+    {0x00281054, VR_LO, "Rescale Type"},
+    {0x00281055, VR_LO, "Window Center & Width Explanation"},
+    {0x00281056, VR_CS, "VOI LUT Function"},
+    {0x00281080, VR_CS, "Gray Scale"},
+    {0x00281090, VR_CS, "Recommended Viewing Mode"},
+    {0x00281100, VR_SS, "Gray Lookup Table Descriptor"},
+    {0x00281101, VR_SS, "Red Palette Color Lookup Table Descriptor"},
+    {0x00281102, VR_SS, "Green Palette Color Lookup Table Descriptor"},
+    {0x00281103, VR_SS, "Blue Palette Color Lookup Table Descriptor"},
+    {0x00281104, VR_US, "Alpha Palette Color Lookup Table Descriptor"},
+    {0x00281111, VR_SS, "Large Red Palette Color Lookup Table Descriptor"},
+    {0x00281112, VR_SS, "Large Green Palette Color Lookup Table Descriptor"},
+    {0x00281113, VR_SS, "Large Blue Palette Color Lookup Table Descriptor"},
+    {0x00281199, VR_UI, "Palette Color Lookup Table UID"},
+    {0x00281200, VR_OW, "Gray Lookup Table Data"},
+    {0x00281201, VR_OW, "Red Palette Color Lookup Table Data"},
+    {0x00281202, VR_OW, "Green Palette Color Lookup Table Data"},
+    {0x00281203, VR_OW, "Blue Palette Color Lookup Table Data"},
+    {0x00281204, VR_OW, "Alpha Palette Color Lookup Table Data"},
+    {0x00281211, VR_OW, "Large Red Palette Color Lookup Table Data"},
+    {0x00281212, VR_OW, "Large Green Palette Color Lookup Table Data"},
+    {0x00281213, VR_OW, "Large Blue Palette Color Lookup Table Data"},
+    {0x00281214, VR_UI, "Large Palette Color Lookup Table UID"},
+    {0x00281221, VR_OW, "Segmented Red Palette Color Lookup Table Data"},
+    {0x00281222, VR_OW, "Segmented Green Palette Color Lookup Table Data"},
+    {0x00281223, VR_OW, "Segmented Blue Palette Color Lookup Table Data"},
+    {0x00281224, VR_OW, "Segmented Alpha Palette Color Lookup Table Data"},
+    {0x00281300, VR_CS, "Breast Implant Present"},
+    {0x00281350, VR_CS, "Partial View"},
+    {0x00281351, VR_ST, "Partial View Description"},
+    {0x00281352, VR_SQ, "Partial View Code Sequence"},
+    {0x0028135A, VR_CS, "Spatial Locations Preserved"},
+    {0x00281401, VR_SQ, "Data Frame Assignment Sequence"},
+    {0x00281402, VR_CS, "Data Path Assignment"},
+    {0x00281403, VR_US, "Bits Mapped to Color Lookup Table"},
+    {0x00281404, VR_SQ, "Blending LUT 1 Sequence"},
+    {0x00281405, VR_CS, "Blending LUT 1 Transfer Function"},
+    {0x00281406, VR_FD, "Blending Weight Constant"},
+    {0x00281407, VR_US, "Blending Lookup Table Descriptor"},
+    {0x00281408, VR_OW, "Blending Lookup Table Data"},
+    {0x0028140B, VR_SQ, "Enhanced Palette Color Lookup Table Sequence"},
+    {0x0028140C, VR_SQ, "Blending LUT 2 Sequence"},
+    {0x0028140D, VR_CS, "Blending LUT 2 Transfer Function"},
+    {0x0028140E, VR_CS, "Data Path ID"},
+    {0x0028140F, VR_CS, "RGB LUT Transfer Function"},
+    {0x00281410, VR_CS, "Alpha LUT Transfer Function"},
+    {0x00282000, VR_OB, "ICC Profile"},
+    {0x00282002, VR_CS, "Color Space"},
+    {0x00282110, VR_CS, "Lossy Image Compression"},
+    {0x00282112, VR_DS, "Lossy Image Compression Ratio"},
+    {0x00282114, VR_CS, "Lossy Image Compression Method"},
+    {0x00283000, VR_SQ, "Modality LUT Sequence"},
+    {0x00283002, VR_SS, "LUT Descriptor"},
+    {0x00283003, VR_LO, "LUT Explanation"},
+    {0x00283004, VR_LO, "Modality LUT Type"},
+    {0x00283006, VR_OW, "LUT Data"},
+    {0x00283010, VR_SQ, "VOI LUT Sequence"},
+    {0x00283110, VR_SQ, "Softcopy VOI LUT Sequence"},
+    {0x00284000, VR_LT, "Image Presentation Comments"},
+    {0x00285000, VR_SQ, "Bi-Plane Acquisition Sequence"},
+    {0x00286010, VR_US, "Representative Frame Number"},
+    {0x00286020, VR_US, "Frame Numbers of Interest (FOI)"},
+    {0x00286022, VR_LO, "Frame of Interest Description"},
+    {0x00286023, VR_CS, "Frame of Interest Type"},
+    {0x00286030, VR_US, "Mask Pointer(s)"},
+    {0x00286040, VR_US, "R Wave Pointer"},
+    {0x00286100, VR_SQ, "Mask Subtraction Sequence"},
+    {0x00286101, VR_CS, "Mask Operation"},
+    {0x00286102, VR_US, "Applicable Frame Range"},
+    {0x00286110, VR_US, "Mask Frame Numbers"},
+    {0x00286112, VR_US, "Contrast Frame Averaging"},
+    {0x00286114, VR_FL, "Mask Sub-pixel Shift"},
+    {0x00286120, VR_SS, "TID Offset"},
+    {0x00286190, VR_ST, "Mask Operation Explanation"},
+    {0x00287000, VR_SQ, "Equipment Administrator Sequence"},
+    {0x00287001, VR_US, "Number of Display Subsystems"},
+    {0x00287002, VR_US, "Current Configuration ID"},
+    {0x00287003, VR_US, "Display Subsystem ID"},
+    {0x00287004, VR_SH, "Display Subsystem Name"},
+    {0x00287005, VR_LO, "Display Subsystem Description"},
+    {0x00287006, VR_CS, "System Status"},
+    {0x00287007, VR_LO, "System Status Comment"},
+    {0x00287008, VR_SQ, "Target Luminance Characteristics Sequence"},
+    {0x00287009, VR_US, "Luminance Characteristics ID"},
+    {0x0028700A, VR_SQ, "Display Subsystem Configuration Sequence"},
+    {0x0028700B, VR_US, "Configuration ID"},
+    {0x0028700C, VR_SH, "Configuration Name"},
+    {0x0028700D, VR_LO, "Configuration Description"},
+    {0x0028700E, VR_US, "Referenced Target Luminance Characteristics ID"},
+    {0x0028700F, VR_SQ, "QA Results Sequence"},
+    {0x00287010, VR_SQ, "Display Subsystem QA Results Sequence"},
+    {0x00287011, VR_SQ, "Configuration QA Results Sequence"},
+    {0x00287012, VR_SQ, "Measurement Equipment Sequence"},
+    {0x00287013, VR_CS, "Measurement Functions"},
+    {0x00287014, VR_CS, "Measurement Equipment Type"},
+    {0x00287015, VR_SQ, "Visual Evaluation Result Sequence"},
+    {0x00287016, VR_SQ, "Display Calibration Result Sequence"},
+    {0x00287017, VR_US, "DDL Value"},
+    {0x00287018, VR_FL, "CIExy White Point"},
+    {0x00287019, VR_CS, "Display Function Type"},
+    {0x0028701A, VR_FL, "Gamma Value"},
+    {0x0028701B, VR_US, "Number of Luminance Points"},
+    {0x0028701C, VR_SQ, "Luminance Response Sequence"},
+    {0x0028701D, VR_FL, "Target Minimum Luminance"},
+    {0x0028701E, VR_FL, "Target Maximum Luminance"},
+    {0x0028701F, VR_FL, "Luminance Value"},
+    {0x00287020, VR_LO, "Luminance Response Description"},
+    {0x00287021, VR_CS, "White Point Flag"},
+    {0x00287022, VR_SQ, "Display Device Type Code Sequence"},
+    {0x00287023, VR_SQ, "Display Subsystem Sequence"},
+    {0x00287024, VR_SQ, "Luminance Result Sequence"},
+    {0x00287025, VR_CS, "Ambient Light Value Source"},
+    {0x00287026, VR_CS, "Measured Characteristics"},
+    {0x00287027, VR_SQ, "Luminance Uniformity Result Sequence"},
+    {0x00287028, VR_SQ, "Visual Evaluation Test Sequence"},
+    {0x00287029, VR_CS, "Test Result"},
+    {0x0028702A, VR_LO, "Test Result Comment"},
+    {0x0028702B, VR_CS, "Test Image Validation"},
+    {0x0028702C, VR_SQ, "Test Pattern Code Sequence"},
+    {0x0028702D, VR_SQ, "Measurement Pattern Code Sequence"},
+    {0x0028702E, VR_SQ, "Visual Evaluation Method Code Sequence"},
+    {0x00287FE0, VR_UR, "Pixel Data Provider URL"},
+    {0x00289001, VR_UL, "Data Point Rows"},
+    {0x00289002, VR_UL, "Data Point Columns"},
+    {0x00289003, VR_CS, "Signal Domain Columns"},
+    {0x00289099, VR_US, "Largest Monochrome Pixel Value"},
+    {0x00289108, VR_CS, "Data Representation"},
+    {0x00289110, VR_SQ, "Pixel Measures Sequence"},
+    {0x00289132, VR_SQ, "Frame VOI LUT Sequence"},
+    {0x00289145, VR_SQ, "Pixel Value Transformation Sequence"},
+    {0x00289235, VR_CS, "Signal Domain Rows"},
+    {0x00289411, VR_FL, "Display Filter Percentage"},
+    {0x00289415, VR_SQ, "Frame Pixel Shift Sequence"},
+    {0x00289416, VR_US, "Subtraction Item ID"},
+    {0x00289422, VR_SQ, "Pixel Intensity Relationship LUT Sequence"},
+    {0x00289443, VR_SQ, "Frame Pixel Data Properties Sequence"},
+    {0x00289444, VR_CS, "Geometrical Properties"},
+    {0x00289445, VR_FL, "Geometric Maximum Distortion"},
+    {0x00289446, VR_CS, "Image Processing Applied"},
+    {0x00289454, VR_CS, "Mask Selection Mode"},
+    {0x00289474, VR_CS, "LUT Function"},
+    {0x00289478, VR_FL, "Mask Visibility Percentage"},
+    {0x00289501, VR_SQ, "Pixel Shift Sequence"},
+    {0x00289502, VR_SQ, "Region Pixel Shift Sequence"},
+    {0x00289503, VR_SS, "Vertices of the Region"},
+    {0x00289505, VR_SQ, "Multi-frame Presentation Sequence"},
+    {0x00289506, VR_US, "Pixel Shift Frame Range"},
+    {0x00289507, VR_US, "LUT Frame Range"},
+    {0x00289520, VR_DS, "Image to Equipment Mapping Matrix"},
+    {0x00289537, VR_CS, "Equipment Coordinate System Identification"},
+    {0x0032000A, VR_CS, "Study Status ID"},
+    {0x0032000C, VR_CS, "Study Priority ID"},
+    {0x00320012, VR_LO, "Study ID Issuer"},
+    {0x00320032, VR_DA, "Study Verified Date"},
+    {0x00320033, VR_TM, "Study Verified Time"},
+    {0x00320034, VR_DA, "Study Read Date"},
+    {0x00320035, VR_TM, "Study Read Time"},
+    {0x00321000, VR_DA, "Scheduled Study Start Date"},
+    {0x00321001, VR_TM, "Scheduled Study Start Time"},
+    {0x00321010, VR_DA, "Scheduled Study Stop Date"},
+    {0x00321011, VR_TM, "Scheduled Study Stop Time"},
+    {0x00321020, VR_LO, "Scheduled Study Location"},
+    {0x00321021, VR_AE, "Scheduled Study Location AE Title"},
+    {0x00321030, VR_LO, "Reason for Study"},
+    {0x00321031, VR_SQ, "Requesting Physician Identification Sequence"},
+    {0x00321032, VR_PN, "Requesting Physician"},
+    {0x00321033, VR_LO, "Requesting Service"},
+    {0x00321034, VR_SQ, "Requesting Service Code Sequence"},
+    {0x00321040, VR_DA, "Study Arrival Date"},
+    {0x00321041, VR_TM, "Study Arrival Time"},
+    {0x00321050, VR_DA, "Study Completion Date"},
+    {0x00321051, VR_TM, "Study Completion Time"},
+    {0x00321055, VR_CS, "Study Component Status ID"},
+    {0x00321060, VR_LO, "Requested Procedure Description"},
+    {0x00321064, VR_SQ, "Requested Procedure Code Sequence"},
+    {0x00321070, VR_LO, "Requested Contrast Agent"},
+    {0x00324000, VR_LT, "Study Comments"},
+    {0x00380004, VR_SQ, "Referenced Patient Alias Sequence"},
+    {0x00380008, VR_CS, "Visit Status ID"},
+    {0x00380010, VR_LO, "Admission ID"},
+    {0x00380011, VR_LO, "Issuer of Admission ID"},
+    {0x00380014, VR_SQ, "Issuer of Admission ID Sequence"},
+    {0x00380016, VR_LO, "Route of Admissions"},
+    {0x0038001A, VR_DA, "Scheduled Admission Date"},
+    {0x0038001B, VR_TM, "Scheduled Admission Time"},
+    {0x0038001C, VR_DA, "Scheduled Discharge Date"},
+    {0x0038001D, VR_TM, "Scheduled Discharge Time"},
+    {0x0038001E, VR_LO, "Scheduled Patient Institution Residence"},
+    {0x00380020, VR_DA, "Admitting Date"},
+    {0x00380021, VR_TM, "Admitting Time"},
+    {0x00380030, VR_DA, "Discharge Date"},
+    {0x00380032, VR_TM, "Discharge Time"},
+    {0x00380040, VR_LO, "Discharge Diagnosis Description"},
+    {0x00380044, VR_SQ, "Discharge Diagnosis Code Sequence"},
+    {0x00380050, VR_LO, "Special Needs"},
+    {0x00380060, VR_LO, "Service Episode ID"},
+    {0x00380061, VR_LO, "Issuer of Service Episode ID"},
+    {0x00380062, VR_LO, "Service Episode Description"},
+    {0x00380064, VR_SQ, "Issuer of Service Episode ID Sequence"},
+    {0x00380100, VR_SQ, "Pertinent Documents Sequence"},
+    {0x00380101, VR_SQ, "Pertinent Resources Sequence"},
+    {0x00380102, VR_LO, "Resource Description"},
+    {0x00380300, VR_LO, "Current Patient Location"},
+    {0x00380400, VR_LO, "Patient's Institution Residence"},
+    {0x00380500, VR_LO, "Patient State"},
+    {0x00380502, VR_SQ, "Patient Clinical Trial Participation Sequence"},
+    {0x00384000, VR_LT, "Visit Comments"},
+    {0x003A0004, VR_CS, "Waveform Originality"},
+    {0x003A0005, VR_US, "Number of Waveform Channels"},
+    {0x003A0010, VR_UL, "Number of Waveform Samples"},
+    {0x003A001A, VR_DS, "Sampling Frequency"},
+    {0x003A0020, VR_SH, "Multiplex Group Label"},
+    {0x003A0200, VR_SQ, "Channel Definition Sequence"},
+    {0x003A0202, VR_IS, "Waveform Channel Number"},
+    {0x003A0203, VR_SH, "Channel Label"},
+    {0x003A0205, VR_CS, "Channel Status"},
+    {0x003A0208, VR_SQ, "Channel Source Sequence"},
+    {0x003A0209, VR_SQ, "Channel Source Modifiers Sequence"},
+    {0x003A020A, VR_SQ, "Source Waveform Sequence"},
+    {0x003A020C, VR_LO, "Channel Derivation Description"},
+    {0x003A0210, VR_DS, "Channel Sensitivity"},
+    {0x003A0211, VR_SQ, "Channel Sensitivity Units Sequence"},
+    {0x003A0212, VR_DS, "Channel Sensitivity Correction Factor"},
+    {0x003A0213, VR_DS, "Channel Baseline"},
+    {0x003A0214, VR_DS, "Channel Time Skew"},
+    {0x003A0215, VR_DS, "Channel Sample Skew"},
+    {0x003A0218, VR_DS, "Channel Offset"},
+    {0x003A021A, VR_US, "Waveform Bits Stored"},
+    {0x003A0220, VR_DS, "Filter Low Frequency"},
+    {0x003A0221, VR_DS, "Filter High Frequency"},
+    {0x003A0222, VR_DS, "Notch Filter Frequency"},
+    {0x003A0223, VR_DS, "Notch Filter Bandwidth"},
+    {0x003A0230, VR_FL, "Waveform Data Display Scale"},
+    {0x003A0231, VR_US, "Waveform Display Background CIELab Value"},
+    {0x003A0240, VR_SQ, "Waveform Presentation Group Sequence"},
+    {0x003A0241, VR_US, "Presentation Group Number"},
+    {0x003A0242, VR_SQ, "Channel Display Sequence"},
+    {0x003A0244, VR_US, "Channel Recommended Display CIELab Value"},
+    {0x003A0245, VR_FL, "Channel Position"},
+    {0x003A0246, VR_CS, "Display Shading Flag"},
+    {0x003A0247, VR_FL, "Fractional Channel Display Scale"},
+    {0x003A0248, VR_FL, "Absolute Channel Display Scale"},
+    {0x003A0300, VR_SQ, "Multiplexed Audio Channels Description Code Sequence"},
+    {0x003A0301, VR_IS, "Channel Identification Code"},
+    {0x003A0302, VR_CS, "Channel Mode"},
+    {0x00400001, VR_AE, "Scheduled Station AE Title"},
+    {0x00400002, VR_DA, "Scheduled Procedure Step Start Date"},
+    {0x00400003, VR_TM, "Scheduled Procedure Step Start Time"},
+    {0x00400004, VR_DA, "Scheduled Procedure Step End Date"},
+    {0x00400005, VR_TM, "Scheduled Procedure Step End Time"},
+    {0x00400006, VR_PN, "Scheduled Performing Physician's Name"},
+    {0x00400007, VR_LO, "Scheduled Procedure Step Description"},
+    {0x00400008, VR_SQ, "Scheduled Protocol Code Sequence"},
+    {0x00400009, VR_SH, "Scheduled Procedure Step ID"},
+    {0x0040000A, VR_SQ, "Stage Code Sequence"},
+    {0x0040000B, VR_SQ, "Scheduled Performing Physician Identification Sequence"},
+    {0x00400010, VR_SH, "Scheduled Station Name"},
+    {0x00400011, VR_SH, "Scheduled Procedure Step Location"},
+    {0x00400012, VR_LO, "Pre-Medication"},
+    {0x00400020, VR_CS, "Scheduled Procedure Step Status"},
+    {0x00400026, VR_SQ, "Order Placer Identifier Sequence"},
+    {0x00400027, VR_SQ, "Order Filler Identifier Sequence"},
+    {0x00400031, VR_UT, "Local Namespace Entity ID"},
+    {0x00400032, VR_UT, "Universal Entity ID"},
+    {0x00400033, VR_CS, "Universal Entity ID Type"},
+    {0x00400035, VR_CS, "Identifier Type Code"},
+    {0x00400036, VR_SQ, "Assigning Facility Sequence"},
+    {0x00400039, VR_SQ, "Assigning Jurisdiction Code Sequence"},
+    {0x0040003A, VR_SQ, "Assigning Agency or Department Code Sequence"},
+    {0x00400100, VR_SQ, "Scheduled Procedure Step Sequence"},
+    {0x00400220, VR_SQ, "Referenced Non-Image Composite SOP Instance Sequence"},
+    {0x00400241, VR_AE, "Performed Station AE Title"},
+    {0x00400242, VR_SH, "Performed Station Name"},
+    {0x00400243, VR_SH, "Performed Location"},
+    {0x00400244, VR_DA, "Performed Procedure Step Start Date"},
+    {0x00400245, VR_TM, "Performed Procedure Step Start Time"},
+    {0x00400250, VR_DA, "Performed Procedure Step End Date"},
+    {0x00400251, VR_TM, "Performed Procedure Step End Time"},
+    {0x00400252, VR_CS, "Performed Procedure Step Status"},
+    {0x00400253, VR_SH, "Performed Procedure Step ID"},
+    {0x00400254, VR_LO, "Performed Procedure Step Description"},
+    {0x00400255, VR_LO, "Performed Procedure Type Description"},
+    {0x00400260, VR_SQ, "Performed Protocol Code Sequence"},
+    {0x00400261, VR_CS, "Performed Protocol Type"},
+    {0x00400270, VR_SQ, "Scheduled Step Attributes Sequence"},
+    {0x00400275, VR_SQ, "Request Attributes Sequence"},
+    {0x00400280, VR_ST, "Comments on the Performed Procedure Step"},
+    {0x00400281, VR_SQ, "Performed Procedure Step Discontinuation Reason Code Sequence"},
+    {0x00400293, VR_SQ, "Quantity Sequence"},
+    {0x00400294, VR_DS, "Quantity"},
+    {0x00400295, VR_SQ, "Measuring Units Sequence"},
+    {0x00400296, VR_SQ, "Billing Item Sequence"},
+    {0x00400300, VR_US, "Total Time of Fluoroscopy"},
+    {0x00400301, VR_US, "Total Number of Exposures"},
+    {0x00400302, VR_US, "Entrance Dose"},
+    {0x00400303, VR_US, "Exposed Area"},
+    {0x00400306, VR_DS, "Distance Source to Entrance"},
+    {0x00400307, VR_DS, "Distance Source to Support"},
+    {0x0040030E, VR_SQ, "Exposure Dose Sequence"},
+    {0x00400310, VR_ST, "Comments on Radiation Dose"},
+    {0x00400312, VR_DS, "X-Ray Output"},
+    {0x00400314, VR_DS, "Half Value Layer"},
+    {0x00400316, VR_DS, "Organ Dose"},
+    {0x00400318, VR_CS, "Organ Exposed"},
+    {0x00400320, VR_SQ, "Billing Procedure Step Sequence"},
+    {0x00400321, VR_SQ, "Film Consumption Sequence"},
+    {0x00400324, VR_SQ, "Billing Supplies and Devices Sequence"},
+    {0x00400330, VR_SQ, "Referenced Procedure Step Sequence"},
+    {0x00400340, VR_SQ, "Performed Series Sequence"},
+    {0x00400400, VR_LT, "Comments on the Scheduled Procedure Step"},
+    {0x00400440, VR_SQ, "Protocol Context Sequence"},
+    {0x00400441, VR_SQ, "Content Item Modifier Sequence"},
+    {0x00400500, VR_SQ, "Scheduled Specimen Sequence"},
+    {0x0040050A, VR_LO, "Specimen Accession Number"},
+    {0x00400512, VR_LO, "Container Identifier"},
+    {0x00400513, VR_SQ, "Issuer of the Container Identifier Sequence"},
+    {0x00400515, VR_SQ, "Alternate Container Identifier Sequence"},
+    {0x00400518, VR_SQ, "Container Type Code Sequence"},
+    {0x0040051A, VR_LO, "Container Description"},
+    {0x00400520, VR_SQ, "Container Component Sequence"},
+    {0x00400550, VR_SQ, "Specimen Sequence"},
+    {0x00400551, VR_LO, "Specimen Identifier"},
+    {0x00400552, VR_SQ, "Specimen Description Sequence (Trial)"},
+    {0x00400553, VR_ST, "Specimen Description (Trial)"},
+    {0x00400554, VR_UI, "Specimen UID"},
+    {0x00400555, VR_SQ, "Acquisition Context Sequence"},
+    {0x00400556, VR_ST, "Acquisition Context Description"},
+    {0x00400560, VR_SQ, "Specimen Description Sequence"},
+    {0x00400562, VR_SQ, "Issuer of the Specimen Identifier Sequence"},
+    {0x0040059A, VR_SQ, "Specimen Type Code Sequence"},
+    {0x00400600, VR_LO, "Specimen Short Description"},
+    {0x00400602, VR_UT, "Specimen Detailed Description"},
+    {0x00400610, VR_SQ, "Specimen Preparation Sequence"},
+    {0x00400612, VR_SQ, "Specimen Preparation Step Content Item Sequence"},
+    {0x00400620, VR_SQ, "Specimen Localization Content Item Sequence"},
+    {0x004006FA, VR_LO, "Slide Identifier"},
+    {0x0040071A, VR_SQ, "Image Center Point Coordinates Sequence"},
+    {0x0040072A, VR_DS, "X Offset in Slide Coordinate System"},
+    {0x0040073A, VR_DS, "Y Offset in Slide Coordinate System"},
+    {0x0040074A, VR_DS, "Z Offset in Slide Coordinate System"},
+    {0x004008D8, VR_SQ, "Pixel Spacing Sequence"},
+    {0x004008DA, VR_SQ, "Coordinate System Axis Code Sequence"},
+    {0x004008EA, VR_SQ, "Measurement Units Code Sequence"},
+    {0x004009F8, VR_SQ, "Vital Stain Code Sequence (Trial)"},
+    {0x00401001, VR_SH, "Requested Procedure ID"},
+    {0x00401002, VR_LO, "Reason for the Requested Procedure"},
+    {0x00401003, VR_SH, "Requested Procedure Priority"},
+    {0x00401004, VR_LO, "Patient Transport Arrangements"},
+    {0x00401005, VR_LO, "Requested Procedure Location"},
+    {0x00401006, VR_SH, "Placer Order Number / Procedure"},
+    {0x00401007, VR_SH, "Filler Order Number / Procedure"},
+    {0x00401008, VR_LO, "Confidentiality Code"},
+    {0x00401009, VR_SH, "Reporting Priority"},
+    {0x0040100A, VR_SQ, "Reason for Requested Procedure Code Sequence"},
+    {0x00401010, VR_PN, "Names of Intended Recipients of Results"},
+    {0x00401011, VR_SQ, "Intended Recipients of Results Identification Sequence"},
+    {0x00401012, VR_SQ, "Reason For Performed Procedure Code Sequence"},
+    {0x00401060, VR_LO, "Requested Procedure Description (Trial)"},
+    {0x00401101, VR_SQ, "Person Identification Code Sequence"},
+    {0x00401102, VR_ST, "Person's Address"},
+    {0x00401103, VR_LO, "Person's Telephone Numbers"},
+    {0x00401104, VR_LT, "Person's Telecom Information"},
+    {0x00401400, VR_LT, "Requested Procedure Comments"},
+    {0x00402001, VR_LO, "Reason for the Imaging Service Request"},
+    {0x00402004, VR_DA, "Issue Date of Imaging Service Request"},
+    {0x00402005, VR_TM, "Issue Time of Imaging Service Request"},
+    {0x00402006, VR_SH, "Placer Order Number / Imaging Service Request (Retired)"},
+    {0x00402007, VR_SH, "Filler Order Number / Imaging Service Request (Retired)"},
+    {0x00402008, VR_PN, "Order Entered By"},
+    {0x00402009, VR_SH, "Order Enterer's Location"},
+    {0x00402010, VR_SH, "Order Callback Phone Number"},
+    {0x00402011, VR_LT, "Order Callback Telecom Information"},
+    {0x00402016, VR_LO, "Placer Order Number / Imaging Service Request"},
+    {0x00402017, VR_LO, "Filler Order Number / Imaging Service Request"},
+    {0x00402400, VR_LT, "Imaging Service Request Comments"},
+    {0x00403001, VR_LO, "Confidentiality Constraint on Patient Data Description"},
+    {0x00404001, VR_CS, "General Purpose Scheduled Procedure Step Status"},
+    {0x00404002, VR_CS, "General Purpose Performed Procedure Step Status"},
+    {0x00404003, VR_CS, "General Purpose Scheduled Procedure Step Priority"},
+    {0x00404004, VR_SQ, "Scheduled Processing Applications Code Sequence"},
+    {0x00404005, VR_DT, "Scheduled Procedure Step Start DateTime"},
+    {0x00404006, VR_CS, "Multiple Copies Flag"},
+    {0x00404007, VR_SQ, "Performed Processing Applications Code Sequence"},
+    {0x00404009, VR_SQ, "Human Performer Code Sequence"},
+    {0x00404010, VR_DT, "Scheduled Procedure Step Modification DateTime"},
+    {0x00404011, VR_DT, "Expected Completion DateTime"},
+    {0x00404015, VR_SQ, "Resulting General Purpose Performed Procedure Steps Sequence"},
+    {0x00404016, VR_SQ, "Referenced General Purpose Scheduled Procedure Step Sequence"},
+    {0x00404018, VR_SQ, "Scheduled Workitem Code Sequence"},
+    {0x00404019, VR_SQ, "Performed Workitem Code Sequence"},
+    {0x00404020, VR_CS, "Input Availability Flag"},
+    {0x00404021, VR_SQ, "Input Information Sequence"},
+    {0x00404022, VR_SQ, "Relevant Information Sequence"},
+    {0x00404023, VR_UI, "Referenced General Purpose Scheduled Procedure Step Transaction UID"},
+    {0x00404025, VR_SQ, "Scheduled Station Name Code Sequence"},
+    {0x00404026, VR_SQ, "Scheduled Station Class Code Sequence"},
+    {0x00404027, VR_SQ, "Scheduled Station Geographic Location Code Sequence"},
+    {0x00404028, VR_SQ, "Performed Station Name Code Sequence"},
+    {0x00404029, VR_SQ, "Performed Station Class Code Sequence"},
+    {0x00404030, VR_SQ, "Performed Station Geographic Location Code Sequence"},
+    {0x00404031, VR_SQ, "Requested Subsequent Workitem Code Sequence"},
+    {0x00404032, VR_SQ, "Non-DICOM Output Code Sequence"},
+    {0x00404033, VR_SQ, "Output Information Sequence"},
+    {0x00404034, VR_SQ, "Scheduled Human Performers Sequence"},
+    {0x00404035, VR_SQ, "Actual Human Performers Sequence"},
+    {0x00404036, VR_LO, "Human Performer's Organization"},
+    {0x00404037, VR_PN, "Human Performer's Name"},
+    {0x00404040, VR_CS, "Raw Data Handling"},
+    {0x00404041, VR_CS, "Input Readiness State"},
+    {0x00404050, VR_DT, "Performed Procedure Step Start DateTime"},
+    {0x00404051, VR_DT, "Performed Procedure Step End DateTime"},
+    {0x00404052, VR_DT, "Procedure Step Cancellation DateTime"},
+    {0x00404070, VR_SQ, "Output Destination Sequence"},
+    {0x00404071, VR_SQ, "DICOM Storage Sequence"},
+    {0x00404072, VR_SQ, "STOW-RS Storage Sequence"},
+    {0x00404073, VR_UR, "Storage URL"},
+    {0x00404074, VR_SQ, "XDS Storage Sequence"},
+    {0x00408302, VR_DS, "Entrance Dose in mGy"},
+    {0x00409092, VR_SQ, "Parametric Map Frame Type Sequence"},
+    {0x00409094, VR_SQ, "Referenced Image Real World Value Mapping Sequence"},
+    {0x00409096, VR_SQ, "Real World Value Mapping Sequence"},
+    {0x00409098, VR_SQ, "Pixel Value Mapping Code Sequence"},
+    {0x00409210, VR_SH, "LUT Label"},
+    {0x00409211, VR_SS, "Real World Value Last Value Mapped"},
+    {0x00409212, VR_FD, "Real World Value LUT Data"},
+    {0x00409213, VR_FD, "Double Float Real World Value Last Value Mapped"},
+    {0x00409214, VR_FD, "Double Float Real World Value First Value Mapped"},
+    {0x00409216, VR_SS, "Real World Value First Value Mapped"},
+    {0x00409220, VR_SQ, "Quantity Definition Sequence"},
+    {0x00409224, VR_FD, "Real World Value Intercept"},
+    {0x00409225, VR_FD, "Real World Value Slope"},
+    {0x0040A007, VR_CS, "Findings Flag (Trial)"},
+    {0x0040A010, VR_CS, "Relationship Type"},
+    {0x0040A020, VR_SQ, "Findings Sequence (Trial)"},
+    {0x0040A021, VR_UI, "Findings Group UID (Trial)"},
+    {0x0040A022, VR_UI, "Referenced Findings Group UID (Trial)"},
+    {0x0040A023, VR_DA, "Findings Group Recording Date (Trial)"},
+    {0x0040A024, VR_TM, "Findings Group Recording Time (Trial)"},
+    {0x0040A026, VR_SQ, "Findings Source Category Code Sequence (Trial)"},
+    {0x0040A027, VR_LO, "Verifying Organization"},
+    {0x0040A028, VR_SQ, "Documenting Organization Identifier Code Sequence (Trial)"},
+    {0x0040A030, VR_DT, "Verification DateTime"},
+    {0x0040A032, VR_DT, "Observation DateTime"},
+    {0x0040A040, VR_CS, "Value Type"},
+    {0x0040A043, VR_SQ, "Concept Name Code Sequence"},
+    {0x0040A047, VR_LO, "Measurement Precision Description (Trial)"},
+    {0x0040A050, VR_CS, "Continuity Of Content"},
+    {0x0040A057, VR_CS, "Urgency or Priority Alerts (Trial)"},
+    {0x0040A060, VR_LO, "Sequencing Indicator (Trial)"},
+    {0x0040A066, VR_SQ, "Document Identifier Code Sequence (Trial)"},
+    {0x0040A067, VR_PN, "Document Author (Trial)"},
+    {0x0040A068, VR_SQ, "Document Author Identifier Code Sequence (Trial)"},
+    {0x0040A070, VR_SQ, "Identifier Code Sequence (Trial)"},
+    {0x0040A073, VR_SQ, "Verifying Observer Sequence"},
+    {0x0040A074, VR_OB, "Object Binary Identifier (Trial)"},
+    {0x0040A075, VR_PN, "Verifying Observer Name"},
+    {0x0040A076, VR_SQ, "Documenting Observer Identifier Code Sequence (Trial)"},
+    {0x0040A078, VR_SQ, "Author Observer Sequence"},
+    {0x0040A07A, VR_SQ, "Participant Sequence"},
+    {0x0040A07C, VR_SQ, "Custodial Organization Sequence"},
+    {0x0040A080, VR_CS, "Participation Type"},
+    {0x0040A082, VR_DT, "Participation DateTime"},
+    {0x0040A084, VR_CS, "Observer Type"},
+    {0x0040A085, VR_SQ, "Procedure Identifier Code Sequence (Trial)"},
+    {0x0040A088, VR_SQ, "Verifying Observer Identification Code Sequence"},
+    {0x0040A089, VR_OB, "Object Directory Binary Identifier (Trial)"},
+    {0x0040A090, VR_SQ, "Equivalent CDA Document Sequence"},
+    {0x0040A0B0, VR_US, "Referenced Waveform Channels"},
+    {0x0040A110, VR_DA, "Date of Document or Verbal Transaction (Trial)"},
+    {0x0040A112, VR_TM, "Time of Document Creation or Verbal Transaction (Trial)"},
+    {0x0040A120, VR_DT, "DateTime"},
+    {0x0040A121, VR_DA, "Date"},
+    {0x0040A122, VR_TM, "Time"},
+    {0x0040A123, VR_PN, "Person Name"},
+    {0x0040A124, VR_UI, "UID"},
+    {0x0040A125, VR_CS, "Report Status ID (Trial)"},
+    {0x0040A130, VR_CS, "Temporal Range Type"},
+    {0x0040A132, VR_UL, "Referenced Sample Positions"},
+    {0x0040A136, VR_US, "Referenced Frame Numbers"},
+    {0x0040A138, VR_DS, "Referenced Time Offsets"},
+    {0x0040A13A, VR_DT, "Referenced DateTime"},
+    {0x0040A160, VR_UT, "Text Value"},
+    {0x0040A161, VR_FD, "Floating Point Value"},
+    {0x0040A162, VR_SL, "Rational Numerator Value"},
+    {0x0040A163, VR_UL, "Rational Denominator Value"},
+    {0x0040A167, VR_SQ, "Observation Category Code Sequence (Trial)"},
+    {0x0040A168, VR_SQ, "Concept Code Sequence"},
+    {0x0040A16A, VR_ST, "Bibliographic Citation (Trial)"},
+    {0x0040A170, VR_SQ, "Purpose of Reference Code Sequence"},
+    {0x0040A171, VR_UI, "Observation UID"},
+    {0x0040A172, VR_UI, "Referenced Observation UID (Trial)"},
+    {0x0040A173, VR_CS, "Referenced Observation Class (Trial)"},
+    {0x0040A174, VR_CS, "Referenced Object Observation Class (Trial)"},
+    {0x0040A180, VR_US, "Annotation Group Number"},
+    {0x0040A192, VR_DA, "Observation Date (Trial)"},
+    {0x0040A193, VR_TM, "Observation Time (Trial)"},
+    {0x0040A194, VR_CS, "Measurement Automation (Trial)"},
+    {0x0040A195, VR_SQ, "Modifier Code Sequence"},
+    {0x0040A224, VR_ST, "Identification Description (Trial)"},
+    {0x0040A290, VR_CS, "Coordinates Set Geometric Type (Trial)"},
+    {0x0040A296, VR_SQ, "Algorithm Code Sequence (Trial)"},
+    {0x0040A297, VR_ST, "Algorithm Description (Trial)"},
+    {0x0040A29A, VR_SL, "Pixel Coordinates Set (Trial)"},
+    {0x0040A300, VR_SQ, "Measured Value Sequence"},
+    {0x0040A301, VR_SQ, "Numeric Value Qualifier Code Sequence"},
+    {0x0040A307, VR_PN, "Current Observer (Trial)"},
+    {0x0040A30A, VR_DS, "Numeric Value"},
+    {0x0040A313, VR_SQ, "Referenced Accession Sequence (Trial)"},
+    {0x0040A33A, VR_ST, "Report Status Comment (Trial)"},
+    {0x0040A340, VR_SQ, "Procedure Context Sequence (Trial)"},
+    {0x0040A352, VR_PN, "Verbal Source (Trial)"},
+    {0x0040A353, VR_ST, "Address (Trial)"},
+    {0x0040A354, VR_LO, "Telephone Number (Trial)"},
+    {0x0040A358, VR_SQ, "Verbal Source Identifier Code Sequence (Trial)"},
+    {0x0040A360, VR_SQ, "Predecessor Documents Sequence"},
+    {0x0040A370, VR_SQ, "Referenced Request Sequence"},
+    {0x0040A372, VR_SQ, "Performed Procedure Code Sequence"},
+    {0x0040A375, VR_SQ, "Current Requested Procedure Evidence Sequence"},
+    {0x0040A380, VR_SQ, "Report Detail Sequence (Trial)"},
+    {0x0040A385, VR_SQ, "Pertinent Other Evidence Sequence"},
+    {0x0040A390, VR_SQ, "HL7 Structured Document Reference Sequence"},
+    {0x0040A402, VR_UI, "Observation Subject UID (Trial)"},
+    {0x0040A403, VR_CS, "Observation Subject Class (Trial)"},
+    {0x0040A404, VR_SQ, "Observation Subject Type Code Sequence (Trial)"},
+    {0x0040A491, VR_CS, "Completion Flag"},
+    {0x0040A492, VR_LO, "Completion Flag Description"},
+    {0x0040A493, VR_CS, "Verification Flag"},
+    {0x0040A494, VR_CS, "Archive Requested"},
+    {0x0040A496, VR_CS, "Preliminary Flag"},
+    {0x0040A504, VR_SQ, "Content Template Sequence"},
+    {0x0040A525, VR_SQ, "Identical Documents Sequence"},
+    {0x0040A600, VR_CS, "Observation Subject Context Flag (Trial)"},
+    {0x0040A601, VR_CS, "Observer Context Flag (Trial)"},
+    {0x0040A603, VR_CS, "Procedure Context Flag (Trial)"},
+    {0x0040A730, VR_SQ, "Content Sequence"},
+    {0x0040A731, VR_SQ, "Relationship Sequence (Trial)"},
+    {0x0040A732, VR_SQ, "Relationship Type Code Sequence (Trial)"},
+    {0x0040A744, VR_SQ, "Language Code Sequence (Trial)"},
+    {0x0040A992, VR_ST, "Uniform Resource Locator (Trial)"},
+    {0x0040B020, VR_SQ, "Waveform Annotation Sequence"},
+    {0x0040DB00, VR_CS, "Template Identifier"},
+    {0x0040DB06, VR_DT, "Template Version"},
+    {0x0040DB07, VR_DT, "Template Local Version"},
+    {0x0040DB0B, VR_CS, "Template Extension Flag"},
+    {0x0040DB0C, VR_UI, "Template Extension Organization UID"},
+    {0x0040DB0D, VR_UI, "Template Extension Creator UID"},
+    {0x0040DB73, VR_UL, "Referenced Content Item Identifier"},
+    {0x0040E001, VR_ST, "HL7 Instance Identifier"},
+    {0x0040E004, VR_DT, "HL7 Document Effective Time"},
+    {0x0040E006, VR_SQ, "HL7 Document Type Code Sequence"},
+    {0x0040E008, VR_SQ, "Document Class Code Sequence"},
+    {0x0040E010, VR_UR, "Retrieve URI"},
+    {0x0040E011, VR_UI, "Retrieve Location UID"},
+    {0x0040E020, VR_CS, "Type of Instances"},
+    {0x0040E021, VR_SQ, "DICOM Retrieval Sequence"},
+    {0x0040E022, VR_SQ, "DICOM Media Retrieval Sequence"},
+    {0x0040E023, VR_SQ, "WADO Retrieval Sequence"},
+    {0x0040E024, VR_SQ, "XDS Retrieval Sequence"},
+    {0x0040E025, VR_SQ, "WADO-RS Retrieval Sequence"},
+    {0x0040E030, VR_UI, "Repository Unique ID"},
+    {0x0040E031, VR_UI, "Home Community ID"},
+    {0x00420010, VR_ST, "Document Title"},
+    {0x00420011, VR_OB, "Encapsulated Document"},
+    {0x00420012, VR_LO, "MIME Type of Encapsulated Document"},
+    {0x00420013, VR_SQ, "Source Instance Sequence"},
+    {0x00420014, VR_LO, "List of MIME Types"},
+    {0x00440001, VR_ST, "Product Package Identifier"},
+    {0x00440002, VR_CS, "Substance Administration Approval"},
+    {0x00440003, VR_LT, "Approval Status Further Description"},
+    {0x00440004, VR_DT, "Approval Status DateTime"},
+    {0x00440007, VR_SQ, "Product Type Code Sequence"},
+    {0x00440008, VR_LO, "Product Name"},
+    {0x00440009, VR_LT, "Product Description"},
+    {0x0044000A, VR_LO, "Product Lot Identifier"},
+    {0x0044000B, VR_DT, "Product Expiration DateTime"},
+    {0x00440010, VR_DT, "Substance Administration DateTime"},
+    {0x00440011, VR_LO, "Substance Administration Notes"},
+    {0x00440012, VR_LO, "Substance Administration Device ID"},
+    {0x00440013, VR_SQ, "Product Parameter Sequence"},
+    {0x00440019, VR_SQ, "Substance Administration Parameter Sequence"},
+    {0x00460012, VR_LO, "Lens Description"},
+    {0x00460014, VR_SQ, "Right Lens Sequence"},
+    {0x00460015, VR_SQ, "Left Lens Sequence"},
+    {0x00460016, VR_SQ, "Unspecified Laterality Lens Sequence"},
+    {0x00460018, VR_SQ, "Cylinder Sequence"},
+    {0x00460028, VR_SQ, "Prism Sequence"},
+    {0x00460030, VR_FD, "Horizontal Prism Power"},
+    {0x00460032, VR_CS, "Horizontal Prism Base"},
+    {0x00460034, VR_FD, "Vertical Prism Power"},
+    {0x00460036, VR_CS, "Vertical Prism Base"},
+    {0x00460038, VR_CS, "Lens Segment Type"},
+    {0x00460040, VR_FD, "Optical Transmittance"},
+    {0x00460042, VR_FD, "Channel Width"},
+    {0x00460044, VR_FD, "Pupil Size"},
+    {0x00460046, VR_FD, "Corneal Size"},
+    {0x00460050, VR_SQ, "Autorefraction Right Eye Sequence"},
+    {0x00460052, VR_SQ, "Autorefraction Left Eye Sequence"},
+    {0x00460060, VR_FD, "Distance Pupillary Distance"},
+    {0x00460062, VR_FD, "Near Pupillary Distance"},
+    {0x00460063, VR_FD, "Intermediate Pupillary Distance"},
+    {0x00460064, VR_FD, "Other Pupillary Distance"},
+    {0x00460070, VR_SQ, "Keratometry Right Eye Sequence"},
+    {0x00460071, VR_SQ, "Keratometry Left Eye Sequence"},
+    {0x00460074, VR_SQ, "Steep Keratometric Axis Sequence"},
+    {0x00460075, VR_FD, "Radius of Curvature"},
+    {0x00460076, VR_FD, "Keratometric Power"},
+    {0x00460077, VR_FD, "Keratometric Axis"},
+    {0x00460080, VR_SQ, "Flat Keratometric Axis Sequence"},
+    {0x00460092, VR_CS, "Background Color"},
+    {0x00460094, VR_CS, "Optotype"},
+    {0x00460095, VR_CS, "Optotype Presentation"},
+    {0x00460097, VR_SQ, "Subjective Refraction Right Eye Sequence"},
+    {0x00460098, VR_SQ, "Subjective Refraction Left Eye Sequence"},
+    {0x00460100, VR_SQ, "Add Near Sequence"},
+    {0x00460101, VR_SQ, "Add Intermediate Sequence"},
+    {0x00460102, VR_SQ, "Add Other Sequence"},
+    {0x00460104, VR_FD, "Add Power"},
+    {0x00460106, VR_FD, "Viewing Distance"},
+    {0x00460121, VR_SQ, "Visual Acuity Type Code Sequence"},
+    {0x00460122, VR_SQ, "Visual Acuity Right Eye Sequence"},
+    {0x00460123, VR_SQ, "Visual Acuity Left Eye Sequence"},
+    {0x00460124, VR_SQ, "Visual Acuity Both Eyes Open Sequence"},
+    {0x00460125, VR_CS, "Viewing Distance Type"},
+    {0x00460135, VR_SS, "Visual Acuity Modifiers"},
+    {0x00460137, VR_FD, "Decimal Visual Acuity"},
+    {0x00460139, VR_LO, "Optotype Detailed Definition"},
+    {0x00460145, VR_SQ, "Referenced Refractive Measurements Sequence"},
+    {0x00460146, VR_FD, "Sphere Power"},
+    {0x00460147, VR_FD, "Cylinder Power"},
+    {0x00460201, VR_CS, "Corneal Topography Surface"},
+    {0x00460202, VR_FL, "Corneal Vertex Location"},
+    {0x00460203, VR_FL, "Pupil Centroid X-Coordinate"},
+    {0x00460204, VR_FL, "Pupil Centroid Y-Coordinate"},
+    {0x00460205, VR_FL, "Equivalent Pupil Radius"},
+    {0x00460207, VR_SQ, "Corneal Topography Map Type Code Sequence"},
+    {0x00460208, VR_IS, "Vertices of the Outline of Pupil"},
+    {0x00460210, VR_SQ, "Corneal Topography Mapping Normals Sequence"},
+    {0x00460211, VR_SQ, "Maximum Corneal Curvature Sequence"},
+    {0x00460212, VR_FL, "Maximum Corneal Curvature"},
+    {0x00460213, VR_FL, "Maximum Corneal Curvature Location"},
+    {0x00460215, VR_SQ, "Minimum Keratometric Sequence"},
+    {0x00460218, VR_SQ, "Simulated Keratometric Cylinder Sequence"},
+    {0x00460220, VR_FL, "Average Corneal Power"},
+    {0x00460224, VR_FL, "Corneal I-S Value"},
+    {0x00460227, VR_FL, "Analyzed Area"},
+    {0x00460230, VR_FL, "Surface Regularity Index"},
+    {0x00460232, VR_FL, "Surface Asymmetry Index"},
+    {0x00460234, VR_FL, "Corneal Eccentricity Index"},
+    {0x00460236, VR_FL, "Keratoconus Prediction Index"},
+    {0x00460238, VR_FL, "Decimal Potential Visual Acuity"},
+    {0x00460242, VR_CS, "Corneal Topography Map Quality Evaluation"},
+    {0x00460244, VR_SQ, "Source Image Corneal Processed Data Sequence"},
+    {0x00460247, VR_FL, "Corneal Point Location"},
+    {0x00460248, VR_CS, "Corneal Point Estimated"},
+    {0x00460249, VR_FL, "Axial Power"},
+    {0x00460250, VR_FL, "Tangential Power"},
+    {0x00460251, VR_FL, "Refractive Power"},
+    {0x00460252, VR_FL, "Relative Elevation"},
+    {0x00460253, VR_FL, "Corneal Wavefront"},
+    {0x00480001, VR_FL, "Imaged Volume Width"},
+    {0x00480002, VR_FL, "Imaged Volume Height"},
+    {0x00480003, VR_FL, "Imaged Volume Depth"},
+    {0x00480006, VR_UL, "Total Pixel Matrix Columns"},
+    {0x00480007, VR_UL, "Total Pixel Matrix Rows"},
+    {0x00480008, VR_SQ, "Total Pixel Matrix Origin Sequence"},
+    {0x00480010, VR_CS, "Specimen Label in Image"},
+    {0x00480011, VR_CS, "Focus Method"},
+    {0x00480012, VR_CS, "Extended Depth of Field"},
+    {0x00480013, VR_US, "Number of Focal Planes"},
+    {0x00480014, VR_FL, "Distance Between Focal Planes"},
+    {0x00480015, VR_US, "Recommended Absent Pixel CIELab Value"},
+    {0x00480100, VR_SQ, "Illuminator Type Code Sequence"},
+    {0x00480102, VR_DS, "Image Orientation (Slide)"},
+    {0x00480105, VR_SQ, "Optical Path Sequence"},
+    {0x00480106, VR_SH, "Optical Path Identifier"},
+    {0x00480107, VR_ST, "Optical Path Description"},
+    {0x00480108, VR_SQ, "Illumination Color Code Sequence"},
+    {0x00480110, VR_SQ, "Specimen Reference Sequence"},
+    {0x00480111, VR_DS, "Condenser Lens Power"},
+    {0x00480112, VR_DS, "Objective Lens Power"},
+    {0x00480113, VR_DS, "Objective Lens Numerical Aperture"},
+    {0x00480120, VR_SQ, "Palette Color Lookup Table Sequence"},
+    {0x00480200, VR_SQ, "Referenced Image Navigation Sequence"},
+    {0x00480201, VR_US, "Top Left Hand Corner of Localizer Area"},
+    {0x00480202, VR_US, "Bottom Right Hand Corner of Localizer Area"},
+    {0x00480207, VR_SQ, "Optical Path Identification Sequence"},
+    {0x0048021A, VR_SQ, "Plane Position (Slide) Sequence"},
+    {0x0048021E, VR_SL, "Column Position In Total Image Pixel Matrix"},
+    {0x0048021F, VR_SL, "Row Position In Total Image Pixel Matrix"},
+    {0x00480301, VR_CS, "Pixel Origin Interpretation"},
+    {0x00500004, VR_CS, "Calibration Image"},
+    {0x00500010, VR_SQ, "Device Sequence"},
+    {0x00500012, VR_SQ, "Container Component Type Code Sequence"},
+    {0x00500013, VR_FD, "Container Component Thickness"},
+    {0x00500014, VR_DS, "Device Length"},
+    {0x00500015, VR_FD, "Container Component Width"},
+    {0x00500016, VR_DS, "Device Diameter"},
+    {0x00500017, VR_CS, "Device Diameter Units"},
+    {0x00500018, VR_DS, "Device Volume"},
+    {0x00500019, VR_DS, "Inter-Marker Distance"},
+    {0x0050001A, VR_CS, "Container Component Material"},
+    {0x0050001B, VR_LO, "Container Component ID"},
+    {0x0050001C, VR_FD, "Container Component Length"},
+    {0x0050001D, VR_FD, "Container Component Diameter"},
+    {0x0050001E, VR_LO, "Container Component Description"},
+    {0x00500020, VR_LO, "Device Description"},
+    {0x00520001, VR_FL, "Contrast/Bolus Ingredient Percent by Volume"},
+    {0x00520002, VR_FD, "OCT Focal Distance"},
+    {0x00520003, VR_FD, "Beam Spot Size"},
+    {0x00520004, VR_FD, "Effective Refractive Index"},
+    {0x00520006, VR_CS, "OCT Acquisition Domain"},
+    {0x00520007, VR_FD, "OCT Optical Center Wavelength"},
+    {0x00520008, VR_FD, "Axial Resolution"},
+    {0x00520009, VR_FD, "Ranging Depth"},
+    {0x00520011, VR_FD, "A-line Rate"},
+    {0x00520012, VR_US, "A-lines Per Frame"},
+    {0x00520013, VR_FD, "Catheter Rotational Rate"},
+    {0x00520014, VR_FD, "A-line Pixel Spacing"},
+    {0x00520016, VR_SQ, "Mode of Percutaneous Access Sequence"},
+    {0x00520025, VR_SQ, "Intravascular OCT Frame Type Sequence"},
+    {0x00520026, VR_CS, "OCT Z Offset Applied"},
+    {0x00520027, VR_SQ, "Intravascular Frame Content Sequence"},
+    {0x00520028, VR_FD, "Intravascular Longitudinal Distance"},
+    {0x00520029, VR_SQ, "Intravascular OCT Frame Content Sequence"},
+    {0x00520030, VR_SS, "OCT Z Offset Correction"},
+    {0x00520031, VR_CS, "Catheter Direction of Rotation"},
+    {0x00520033, VR_FD, "Seam Line Location"},
+    {0x00520034, VR_FD, "First A-line Location"},
+    {0x00520036, VR_US, "Seam Line Index"},
+    {0x00520038, VR_US, "Number of Padded A-lines"},
+    {0x00520039, VR_CS, "Interpolation Type"},
+    {0x0052003A, VR_CS, "Refractive Index Applied"},
+    {0x00540010, VR_US, "Energy Window Vector"},
+    {0x00540011, VR_US, "Number of Energy Windows"},
+    {0x00540012, VR_SQ, "Energy Window Information Sequence"},
+    {0x00540013, VR_SQ, "Energy Window Range Sequence"},
+    {0x00540014, VR_DS, "Energy Window Lower Limit"},
+    {0x00540015, VR_DS, "Energy Window Upper Limit"},
+    {0x00540016, VR_SQ, "Radiopharmaceutical Information Sequence"},
+    {0x00540017, VR_IS, "Residual Syringe Counts"},
+    {0x00540018, VR_SH, "Energy Window Name"},
+    {0x00540020, VR_US, "Detector Vector"},
+    {0x00540021, VR_US, "Number of Detectors"},
+    {0x00540022, VR_SQ, "Detector Information Sequence"},
+    {0x00540030, VR_US, "Phase Vector"},
+    {0x00540031, VR_US, "Number of Phases"},
+    {0x00540032, VR_SQ, "Phase Information Sequence"},
+    {0x00540033, VR_US, "Number of Frames in Phase"},
+    {0x00540036, VR_IS, "Phase Delay"},
+    {0x00540038, VR_IS, "Pause Between Frames"},
+    {0x00540039, VR_CS, "Phase Description"},
+    {0x00540050, VR_US, "Rotation Vector"},
+    {0x00540051, VR_US, "Number of Rotations"},
+    {0x00540052, VR_SQ, "Rotation Information Sequence"},
+    {0x00540053, VR_US, "Number of Frames in Rotation"},
+    {0x00540060, VR_US, "R-R Interval Vector"},
+    {0x00540061, VR_US, "Number of R-R Intervals"},
+    {0x00540062, VR_SQ, "Gated Information Sequence"},
+    {0x00540063, VR_SQ, "Data Information Sequence"},
+    {0x00540070, VR_US, "Time Slot Vector"},
+    {0x00540071, VR_US, "Number of Time Slots"},
+    {0x00540072, VR_SQ, "Time Slot Information Sequence"},
+    {0x00540073, VR_DS, "Time Slot Time"},
+    {0x00540080, VR_US, "Slice Vector"},
+    {0x00540081, VR_US, "Number of Slices"},
+    {0x00540090, VR_US, "Angular View Vector"},
+    {0x00540100, VR_US, "Time Slice Vector"},
+    {0x00540101, VR_US, "Number of Time Slices"},
+    {0x00540200, VR_DS, "Start Angle"},
+    {0x00540202, VR_CS, "Type of Detector Motion"},
+    {0x00540210, VR_IS, "Trigger Vector"},
+    {0x00540211, VR_US, "Number of Triggers in Phase"},
+    {0x00540220, VR_SQ, "View Code Sequence"},
+    {0x00540222, VR_SQ, "View Modifier Code Sequence"},
+    {0x00540300, VR_SQ, "Radionuclide Code Sequence"},
+    {0x00540302, VR_SQ, "Administration Route Code Sequence"},
+    {0x00540304, VR_SQ, "Radiopharmaceutical Code Sequence"},
+    {0x00540306, VR_SQ, "Calibration Data Sequence"},
+    {0x00540308, VR_US, "Energy Window Number"},
+    {0x00540400, VR_SH, "Image ID"},
+    {0x00540410, VR_SQ, "Patient Orientation Code Sequence"},
+    {0x00540412, VR_SQ, "Patient Orientation Modifier Code Sequence"},
+    {0x00540414, VR_SQ, "Patient Gantry Relationship Code Sequence"},
+    {0x00540500, VR_CS, "Slice Progression Direction"},
+    {0x00540501, VR_CS, "Scan Progression Direction"},
+    {0x00541000, VR_CS, "Series Type"},
+    {0x00541001, VR_CS, "Units"},
+    {0x00541002, VR_CS, "Counts Source"},
+    {0x00541004, VR_CS, "Reprojection Method"},
+    {0x00541006, VR_CS, "SUV Type"},
+    {0x00541100, VR_CS, "Randoms Correction Method"},
+    {0x00541101, VR_LO, "Attenuation Correction Method"},
+    {0x00541102, VR_CS, "Decay Correction"},
+    {0x00541103, VR_LO, "Reconstruction Method"},
+    {0x00541104, VR_LO, "Detector Lines of Response Used"},
+    {0x00541105, VR_LO, "Scatter Correction Method"},
+    {0x00541200, VR_DS, "Axial Acceptance"},
+    {0x00541201, VR_IS, "Axial Mash"},
+    {0x00541202, VR_IS, "Transverse Mash"},
+    {0x00541203, VR_DS, "Detector Element Size"},
+    {0x00541210, VR_DS, "Coincidence Window Width"},
+    {0x00541220, VR_CS, "Secondary Counts Type"},
+    {0x00541300, VR_DS, "Frame Reference Time"},
+    {0x00541310, VR_IS, "Primary (Prompts) Counts Accumulated"},
+    {0x00541311, VR_IS, "Secondary Counts Accumulated"},
+    {0x00541320, VR_DS, "Slice Sensitivity Factor"},
+    {0x00541321, VR_DS, "Decay Factor"},
+    {0x00541322, VR_DS, "Dose Calibration Factor"},
+    {0x00541323, VR_DS, "Scatter Fraction Factor"},
+    {0x00541324, VR_DS, "Dead Time Factor"},
+    {0x00541330, VR_US, "Image Index"},
+    {0x00541400, VR_CS, "Counts Included"},
+    {0x00541401, VR_CS, "Dead Time Correction Flag"},
+    {0x00603000, VR_SQ, "Histogram Sequence"},
+    {0x00603002, VR_US, "Histogram Number of Bins"},
+    {0x00603004, VR_SS, "Histogram First Bin Value"},
+    {0x00603006, VR_SS, "Histogram Last Bin Value"},
+    {0x00603008, VR_US, "Histogram Bin Width"},
+    {0x00603010, VR_LO, "Histogram Explanation"},
+    {0x00603020, VR_UL, "Histogram Data"},
+    {0x00620001, VR_CS, "Segmentation Type"},
+    {0x00620002, VR_SQ, "Segment Sequence"},
+    {0x00620003, VR_SQ, "Segmented Property Category Code Sequence"},
+    {0x00620004, VR_US, "Segment Number"},
+    {0x00620005, VR_LO, "Segment Label"},
+    {0x00620006, VR_ST, "Segment Description"},
+    {0x00620008, VR_CS, "Segment Algorithm Type"},
+    {0x00620009, VR_LO, "Segment Algorithm Name"},
+    {0x0062000A, VR_SQ, "Segment Identification Sequence"},
+    {0x0062000B, VR_US, "Referenced Segment Number"},
+    {0x0062000C, VR_US, "Recommended Display Grayscale Value"},
+    {0x0062000D, VR_US, "Recommended Display CIELab Value"},
+    {0x0062000E, VR_US, "Maximum Fractional Value"},
+    {0x0062000F, VR_SQ, "Segmented Property Type Code Sequence"},
+    {0x00620010, VR_CS, "Segmentation Fractional Type"},
+    {0x00620011, VR_SQ, "Segmented Property Type Modifier Code Sequence"},
+    {0x00620012, VR_SQ, "Used Segments Sequence"},
+    {0x00620020, VR_UT, "Tracking ID"},
+    {0x00620021, VR_UI, "Tracking UID"},
+    {0x00640002, VR_SQ, "Deformable Registration Sequence"},
+    {0x00640003, VR_UI, "Source Frame of Reference UID"},
+    {0x00640005, VR_SQ, "Deformable Registration Grid Sequence"},
+    {0x00640007, VR_UL, "Grid Dimensions"},
+    {0x00640008, VR_FD, "Grid Resolution"},
+    {0x00640009, VR_OF, "Vector Grid Data"},
+    {0x0064000F, VR_SQ, "Pre Deformation Matrix Registration Sequence"},
+    {0x00640010, VR_SQ, "Post Deformation Matrix Registration Sequence"},
+    {0x00660001, VR_UL, "Number of Surfaces"},
+    {0x00660002, VR_SQ, "Surface Sequence"},
+    {0x00660003, VR_UL, "Surface Number"},
+    {0x00660004, VR_LT, "Surface Comments"},
+    {0x00660009, VR_CS, "Surface Processing"},
+    {0x0066000A, VR_FL, "Surface Processing Ratio"},
+    {0x0066000B, VR_LO, "Surface Processing Description"},
+    {0x0066000C, VR_FL, "Recommended Presentation Opacity"},
+    {0x0066000D, VR_CS, "Recommended Presentation Type"},
+    {0x0066000E, VR_CS, "Finite Volume"},
+    {0x00660010, VR_CS, "Manifold"},
+    {0x00660011, VR_SQ, "Surface Points Sequence"},
+    {0x00660012, VR_SQ, "Surface Points Normals Sequence"},
+    {0x00660013, VR_SQ, "Surface Mesh Primitives Sequence"},
+    {0x00660015, VR_UL, "Number of Surface Points"},
+    {0x00660016, VR_OF, "Point Coordinates Data"},
+    {0x00660017, VR_FL, "Point Position Accuracy"},
+    {0x00660018, VR_FL, "Mean Point Distance"},
+    {0x00660019, VR_FL, "Maximum Point Distance"},
+    {0x0066001A, VR_FL, "Points Bounding Box Coordinates"},
+    {0x0066001B, VR_FL, "Axis of Rotation"},
+    {0x0066001C, VR_FL, "Center of Rotation"},
+    {0x0066001E, VR_UL, "Number of Vectors"},
+    {0x0066001F, VR_US, "Vector Dimensionality"},
+    {0x00660020, VR_FL, "Vector Accuracy"},
+    {0x00660021, VR_OF, "Vector Coordinate Data"},
+    {0x00660023, VR_OW, "Triangle Point Index List"},
+    {0x00660024, VR_OW, "Edge Point Index List"},
+    {0x00660025, VR_OW, "Vertex Point Index List"},
+    {0x00660026, VR_SQ, "Triangle Strip Sequence"},
+    {0x00660027, VR_SQ, "Triangle Fan Sequence"},
+    {0x00660028, VR_SQ, "Line Sequence"},
+    {0x00660029, VR_OW, "Primitive Point Index List"},
+    {0x0066002A, VR_UL, "Surface Count"},
+    {0x0066002B, VR_SQ, "Referenced Surface Sequence"},
+    {0x0066002C, VR_UL, "Referenced Surface Number"},
+    {0x0066002D, VR_SQ, "Segment Surface Generation Algorithm Identification Sequence"},
+    {0x0066002E, VR_SQ, "Segment Surface Source Instance Sequence"},
+    {0x0066002F, VR_SQ, "Algorithm Family Code Sequence"},
+    {0x00660030, VR_SQ, "Algorithm Name Code Sequence"},
+    {0x00660031, VR_LO, "Algorithm Version"},
+    {0x00660032, VR_LT, "Algorithm Parameters"},
+    {0x00660034, VR_SQ, "Facet Sequence"},
+    {0x00660035, VR_SQ, "Surface Processing Algorithm Identification Sequence"},
+    {0x00660036, VR_LO, "Algorithm Name"},
+    {0x00660037, VR_FL, "Recommended Point Radius"},
+    {0x00660038, VR_FL, "Recommended Line Thickness"},
+    {0x00660040, VR_OL, "Long Primitive Point Index List"},
+    {0x00660041, VR_OL, "Long Triangle Point Index List"},
+    {0x00660042, VR_OL, "Long Edge Point Index List"},
+    {0x00660043, VR_OL, "Long Vertex Point Index List"},
+    {0x00660101, VR_SQ, "Track Set Sequence"},
+    {0x00660102, VR_SQ, "Track Sequence"},
+    {0x00660103, VR_OW, "Recommended Display CIELab Value List"},
+    {0x00660104, VR_SQ, "Tracking Algorithm Identification Sequence"},
+    {0x00660105, VR_UL, "Track Set Number"},
+    {0x00660106, VR_LO, "Track Set Label"},
+    {0x00660107, VR_UT, "Track Set Description"},
+    {0x00660108, VR_SQ, "Track Set Anatomical Type Code Sequence"},
+    {0x00660121, VR_SQ, "Measurements Sequence"},
+    {0x00660124, VR_SQ, "Track Set Statistics Sequence"},
+    {0x00660125, VR_OF, "Floating Point Values"},
+    {0x00660129, VR_OL, "Track Point Index List"},
+    {0x00660130, VR_SQ, "Track Statistics Sequence"},
+    {0x00660132, VR_SQ, "Measurement Values Sequence"},
+    {0x00660133, VR_SQ, "Diffusion Acquisition Code Sequence"},
+    {0x00660134, VR_SQ, "Diffusion Model Code Sequence"},
+    {0x00686210, VR_LO, "Implant Size"},
+    {0x00686221, VR_LO, "Implant Template Version"},
+    {0x00686222, VR_SQ, "Replaced Implant Template Sequence"},
+    {0x00686223, VR_CS, "Implant Type"},
+    {0x00686224, VR_SQ, "Derivation Implant Template Sequence"},
+    {0x00686225, VR_SQ, "Original Implant Template Sequence"},
+    {0x00686226, VR_DT, "Effective DateTime"},
+    {0x00686230, VR_SQ, "Implant Target Anatomy Sequence"},
+    {0x00686260, VR_SQ, "Information From Manufacturer Sequence"},
+    {0x00686265, VR_SQ, "Notification From Manufacturer Sequence"},
+    {0x00686270, VR_DT, "Information Issue DateTime"},
+    {0x00686280, VR_ST, "Information Summary"},
+    {0x006862A0, VR_SQ, "Implant Regulatory Disapproval Code Sequence"},
+    {0x006862A5, VR_FD, "Overall Template Spatial Tolerance"},
+    {0x006862C0, VR_SQ, "HPGL Document Sequence"},
+    {0x006862D0, VR_US, "HPGL Document ID"},
+    {0x006862D5, VR_LO, "HPGL Document Label"},
+    {0x006862E0, VR_SQ, "View Orientation Code Sequence"},
+    {0x006862F0, VR_FD, "View Orientation Modifier"},
+    {0x006862F2, VR_FD, "HPGL Document Scaling"},
+    {0x00686300, VR_OB, "HPGL Document"},
+    {0x00686310, VR_US, "HPGL Contour Pen Number"},
+    {0x00686320, VR_SQ, "HPGL Pen Sequence"},
+    {0x00686330, VR_US, "HPGL Pen Number"},
+    {0x00686340, VR_LO, "HPGL Pen Label"},
+    {0x00686345, VR_ST, "HPGL Pen Description"},
+    {0x00686346, VR_FD, "Recommended Rotation Point"},
+    {0x00686347, VR_FD, "Bounding Rectangle"},
+    {0x00686350, VR_US, "Implant Template 3D Model Surface Number"},
+    {0x00686360, VR_SQ, "Surface Model Description Sequence"},
+    {0x00686380, VR_LO, "Surface Model Label"},
+    {0x00686390, VR_FD, "Surface Model Scaling Factor"},
+    {0x006863A0, VR_SQ, "Materials Code Sequence"},
+    {0x006863A4, VR_SQ, "Coating Materials Code Sequence"},
+    {0x006863A8, VR_SQ, "Implant Type Code Sequence"},
+    {0x006863AC, VR_SQ, "Fixation Method Code Sequence"},
+    {0x006863B0, VR_SQ, "Mating Feature Sets Sequence"},
+    {0x006863C0, VR_US, "Mating Feature Set ID"},
+    {0x006863D0, VR_LO, "Mating Feature Set Label"},
+    {0x006863E0, VR_SQ, "Mating Feature Sequence"},
+    {0x006863F0, VR_US, "Mating Feature ID"},
+    {0x00686400, VR_SQ, "Mating Feature Degree of Freedom Sequence"},
+    {0x00686410, VR_US, "Degree of Freedom ID"},
+    {0x00686420, VR_CS, "Degree of Freedom Type"},
+    {0x00686430, VR_SQ, "2D Mating Feature Coordinates Sequence"},
+    {0x00686440, VR_US, "Referenced HPGL Document ID"},
+    {0x00686450, VR_FD, "2D Mating Point"},
+    {0x00686460, VR_FD, "2D Mating Axes"},
+    {0x00686470, VR_SQ, "2D Degree of Freedom Sequence"},
+    {0x00686490, VR_FD, "3D Degree of Freedom Axis"},
+    {0x006864A0, VR_FD, "Range of Freedom"},
+    {0x006864C0, VR_FD, "3D Mating Point"},
+    {0x006864D0, VR_FD, "3D Mating Axes"},
+    {0x006864F0, VR_FD, "2D Degree of Freedom Axis"},
+    {0x00686500, VR_SQ, "Planning Landmark Point Sequence"},
+    {0x00686510, VR_SQ, "Planning Landmark Line Sequence"},
+    {0x00686520, VR_SQ, "Planning Landmark Plane Sequence"},
+    {0x00686530, VR_US, "Planning Landmark ID"},
+    {0x00686540, VR_LO, "Planning Landmark Description"},
+    {0x00686545, VR_SQ, "Planning Landmark Identification Code Sequence"},
+    {0x00686550, VR_SQ, "2D Point Coordinates Sequence"},
+    {0x00686560, VR_FD, "2D Point Coordinates"},
+    {0x00686590, VR_FD, "3D Point Coordinates"},
+    {0x006865A0, VR_SQ, "2D Line Coordinates Sequence"},
+    {0x006865B0, VR_FD, "2D Line Coordinates"},
+    {0x006865D0, VR_FD, "3D Line Coordinates"},
+    {0x006865E0, VR_SQ, "2D Plane Coordinates Sequence"},
+    {0x006865F0, VR_FD, "2D Plane Intersection"},
+    {0x00686610, VR_FD, "3D Plane Origin"},
+    {0x00686620, VR_FD, "3D Plane Normal"},
+    {0x00700001, VR_SQ, "Graphic Annotation Sequence"},
+    {0x00700002, VR_CS, "Graphic Layer"},
+    {0x00700003, VR_CS, "Bounding Box Annotation Units"},
+    {0x00700004, VR_CS, "Anchor Point Annotation Units"},
+    {0x00700005, VR_CS, "Graphic Annotation Units"},
+    {0x00700006, VR_ST, "Unformatted Text Value"},
+    {0x00700008, VR_SQ, "Text Object Sequence"},
+    {0x00700009, VR_SQ, "Graphic Object Sequence"},
+    {0x00700010, VR_FL, "Bounding Box Top Left Hand Corner"},
+    {0x00700011, VR_FL, "Bounding Box Bottom Right Hand Corner"},
+    {0x00700012, VR_CS, "Bounding Box Text Horizontal Justification"},
+    {0x00700014, VR_FL, "Anchor Point"},
+    {0x00700015, VR_CS, "Anchor Point Visibility"},
+    {0x00700020, VR_US, "Graphic Dimensions"},
+    {0x00700021, VR_US, "Number of Graphic Points"},
+    {0x00700022, VR_FL, "Graphic Data"},
+    {0x00700023, VR_CS, "Graphic Type"},
+    {0x00700024, VR_CS, "Graphic Filled"},
+    {0x00700040, VR_IS, "Image Rotation (Retired)"},
+    {0x00700041, VR_CS, "Image Horizontal Flip"},
+    {0x00700042, VR_US, "Image Rotation"},
+    {0x00700050, VR_US, "Displayed Area Top Left Hand Corner (Trial)"},
+    {0x00700051, VR_US, "Displayed Area Bottom Right Hand Corner (Trial)"},
+    {0x00700052, VR_SL, "Displayed Area Top Left Hand Corner"},
+    {0x00700053, VR_SL, "Displayed Area Bottom Right Hand Corner"},
+    {0x0070005A, VR_SQ, "Displayed Area Selection Sequence"},
+    {0x00700060, VR_SQ, "Graphic Layer Sequence"},
+    {0x00700062, VR_IS, "Graphic Layer Order"},
+    {0x00700066, VR_US, "Graphic Layer Recommended Display Grayscale Value"},
+    {0x00700067, VR_US, "Graphic Layer Recommended Display RGB Value"},
+    {0x00700068, VR_LO, "Graphic Layer Description"},
+    {0x00700080, VR_CS, "Content Label"},
+    {0x00700081, VR_LO, "Content Description"},
+    {0x00700082, VR_DA, "Presentation Creation Date"},
+    {0x00700083, VR_TM, "Presentation Creation Time"},
+    {0x00700084, VR_PN, "Content Creator's Name"},
+    {0x00700086, VR_SQ, "Content Creator's Identification Code Sequence"},
+    {0x00700087, VR_SQ, "Alternate Content Description Sequence"},
+    {0x00700100, VR_CS, "Presentation Size Mode"},
+    {0x00700101, VR_DS, "Presentation Pixel Spacing"},
+    {0x00700102, VR_IS, "Presentation Pixel Aspect Ratio"},
+    {0x00700103, VR_FL, "Presentation Pixel Magnification Ratio"},
+    {0x00700207, VR_LO, "Graphic Group Label"},
+    {0x00700208, VR_ST, "Graphic Group Description"},
+    {0x00700209, VR_SQ, "Compound Graphic Sequence"},
+    {0x00700226, VR_UL, "Compound Graphic Instance ID"},
+    {0x00700227, VR_LO, "Font Name"},
+    {0x00700228, VR_CS, "Font Name Type"},
+    {0x00700229, VR_LO, "CSS Font Name"},
+    {0x00700230, VR_FD, "Rotation Angle"},
+    {0x00700231, VR_SQ, "Text Style Sequence"},
+    {0x00700232, VR_SQ, "Line Style Sequence"},
+    {0x00700233, VR_SQ, "Fill Style Sequence"},
+    {0x00700234, VR_SQ, "Graphic Group Sequence"},
+    {0x00700241, VR_US, "Text Color CIELab Value"},
+    {0x00700242, VR_CS, "Horizontal Alignment"},
+    {0x00700243, VR_CS, "Vertical Alignment"},
+    {0x00700244, VR_CS, "Shadow Style"},
+    {0x00700245, VR_FL, "Shadow Offset X"},
+    {0x00700246, VR_FL, "Shadow Offset Y"},
+    {0x00700247, VR_US, "Shadow Color CIELab Value"},
+    {0x00700248, VR_CS, "Underlined"},
+    {0x00700249, VR_CS, "Bold"},
+    {0x00700250, VR_CS, "Italic"},
+    {0x00700251, VR_US, "Pattern On Color CIELab Value"},
+    {0x00700252, VR_US, "Pattern Off Color CIELab Value"},
+    {0x00700253, VR_FL, "Line Thickness"},
+    {0x00700254, VR_CS, "Line Dashing Style"},
+    {0x00700255, VR_UL, "Line Pattern"},
+    {0x00700256, VR_OB, "Fill Pattern"},
+    {0x00700257, VR_CS, "Fill Mode"},
+    {0x00700258, VR_FL, "Shadow Opacity"},
+    {0x00700261, VR_FL, "Gap Length"},
+    {0x00700262, VR_FL, "Diameter of Visibility"},
+    {0x00700273, VR_FL, "Rotation Point"},
+    {0x00700274, VR_CS, "Tick Alignment"},
+    {0x00700278, VR_CS, "Show Tick Label"},
+    {0x00700279, VR_CS, "Tick Label Alignment"},
+    {0x00700282, VR_CS, "Compound Graphic Units"},
+    {0x00700284, VR_FL, "Pattern On Opacity"},
+    {0x00700285, VR_FL, "Pattern Off Opacity"},
+    {0x00700287, VR_SQ, "Major Ticks Sequence"},
+    {0x00700288, VR_FL, "Tick Position"},
+    {0x00700289, VR_SH, "Tick Label"},
+    {0x00700294, VR_CS, "Compound Graphic Type"},
+    {0x00700295, VR_UL, "Graphic Group ID"},
+    {0x00700306, VR_CS, "Shape Type"},
+    {0x00700308, VR_SQ, "Registration Sequence"},
+    {0x00700309, VR_SQ, "Matrix Registration Sequence"},
+    {0x0070030A, VR_SQ, "Matrix Sequence"},
+    {0x0070030B, VR_FD, "Frame of Reference to Displayed Coordinate System Transformation Matrix"},
+    {0x0070030C, VR_CS, "Frame of Reference Transformation Matrix Type"},
+    {0x0070030D, VR_SQ, "Registration Type Code Sequence"},
+    {0x0070030F, VR_ST, "Fiducial Description"},
+    {0x00700310, VR_SH, "Fiducial Identifier"},
+    {0x00700311, VR_SQ, "Fiducial Identifier Code Sequence"},
+    {0x00700312, VR_FD, "Contour Uncertainty Radius"},
+    {0x00700314, VR_SQ, "Used Fiducials Sequence"},
+    {0x00700318, VR_SQ, "Graphic Coordinates Data Sequence"},
+    {0x0070031A, VR_UI, "Fiducial UID"},
+    {0x0070031C, VR_SQ, "Fiducial Set Sequence"},
+    {0x0070031E, VR_SQ, "Fiducial Sequence"},
+    {0x00700401, VR_US, "Graphic Layer Recommended Display CIELab Value"},
+    {0x00700402, VR_SQ, "Blending Sequence"},
+    {0x00700403, VR_FL, "Relative Opacity"},
+    {0x00700404, VR_SQ, "Referenced Spatial Registration Sequence"},
+    {0x00700405, VR_CS, "Blending Position"},
+    {0x00701101, VR_UI, "Presentation Display Collection UID"},
+    {0x00701102, VR_UI, "Presentation Sequence Collection UID"},
+    {0x00701103, VR_US, "Presentation Sequence Position Index"},
+    {0x00701104, VR_SQ, "Rendered Image Reference Sequence"},
+    {0x00701201, VR_SQ, "Volumetric Presentation State Input Sequence"},
+    {0x00701202, VR_CS, "Presentation Input Type"},
+    {0x00701203, VR_US, "Input Sequence Position Index"},
+    {0x00701204, VR_CS, "Crop"},
+    {0x00701205, VR_US, "Cropping Specification Index"},
+    {0x00701206, VR_CS, "Compositing Method"},
+    {0x00701207, VR_US, "Volumetric Presentation Input Number"},
+    {0x00701208, VR_CS, "Image Volume Geometry"},
+    {0x00701301, VR_SQ, "Volume Cropping Sequence"},
+    {0x00701302, VR_CS, "Volume Cropping Method"},
+    {0x00701303, VR_FD, "Bounding Box Crop"},
+    {0x00701304, VR_SQ, "Oblique Cropping Plane Sequence"},
+    {0x00701305, VR_FD, "Plane"},
+    {0x00701306, VR_FD, "Plane Normal"},
+    {0x00701309, VR_US, "Cropping Specification Number"},
+    {0x00701501, VR_CS, "Multi-Planar Reconstruction Style"},
+    {0x00701502, VR_CS, "MPR Thickness Type"},
+    {0x00701503, VR_FD, "MPR Slab Thickness"},
+    {0x00701505, VR_FD, "MPR Top Left Hand Corner"},
+    {0x00701507, VR_FD, "MPR View Width Direction"},
+    {0x00701508, VR_FD, "MPR View Width"},
+    {0x0070150C, VR_UL, "Number of Volumetric Curve Points"},
+    {0x0070150D, VR_OD, "Volumetric Curve Points"},
+    {0x00701511, VR_FD, "MPR View Height Direction"},
+    {0x00701512, VR_FD, "MPR View Height"},
+    {0x00701801, VR_SQ, "Presentation State Classification Component Sequence"},
+    {0x00701802, VR_CS, "Component Type"},
+    {0x00701803, VR_SQ, "Component Input Sequence"},
+    {0x00701804, VR_US, "Volumetric Presentation Input Index"},
+    {0x00701805, VR_SQ, "Presentation State Compositor Component Sequence"},
+    {0x00701806, VR_SQ, "Weighting Transfer Function Sequence"},
+    {0x00701807, VR_US, "Weighting Lookup Table Descriptor"},
+    {0x00701808, VR_OB, "Weighting Lookup Table Data"},
+    {0x00701901, VR_SQ, "Volumetric Annotation Sequence"},
+    {0x00701903, VR_SQ, "Referenced Structured Context Sequence"},
+    {0x00701904, VR_UI, "Referenced Content Item"},
+    {0x00701905, VR_SQ, "Volumetric Presentation Input Annotation Sequence"},
+    {0x00701907, VR_CS, "Annotation Clipping"},
+    {0x00701A01, VR_CS, "Presentation Animation Style"},
+    {0x00701A03, VR_FD, "Recommended Animation Rate"},
+    {0x00701A04, VR_SQ, "Animation Curve Sequence"},
+    {0x00701A05, VR_FD, "Animation Step Size"},
+    {0x00720002, VR_SH, "Hanging Protocol Name"},
+    {0x00720004, VR_LO, "Hanging Protocol Description"},
+    {0x00720006, VR_CS, "Hanging Protocol Level"},
+    {0x00720008, VR_LO, "Hanging Protocol Creator"},
+    {0x0072000A, VR_DT, "Hanging Protocol Creation DateTime"},
+    {0x0072000C, VR_SQ, "Hanging Protocol Definition Sequence"},
+    {0x0072000E, VR_SQ, "Hanging Protocol User Identification Code Sequence"},
+    {0x00720010, VR_LO, "Hanging Protocol User Group Name"},
+    {0x00720012, VR_SQ, "Source Hanging Protocol Sequence"},
+    {0x00720014, VR_US, "Number of Priors Referenced"},
+    {0x00720020, VR_SQ, "Image Sets Sequence"},
+    {0x00720022, VR_SQ, "Image Set Selector Sequence"},
+    {0x00720024, VR_CS, "Image Set Selector Usage Flag"},
+    {0x00720026, VR_AT, "Selector Attribute"},
+    {0x00720028, VR_US, "Selector Value Number"},
+    {0x00720030, VR_SQ, "Time Based Image Sets Sequence"},
+    {0x00720032, VR_US, "Image Set Number"},
+    {0x00720034, VR_CS, "Image Set Selector Category"},
+    {0x00720038, VR_US, "Relative Time"},
+    {0x0072003A, VR_CS, "Relative Time Units"},
+    {0x0072003C, VR_SS, "Abstract Prior Value"},
+    {0x0072003E, VR_SQ, "Abstract Prior Code Sequence"},
+    {0x00720040, VR_LO, "Image Set Label"},
+    {0x00720050, VR_CS, "Selector Attribute VR"},
+    {0x00720052, VR_AT, "Selector Sequence Pointer"},
+    {0x00720054, VR_LO, "Selector Sequence Pointer Private Creator"},
+    {0x00720056, VR_LO, "Selector Attribute Private Creator"},
+    {0x0072005E, VR_AE, "Selector AE Value"},
+    {0x0072005F, VR_AS, "Selector AS Value"},
+    {0x00720060, VR_AT, "Selector AT Value"},
+    {0x00720061, VR_DA, "Selector DA Value"},
+    {0x00720062, VR_CS, "Selector CS Value"},
+    {0x00720063, VR_DT, "Selector DT Value"},
+    {0x00720064, VR_IS, "Selector IS Value"},
+    {0x00720065, VR_OB, "Selector OB Value"},
+    {0x00720066, VR_LO, "Selector LO Value"},
+    {0x00720067, VR_OF, "Selector OF Value"},
+    {0x00720068, VR_LT, "Selector LT Value"},
+    {0x00720069, VR_OW, "Selector OW Value"},
+    {0x0072006A, VR_PN, "Selector PN Value"},
+    {0x0072006B, VR_TM, "Selector TM Value"},
+    {0x0072006C, VR_SH, "Selector SH Value"},
+    {0x0072006D, VR_UN, "Selector UN Value"},
+    {0x0072006E, VR_ST, "Selector ST Value"},
+    {0x0072006F, VR_UC, "Selector UC Value"},
+    {0x00720070, VR_UT, "Selector UT Value"},
+    {0x00720071, VR_UR, "Selector UR Value"},
+    {0x00720072, VR_DS, "Selector DS Value"},
+    {0x00720073, VR_OD, "Selector OD Value"},
+    {0x00720074, VR_FD, "Selector FD Value"},
+    {0x00720075, VR_OL, "Selector OL Value"},
+    {0x00720076, VR_FL, "Selector FL Value"},
+    {0x00720078, VR_UL, "Selector UL Value"},
+    {0x0072007A, VR_US, "Selector US Value"},
+    {0x0072007C, VR_SL, "Selector SL Value"},
+    {0x0072007E, VR_SS, "Selector SS Value"},
+    {0x0072007F, VR_UI, "Selector UI Value"},
+    {0x00720080, VR_SQ, "Selector Code Sequence Value"},
+    {0x00720100, VR_US, "Number of Screens"},
+    {0x00720102, VR_SQ, "Nominal Screen Definition Sequence"},
+    {0x00720104, VR_US, "Number of Vertical Pixels"},
+    {0x00720106, VR_US, "Number of Horizontal Pixels"},
+    {0x00720108, VR_FD, "Display Environment Spatial Position"},
+    {0x0072010A, VR_US, "Screen Minimum Grayscale Bit Depth"},
+    {0x0072010C, VR_US, "Screen Minimum Color Bit Depth"},
+    {0x0072010E, VR_US, "Application Maximum Repaint Time"},
+    {0x00720200, VR_SQ, "Display Sets Sequence"},
+    {0x00720202, VR_US, "Display Set Number"},
+    {0x00720203, VR_LO, "Display Set Label"},
+    {0x00720204, VR_US, "Display Set Presentation Group"},
+    {0x00720206, VR_LO, "Display Set Presentation Group Description"},
+    {0x00720208, VR_CS, "Partial Data Display Handling"},
+    {0x00720210, VR_SQ, "Synchronized Scrolling Sequence"},
+    {0x00720212, VR_US, "Display Set Scrolling Group"},
+    {0x00720214, VR_SQ, "Navigation Indicator Sequence"},
+    {0x00720216, VR_US, "Navigation Display Set"},
+    {0x00720218, VR_US, "Reference Display Sets"},
+    {0x00720300, VR_SQ, "Image Boxes Sequence"},
+    {0x00720302, VR_US, "Image Box Number"},
+    {0x00720304, VR_CS, "Image Box Layout Type"},
+    {0x00720306, VR_US, "Image Box Tile Horizontal Dimension"},
+    {0x00720308, VR_US, "Image Box Tile Vertical Dimension"},
+    {0x00720310, VR_CS, "Image Box Scroll Direction"},
+    {0x00720312, VR_CS, "Image Box Small Scroll Type"},
+    {0x00720314, VR_US, "Image Box Small Scroll Amount"},
+    {0x00720316, VR_CS, "Image Box Large Scroll Type"},
+    {0x00720318, VR_US, "Image Box Large Scroll Amount"},
+    {0x00720320, VR_US, "Image Box Overlap Priority"},
+    {0x00720330, VR_FD, "Cine Relative to Real-Time"},
+    {0x00720400, VR_SQ, "Filter Operations Sequence"},
+    {0x00720402, VR_CS, "Filter-by Category"},
+    {0x00720404, VR_CS, "Filter-by Attribute Presence"},
+    {0x00720406, VR_CS, "Filter-by Operator"},
+    {0x00720420, VR_US, "Structured Display Background CIELab Value"},
+    {0x00720421, VR_US, "Empty Image Box CIELab Value"},
+    {0x00720422, VR_SQ, "Structured Display Image Box Sequence"},
+    {0x00720424, VR_SQ, "Structured Display Text Box Sequence"},
+    {0x00720427, VR_SQ, "Referenced First Frame Sequence"},
+    {0x00720430, VR_SQ, "Image Box Synchronization Sequence"},
+    {0x00720432, VR_US, "Synchronized Image Box List"},
+    {0x00720434, VR_CS, "Type of Synchronization"},
+    {0x00720500, VR_CS, "Blending Operation Type"},
+    {0x00720510, VR_CS, "Reformatting Operation Type"},
+    {0x00720512, VR_FD, "Reformatting Thickness"},
+    {0x00720514, VR_FD, "Reformatting Interval"},
+    {0x00720516, VR_CS, "Reformatting Operation Initial View Direction"},
+    {0x00720520, VR_CS, "3D Rendering Type"},
+    {0x00720600, VR_SQ, "Sorting Operations Sequence"},
+    {0x00720602, VR_CS, "Sort-by Category"},
+    {0x00720604, VR_CS, "Sorting Direction"},
+    {0x00720700, VR_CS, "Display Set Patient Orientation"},
+    {0x00720702, VR_CS, "VOI Type"},
+    {0x00720704, VR_CS, "Pseudo-Color Type"},
+    {0x00720705, VR_SQ, "Pseudo-Color Palette Instance Reference Sequence"},
+    {0x00720706, VR_CS, "Show Grayscale Inverted"},
+    {0x00720710, VR_CS, "Show Image True Size Flag"},
+    {0x00720712, VR_CS, "Show Graphic Annotation Flag"},
+    {0x00720714, VR_CS, "Show Patient Demographics Flag"},
+    {0x00720716, VR_CS, "Show Acquisition Techniques Flag"},
+    {0x00720717, VR_CS, "Display Set Horizontal Justification"},
+    {0x00720718, VR_CS, "Display Set Vertical Justification"},
+    {0x00740120, VR_FD, "Continuation Start Meterset"},
+    {0x00740121, VR_FD, "Continuation End Meterset"},
+    {0x00741000, VR_CS, "Procedure Step State"},
+    {0x00741002, VR_SQ, "Procedure Step Progress Information Sequence"},
+    {0x00741004, VR_DS, "Procedure Step Progress"},
+    {0x00741006, VR_ST, "Procedure Step Progress Description"},
+    {0x00741008, VR_SQ, "Procedure Step Communications URI Sequence"},
+    {0x0074100A, VR_UR, "Contact URI"},
+    {0x0074100C, VR_LO, "Contact Display Name"},
+    {0x0074100E, VR_SQ, "Procedure Step Discontinuation Reason Code Sequence"},
+    {0x00741020, VR_SQ, "Beam Task Sequence"},
+    {0x00741022, VR_CS, "Beam Task Type"},
+    {0x00741024, VR_IS, "Beam Order Index (Trial)"},
+    {0x00741025, VR_CS, "Autosequence Flag"},
+    {0x00741026, VR_FD, "Table Top Vertical Adjusted Position"},
+    {0x00741027, VR_FD, "Table Top Longitudinal Adjusted Position"},
+    {0x00741028, VR_FD, "Table Top Lateral Adjusted Position"},
+    {0x0074102A, VR_FD, "Patient Support Adjusted Angle"},
+    {0x0074102B, VR_FD, "Table Top Eccentric Adjusted Angle"},
+    {0x0074102C, VR_FD, "Table Top Pitch Adjusted Angle"},
+    {0x0074102D, VR_FD, "Table Top Roll Adjusted Angle"},
+    {0x00741030, VR_SQ, "Delivery Verification Image Sequence"},
+    {0x00741032, VR_CS, "Verification Image Timing"},
+    {0x00741034, VR_CS, "Double Exposure Flag"},
+    {0x00741036, VR_CS, "Double Exposure Ordering"},
+    {0x00741038, VR_DS, "Double Exposure Meterset (Trial)"},
+    {0x0074103A, VR_DS, "Double Exposure Field Delta (Trial)"},
+    {0x00741040, VR_SQ, "Related Reference RT Image Sequence"},
+    {0x00741042, VR_SQ, "General Machine Verification Sequence"},
+    {0x00741044, VR_SQ, "Conventional Machine Verification Sequence"},
+    {0x00741046, VR_SQ, "Ion Machine Verification Sequence"},
+    {0x00741048, VR_SQ, "Failed Attributes Sequence"},
+    {0x0074104A, VR_SQ, "Overridden Attributes Sequence"},
+    {0x0074104C, VR_SQ, "Conventional Control Point Verification Sequence"},
+    {0x0074104E, VR_SQ, "Ion Control Point Verification Sequence"},
+    {0x00741050, VR_SQ, "Attribute Occurrence Sequence"},
+    {0x00741052, VR_AT, "Attribute Occurrence Pointer"},
+    {0x00741054, VR_UL, "Attribute Item Selector"},
+    {0x00741056, VR_LO, "Attribute Occurrence Private Creator"},
+    {0x00741057, VR_IS, "Selector Sequence Pointer Items"},
+    {0x00741200, VR_CS, "Scheduled Procedure Step Priority"},
+    {0x00741202, VR_LO, "Worklist Label"},
+    {0x00741204, VR_LO, "Procedure Step Label"},
+    {0x00741210, VR_SQ, "Scheduled Processing Parameters Sequence"},
+    {0x00741212, VR_SQ, "Performed Processing Parameters Sequence"},
+    {0x00741216, VR_SQ, "Unified Procedure Step Performed Procedure Sequence"},
+    {0x00741220, VR_SQ, "Related Procedure Step Sequence"},
+    {0x00741222, VR_LO, "Procedure Step Relationship Type"},
+    {0x00741224, VR_SQ, "Replaced Procedure Step Sequence"},
+    {0x00741230, VR_LO, "Deletion Lock"},
+    {0x00741234, VR_AE, "Receiving AE"},
+    {0x00741236, VR_AE, "Requesting AE"},
+    {0x00741238, VR_LT, "Reason for Cancellation"},
+    {0x00741242, VR_CS, "SCP Status"},
+    {0x00741244, VR_CS, "Subscription List Status"},
+    {0x00741246, VR_CS, "Unified Procedure Step List Status"},
+    {0x00741324, VR_UL, "Beam Order Index"},
+    {0x00741338, VR_FD, "Double Exposure Meterset"},
+    {0x0074133A, VR_FD, "Double Exposure Field Delta"},
+    {0x00741401, VR_SQ, "Brachy Task Sequence"},
+    {0x00741402, VR_DS, "Continuation Start Total Reference Air Kerma"},
+    {0x00741403, VR_DS, "Continuation End Total Reference Air Kerma"},
+    {0x00741404, VR_IS, "Continuation Pulse Number"},
+    {0x00741405, VR_SQ, "Channel Delivery Order Sequence"},
+    {0x00741406, VR_IS, "Referenced Channel Number"},
+    {0x00741407, VR_DS, "Start Cumulative Time Weight"},
+    {0x00741408, VR_DS, "End Cumulative Time Weight"},
+    {0x00741409, VR_SQ, "Omitted Channel Sequence"},
+    {0x0074140A, VR_CS, "Reason for Channel Omission"},
+    {0x0074140B, VR_LO, "Reason for Channel Omission Description"},
+    {0x0074140C, VR_IS, "Channel Delivery Order Index"},
+    {0x0074140D, VR_SQ, "Channel Delivery Continuation Sequence"},
+    {0x0074140E, VR_SQ, "Omitted Application Setup Sequence"},
+    {0x00760001, VR_LO, "Implant Assembly Template Name"},
+    {0x00760003, VR_LO, "Implant Assembly Template Issuer"},
+    {0x00760006, VR_LO, "Implant Assembly Template Version"},
+    {0x00760008, VR_SQ, "Replaced Implant Assembly Template Sequence"},
+    {0x0076000A, VR_CS, "Implant Assembly Template Type"},
+    {0x0076000C, VR_SQ, "Original Implant Assembly Template Sequence"},
+    {0x0076000E, VR_SQ, "Derivation Implant Assembly Template Sequence"},
+    {0x00760010, VR_SQ, "Implant Assembly Template Target Anatomy Sequence"},
+    {0x00760020, VR_SQ, "Procedure Type Code Sequence"},
+    {0x00760030, VR_LO, "Surgical Technique"},
+    {0x00760032, VR_SQ, "Component Types Sequence"},
+    {0x00760034, VR_CS, "Component Type Code Sequence"},
+    {0x00760036, VR_CS, "Exclusive Component Type"},
+    {0x00760038, VR_CS, "Mandatory Component Type"},
+    {0x00760040, VR_SQ, "Component Sequence"},
+    {0x00760055, VR_US, "Component ID"},
+    {0x00760060, VR_SQ, "Component Assembly Sequence"},
+    {0x00760070, VR_US, "Component 1 Referenced ID"},
+    {0x00760080, VR_US, "Component 1 Referenced Mating Feature Set ID"},
+    {0x00760090, VR_US, "Component 1 Referenced Mating Feature ID"},
+    {0x007600A0, VR_US, "Component 2 Referenced ID"},
+    {0x007600B0, VR_US, "Component 2 Referenced Mating Feature Set ID"},
+    {0x007600C0, VR_US, "Component 2 Referenced Mating Feature ID"},
+    {0x00780001, VR_LO, "Implant Template Group Name"},
+    {0x00780010, VR_ST, "Implant Template Group Description"},
+    {0x00780020, VR_LO, "Implant Template Group Issuer"},
+    {0x00780024, VR_LO, "Implant Template Group Version"},
+    {0x00780026, VR_SQ, "Replaced Implant Template Group Sequence"},
+    {0x00780028, VR_SQ, "Implant Template Group Target Anatomy Sequence"},
+    {0x0078002A, VR_SQ, "Implant Template Group Members Sequence"},
+    {0x0078002E, VR_US, "Implant Template Group Member ID"},
+    {0x00780050, VR_FD, "3D Implant Template Group Member Matching Point"},
+    {0x00780060, VR_FD, "3D Implant Template Group Member Matching Axes"},
+    {0x00780070, VR_SQ, "Implant Template Group Member Matching 2D Coordinates Sequence"},
+    {0x00780090, VR_FD, "2D Implant Template Group Member Matching Point"},
+    {0x007800A0, VR_FD, "2D Implant Template Group Member Matching Axes"},
+    {0x007800B0, VR_SQ, "Implant Template Group Variation Dimension Sequence"},
+    {0x007800B2, VR_LO, "Implant Template Group Variation Dimension Name"},
+    {0x007800B4, VR_SQ, "Implant Template Group Variation Dimension Rank Sequence"},
+    {0x007800B6, VR_US, "Referenced Implant Template Group Member ID"},
+    {0x007800B8, VR_US, "Implant Template Group Variation Dimension Rank"},
+    {0x00800001, VR_SQ, "Surface Scan Acquisition Type Code Sequence"},
+    {0x00800002, VR_SQ, "Surface Scan Mode Code Sequence"},
+    {0x00800003, VR_SQ, "Registration Method Code Sequence"},
+    {0x00800004, VR_FD, "Shot Duration Time"},
+    {0x00800005, VR_FD, "Shot Offset Time"},
+    {0x00800006, VR_US, "Surface Point Presentation Value Data"},
+    {0x00800007, VR_US, "Surface Point Color CIELab Value Data"},
+    {0x00800008, VR_SQ, "UV Mapping Sequence"},
+    {0x00800009, VR_SH, "Texture Label"},
+    {0x00800010, VR_OF, "U Value Data"},
+    {0x00800011, VR_OF, "V Value Data"},
+    {0x00800012, VR_SQ, "Referenced Texture Sequence"},
+    {0x00800013, VR_SQ, "Referenced Surface Data Sequence"},
+    {0x00820001, VR_CS, "Assessment Summary"},
+    {0x00820003, VR_UT, "Assessment Summary Description"},
+    {0x00820004, VR_SQ, "Assessed SOP Instance Sequence"},
+    {0x00820005, VR_SQ, "Referenced Comparison SOP Instance Sequence"},
+    {0x00820006, VR_UL, "Number of Assessment Observations"},
+    {0x00820007, VR_SQ, "Assessment Observations Sequence"},
+    {0x00820008, VR_CS, "Observation Significance"},
+    {0x0082000A, VR_UT, "Observation Description"},
+    {0x0082000C, VR_SQ, "Structured Constraint Observation Sequence"},
+    {0x00820010, VR_SQ, "Assessed Attribute Value Sequence"},
+    {0x00820016, VR_LO, "Assessment Set ID"},
+    {0x00820017, VR_SQ, "Assessment Requester Sequence"},
+    {0x00820018, VR_LO, "Selector Attribute Name"},
+    {0x00820019, VR_LO, "Selector Attribute Keyword"},
+    {0x00820021, VR_SQ, "Assessment Type Code Sequence"},
+    {0x00820022, VR_SQ, "Observation Basis Code Sequence"},
+    {0x00820023, VR_LO, "Assessment Label"},
+    {0x00820032, VR_CS, "Constraint Type"},
+    {0x00820033, VR_UT, "Specification Selection Guidance"},
+    {0x00820034, VR_SQ, "Constraint Value Sequence"},
+    {0x00820035, VR_SQ, "Recommended Default Value Sequence"},
+    {0x00820036, VR_CS, "Constraint Violation Significance"},
+    {0x00820037, VR_UT, "Constraint Violation Condition"},
+    {0x00880130, VR_SH, "Storage Media File-set ID"},
+    {0x00880140, VR_UI, "Storage Media File-set UID"},
+    {0x00880200, VR_SQ, "Icon Image Sequence"},
+    {0x00880904, VR_LO, "Topic Title"},
+    {0x00880906, VR_ST, "Topic Subject"},
+    {0x00880910, VR_LO, "Topic Author"},
+    {0x00880912, VR_LO, "Topic Keywords"},
+    {0x01000410, VR_CS, "SOP Instance Status"},
+    {0x01000420, VR_DT, "SOP Authorization DateTime"},
+    {0x01000424, VR_LT, "SOP Authorization Comment"},
+    {0x01000426, VR_LO, "Authorization Equipment Certification Number"},
+    {0x04000005, VR_US, "MAC ID Number"},
+    {0x04000010, VR_UI, "MAC Calculation Transfer Syntax UID"},
+    {0x04000015, VR_CS, "MAC Algorithm"},
+    {0x04000020, VR_AT, "Data Elements Signed"},
+    {0x04000100, VR_UI, "Digital Signature UID"},
+    {0x04000105, VR_DT, "Digital Signature DateTime"},
+    {0x04000110, VR_CS, "Certificate Type"},
+    {0x04000115, VR_OB, "Certificate of Signer"},
+    {0x04000120, VR_OB, "Signature"},
+    {0x04000305, VR_CS, "Certified Timestamp Type"},
+    {0x04000310, VR_OB, "Certified Timestamp"},
+    {0x04000315, VR_FL, ""},
+    {0x04000401, VR_SQ, "Digital Signature Purpose Code Sequence"},
+    {0x04000402, VR_SQ, "Referenced Digital Signature Sequence"},
+    {0x04000403, VR_SQ, "Referenced SOP Instance MAC Sequence"},
+    {0x04000404, VR_OB, "MAC"},
+    {0x04000500, VR_SQ, "Encrypted Attributes Sequence"},
+    {0x04000510, VR_UI, "Encrypted Content Transfer Syntax UID"},
+    {0x04000520, VR_OB, "Encrypted Content"},
+    {0x04000550, VR_SQ, "Modified Attributes Sequence"},
+    {0x04000561, VR_SQ, "Original Attributes Sequence"},
+    {0x04000562, VR_DT, "Attribute Modification DateTime"},
+    {0x04000563, VR_LO, "Modifying System"},
+    {0x04000564, VR_LO, "Source of Previous Values"},
+    {0x04000565, VR_CS, "Reason for the Attribute Modification"},
+    {0x20000010, VR_IS, "Number of Copies"},
+    {0x2000001E, VR_SQ, "Printer Configuration Sequence"},
+    {0x20000020, VR_CS, "Print Priority"},
+    {0x20000030, VR_CS, "Medium Type"},
+    {0x20000040, VR_CS, "Film Destination"},
+    {0x20000050, VR_LO, "Film Session Label"},
+    {0x20000060, VR_IS, "Memory Allocation"},
+    {0x20000061, VR_IS, "Maximum Memory Allocation"},
+    {0x20000062, VR_CS, "Color Image Printing Flag"},
+    {0x20000063, VR_CS, "Collation Flag"},
+    {0x20000065, VR_CS, "Annotation Flag"},
+    {0x20000067, VR_CS, "Image Overlay Flag"},
+    {0x20000069, VR_CS, "Presentation LUT Flag"},
+    {0x2000006A, VR_CS, "Image Box Presentation LUT Flag"},
+    {0x200000A0, VR_US, "Memory Bit Depth"},
+    {0x200000A1, VR_US, "Printing Bit Depth"},
+    {0x200000A2, VR_SQ, "Media Installed Sequence"},
+    {0x200000A4, VR_SQ, "Other Media Available Sequence"},
+    {0x200000A8, VR_SQ, "Supported Image Display Formats Sequence"},
+    {0x20000500, VR_SQ, "Referenced Film Box Sequence"},
+    {0x20000510, VR_SQ, "Referenced Stored Print Sequence"},
+    {0x20100010, VR_ST, "Image Display Format"},
+    {0x20100030, VR_CS, "Annotation Display Format ID"},
+    {0x20100040, VR_CS, "Film Orientation"},
+    {0x20100050, VR_CS, "Film Size ID"},
+    {0x20100052, VR_CS, "Printer Resolution ID"},
+    {0x20100054, VR_CS, "Default Printer Resolution ID"},
+    {0x20100060, VR_CS, "Magnification Type"},
+    {0x20100080, VR_CS, "Smoothing Type"},
+    {0x201000A6, VR_CS, "Default Magnification Type"},
+    {0x201000A7, VR_CS, "Other Magnification Types Available"},
+    {0x201000A8, VR_CS, "Default Smoothing Type"},
+    {0x201000A9, VR_CS, "Other Smoothing Types Available"},
+    {0x20100100, VR_CS, "Border Density"},
+    {0x20100110, VR_CS, "Empty Image Density"},
+    {0x20100120, VR_US, "Min Density"},
+    {0x20100130, VR_US, "Max Density"},
+    {0x20100140, VR_CS, "Trim"},
+    {0x20100150, VR_ST, "Configuration Information"},
+    {0x20100152, VR_LT, "Configuration Information Description"},
+    {0x20100154, VR_IS, "Maximum Collated Films"},
+    {0x2010015E, VR_US, "Illumination"},
+    {0x20100160, VR_US, "Reflected Ambient Light"},
+    {0x20100376, VR_DS, "Printer Pixel Spacing"},
+    {0x20100500, VR_SQ, "Referenced Film Session Sequence"},
+    {0x20100510, VR_SQ, "Referenced Image Box Sequence"},
+    {0x20100520, VR_SQ, "Referenced Basic Annotation Box Sequence"},
+    {0x20200010, VR_US, "Image Box Position"},
+    {0x20200020, VR_CS, "Polarity"},
+    {0x20200030, VR_DS, "Requested Image Size"},
+    {0x20200040, VR_CS, "Requested Decimate/Crop Behavior"},
+    {0x20200050, VR_CS, "Requested Resolution ID"},
+    {0x202000A0, VR_CS, "Requested Image Size Flag"},
+    {0x202000A2, VR_CS, "Decimate/Crop Result"},
+    {0x20200110, VR_SQ, "Basic Grayscale Image Sequence"},
+    {0x20200111, VR_SQ, "Basic Color Image Sequence"},
+    {0x20200130, VR_SQ, "Referenced Image Overlay Box Sequence"},
+    {0x20200140, VR_SQ, "Referenced VOI LUT Box Sequence"},
+    {0x20300010, VR_US, "Annotation Position"},
+    {0x20300020, VR_LO, "Text String"},
+    {0x20400010, VR_SQ, "Referenced Overlay Plane Sequence"},
+    {0x20400011, VR_US, "Referenced Overlay Plane Groups"},
+    {0x20400020, VR_SQ, "Overlay Pixel Data Sequence"},
+    {0x20400060, VR_CS, "Overlay Magnification Type"},
+    {0x20400070, VR_CS, "Overlay Smoothing Type"},
+    {0x20400072, VR_CS, "Overlay or Image Magnification"},
+    {0x20400074, VR_US, "Magnify to Number of Columns"},
+    {0x20400080, VR_CS, "Overlay Foreground Density"},
+    {0x20400082, VR_CS, "Overlay Background Density"},
+    {0x20400090, VR_CS, "Overlay Mode"},
+    {0x20400100, VR_CS, "Threshold Density"},
+    {0x20400500, VR_SQ, "Referenced Image Box Sequence (Retired)"},
+    {0x20500010, VR_SQ, "Presentation LUT Sequence"},
+    {0x20500020, VR_CS, "Presentation LUT Shape"},
+    {0x20500500, VR_SQ, "Referenced Presentation LUT Sequence"},
+    {0x21000010, VR_SH, "Print Job ID"},
+    {0x21000020, VR_CS, "Execution Status"},
+    {0x21000030, VR_CS, "Execution Status Info"},
+    {0x21000040, VR_DA, "Creation Date"},
+    {0x21000050, VR_TM, "Creation Time"},
+    {0x21000070, VR_AE, "Originator"},
+    {0x21000140, VR_AE, "Destination AE"},
+    {0x21000160, VR_SH, "Owner ID"},
+    {0x21000170, VR_IS, "Number of Films"},
+    {0x21000500, VR_SQ, "Referenced Print Job Sequence (Pull Stored Print)"},
+    {0x21100010, VR_CS, "Printer Status"},
+    {0x21100020, VR_CS, "Printer Status Info"},
+    {0x21100030, VR_LO, "Printer Name"},
+    {0x21100099, VR_SH, "Print Queue ID"},
+    {0x21200010, VR_CS, "Queue Status"},
+    {0x21200050, VR_SQ, "Print Job Description Sequence"},
+    {0x21200070, VR_SQ, "Referenced Print Job Sequence"},
+    {0x21300010, VR_SQ, "Print Management Capabilities Sequence"},
+    {0x21300015, VR_SQ, "Printer Characteristics Sequence"},
+    {0x21300030, VR_SQ, "Film Box Content Sequence"},
+    {0x21300040, VR_SQ, "Image Box Content Sequence"},
+    {0x21300050, VR_SQ, "Annotation Content Sequence"},
+    {0x21300060, VR_SQ, "Image Overlay Box Content Sequence"},
+    {0x21300080, VR_SQ, "Presentation LUT Content Sequence"},
+    {0x213000A0, VR_SQ, "Proposed Study Sequence"},
+    {0x213000C0, VR_SQ, "Original Image Sequence"},
+    {0x22000001, VR_CS, "Label Using Information Extracted From Instances"},
+    {0x22000002, VR_UT, "Label Text"},
+    {0x22000003, VR_CS, "Label Style Selection"},
+    {0x22000004, VR_LT, "Media Disposition"},
+    {0x22000005, VR_LT, "Barcode Value"},
+    {0x22000006, VR_CS, "Barcode Symbology"},
+    {0x22000007, VR_CS, "Allow Media Splitting"},
+    {0x22000008, VR_CS, "Include Non-DICOM Objects"},
+    {0x22000009, VR_CS, "Include Display Application"},
+    {0x2200000A, VR_CS, "Preserve Composite Instances After Media Creation"},
+    {0x2200000B, VR_US, "Total Number of Pieces of Media Created"},
+    {0x2200000C, VR_LO, "Requested Media Application Profile"},
+    {0x2200000D, VR_SQ, "Referenced Storage Media Sequence"},
+    {0x2200000E, VR_AT, "Failure Attributes"},
+    {0x2200000F, VR_CS, "Allow Lossy Compression"},
+    {0x22000020, VR_CS, "Request Priority"},
+    {0x30020002, VR_SH, "RT Image Label"},
+    {0x30020003, VR_LO, "RT Image Name"},
+    {0x30020004, VR_ST, "RT Image Description"},
+    {0x3002000A, VR_CS, "Reported Values Origin"},
+    {0x3002000C, VR_CS, "RT Image Plane"},
+    {0x3002000D, VR_DS, "X-Ray Image Receptor Translation"},
+    {0x3002000E, VR_DS, "X-Ray Image Receptor Angle"},
+    {0x30020010, VR_DS, "RT Image Orientation"},
+    {0x30020011, VR_DS, "Image Plane Pixel Spacing"},
+    {0x30020012, VR_DS, "RT Image Position"},
+    {0x30020020, VR_SH, "Radiation Machine Name"},
+    {0x30020022, VR_DS, "Radiation Machine SAD"},
+    {0x30020024, VR_DS, "Radiation Machine SSD"},
+    {0x30020026, VR_DS, "RT Image SID"},
+    {0x30020028, VR_DS, "Source to Reference Object Distance"},
+    {0x30020029, VR_IS, "Fraction Number"},
+    {0x30020030, VR_SQ, "Exposure Sequence"},
+    {0x30020032, VR_DS, "Meterset Exposure"},
+    {0x30020034, VR_DS, "Diaphragm Position"},
+    {0x30020040, VR_SQ, "Fluence Map Sequence"},
+    {0x30020041, VR_CS, "Fluence Data Source"},
+    {0x30020042, VR_DS, "Fluence Data Scale"},
+    {0x30020050, VR_SQ, "Primary Fluence Mode Sequence"},
+    {0x30020051, VR_CS, "Fluence Mode"},
+    {0x30020052, VR_SH, "Fluence Mode ID"},
+    {0x30040001, VR_CS, "DVH Type"},
+    {0x30040002, VR_CS, "Dose Units"},
+    {0x30040004, VR_CS, "Dose Type"},
+    {0x30040005, VR_CS, "Spatial Transform of Dose"},
+    {0x30040006, VR_LO, "Dose Comment"},
+    {0x30040008, VR_DS, "Normalization Point"},
+    {0x3004000A, VR_CS, "Dose Summation Type"},
+    {0x3004000C, VR_DS, "Grid Frame Offset Vector"},
+    {0x3004000E, VR_DS, "Dose Grid Scaling"},
+    {0x30040010, VR_SQ, "RT Dose ROI Sequence"},
+    {0x30040012, VR_DS, "Dose Value"},
+    {0x30040014, VR_CS, "Tissue Heterogeneity Correction"},
+    {0x30040040, VR_DS, "DVH Normalization Point"},
+    {0x30040042, VR_DS, "DVH Normalization Dose Value"},
+    {0x30040050, VR_SQ, "DVH Sequence"},
+    {0x30040052, VR_DS, "DVH Dose Scaling"},
+    {0x30040054, VR_CS, "DVH Volume Units"},
+    {0x30040056, VR_IS, "DVH Number of Bins"},
+    {0x30040058, VR_DS, "DVH Data"},
+    {0x30040060, VR_SQ, "DVH Referenced ROI Sequence"},
+    {0x30040062, VR_CS, "DVH ROI Contribution Type"},
+    {0x30040070, VR_DS, "DVH Minimum Dose"},
+    {0x30040072, VR_DS, "DVH Maximum Dose"},
+    {0x30040074, VR_DS, "DVH Mean Dose"},
+    {0x30060002, VR_SH, "Structure Set Label"},
+    {0x30060004, VR_LO, "Structure Set Name"},
+    {0x30060006, VR_ST, "Structure Set Description"},
+    {0x30060008, VR_DA, "Structure Set Date"},
+    {0x30060009, VR_TM, "Structure Set Time"},
+    {0x30060010, VR_SQ, "Referenced Frame of Reference Sequence"},
+    {0x30060012, VR_SQ, "RT Referenced Study Sequence"},
+    {0x30060014, VR_SQ, "RT Referenced Series Sequence"},
+    {0x30060016, VR_SQ, "Contour Image Sequence"},
+    {0x30060018, VR_SQ, "Predecessor Structure Set Sequence"},
+    {0x30060020, VR_SQ, "Structure Set ROI Sequence"},
+    {0x30060022, VR_IS, "ROI Number"},
+    {0x30060024, VR_UI, "Referenced Frame of Reference UID"},
+    {0x30060026, VR_LO, "ROI Name"},
+    {0x30060028, VR_ST, "ROI Description"},
+    {0x3006002A, VR_IS, "ROI Display Color"},
+    {0x3006002C, VR_DS, "ROI Volume"},
+    {0x30060030, VR_SQ, "RT Related ROI Sequence"},
+    {0x30060033, VR_CS, "RT ROI Relationship"},
+    {0x30060036, VR_CS, "ROI Generation Algorithm"},
+    {0x30060038, VR_LO, "ROI Generation Description"},
+    {0x30060039, VR_SQ, "ROI Contour Sequence"},
+    {0x30060040, VR_SQ, "Contour Sequence"},
+    {0x30060042, VR_CS, "Contour Geometric Type"},
+    {0x30060044, VR_DS, "Contour Slab Thickness"},
+    {0x30060045, VR_DS, "Contour Offset Vector"},
+    {0x30060046, VR_IS, "Number of Contour Points"},
+    {0x30060048, VR_IS, "Contour Number"},
+    {0x30060049, VR_IS, "Attached Contours"},
+    {0x30060050, VR_DS, "Contour Data"},
+    {0x30060080, VR_SQ, "RT ROI Observations Sequence"},
+    {0x30060082, VR_IS, "Observation Number"},
+    {0x30060084, VR_IS, "Referenced ROI Number"},
+    {0x30060085, VR_SH, "ROI Observation Label"},
+    {0x30060086, VR_SQ, "RT ROI Identification Code Sequence"},
+    {0x30060088, VR_ST, "ROI Observation Description"},
+    {0x300600A0, VR_SQ, "Related RT ROI Observations Sequence"},
+    {0x300600A4, VR_CS, "RT ROI Interpreted Type"},
+    {0x300600A6, VR_PN, "ROI Interpreter"},
+    {0x300600B0, VR_SQ, "ROI Physical Properties Sequence"},
+    {0x300600B2, VR_CS, "ROI Physical Property"},
+    {0x300600B4, VR_DS, "ROI Physical Property Value"},
+    {0x300600B6, VR_SQ, "ROI Elemental Composition Sequence"},
+    {0x300600B7, VR_US, "ROI Elemental Composition Atomic Number"},
+    {0x300600B8, VR_FL, "ROI Elemental Composition Atomic Mass Fraction"},
+    {0x300600B9, VR_SQ, "Additional RT ROI Identification Code Sequence"},
+    {0x300600C0, VR_SQ, "Frame of Reference Relationship Sequence"},
+    {0x300600C2, VR_UI, "Related Frame of Reference UID"},
+    {0x300600C4, VR_CS, "Frame of Reference Transformation Type"},
+    {0x300600C6, VR_DS, "Frame of Reference Transformation Matrix"},
+    {0x300600C8, VR_LO, "Frame of Reference Transformation Comment"},
+    {0x30080010, VR_SQ, "Measured Dose Reference Sequence"},
+    {0x30080012, VR_ST, "Measured Dose Description"},
+    {0x30080014, VR_CS, "Measured Dose Type"},
+    {0x30080016, VR_DS, "Measured Dose Value"},
+    {0x30080020, VR_SQ, "Treatment Session Beam Sequence"},
+    {0x30080021, VR_SQ, "Treatment Session Ion Beam Sequence"},
+    {0x30080022, VR_IS, "Current Fraction Number"},
+    {0x30080024, VR_DA, "Treatment Control Point Date"},
+    {0x30080025, VR_TM, "Treatment Control Point Time"},
+    {0x3008002A, VR_CS, "Treatment Termination Status"},
+    {0x3008002B, VR_SH, "Treatment Termination Code"},
+    {0x3008002C, VR_CS, "Treatment Verification Status"},
+    {0x30080030, VR_SQ, "Referenced Treatment Record Sequence"},
+    {0x30080032, VR_DS, "Specified Primary Meterset"},
+    {0x30080033, VR_DS, "Specified Secondary Meterset"},
+    {0x30080036, VR_DS, "Delivered Primary Meterset"},
+    {0x30080037, VR_DS, "Delivered Secondary Meterset"},
+    {0x3008003A, VR_DS, "Specified Treatment Time"},
+    {0x3008003B, VR_DS, "Delivered Treatment Time"},
+    {0x30080040, VR_SQ, "Control Point Delivery Sequence"},
+    {0x30080041, VR_SQ, "Ion Control Point Delivery Sequence"},
+    {0x30080042, VR_DS, "Specified Meterset"},
+    {0x30080044, VR_DS, "Delivered Meterset"},
+    {0x30080045, VR_FL, "Meterset Rate Set"},
+    {0x30080046, VR_FL, "Meterset Rate Delivered"},
+    {0x30080047, VR_FL, "Scan Spot Metersets Delivered"},
+    {0x30080048, VR_DS, "Dose Rate Delivered"},
+    {0x30080050, VR_SQ, "Treatment Summary Calculated Dose Reference Sequence"},
+    {0x30080052, VR_DS, "Cumulative Dose to Dose Reference"},
+    {0x30080054, VR_DA, "First Treatment Date"},
+    {0x30080056, VR_DA, "Most Recent Treatment Date"},
+    {0x3008005A, VR_IS, "Number of Fractions Delivered"},
+    {0x30080060, VR_SQ, "Override Sequence"},
+    {0x30080061, VR_AT, "Parameter Sequence Pointer"},
+    {0x30080062, VR_AT, "Override Parameter Pointer"},
+    {0x30080063, VR_IS, "Parameter Item Index"},
+    {0x30080064, VR_IS, "Measured Dose Reference Number"},
+    {0x30080065, VR_AT, "Parameter Pointer"},
+    {0x30080066, VR_ST, "Override Reason"},
+    {0x30080068, VR_SQ, "Corrected Parameter Sequence"},
+    {0x3008006A, VR_FL, "Correction Value"},
+    {0x30080070, VR_SQ, "Calculated Dose Reference Sequence"},
+    {0x30080072, VR_IS, "Calculated Dose Reference Number"},
+    {0x30080074, VR_ST, "Calculated Dose Reference Description"},
+    {0x30080076, VR_DS, "Calculated Dose Reference Dose Value"},
+    {0x30080078, VR_DS, "Start Meterset"},
+    {0x3008007A, VR_DS, "End Meterset"},
+    {0x30080080, VR_SQ, "Referenced Measured Dose Reference Sequence"},
+    {0x30080082, VR_IS, "Referenced Measured Dose Reference Number"},
+    {0x30080090, VR_SQ, "Referenced Calculated Dose Reference Sequence"},
+    {0x30080092, VR_IS, "Referenced Calculated Dose Reference Number"},
+    {0x300800A0, VR_SQ, "Beam Limiting Device Leaf Pairs Sequence"},
+    {0x300800B0, VR_SQ, "Recorded Wedge Sequence"},
+    {0x300800C0, VR_SQ, "Recorded Compensator Sequence"},
+    {0x300800D0, VR_SQ, "Recorded Block Sequence"},
+    {0x300800E0, VR_SQ, "Treatment Summary Measured Dose Reference Sequence"},
+    {0x300800F0, VR_SQ, "Recorded Snout Sequence"},
+    {0x300800F2, VR_SQ, "Recorded Range Shifter Sequence"},
+    {0x300800F4, VR_SQ, "Recorded Lateral Spreading Device Sequence"},
+    {0x300800F6, VR_SQ, "Recorded Range Modulator Sequence"},
+    {0x30080100, VR_SQ, "Recorded Source Sequence"},
+    {0x30080105, VR_LO, "Source Serial Number"},
+    {0x30080110, VR_SQ, "Treatment Session Application Setup Sequence"},
+    {0x30080116, VR_CS, "Application Setup Check"},
+    {0x30080120, VR_SQ, "Recorded Brachy Accessory Device Sequence"},
+    {0x30080122, VR_IS, "Referenced Brachy Accessory Device Number"},
+    {0x30080130, VR_SQ, "Recorded Channel Sequence"},
+    {0x30080132, VR_DS, "Specified Channel Total Time"},
+    {0x30080134, VR_DS, "Delivered Channel Total Time"},
+    {0x30080136, VR_IS, "Specified Number of Pulses"},
+    {0x30080138, VR_IS, "Delivered Number of Pulses"},
+    {0x3008013A, VR_DS, "Specified Pulse Repetition Interval"},
+    {0x3008013C, VR_DS, "Delivered Pulse Repetition Interval"},
+    {0x30080140, VR_SQ, "Recorded Source Applicator Sequence"},
+    {0x30080142, VR_IS, "Referenced Source Applicator Number"},
+    {0x30080150, VR_SQ, "Recorded Channel Shield Sequence"},
+    {0x30080152, VR_IS, "Referenced Channel Shield Number"},
+    {0x30080160, VR_SQ, "Brachy Control Point Delivered Sequence"},
+    {0x30080162, VR_DA, "Safe Position Exit Date"},
+    {0x30080164, VR_TM, "Safe Position Exit Time"},
+    {0x30080166, VR_DA, "Safe Position Return Date"},
+    {0x30080168, VR_TM, "Safe Position Return Time"},
+    {0x30080171, VR_SQ, "Pulse Specific Brachy Control Point Delivered Sequence"},
+    {0x30080172, VR_US, "Pulse Number"},
+    {0x30080173, VR_SQ, "Brachy Pulse Control Point Delivered Sequence"},
+    {0x30080200, VR_CS, "Current Treatment Status"},
+    {0x30080202, VR_ST, "Treatment Status Comment"},
+    {0x30080220, VR_SQ, "Fraction Group Summary Sequence"},
+    {0x30080223, VR_IS, "Referenced Fraction Number"},
+    {0x30080224, VR_CS, "Fraction Group Type"},
+    {0x30080230, VR_CS, "Beam Stopper Position"},
+    {0x30080240, VR_SQ, "Fraction Status Summary Sequence"},
+    {0x30080250, VR_DA, "Treatment Date"},
+    {0x30080251, VR_TM, "Treatment Time"},
+    {0x300A0002, VR_SH, "RT Plan Label"},
+    {0x300A0003, VR_LO, "RT Plan Name"},
+    {0x300A0004, VR_ST, "RT Plan Description"},
+    {0x300A0006, VR_DA, "RT Plan Date"},
+    {0x300A0007, VR_TM, "RT Plan Time"},
+    {0x300A0009, VR_LO, "Treatment Protocols"},
+    {0x300A000A, VR_CS, "Plan Intent"},
+    {0x300A000B, VR_LO, "Treatment Sites"},
+    {0x300A000C, VR_CS, "RT Plan Geometry"},
+    {0x300A000E, VR_ST, "Prescription Description"},
+    {0x300A0010, VR_SQ, "Dose Reference Sequence"},
+    {0x300A0012, VR_IS, "Dose Reference Number"},
+    {0x300A0013, VR_UI, "Dose Reference UID"},
+    {0x300A0014, VR_CS, "Dose Reference Structure Type"},
+    {0x300A0015, VR_CS, "Nominal Beam Energy Unit"},
+    {0x300A0016, VR_LO, "Dose Reference Description"},
+    {0x300A0018, VR_DS, "Dose Reference Point Coordinates"},
+    {0x300A001A, VR_DS, "Nominal Prior Dose"},
+    {0x300A0020, VR_CS, "Dose Reference Type"},
+    {0x300A0021, VR_DS, "Constraint Weight"},
+    {0x300A0022, VR_DS, "Delivery Warning Dose"},
+    {0x300A0023, VR_DS, "Delivery Maximum Dose"},
+    {0x300A0025, VR_DS, "Target Minimum Dose"},
+    {0x300A0026, VR_DS, "Target Prescription Dose"},
+    {0x300A0027, VR_DS, "Target Maximum Dose"},
+    {0x300A0028, VR_DS, "Target Underdose Volume Fraction"},
+    {0x300A002A, VR_DS, "Organ at Risk Full-volume Dose"},
+    {0x300A002B, VR_DS, "Organ at Risk Limit Dose"},
+    {0x300A002C, VR_DS, "Organ at Risk Maximum Dose"},
+    {0x300A002D, VR_DS, "Organ at Risk Overdose Volume Fraction"},
+    {0x300A0040, VR_SQ, "Tolerance Table Sequence"},
+    {0x300A0042, VR_IS, "Tolerance Table Number"},
+    {0x300A0043, VR_SH, "Tolerance Table Label"},
+    {0x300A0044, VR_DS, "Gantry Angle Tolerance"},
+    {0x300A0046, VR_DS, "Beam Limiting Device Angle Tolerance"},
+    {0x300A0048, VR_SQ, "Beam Limiting Device Tolerance Sequence"},
+    {0x300A004A, VR_DS, "Beam Limiting Device Position Tolerance"},
+    {0x300A004B, VR_FL, "Snout Position Tolerance"},
+    {0x300A004C, VR_DS, "Patient Support Angle Tolerance"},
+    {0x300A004E, VR_DS, "Table Top Eccentric Angle Tolerance"},
+    {0x300A004F, VR_FL, "Table Top Pitch Angle Tolerance"},
+    {0x300A0050, VR_FL, "Table Top Roll Angle Tolerance"},
+    {0x300A0051, VR_DS, "Table Top Vertical Position Tolerance"},
+    {0x300A0052, VR_DS, "Table Top Longitudinal Position Tolerance"},
+    {0x300A0053, VR_DS, "Table Top Lateral Position Tolerance"},
+    {0x300A0055, VR_CS, "RT Plan Relationship"},
+    {0x300A0070, VR_SQ, "Fraction Group Sequence"},
+    {0x300A0071, VR_IS, "Fraction Group Number"},
+    {0x300A0072, VR_LO, "Fraction Group Description"},
+    {0x300A0078, VR_IS, "Number of Fractions Planned"},
+    {0x300A0079, VR_IS, "Number of Fraction Pattern Digits Per Day"},
+    {0x300A007A, VR_IS, "Repeat Fraction Cycle Length"},
+    {0x300A007B, VR_LT, "Fraction Pattern"},
+    {0x300A0080, VR_IS, "Number of Beams"},
+    {0x300A0082, VR_DS, "Beam Dose Specification Point"},
+    {0x300A0084, VR_DS, "Beam Dose"},
+    {0x300A0086, VR_DS, "Beam Meterset"},
+    {0x300A0088, VR_FL, "Beam Dose Point Depth"},
+    {0x300A0089, VR_FL, "Beam Dose Point Equivalent Depth"},
+    {0x300A008A, VR_FL, "Beam Dose Point SSD"},
+    {0x300A008B, VR_CS, "Beam Dose Meaning"},
+    {0x300A008C, VR_SQ, "Beam Dose Verification Control Point Sequence"},
+    {0x300A008D, VR_FL, "Average Beam Dose Point Depth"},
+    {0x300A008E, VR_FL, "Average Beam Dose Point Equivalent Depth"},
+    {0x300A008F, VR_FL, "Average Beam Dose Point SSD"},
+    {0x300A0090, VR_CS, "Beam Dose Type"},
+    {0x300A0091, VR_DS, "Alternate Beam Dose"},
+    {0x300A0092, VR_CS, "Alternate Beam Dose Type"},
+    {0x300A00A0, VR_IS, "Number of Brachy Application Setups"},
+    {0x300A00A2, VR_DS, "Brachy Application Setup Dose Specification Point"},
+    {0x300A00A4, VR_DS, "Brachy Application Setup Dose"},
+    {0x300A00B0, VR_SQ, "Beam Sequence"},
+    {0x300A00B2, VR_SH, "Treatment Machine Name"},
+    {0x300A00B3, VR_CS, "Primary Dosimeter Unit"},
+    {0x300A00B4, VR_DS, "Source-Axis Distance"},
+    {0x300A00B6, VR_SQ, "Beam Limiting Device Sequence"},
+    {0x300A00B8, VR_CS, "RT Beam Limiting Device Type"},
+    {0x300A00BA, VR_DS, "Source to Beam Limiting Device Distance"},
+    {0x300A00BB, VR_FL, "Isocenter to Beam Limiting Device Distance"},
+    {0x300A00BC, VR_IS, "Number of Leaf/Jaw Pairs"},
+    {0x300A00BE, VR_DS, "Leaf Position Boundaries"},
+    {0x300A00C0, VR_IS, "Beam Number"},
+    {0x300A00C2, VR_LO, "Beam Name"},
+    {0x300A00C3, VR_ST, "Beam Description"},
+    {0x300A00C4, VR_CS, "Beam Type"},
+    {0x300A00C5, VR_FD, "Beam Delivery Duration Limit"},
+    {0x300A00C6, VR_CS, "Radiation Type"},
+    {0x300A00C7, VR_CS, "High-Dose Technique Type"},
+    {0x300A00C8, VR_IS, "Reference Image Number"},
+    {0x300A00CA, VR_SQ, "Planned Verification Image Sequence"},
+    {0x300A00CC, VR_LO, "Imaging Device-Specific Acquisition Parameters"},
+    {0x300A00CE, VR_CS, "Treatment Delivery Type"},
+    {0x300A00D0, VR_IS, "Number of Wedges"},
+    {0x300A00D1, VR_SQ, "Wedge Sequence"},
+    {0x300A00D2, VR_IS, "Wedge Number"},
+    {0x300A00D3, VR_CS, "Wedge Type"},
+    {0x300A00D4, VR_SH, "Wedge ID"},
+    {0x300A00D5, VR_IS, "Wedge Angle"},
+    {0x300A00D6, VR_DS, "Wedge Factor"},
+    {0x300A00D7, VR_FL, "Total Wedge Tray Water-Equivalent Thickness"},
+    {0x300A00D8, VR_DS, "Wedge Orientation"},
+    {0x300A00D9, VR_FL, "Isocenter to Wedge Tray Distance"},
+    {0x300A00DA, VR_DS, "Source to Wedge Tray Distance"},
+    {0x300A00DB, VR_FL, "Wedge Thin Edge Position"},
+    {0x300A00DC, VR_SH, "Bolus ID"},
+    {0x300A00DD, VR_ST, "Bolus Description"},
+    {0x300A00DE, VR_DS, "Effective Wedge Angle"},
+    {0x300A00E0, VR_IS, "Number of Compensators"},
+    {0x300A00E1, VR_SH, "Material ID"},
+    {0x300A00E2, VR_DS, "Total Compensator Tray Factor"},
+    {0x300A00E3, VR_SQ, "Compensator Sequence"},
+    {0x300A00E4, VR_IS, "Compensator Number"},
+    {0x300A00E5, VR_SH, "Compensator ID"},
+    {0x300A00E6, VR_DS, "Source to Compensator Tray Distance"},
+    {0x300A00E7, VR_IS, "Compensator Rows"},
+    {0x300A00E8, VR_IS, "Compensator Columns"},
+    {0x300A00E9, VR_DS, "Compensator Pixel Spacing"},
+    {0x300A00EA, VR_DS, "Compensator Position"},
+    {0x300A00EB, VR_DS, "Compensator Transmission Data"},
+    {0x300A00EC, VR_DS, "Compensator Thickness Data"},
+    {0x300A00ED, VR_IS, "Number of Boli"},
+    {0x300A00EE, VR_CS, "Compensator Type"},
+    {0x300A00EF, VR_SH, "Compensator Tray ID"},
+    {0x300A00F0, VR_IS, "Number of Blocks"},
+    {0x300A00F2, VR_DS, "Total Block Tray Factor"},
+    {0x300A00F3, VR_FL, "Total Block Tray Water-Equivalent Thickness"},
+    {0x300A00F4, VR_SQ, "Block Sequence"},
+    {0x300A00F5, VR_SH, "Block Tray ID"},
+    {0x300A00F6, VR_DS, "Source to Block Tray Distance"},
+    {0x300A00F7, VR_FL, "Isocenter to Block Tray Distance"},
+    {0x300A00F8, VR_CS, "Block Type"},
+    {0x300A00F9, VR_LO, "Accessory Code"},
+    {0x300A00FA, VR_CS, "Block Divergence"},
+    {0x300A00FB, VR_CS, "Block Mounting Position"},
+    {0x300A00FC, VR_IS, "Block Number"},
+    {0x300A00FE, VR_LO, "Block Name"},
+    {0x300A0100, VR_DS, "Block Thickness"},
+    {0x300A0102, VR_DS, "Block Transmission"},
+    {0x300A0104, VR_IS, "Block Number of Points"},
+    {0x300A0106, VR_DS, "Block Data"},
+    {0x300A0107, VR_SQ, "Applicator Sequence"},
+    {0x300A0108, VR_SH, "Applicator ID"},
+    {0x300A0109, VR_CS, "Applicator Type"},
+    {0x300A010A, VR_LO, "Applicator Description"},
+    {0x300A010C, VR_DS, "Cumulative Dose Reference Coefficient"},
+    {0x300A010E, VR_DS, "Final Cumulative Meterset Weight"},
+    {0x300A0110, VR_IS, "Number of Control Points"},
+    {0x300A0111, VR_SQ, "Control Point Sequence"},
+    {0x300A0112, VR_IS, "Control Point Index"},
+    {0x300A0114, VR_DS, "Nominal Beam Energy"},
+    {0x300A0115, VR_DS, "Dose Rate Set"},
+    {0x300A0116, VR_SQ, "Wedge Position Sequence"},
+    {0x300A0118, VR_CS, "Wedge Position"},
+    {0x300A011A, VR_SQ, "Beam Limiting Device Position Sequence"},
+    {0x300A011C, VR_DS, "Leaf/Jaw Positions"},
+    {0x300A011E, VR_DS, "Gantry Angle"},
+    {0x300A011F, VR_CS, "Gantry Rotation Direction"},
+    {0x300A0120, VR_DS, "Beam Limiting Device Angle"},
+    {0x300A0121, VR_CS, "Beam Limiting Device Rotation Direction"},
+    {0x300A0122, VR_DS, "Patient Support Angle"},
+    {0x300A0123, VR_CS, "Patient Support Rotation Direction"},
+    {0x300A0124, VR_DS, "Table Top Eccentric Axis Distance"},
+    {0x300A0125, VR_DS, "Table Top Eccentric Angle"},
+    {0x300A0126, VR_CS, "Table Top Eccentric Rotation Direction"},
+    {0x300A0128, VR_DS, "Table Top Vertical Position"},
+    {0x300A0129, VR_DS, "Table Top Longitudinal Position"},
+    {0x300A012A, VR_DS, "Table Top Lateral Position"},
+    {0x300A012C, VR_DS, "Isocenter Position"},
+    {0x300A012E, VR_DS, "Surface Entry Point"},
+    {0x300A0130, VR_DS, "Source to Surface Distance"},
+    {0x300A0131, VR_FL, "Average Beam Dose Point Source to External Contour Distance"},
+    {0x300A0132, VR_FL, "Source to External Contour Distance"},
+    {0x300A0133, VR_FL, "External Contour Entry Point"},
+    {0x300A0134, VR_DS, "Cumulative Meterset Weight"},
+    {0x300A0140, VR_FL, "Table Top Pitch Angle"},
+    {0x300A0142, VR_CS, "Table Top Pitch Rotation Direction"},
+    {0x300A0144, VR_FL, "Table Top Roll Angle"},
+    {0x300A0146, VR_CS, "Table Top Roll Rotation Direction"},
+    {0x300A0148, VR_FL, "Head Fixation Angle"},
+    {0x300A014A, VR_FL, "Gantry Pitch Angle"},
+    {0x300A014C, VR_CS, "Gantry Pitch Rotation Direction"},
+    {0x300A014E, VR_FL, "Gantry Pitch Angle Tolerance"},
+    {0x300A0150, VR_CS, "Fixation Eye"},
+    {0x300A0151, VR_DS, "Chair Head Frame Position"},
+    {0x300A0152, VR_DS, "Head Fixation Angle Tolerance"},
+    {0x300A0153, VR_DS, "Chair Head Frame Position Tolerance"},
+    {0x300A0154, VR_DS, "Fixation Light Azimuthal Angle Tolerance"},
+    {0x300A0155, VR_DS, "Fixation Light Polar Angle Tolerance"},
+    {0x300A0180, VR_SQ, "Patient Setup Sequence"},
+    {0x300A0182, VR_IS, "Patient Setup Number"},
+    {0x300A0183, VR_LO, "Patient Setup Label"},
+    {0x300A0184, VR_LO, "Patient Additional Position"},
+    {0x300A0190, VR_SQ, "Fixation Device Sequence"},
+    {0x300A0192, VR_CS, "Fixation Device Type"},
+    {0x300A0194, VR_SH, "Fixation Device Label"},
+    {0x300A0196, VR_ST, "Fixation Device Description"},
+    {0x300A0198, VR_SH, "Fixation Device Position"},
+    {0x300A0199, VR_FL, "Fixation Device Pitch Angle"},
+    {0x300A019A, VR_FL, "Fixation Device Roll Angle"},
+    {0x300A01A0, VR_SQ, "Shielding Device Sequence"},
+    {0x300A01A2, VR_CS, "Shielding Device Type"},
+    {0x300A01A4, VR_SH, "Shielding Device Label"},
+    {0x300A01A6, VR_ST, "Shielding Device Description"},
+    {0x300A01A8, VR_SH, "Shielding Device Position"},
+    {0x300A01B0, VR_CS, "Setup Technique"},
+    {0x300A01B2, VR_ST, "Setup Technique Description"},
+    {0x300A01B4, VR_SQ, "Setup Device Sequence"},
+    {0x300A01B6, VR_CS, "Setup Device Type"},
+    {0x300A01B8, VR_SH, "Setup Device Label"},
+    {0x300A01BA, VR_ST, "Setup Device Description"},
+    {0x300A01BC, VR_DS, "Setup Device Parameter"},
+    {0x300A01D0, VR_ST, "Setup Reference Description"},
+    {0x300A01D2, VR_DS, "Table Top Vertical Setup Displacement"},
+    {0x300A01D4, VR_DS, "Table Top Longitudinal Setup Displacement"},
+    {0x300A01D6, VR_DS, "Table Top Lateral Setup Displacement"},
+    {0x300A0200, VR_CS, "Brachy Treatment Technique"},
+    {0x300A0202, VR_CS, "Brachy Treatment Type"},
+    {0x300A0206, VR_SQ, "Treatment Machine Sequence"},
+    {0x300A0210, VR_SQ, "Source Sequence"},
+    {0x300A0212, VR_IS, "Source Number"},
+    {0x300A0214, VR_CS, "Source Type"},
+    {0x300A0216, VR_LO, "Source Manufacturer"},
+    {0x300A0218, VR_DS, "Active Source Diameter"},
+    {0x300A021A, VR_DS, "Active Source Length"},
+    {0x300A021B, VR_SH, "Source Model ID"},
+    {0x300A021C, VR_LO, "Source Description"},
+    {0x300A0222, VR_DS, "Source Encapsulation Nominal Thickness"},
+    {0x300A0224, VR_DS, "Source Encapsulation Nominal Transmission"},
+    {0x300A0226, VR_LO, "Source Isotope Name"},
+    {0x300A0228, VR_DS, "Source Isotope Half Life"},
+    {0x300A0229, VR_CS, "Source Strength Units"},
+    {0x300A022A, VR_DS, "Reference Air Kerma Rate"},
+    {0x300A022B, VR_DS, "Source Strength"},
+    {0x300A022C, VR_DA, "Source Strength Reference Date"},
+    {0x300A022E, VR_TM, "Source Strength Reference Time"},
+    {0x300A0230, VR_SQ, "Application Setup Sequence"},
+    {0x300A0232, VR_CS, "Application Setup Type"},
+    {0x300A0234, VR_IS, "Application Setup Number"},
+    {0x300A0236, VR_LO, "Application Setup Name"},
+    {0x300A0238, VR_LO, "Application Setup Manufacturer"},
+    {0x300A0240, VR_IS, "Template Number"},
+    {0x300A0242, VR_SH, "Template Type"},
+    {0x300A0244, VR_LO, "Template Name"},
+    {0x300A0250, VR_DS, "Total Reference Air Kerma"},
+    {0x300A0260, VR_SQ, "Brachy Accessory Device Sequence"},
+    {0x300A0262, VR_IS, "Brachy Accessory Device Number"},
+    {0x300A0263, VR_SH, "Brachy Accessory Device ID"},
+    {0x300A0264, VR_CS, "Brachy Accessory Device Type"},
+    {0x300A0266, VR_LO, "Brachy Accessory Device Name"},
+    {0x300A026A, VR_DS, "Brachy Accessory Device Nominal Thickness"},
+    {0x300A026C, VR_DS, "Brachy Accessory Device Nominal Transmission"},
+    {0x300A0280, VR_SQ, "Channel Sequence"},
+    {0x300A0282, VR_IS, "Channel Number"},
+    {0x300A0284, VR_DS, "Channel Length"},
+    {0x300A0286, VR_DS, "Channel Total Time"},
+    {0x300A0288, VR_CS, "Source Movement Type"},
+    {0x300A028A, VR_IS, "Number of Pulses"},
+    {0x300A028C, VR_DS, "Pulse Repetition Interval"},
+    {0x300A0290, VR_IS, "Source Applicator Number"},
+    {0x300A0291, VR_SH, "Source Applicator ID"},
+    {0x300A0292, VR_CS, "Source Applicator Type"},
+    {0x300A0294, VR_LO, "Source Applicator Name"},
+    {0x300A0296, VR_DS, "Source Applicator Length"},
+    {0x300A0298, VR_LO, "Source Applicator Manufacturer"},
+    {0x300A029C, VR_DS, "Source Applicator Wall Nominal Thickness"},
+    {0x300A029E, VR_DS, "Source Applicator Wall Nominal Transmission"},
+    {0x300A02A0, VR_DS, "Source Applicator Step Size"},
+    {0x300A02A2, VR_IS, "Transfer Tube Number"},
+    {0x300A02A4, VR_DS, "Transfer Tube Length"},
+    {0x300A02B0, VR_SQ, "Channel Shield Sequence"},
+    {0x300A02B2, VR_IS, "Channel Shield Number"},
+    {0x300A02B3, VR_SH, "Channel Shield ID"},
+    {0x300A02B4, VR_LO, "Channel Shield Name"},
+    {0x300A02B8, VR_DS, "Channel Shield Nominal Thickness"},
+    {0x300A02BA, VR_DS, "Channel Shield Nominal Transmission"},
+    {0x300A02C8, VR_DS, "Final Cumulative Time Weight"},
+    {0x300A02D0, VR_SQ, "Brachy Control Point Sequence"},
+    {0x300A02D2, VR_DS, "Control Point Relative Position"},
+    {0x300A02D4, VR_DS, "Control Point 3D Position"},
+    {0x300A02D6, VR_DS, "Cumulative Time Weight"},
+    {0x300A02E0, VR_CS, "Compensator Divergence"},
+    {0x300A02E1, VR_CS, "Compensator Mounting Position"},
+    {0x300A02E2, VR_DS, "Source to Compensator Distance"},
+    {0x300A02E3, VR_FL, "Total Compensator Tray Water-Equivalent Thickness"},
+    {0x300A02E4, VR_FL, "Isocenter to Compensator Tray Distance"},
+    {0x300A02E5, VR_FL, "Compensator Column Offset"},
+    {0x300A02E6, VR_FL, "Isocenter to Compensator Distances"},
+    {0x300A02E7, VR_FL, "Compensator Relative Stopping Power Ratio"},
+    {0x300A02E8, VR_FL, "Compensator Milling Tool Diameter"},
+    {0x300A02EA, VR_SQ, "Ion Range Compensator Sequence"},
+    {0x300A02EB, VR_LT, "Compensator Description"},
+    {0x300A0302, VR_IS, "Radiation Mass Number"},
+    {0x300A0304, VR_IS, "Radiation Atomic Number"},
+    {0x300A0306, VR_SS, "Radiation Charge State"},
+    {0x300A0308, VR_CS, "Scan Mode"},
+    {0x300A0309, VR_CS, "Modulated Scan Mode Type"},
+    {0x300A030A, VR_FL, "Virtual Source-Axis Distances"},
+    {0x300A030C, VR_SQ, "Snout Sequence"},
+    {0x300A030D, VR_FL, "Snout Position"},
+    {0x300A030F, VR_SH, "Snout ID"},
+    {0x300A0312, VR_IS, "Number of Range Shifters"},
+    {0x300A0314, VR_SQ, "Range Shifter Sequence"},
+    {0x300A0316, VR_IS, "Range Shifter Number"},
+    {0x300A0318, VR_SH, "Range Shifter ID"},
+    {0x300A0320, VR_CS, "Range Shifter Type"},
+    {0x300A0322, VR_LO, "Range Shifter Description"},
+    {0x300A0330, VR_IS, "Number of Lateral Spreading Devices"},
+    {0x300A0332, VR_SQ, "Lateral Spreading Device Sequence"},
+    {0x300A0334, VR_IS, "Lateral Spreading Device Number"},
+    {0x300A0336, VR_SH, "Lateral Spreading Device ID"},
+    {0x300A0338, VR_CS, "Lateral Spreading Device Type"},
+    {0x300A033A, VR_LO, "Lateral Spreading Device Description"},
+    {0x300A033C, VR_FL, "Lateral Spreading Device Water Equivalent Thickness"},
+    {0x300A0340, VR_IS, "Number of Range Modulators"},
+    {0x300A0342, VR_SQ, "Range Modulator Sequence"},
+    {0x300A0344, VR_IS, "Range Modulator Number"},
+    {0x300A0346, VR_SH, "Range Modulator ID"},
+    {0x300A0348, VR_CS, "Range Modulator Type"},
+    {0x300A034A, VR_LO, "Range Modulator Description"},
+    {0x300A034C, VR_SH, "Beam Current Modulation ID"},
+    {0x300A0350, VR_CS, "Patient Support Type"},
+    {0x300A0352, VR_SH, "Patient Support ID"},
+    {0x300A0354, VR_LO, "Patient Support Accessory Code"},
+    {0x300A0355, VR_LO, "Tray Accessory Code"},
+    {0x300A0356, VR_FL, "Fixation Light Azimuthal Angle"},
+    {0x300A0358, VR_FL, "Fixation Light Polar Angle"},
+    {0x300A035A, VR_FL, "Meterset Rate"},
+    {0x300A0360, VR_SQ, "Range Shifter Settings Sequence"},
+    {0x300A0362, VR_LO, "Range Shifter Setting"},
+    {0x300A0364, VR_FL, "Isocenter to Range Shifter Distance"},
+    {0x300A0366, VR_FL, "Range Shifter Water Equivalent Thickness"},
+    {0x300A0370, VR_SQ, "Lateral Spreading Device Settings Sequence"},
+    {0x300A0372, VR_LO, "Lateral Spreading Device Setting"},
+    {0x300A0374, VR_FL, "Isocenter to Lateral Spreading Device Distance"},
+    {0x300A0380, VR_SQ, "Range Modulator Settings Sequence"},
+    {0x300A0382, VR_FL, "Range Modulator Gating Start Value"},
+    {0x300A0384, VR_FL, "Range Modulator Gating Stop Value"},
+    {0x300A0386, VR_FL, "Range Modulator Gating Start Water Equivalent Thickness"},
+    {0x300A0388, VR_FL, "Range Modulator Gating Stop Water Equivalent Thickness"},
+    {0x300A038A, VR_FL, "Isocenter to Range Modulator Distance"},
+    {0x300A0390, VR_SH, "Scan Spot Tune ID"},
+    {0x300A0391, VR_IS, "Scan Spot Prescribed Indices"},
+    {0x300A0392, VR_IS, "Number of Scan Spot Positions"},
+    {0x300A0393, VR_CS, "Scan Spot Reordered"},
+    {0x300A0394, VR_FL, "Scan Spot Position Map"},
+    {0x300A0395, VR_CS, "Scan Spot Reordering Allowed"},
+    {0x300A0396, VR_FL, "Scan Spot Meterset Weights"},
+    {0x300A0398, VR_FL, "Scanning Spot Size"},
+    {0x300A039A, VR_IS, "Number of Paintings"},
+    {0x300A03A0, VR_SQ, "Ion Tolerance Table Sequence"},
+    {0x300A03A2, VR_SQ, "Ion Beam Sequence"},
+    {0x300A03A4, VR_SQ, "Ion Beam Limiting Device Sequence"},
+    {0x300A03A6, VR_SQ, "Ion Block Sequence"},
+    {0x300A03A8, VR_SQ, "Ion Control Point Sequence"},
+    {0x300A03AA, VR_SQ, "Ion Wedge Sequence"},
+    {0x300A03AC, VR_SQ, "Ion Wedge Position Sequence"},
+    {0x300A0401, VR_SQ, "Referenced Setup Image Sequence"},
+    {0x300A0402, VR_ST, "Setup Image Comment"},
+    {0x300A0410, VR_SQ, "Motion Synchronization Sequence"},
+    {0x300A0412, VR_FL, "Control Point Orientation"},
+    {0x300A0420, VR_SQ, "General Accessory Sequence"},
+    {0x300A0421, VR_SH, "General Accessory ID"},
+    {0x300A0422, VR_ST, "General Accessory Description"},
+    {0x300A0423, VR_CS, "General Accessory Type"},
+    {0x300A0424, VR_IS, "General Accessory Number"},
+    {0x300A0425, VR_FL, "Source to General Accessory Distance"},
+    {0x300A0431, VR_SQ, "Applicator Geometry Sequence"},
+    {0x300A0432, VR_CS, "Applicator Aperture Shape"},
+    {0x300A0433, VR_FL, "Applicator Opening"},
+    {0x300A0434, VR_FL, "Applicator Opening X"},
+    {0x300A0435, VR_FL, "Applicator Opening Y"},
+    {0x300A0436, VR_FL, "Source to Applicator Mounting Position Distance"},
+    {0x300A0440, VR_IS, "Number of Block Slab Items"},
+    {0x300A0441, VR_SQ, "Block Slab Sequence"},
+    {0x300A0442, VR_DS, "Block Slab Thickness"},
+    {0x300A0443, VR_US, "Block Slab Number"},
+    {0x300A0450, VR_SQ, "Device Motion Control Sequence"},
+    {0x300A0451, VR_CS, "Device Motion Execution Mode"},
+    {0x300A0452, VR_CS, "Device Motion Observation Mode"},
+    {0x300A0453, VR_SQ, "Device Motion Parameter Code Sequence"},
+    {0x300A0501, VR_FL, "Distal Depth Fraction"},
+    {0x300A0502, VR_FL, "Distal Depth"},
+    {0x300A0503, VR_FL, "Nominal Range Modulation Fractions"},
+    {0x300A0504, VR_FL, "Nominal Range Modulated Region Depths"},
+    {0x300A0505, VR_SQ, "Depth Dose Parameters Sequence"},
+    {0x300A0506, VR_SQ, "Delivered Depth Dose Parameters Sequence"},
+    {0x300A0507, VR_FL, "Delivered Distal Depth Fraction"},
+    {0x300A0508, VR_FL, "Delivered Distal Depth"},
+    {0x300A0509, VR_FL, "Delivered Nominal Range Modulation Fractions"},
+    {0x300A0510, VR_FL, "Delivered Nominal Range Modulated Region Depths"},
+    {0x300A0511, VR_CS, "Delivered Reference Dose Definition"},
+    {0x300A0512, VR_CS, "Reference Dose Definition"},
+    {0x300C0002, VR_SQ, "Referenced RT Plan Sequence"},
+    {0x300C0004, VR_SQ, "Referenced Beam Sequence"},
+    {0x300C0006, VR_IS, "Referenced Beam Number"},
+    {0x300C0007, VR_IS, "Referenced Reference Image Number"},
+    {0x300C0008, VR_DS, "Start Cumulative Meterset Weight"},
+    {0x300C0009, VR_DS, "End Cumulative Meterset Weight"},
+    {0x300C000A, VR_SQ, "Referenced Brachy Application Setup Sequence"},
+    {0x300C000C, VR_IS, "Referenced Brachy Application Setup Number"},
+    {0x300C000E, VR_IS, "Referenced Source Number"},
+    {0x300C0020, VR_SQ, "Referenced Fraction Group Sequence"},
+    {0x300C0022, VR_IS, "Referenced Fraction Group Number"},
+    {0x300C0040, VR_SQ, "Referenced Verification Image Sequence"},
+    {0x300C0042, VR_SQ, "Referenced Reference Image Sequence"},
+    {0x300C0050, VR_SQ, "Referenced Dose Reference Sequence"},
+    {0x300C0051, VR_IS, "Referenced Dose Reference Number"},
+    {0x300C0055, VR_SQ, "Brachy Referenced Dose Reference Sequence"},
+    {0x300C0060, VR_SQ, "Referenced Structure Set Sequence"},
+    {0x300C006A, VR_IS, "Referenced Patient Setup Number"},
+    {0x300C0080, VR_SQ, "Referenced Dose Sequence"},
+    {0x300C00A0, VR_IS, "Referenced Tolerance Table Number"},
+    {0x300C00B0, VR_SQ, "Referenced Bolus Sequence"},
+    {0x300C00C0, VR_IS, "Referenced Wedge Number"},
+    {0x300C00D0, VR_IS, "Referenced Compensator Number"},
+    {0x300C00E0, VR_IS, "Referenced Block Number"},
+    {0x300C00F0, VR_IS, "Referenced Control Point Index"},
+    {0x300C00F2, VR_SQ, "Referenced Control Point Sequence"},
+    {0x300C00F4, VR_IS, "Referenced Start Control Point Index"},
+    {0x300C00F6, VR_IS, "Referenced Stop Control Point Index"},
+    {0x300C0100, VR_IS, "Referenced Range Shifter Number"},
+    {0x300C0102, VR_IS, "Referenced Lateral Spreading Device Number"},
+    {0x300C0104, VR_IS, "Referenced Range Modulator Number"},
+    {0x300C0111, VR_SQ, "Omitted Beam Task Sequence"},
+    {0x300C0112, VR_CS, "Reason for Omission"},
+    {0x300C0113, VR_LO, "Reason for Omission Description"},
+    {0x300E0002, VR_CS, "Approval Status"},
+    {0x300E0004, VR_DA, "Review Date"},
+    {0x300E0005, VR_TM, "Review Time"},
+    {0x300E0008, VR_PN, "Reviewer Name"},
+    {0x40000010, VR_LT, "Arbitrary"},
+    {0x40004000, VR_LT, "Text Comments"},
+    {0x40080040, VR_SH, "Results ID"},
+    {0x40080042, VR_LO, "Results ID Issuer"},
+    {0x40080050, VR_SQ, "Referenced Interpretation Sequence"},
+    {0x400800FF, VR_CS, "Report Production Status (Trial)"},
+    {0x40080100, VR_DA, "Interpretation Recorded Date"},
+    {0x40080101, VR_TM, "Interpretation Recorded Time"},
+    {0x40080102, VR_PN, "Interpretation Recorder"},
+    {0x40080103, VR_LO, "Reference to Recorded Sound"},
+    {0x40080108, VR_DA, "Interpretation Transcription Date"},
+    {0x40080109, VR_TM, "Interpretation Transcription Time"},
+    {0x4008010A, VR_PN, "Interpretation Transcriber"},
+    {0x4008010B, VR_ST, "Interpretation Text"},
+    {0x4008010C, VR_PN, "Interpretation Author"},
+    {0x40080111, VR_SQ, "Interpretation Approver Sequence"},
+    {0x40080112, VR_DA, "Interpretation Approval Date"},
+    {0x40080113, VR_TM, "Interpretation Approval Time"},
+    {0x40080114, VR_PN, "Physician Approving Interpretation"},
+    {0x40080115, VR_LT, "Interpretation Diagnosis Description"},
+    {0x40080117, VR_SQ, "Interpretation Diagnosis Code Sequence"},
+    {0x40080118, VR_SQ, "Results Distribution List Sequence"},
+    {0x40080119, VR_PN, "Distribution Name"},
+    {0x4008011A, VR_LO, "Distribution Address"},
+    {0x40080200, VR_SH, "Interpretation ID"},
+    {0x40080202, VR_LO, "Interpretation ID Issuer"},
+    {0x40080210, VR_CS, "Interpretation Type ID"},
+    {0x40080212, VR_CS, "Interpretation Status ID"},
+    {0x40080300, VR_ST, "Impressions"},
+    {0x40084000, VR_ST, "Results Comments"},
+    {0x40100001, VR_CS, "Low Energy Detectors"},
+    {0x40100002, VR_CS, "High Energy Detectors"},
+    {0x40100004, VR_SQ, "Detector Geometry Sequence"},
+    {0x40101001, VR_SQ, "Threat ROI Voxel Sequence"},
+    {0x40101004, VR_FL, "Threat ROI Base"},
+    {0x40101005, VR_FL, "Threat ROI Extents"},
+    {0x40101006, VR_OB, "Threat ROI Bitmap"},
+    {0x40101007, VR_SH, "Route Segment ID"},
+    {0x40101008, VR_CS, "Gantry Type"},
+    {0x40101009, VR_CS, "OOI Owner Type"},
+    {0x4010100A, VR_SQ, "Route Segment Sequence"},
+    {0x40101010, VR_US, "Potential Threat Object ID"},
+    {0x40101011, VR_SQ, "Threat Sequence"},
+    {0x40101012, VR_CS, "Threat Category"},
+    {0x40101013, VR_LT, "Threat Category Description"},
+    {0x40101014, VR_CS, "ATD Ability Assessment"},
+    {0x40101015, VR_CS, "ATD Assessment Flag"},
+    {0x40101016, VR_FL, "ATD Assessment Probability"},
+    {0x40101017, VR_FL, "Mass"},
+    {0x40101018, VR_FL, "Density"},
+    {0x40101019, VR_FL, "Z Effective"},
+    {0x4010101A, VR_SH, "Boarding Pass ID"},
+    {0x4010101B, VR_FL, "Center of Mass"},
+    {0x4010101C, VR_FL, "Center of PTO"},
+    {0x4010101D, VR_FL, "Bounding Polygon"},
+    {0x4010101E, VR_SH, "Route Segment Start Location ID"},
+    {0x4010101F, VR_SH, "Route Segment End Location ID"},
+    {0x40101020, VR_CS, "Route Segment Location ID Type"},
+    {0x40101021, VR_CS, "Abort Reason"},
+    {0x40101023, VR_FL, "Volume of PTO"},
+    {0x40101024, VR_CS, "Abort Flag"},
+    {0x40101025, VR_DT, "Route Segment Start Time"},
+    {0x40101026, VR_DT, "Route Segment End Time"},
+    {0x40101027, VR_CS, "TDR Type"},
+    {0x40101028, VR_CS, "International Route Segment"},
+    {0x40101029, VR_LO, "Threat Detection Algorithm and Version"},
+    {0x4010102A, VR_SH, "Assigned Location"},
+    {0x4010102B, VR_DT, "Alarm Decision Time"},
+    {0x40101031, VR_CS, "Alarm Decision"},
+    {0x40101033, VR_US, "Number of Total Objects"},
+    {0x40101034, VR_US, "Number of Alarm Objects"},
+    {0x40101037, VR_SQ, "PTO Representation Sequence"},
+    {0x40101038, VR_SQ, "ATD Assessment Sequence"},
+    {0x40101039, VR_CS, "TIP Type"},
+    {0x4010103A, VR_CS, "Version"},
+    {0x40101041, VR_DT, "OOI Owner Creation Time"},
+    {0x40101042, VR_CS, "OOI Type"},
+    {0x40101043, VR_FL, "OOI Size"},
+    {0x40101044, VR_CS, "Acquisition Status"},
+    {0x40101045, VR_SQ, "Basis Materials Code Sequence"},
+    {0x40101046, VR_CS, "Phantom Type"},
+    {0x40101047, VR_SQ, "OOI Owner Sequence"},
+    {0x40101048, VR_CS, "Scan Type"},
+    {0x40101051, VR_LO, "Itinerary ID"},
+    {0x40101052, VR_SH, "Itinerary ID Type"},
+    {0x40101053, VR_LO, "Itinerary ID Assigning Authority"},
+    {0x40101054, VR_SH, "Route ID"},
+    {0x40101055, VR_SH, "Route ID Assigning Authority"},
+    {0x40101056, VR_CS, "Inbound Arrival Type"},
+    {0x40101058, VR_SH, "Carrier ID"},
+    {0x40101059, VR_CS, "Carrier ID Assigning Authority"},
+    {0x40101060, VR_FL, "Source Orientation"},
+    {0x40101061, VR_FL, "Source Position"},
+    {0x40101062, VR_FL, "Belt Height"},
+    {0x40101064, VR_SQ, "Algorithm Routing Code Sequence"},
+    {0x40101067, VR_CS, "Transport Classification"},
+    {0x40101068, VR_LT, "OOI Type Descriptor"},
+    {0x40101069, VR_FL, "Total Processing Time"},
+    {0x4010106C, VR_OB, "Detector Calibration Data"},
+    {0x4010106D, VR_CS, "Additional Screening Performed"},
+    {0x4010106E, VR_CS, "Additional Inspection Selection Criteria"},
+    {0x4010106F, VR_SQ, "Additional Inspection Method Sequence"},
+    {0x40101070, VR_CS, "AIT Device Type"},
+    {0x40101071, VR_SQ, "QR Measurements Sequence"},
+    {0x40101072, VR_SQ, "Target Material Sequence"},
+    {0x40101073, VR_FD, "SNR Threshold"},
+    {0x40101075, VR_DS, "Image Scale Representation"},
+    {0x40101076, VR_SQ, "Referenced PTO Sequence"},
+    {0x40101077, VR_SQ, "Referenced TDR Instance Sequence"},
+    {0x40101078, VR_ST, "PTO Location Description"},
+    {0x40101079, VR_SQ, "Anomaly Locator Indicator Sequence"},
+    {0x4010107A, VR_FL, "Anomaly Locator Indicator"},
+    {0x4010107B, VR_SQ, "PTO Region Sequence"},
+    {0x4010107C, VR_CS, "Inspection Selection Criteria"},
+    {0x4010107D, VR_SQ, "Secondary Inspection Method Sequence"},
+    {0x4010107E, VR_DS, "PRCS to RCS Orientation"},
+    {0x4FFE0001, VR_SQ, "MAC Parameters Sequence"},
+    {0x52009229, VR_SQ, "Shared Functional Groups Sequence"},
+    {0x52009230, VR_SQ, "Per-frame Functional Groups Sequence"},
+    {0x54000100, VR_SQ, "Waveform Sequence"},
+    {0x54000110, VR_OB, "Channel Minimum Value"},
+    {0x54000112, VR_OB, "Channel Maximum Value"},
+    {0x54001004, VR_US, "Waveform Bits Allocated"},
+    {0x54001006, VR_CS, "Waveform Sample Interpretation"},
+    {0x5400100A, VR_OB, "Waveform Padding Value"},
+    {0x54001010, VR_OB, "Waveform Data"},
+    {0x56000010, VR_OF, "First Order Phase Correction Angle"},
+    {0x56000020, VR_OF, "Spectroscopy Data"},
+    {0x7FE00008, VR_OF, "Float Pixel Data"},
+    {0x7FE00009, VR_OD, "Double Float Pixel Data"},
+    {0x7FE00010, VR_OB, "Pixel Data"},
+    {0x7FE00020, VR_OW, "Coefficients SDVN"},
+    {0x7FE00030, VR_OW, "Coefficients SDHN"},
+    {0x7FE00040, VR_OW, "Coefficients SDDN"},
+    {0xFFFAFFFA, VR_SQ, "Digital Signatures Sequence"},
+    {0xFFFCFFFC, VR_OB, "Data Set Trailing Padding"},
+    {0xFFFEE000, VR_NONE, "Item"},
+    {0xFFFEE00D, VR_NONE, "Item Delimitation Item"},
+    {0xFFFEE0DD, VR_NONE, "Sequence Delimitation Item"},
+};
 
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0000;
-    x->title="File Meta Information Group Length";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0001;
-    x->title="File Meta Information Version";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0002;
-    x->title="Media Storage SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0003;
-    x->title="Media Storage SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0010;
-    x->title="Transfer Syntax UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0012;
-    x->title="Implementation Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0013;
-    x->title="Implementation Version Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0016;
-    x->title="Source Application Entity Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0017;
-    x->title="Sending Application Entity Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0018;
-    x->title="Receiving Application Entity Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0100;
-    x->title="Private Information Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0102;
-    x->title="Private Information";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1130;
-    x->title="File-set ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1141;
-    x->title="File-set Descriptor File ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1142;
-    x->title="Specific Character Set of File-set Descriptor File";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1200;
-    x->title="Offset of the First Directory Record of the Root Directory Entity";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1202;
-    x->title="Offset of the Last Directory Record of the Root Directory Entity";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1212;
-    x->title="File-set Consistency Flag";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1220;
-    x->title="Directory Record Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1400;
-    x->title="Offset of the Next Directory Record";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1410;
-    x->title="Record In-use Flag";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1420;
-    x->title="Offset of Referenced Lower-Level Directory Entity";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1430;
-    x->title="Directory Record Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1432;
-    x->title="Private Record UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1500;
-    x->title="Referenced File ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1504;
-    x->title="MRDR Directory Record Offset";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1510;
-    x->title="Referenced SOP Class UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1511;
-    x->title="Referenced SOP Instance UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1512;
-    x->title="Referenced Transfer Syntax UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x151A;
-    x->title="Referenced Related General SOP Class UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1600;
-    x->title="Number of References";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0001;
-    x->title="Length to End";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0005;
-    x->title="Specific Character Set";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0006;
-    x->title="Language Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0008;
-    x->title="Image Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0010;
-    x->title="Recognition Code";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0012;
-    x->title="Instance Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0013;
-    x->title="Instance Creation Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0014;
-    x->title="Instance Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0015;
-    x->title="Instance Coercion DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0016;
-    x->title="SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0018;
-    x->title="SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x001A;
-    x->title="Related General SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x001B;
-    x->title="Original Specialized SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0020;
-    x->title="Study Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0021;
-    x->title="Series Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0022;
-    x->title="Acquisition Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0023;
-    x->title="Content Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0024;
-    x->title="Overlay Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0025;
-    x->title="Curve Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x002A;
-    x->title="Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0030;
-    x->title="Study Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0031;
-    x->title="Series Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0032;
-    x->title="Acquisition Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0033;
-    x->title="Content Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0034;
-    x->title="Overlay Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0035;
-    x->title="Curve Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0040;
-    x->title="Data Set Type";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0041;
-    x->title="Data Set Subtype";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0042;
-    x->title="Nuclear Medicine Series Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0050;
-    x->title="Accession Number";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0051;
-    x->title="Issuer of Accession Number Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0052;
-    x->title="Query/Retrieve Level";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0053;
-    x->title="Query/Retrieve View";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0054;
-    x->title="Retrieve AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0055;
-    x->title="Station AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0056;
-    x->title="Instance Availability";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0058;
-    x->title="Failed SOP Instance UID List";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0060;
-    x->title="Modality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0061;
-    x->title="Modalities in Study";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0062;
-    x->title="SOP Classes in Study";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0064;
-    x->title="Conversion Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0068;
-    x->title="Presentation Intent Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0070;
-    x->title="Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0080;
-    x->title="Institution Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0081;
-    x->title="Institution Address";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0082;
-    x->title="Institution Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0090;
-    x->title="Referring Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0092;
-    x->title="Referring Physician's Address";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0094;
-    x->title="Referring Physician's Telephone Numbers";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0096;
-    x->title="Referring Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x009C;
-    x->title="Consulting Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x009D;
-    x->title="Consulting Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0100;
-    x->title="Code Value";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0101;
-    x->title="Extended Code Value";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0102;
-    x->title="Coding Scheme Designator";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0103;
-    x->title="Coding Scheme Version";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0104;
-    x->title="Code Meaning";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0105;
-    x->title="Mapping Resource";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0106;
-    x->title="Context Group Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0107;
-    x->title="Context Group Local Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0108;
-    x->title="Extended Code Meaning";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010B;
-    x->title="Context Group Extension Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010C;
-    x->title="Coding Scheme UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010D;
-    x->title="Context Group Extension Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010F;
-    x->title="Context Identifier";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0110;
-    x->title="Coding Scheme Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0112;
-    x->title="Coding Scheme Registry";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0114;
-    x->title="Coding Scheme External ID";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0115;
-    x->title="Coding Scheme Name";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0116;
-    x->title="Coding Scheme Responsible Organization";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0117;
-    x->title="Context UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0118;
-    x->title="Mapping Resource UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0119;
-    x->title="Long Code Value";
-    x->vr="UC";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0120;
-    x->title="URN Code Value";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0121;
-    x->title="Equivalent Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0122;
-    x->title="Mapping Resource Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0123;
-    x->title="Context Group Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0124;
-    x->title="Mapping Resource Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0201;
-    x->title="Timezone Offset From UTC";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0300;
-    x->title="Private Data Element Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0301;
-    x->title="Private Group Reference";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0302;
-    x->title="Private Creator Reference";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0303;
-    x->title="Block Identifying Information Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0304;
-    x->title="Nonidentifying Private Elements";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0306;
-    x->title="Identifying Private Elements";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0305;
-    x->title="Deidentification Action Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0307;
-    x->title="Deidentification Action";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1000;
-    x->title="Network ID";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1010;
-    x->title="Station Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1030;
-    x->title="Study Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1032;
-    x->title="Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x103E;
-    x->title="Series Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x103F;
-    x->title="Series Description Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1040;
-    x->title="Institutional Department Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1048;
-    x->title="Physician(s) of Record";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1049;
-    x->title="Physician(s) of Record Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1050;
-    x->title="Performing Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1052;
-    x->title="Performing Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1060;
-    x->title="Name of Physician(s) Reading Study";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1062;
-    x->title="Physician(s) Reading Study Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1070;
-    x->title="Operators' Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1072;
-    x->title="Operator Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1080;
-    x->title="Admitting Diagnoses Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1084;
-    x->title="Admitting Diagnoses Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1090;
-    x->title="Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1100;
-    x->title="Referenced Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1110;
-    x->title="Referenced Study Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1111;
-    x->title="Referenced Performed Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1115;
-    x->title="Referenced Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1120;
-    x->title="Referenced Patient Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1125;
-    x->title="Referenced Visit Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1130;
-    x->title="Referenced Overlay Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1134;
-    x->title="Referenced Stereometric Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x113A;
-    x->title="Referenced Waveform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1140;
-    x->title="Referenced Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1145;
-    x->title="Referenced Curve Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x114A;
-    x->title="Referenced Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x114B;
-    x->title="Referenced Real World Value Mapping Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1150;
-    x->title="Referenced SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1155;
-    x->title="Referenced SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x115A;
-    x->title="SOP Classes Supported";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1160;
-    x->title="Referenced Frame Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1161;
-    x->title="Simple Frame List";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1162;
-    x->title="Calculated Frame List";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1163;
-    x->title="Time Range";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1164;
-    x->title="Frame Extraction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1167;
-    x->title="Multi-frame Source SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1190;
-    x->title="Retrieve URL";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1195;
-    x->title="Transaction UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1196;
-    x->title="Warning Reason";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1197;
-    x->title="Failure Reason";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1198;
-    x->title="Failed SOP Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1199;
-    x->title="Referenced SOP Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x119A;
-    x->title="Other Failures Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1200;
-    x->title="Studies Containing Other Referenced Instances Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1250;
-    x->title="Related Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2110;
-    x->title="Lossy Image Compression (Retired)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2111;
-    x->title="Derivation Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2112;
-    x->title="Source Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2120;
-    x->title="Stage Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2122;
-    x->title="Stage Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2124;
-    x->title="Number of Stages";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2127;
-    x->title="View Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2128;
-    x->title="View Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2129;
-    x->title="Number of Event Timers";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x212A;
-    x->title="Number of Views in Stage";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2130;
-    x->title="Event Elapsed Time(s)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2132;
-    x->title="Event Timer Name(s)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2133;
-    x->title="Event Timer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2134;
-    x->title="Event Time Offset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2135;
-    x->title="Event Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2142;
-    x->title="Start Trim";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2143;
-    x->title="Stop Trim";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2144;
-    x->title="Recommended Display Frame Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2200;
-    x->title="Transducer Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2204;
-    x->title="Transducer Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2208;
-    x->title="Anatomic Structure";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2218;
-    x->title="Anatomic Region Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2220;
-    x->title="Anatomic Region Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2228;
-    x->title="Primary Anatomic Structure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2229;
-    x->title="Anatomic Structure, Space or Region Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2230;
-    x->title="Primary Anatomic Structure Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2240;
-    x->title="Transducer Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2242;
-    x->title="Transducer Position Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2244;
-    x->title="Transducer Orientation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2246;
-    x->title="Transducer Orientation Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2251;
-    x->title="Anatomic Structure Space Or Region Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2253;
-    x->title="Anatomic Portal Of Entrance Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2255;
-    x->title="Anatomic Approach Direction Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2256;
-    x->title="Anatomic Perspective Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2257;
-    x->title="Anatomic Perspective Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2258;
-    x->title="Anatomic Location Of Examining Instrument Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2259;
-    x->title="Anatomic Location Of Examining Instrument Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x225A;
-    x->title="Anatomic Structure Space Or Region Modifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x225C;
-    x->title="On Axis Background Anatomic Structure Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3001;
-    x->title="Alternate Representation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3010;
-    x->title="Irradiation Event UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3011;
-    x->title="Source Irradiation Event Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3012;
-    x->title="Radiopharmaceutical Administration Event UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x4000;
-    x->title="Identifying Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9007;
-    x->title="Frame Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9092;
-    x->title="Referenced Image Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9121;
-    x->title="Referenced Raw Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9123;
-    x->title="Creator-Version UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9124;
-    x->title="Derivation Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9154;
-    x->title="Source Image Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9205;
-    x->title="Pixel Presentation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9206;
-    x->title="Volumetric Properties";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9207;
-    x->title="Volume Based Calculation Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9208;
-    x->title="Complex Image Component";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9209;
-    x->title="Acquisition Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9215;
-    x->title="Derivation Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9237;
-    x->title="Referenced Presentation State Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9410;
-    x->title="Referenced Other Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9458;
-    x->title="Frame Display Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9459;
-    x->title="Recommended Display Frame Rate in Float";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9460;
-    x->title="Skip Frame Range Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0010;
-    x->title="Patient's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0020;
-    x->title="Patient ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0021;
-    x->title="Issuer of Patient ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0022;
-    x->title="Type of Patient ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0024;
-    x->title="Issuer of Patient ID Qualifiers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0026;
-    x->title="Source Patient Group Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0027;
-    x->title="Group of Patients Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0028;
-    x->title="Subject Relative Position in Image";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0030;
-    x->title="Patient's Birth Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0032;
-    x->title="Patient's Birth Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0033;
-    x->title="Patient's Birth Date in Alternative Calendar";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0034;
-    x->title="Patient's Death Date in Alternative Calendar";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0035;
-    x->title="Patient's Alternative Calendar";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0040;
-    x->title="Patient's Sex";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0050;
-    x->title="Patient's Insurance Plan Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0101;
-    x->title="Patient's Primary Language Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0102;
-    x->title="Patient's Primary Language Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0200;
-    x->title="Quality Control Subject";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0201;
-    x->title="Quality Control Subject Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0212;
-    x->title="Strain Description";
-    x->vr="UC";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0213;
-    x->title="Strain Nomenclature";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0214;
-    x->title="Strain Stock Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0215;
-    x->title="Strain Source Registry Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0216;
-    x->title="Strain Stock Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0217;
-    x->title="Strain Source";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0218;
-    x->title="Strain Additional Information";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0219;
-    x->title="Strain Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1000;
-    x->title="Other Patient IDs";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1001;
-    x->title="Other Patient Names";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1002;
-    x->title="Other Patient IDs Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1005;
-    x->title="Patient's Birth Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1010;
-    x->title="Patient's Age";
-    x->vr="AS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1020;
-    x->title="Patient's Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1021;
-    x->title="Patient's Size Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1030;
-    x->title="Patient's Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1040;
-    x->title="Patient's Address";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1050;
-    x->title="Insurance Plan Identification";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1060;
-    x->title="Patient's Mother's Birth Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1080;
-    x->title="Military Rank";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1081;
-    x->title="Branch of Service";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1090;
-    x->title="Medical Record Locator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1100;
-    x->title="Referenced Patient Photo Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2000;
-    x->title="Medical Alerts";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2110;
-    x->title="Allergies";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2150;
-    x->title="Country of Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2152;
-    x->title="Region of Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2154;
-    x->title="Patient's Telephone Numbers";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2155;
-    x->title="Patient's Telecom Information";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2160;
-    x->title="Ethnic Group";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2180;
-    x->title="Occupation";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21A0;
-    x->title="Smoking Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21B0;
-    x->title="Additional Patient History";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21C0;
-    x->title="Pregnancy Status";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21D0;
-    x->title="Last Menstrual Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21F0;
-    x->title="Patient's Religious Preference";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2201;
-    x->title="Patient Species Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2202;
-    x->title="Patient Species Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2203;
-    x->title="Patient's Sex Neutered";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2210;
-    x->title="Anatomical Orientation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2292;
-    x->title="Patient Breed Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2293;
-    x->title="Patient Breed Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2294;
-    x->title="Breed Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2295;
-    x->title="Breed Registration Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2296;
-    x->title="Breed Registry Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2297;
-    x->title="Responsible Person";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2298;
-    x->title="Responsible Person Role";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2299;
-    x->title="Responsible Organization";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x4000;
-    x->title="Patient Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x9431;
-    x->title="Examined Body Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0010;
-    x->title="Clinical Trial Sponsor Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0020;
-    x->title="Clinical Trial Protocol ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0021;
-    x->title="Clinical Trial Protocol Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0030;
-    x->title="Clinical Trial Site ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0031;
-    x->title="Clinical Trial Site Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0040;
-    x->title="Clinical Trial Subject ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0042;
-    x->title="Clinical Trial Subject Reading ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0050;
-    x->title="Clinical Trial Time Point ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0051;
-    x->title="Clinical Trial Time Point Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0060;
-    x->title="Clinical Trial Coordinating Center Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0062;
-    x->title="Patient Identity Removed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0063;
-    x->title="De-identification Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0064;
-    x->title="De-identification Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0071;
-    x->title="Clinical Trial Series ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0072;
-    x->title="Clinical Trial Series Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0081;
-    x->title="Clinical Trial Protocol Ethics Committee Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0082;
-    x->title="Clinical Trial Protocol Ethics Committee Approval Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0083;
-    x->title="Consent for Clinical Trial Use Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0084;
-    x->title="Distribution Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0085;
-    x->title="Consent for Distribution Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0023;
-    x->title="CAD File Format";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0024;
-    x->title="Component Reference System";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0025;
-    x->title="Component Manufacturing Procedure";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0028;
-    x->title="Component Manufacturer";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0030;
-    x->title="Material Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0032;
-    x->title="Material Pipe Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0034;
-    x->title="Material Isolation Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0042;
-    x->title="Material Grade";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0044;
-    x->title="Material Properties Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0045;
-    x->title="Material Properties File Format (Retired)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0046;
-    x->title="Material Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0050;
-    x->title="Component Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0052;
-    x->title="Curvature Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0054;
-    x->title="Outer Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0056;
-    x->title="Inner Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0100;
-    x->title="Component Welder IDs";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0101;
-    x->title="Secondary Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0102;
-    x->title="Secondary Review Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0103;
-    x->title="Secondary Review Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0104;
-    x->title="Secondary Reviewer Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0105;
-    x->title="Repair ID";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0106;
-    x->title="Multiple Component Approval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0107;
-    x->title="Other Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0108;
-    x->title="Other Secondary Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x1010;
-    x->title="Actual Environmental Conditions";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x1020;
-    x->title="Expiry Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x1040;
-    x->title="Environmental Conditions";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2002;
-    x->title="Evaluator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2004;
-    x->title="Evaluator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2006;
-    x->title="Evaluator Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2008;
-    x->title="Evaluation Attempt";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2012;
-    x->title="Indication Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2014;
-    x->title="Indication Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2016;
-    x->title="Indication Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2018;
-    x->title="Indication Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x201A;
-    x->title="Indication Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x201C;
-    x->title="Indication Disposition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x201E;
-    x->title="Indication ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2030;
-    x->title="Indication Physical Property Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2032;
-    x->title="Property Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2202;
-    x->title="Coordinate System Number of Axes";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2204;
-    x->title="Coordinate System Axes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2206;
-    x->title="Coordinate System Axis Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2208;
-    x->title="Coordinate System Data Set Mapping";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x220A;
-    x->title="Coordinate System Axis Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x220C;
-    x->title="Coordinate System Axis Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x220E;
-    x->title="Coordinate System Axis Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2210;
-    x->title="Coordinate System Axis Values";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2220;
-    x->title="Coordinate System Transform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2222;
-    x->title="Transform Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2224;
-    x->title="Transform Number of Axes";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2226;
-    x->title="Transform Order of Axes";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2228;
-    x->title="Transformed Axis Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x222A;
-    x->title="Coordinate System Transform Rotation and Scale Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x222C;
-    x->title="Coordinate System Transform Translation Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3011;
-    x->title="Internal Detector Frame Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3012;
-    x->title="Number of Frames Integrated";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3020;
-    x->title="Detector Temperature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3022;
-    x->title="Sensor Name";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3024;
-    x->title="Horizontal Offset of Sensor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3026;
-    x->title="Vertical Offset of Sensor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3028;
-    x->title="Sensor Temperature";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3040;
-    x->title="Dark Current Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3050;
-    x->title="Dark Current Counts";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3060;
-    x->title="Gain Correction Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3070;
-    x->title="Air Counts";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3071;
-    x->title="KV Used in Gain Calibration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3072;
-    x->title="MA Used in Gain Calibration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3073;
-    x->title="Number of Frames Used for Integration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3074;
-    x->title="Filter Material Used in Gain Calibration";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3075;
-    x->title="Filter Thickness Used in Gain Calibration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3076;
-    x->title="Date of Gain Calibration";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3077;
-    x->title="Time of Gain Calibration";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3080;
-    x->title="Bad Pixel Image";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3099;
-    x->title="Calibration Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4002;
-    x->title="Pulser Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4004;
-    x->title="Pulser Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4006;
-    x->title="Pulser Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4008;
-    x->title="Receiver Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400A;
-    x->title="Amplifier Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400C;
-    x->title="Receiver Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400E;
-    x->title="Pre-Amplifier Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400F;
-    x->title="Pre-Amplifier Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4010;
-    x->title="Transmit Transducer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4011;
-    x->title="Receive Transducer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4012;
-    x->title="Number of Elements";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4013;
-    x->title="Element Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4014;
-    x->title="Element Dimension A";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4015;
-    x->title="Element Dimension B";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4016;
-    x->title="Element Pitch A";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4017;
-    x->title="Measured Beam Dimension A";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4018;
-    x->title="Measured Beam Dimension B";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4019;
-    x->title="Location of Measured Beam Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401A;
-    x->title="Nominal Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401B;
-    x->title="Measured Center Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401C;
-    x->title="Measured Bandwidth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401D;
-    x->title="Element Pitch B";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4020;
-    x->title="Pulser Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4022;
-    x->title="Pulse Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4024;
-    x->title="Excitation Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4026;
-    x->title="Modulation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4028;
-    x->title="Damping";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4030;
-    x->title="Receiver Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4031;
-    x->title="Acquired Soundpath Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4032;
-    x->title="Acquisition Compression Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4033;
-    x->title="Acquisition Sample Size";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4034;
-    x->title="Rectifier Smoothing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4035;
-    x->title="DAC Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4036;
-    x->title="DAC Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4038;
-    x->title="DAC Gain Points";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x403A;
-    x->title="DAC Time Points";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x403C;
-    x->title="DAC Amplitude";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4040;
-    x->title="Pre-Amplifier Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4050;
-    x->title="Transmit Transducer Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4051;
-    x->title="Receive Transducer Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4052;
-    x->title="Incident Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4054;
-    x->title="Coupling Technique";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4056;
-    x->title="Coupling Medium";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4057;
-    x->title="Coupling Velocity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4058;
-    x->title="Probe Center Location X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4059;
-    x->title="Probe Center Location Z";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x405A;
-    x->title="Sound Path Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x405C;
-    x->title="Delay Law Identifier";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4060;
-    x->title="Gate Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4062;
-    x->title="Gate Threshold";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4064;
-    x->title="Velocity of Sound";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4070;
-    x->title="Calibration Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4072;
-    x->title="Calibration Procedure";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4074;
-    x->title="Procedure Version";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4076;
-    x->title="Procedure Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4078;
-    x->title="Procedure Expiration Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x407A;
-    x->title="Procedure Last Modified Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x407C;
-    x->title="Calibration Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x407E;
-    x->title="Calibration Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4080;
-    x->title="Probe Drive Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4081;
-    x->title="Drive Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4082;
-    x->title="Probe Drive Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4083;
-    x->title="Drive Probe Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4084;
-    x->title="Probe Inductance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4085;
-    x->title="Probe Resistance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4086;
-    x->title="Receive Probe Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4087;
-    x->title="Probe Drive Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4088;
-    x->title="Bridge Resistors";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4089;
-    x->title="Probe Orientation Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408B;
-    x->title="User Selected Gain Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408C;
-    x->title="User Selected Phase";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408D;
-    x->title="User Selected Offset X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408E;
-    x->title="User Selected Offset Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4091;
-    x->title="Channel Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4092;
-    x->title="Channel Threshold";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409A;
-    x->title="Scanner Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409B;
-    x->title="Scan Procedure";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409C;
-    x->title="Translation Rate X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409D;
-    x->title="Translation Rate Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409F;
-    x->title="Channel Overlap";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x40A0;
-    x->title="Image Quality Indicator Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x40A1;
-    x->title="Image Quality Indicator Material";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x40A2;
-    x->title="Image Quality Indicator Size";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5002;
-    x->title="LINAC Energy";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5004;
-    x->title="LINAC Output";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5100;
-    x->title="Active Aperture";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5101;
-    x->title="Total Aperture";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5102;
-    x->title="Aperture Elevation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5103;
-    x->title="Main Lobe Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5104;
-    x->title="Main Roof Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5105;
-    x->title="Connector Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5106;
-    x->title="Wedge Model Number";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5107;
-    x->title="Wedge Angle Float";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5108;
-    x->title="Wedge Roof Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5109;
-    x->title="Wedge Element 1 Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510A;
-    x->title="Wedge Material Velocity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510B;
-    x->title="Wedge Material";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510C;
-    x->title="Wedge Offset Z";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510D;
-    x->title="Wedge Origin Offset X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510E;
-    x->title="Wedge Time Delay";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510F;
-    x->title="Wedge Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5110;
-    x->title="Wedge Manufacturer Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5111;
-    x->title="Wedge Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5112;
-    x->title="Nominal Beam Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5113;
-    x->title="Wedge Offset X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5114;
-    x->title="Wedge Offset Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5115;
-    x->title="Wedge Total Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5116;
-    x->title="Wedge In Contact Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5117;
-    x->title="Wedge Front Gap";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5118;
-    x->title="Wedge Total Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5119;
-    x->title="Wedge Front Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511A;
-    x->title="Wedge Rear Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511B;
-    x->title="Wedge Total Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511C;
-    x->title="Wedge In Contact Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511D;
-    x->title="Wedge Chamfer Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511E;
-    x->title="Wedge Curve";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511F;
-    x->title="Radius Along the Wedge";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0010;
-    x->title="Contrast/Bolus Agent";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0012;
-    x->title="Contrast/Bolus Agent Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0013;
-    x->title="Contrast/Bolus T1 Relaxivity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0014;
-    x->title="Contrast/Bolus Administration Route Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0015;
-    x->title="Body Part Examined";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0020;
-    x->title="Scanning Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0021;
-    x->title="Sequence Variant";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0022;
-    x->title="Scan Options";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0023;
-    x->title="MR Acquisition Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0024;
-    x->title="Sequence Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0025;
-    x->title="Angio Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0026;
-    x->title="Intervention Drug Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0027;
-    x->title="Intervention Drug Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0028;
-    x->title="Intervention Drug Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0029;
-    x->title="Intervention Drug Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x002A;
-    x->title="Additional Drug Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0030;
-    x->title="Radionuclide";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0031;
-    x->title="Radiopharmaceutical";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0032;
-    x->title="Energy Window Centerline";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0033;
-    x->title="Energy Window Total Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0034;
-    x->title="Intervention Drug Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0035;
-    x->title="Intervention Drug Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0036;
-    x->title="Intervention Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0037;
-    x->title="Therapy Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0038;
-    x->title="Intervention Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0039;
-    x->title="Therapy Description";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x003A;
-    x->title="Intervention Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0040;
-    x->title="Cine Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0042;
-    x->title="Initial Cine Run State";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0050;
-    x->title="Slice Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0060;
-    x->title="KVP";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0061;
-    x->title="";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0070;
-    x->title="Counts Accumulated";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0071;
-    x->title="Acquisition Termination Condition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0072;
-    x->title="Effective Duration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0073;
-    x->title="Acquisition Start Condition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0074;
-    x->title="Acquisition Start Condition Data";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0075;
-    x->title="Acquisition Termination Condition Data";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0080;
-    x->title="Repetition Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0081;
-    x->title="Echo Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0082;
-    x->title="Inversion Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0083;
-    x->title="Number of Averages";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0084;
-    x->title="Imaging Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0085;
-    x->title="Imaged Nucleus";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0086;
-    x->title="Echo Number(s)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0087;
-    x->title="Magnetic Field Strength";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0088;
-    x->title="Spacing Between Slices";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0089;
-    x->title="Number of Phase Encoding Steps";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0090;
-    x->title="Data Collection Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0091;
-    x->title="Echo Train Length";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0093;
-    x->title="Percent Sampling";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0094;
-    x->title="Percent Phase Field of View";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0095;
-    x->title="Pixel Bandwidth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1000;
-    x->title="Device Serial Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1002;
-    x->title="Device UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1003;
-    x->title="Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1004;
-    x->title="Plate ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1005;
-    x->title="Generator ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1006;
-    x->title="Grid ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1007;
-    x->title="Cassette ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1008;
-    x->title="Gantry ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1010;
-    x->title="Secondary Capture Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1011;
-    x->title="Hardcopy Creation Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1012;
-    x->title="Date of Secondary Capture";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1014;
-    x->title="Time of Secondary Capture";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1016;
-    x->title="Secondary Capture Device Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1017;
-    x->title="Hardcopy Device Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1018;
-    x->title="Secondary Capture Device Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1019;
-    x->title="Secondary Capture Device Software Versions";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x101A;
-    x->title="Hardcopy Device Software Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x101B;
-    x->title="Hardcopy Device Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1020;
-    x->title="Software Version(s)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1022;
-    x->title="Video Image Format Acquired";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1023;
-    x->title="Digital Image Format Acquired";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1030;
-    x->title="Protocol Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1040;
-    x->title="Contrast/Bolus Route";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1041;
-    x->title="Contrast/Bolus Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1042;
-    x->title="Contrast/Bolus Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1043;
-    x->title="Contrast/Bolus Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1044;
-    x->title="Contrast/Bolus Total Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1045;
-    x->title="Syringe Counts";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1046;
-    x->title="Contrast Flow Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1047;
-    x->title="Contrast Flow Duration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1048;
-    x->title="Contrast/Bolus Ingredient";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1049;
-    x->title="Contrast/Bolus Ingredient Concentration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1050;
-    x->title="Spatial Resolution";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1060;
-    x->title="Trigger Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1061;
-    x->title="Trigger Source or Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1062;
-    x->title="Nominal Interval";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1063;
-    x->title="Frame Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1064;
-    x->title="Cardiac Framing Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1065;
-    x->title="Frame Time Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1066;
-    x->title="Frame Delay";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1067;
-    x->title="Image Trigger Delay";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1068;
-    x->title="Multiplex Group Time Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1069;
-    x->title="Trigger Time Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x106A;
-    x->title="Synchronization Trigger";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x106C;
-    x->title="Synchronization Channel";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x106E;
-    x->title="Trigger Sample Position";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1070;
-    x->title="Radiopharmaceutical Route";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1071;
-    x->title="Radiopharmaceutical Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1072;
-    x->title="Radiopharmaceutical Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1073;
-    x->title="Radiopharmaceutical Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1074;
-    x->title="Radionuclide Total Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1075;
-    x->title="Radionuclide Half Life";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1076;
-    x->title="Radionuclide Positron Fraction";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1077;
-    x->title="Radiopharmaceutical Specific Activity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1078;
-    x->title="Radiopharmaceutical Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1079;
-    x->title="Radiopharmaceutical Stop DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1080;
-    x->title="Beat Rejection Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1081;
-    x->title="Low R-R Value";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1082;
-    x->title="High R-R Value";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1083;
-    x->title="Intervals Acquired";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1084;
-    x->title="Intervals Rejected";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1085;
-    x->title="PVC Rejection";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1086;
-    x->title="Skip Beats";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1088;
-    x->title="Heart Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1090;
-    x->title="Cardiac Number of Images";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1094;
-    x->title="Trigger Window";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1100;
-    x->title="Reconstruction Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1110;
-    x->title="Distance Source to Detector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1111;
-    x->title="Distance Source to Patient";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1114;
-    x->title="Estimated Radiographic Magnification Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1120;
-    x->title="Gantry/Detector Tilt";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1121;
-    x->title="Gantry/Detector Slew";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1130;
-    x->title="Table Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1131;
-    x->title="Table Traverse";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1134;
-    x->title="Table Motion";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1135;
-    x->title="Table Vertical Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1136;
-    x->title="Table Lateral Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1137;
-    x->title="Table Longitudinal Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1138;
-    x->title="Table Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x113A;
-    x->title="Table Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1140;
-    x->title="Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1141;
-    x->title="Angular Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1142;
-    x->title="Radial Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1143;
-    x->title="Scan Arc";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1144;
-    x->title="Angular Step";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1145;
-    x->title="Center of Rotation Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1146;
-    x->title="Rotation Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1147;
-    x->title="Field of View Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1149;
-    x->title="Field of View Dimension(s)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1150;
-    x->title="Exposure Time";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1151;
-    x->title="X-Ray Tube Current";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1152;
-    x->title="Exposure";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1153;
-    x->title="Exposure in µAs";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1154;
-    x->title="Average Pulse Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1155;
-    x->title="Radiation Setting";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1156;
-    x->title="Rectification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x115A;
-    x->title="Radiation Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x115E;
-    x->title="Image and Fluoroscopy Area Dose Product";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1160;
-    x->title="Filter Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1161;
-    x->title="Type of Filters";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1162;
-    x->title="Intensifier Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1164;
-    x->title="Imager Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1166;
-    x->title="Grid";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1170;
-    x->title="Generator Power";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1180;
-    x->title="Collimator/grid Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1181;
-    x->title="Collimator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1182;
-    x->title="Focal Distance";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1183;
-    x->title="X Focus Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1184;
-    x->title="Y Focus Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1190;
-    x->title="Focal Spot(s)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1191;
-    x->title="Anode Target Material";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x11A0;
-    x->title="Body Part Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x11A2;
-    x->title="Compression Force";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x11A4;
-    x->title="Paddle Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1200;
-    x->title="Date of Last Calibration";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1201;
-    x->title="Time of Last Calibration";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1202;
-    x->title="DateTime of Last Calibration";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1210;
-    x->title="Convolution Kernel";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1240;
-    x->title="Upper/Lower Pixel Values";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1242;
-    x->title="Actual Frame Duration";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1243;
-    x->title="Count Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1244;
-    x->title="Preferred Playback Sequencing";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1250;
-    x->title="Receive Coil Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1251;
-    x->title="Transmit Coil Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1260;
-    x->title="Plate Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1261;
-    x->title="Phosphor Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1271;
-    x->title="Water Equivalent Diameter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1272;
-    x->title="Water Equivalent Diameter Calculation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1300;
-    x->title="Scan Velocity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1301;
-    x->title="Whole Body Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1302;
-    x->title="Scan Length";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1310;
-    x->title="Acquisition Matrix";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1312;
-    x->title="In-plane Phase Encoding Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1314;
-    x->title="Flip Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1315;
-    x->title="Variable Flip Angle Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1316;
-    x->title="SAR";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1318;
-    x->title="dB/dt";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1320;
-    x->title="B1rms";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1400;
-    x->title="Acquisition Device Processing Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1401;
-    x->title="Acquisition Device Processing Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1402;
-    x->title="Cassette Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1403;
-    x->title="Cassette Size";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1404;
-    x->title="Exposures on Plate";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1405;
-    x->title="Relative X-Ray Exposure";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1411;
-    x->title="Exposure Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1412;
-    x->title="Target Exposure Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1413;
-    x->title="Deviation Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1450;
-    x->title="Column Angulation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1460;
-    x->title="Tomo Layer Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1470;
-    x->title="Tomo Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1480;
-    x->title="Tomo Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1490;
-    x->title="Tomo Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1491;
-    x->title="Tomo Class";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1495;
-    x->title="Number of Tomosynthesis Source Images";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1500;
-    x->title="Positioner Motion";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1508;
-    x->title="Positioner Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1510;
-    x->title="Positioner Primary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1511;
-    x->title="Positioner Secondary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1520;
-    x->title="Positioner Primary Angle Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1521;
-    x->title="Positioner Secondary Angle Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1530;
-    x->title="Detector Primary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1531;
-    x->title="Detector Secondary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1600;
-    x->title="Shutter Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1602;
-    x->title="Shutter Left Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1604;
-    x->title="Shutter Right Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1606;
-    x->title="Shutter Upper Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1608;
-    x->title="Shutter Lower Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1610;
-    x->title="Center of Circular Shutter";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1612;
-    x->title="Radius of Circular Shutter";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1620;
-    x->title="Vertices of the Polygonal Shutter";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1622;
-    x->title="Shutter Presentation Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1623;
-    x->title="Shutter Overlay Group";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1624;
-    x->title="Shutter Presentation Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1700;
-    x->title="Collimator Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1702;
-    x->title="Collimator Left Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1704;
-    x->title="Collimator Right Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1706;
-    x->title="Collimator Upper Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1708;
-    x->title="Collimator Lower Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1710;
-    x->title="Center of Circular Collimator";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1712;
-    x->title="Radius of Circular Collimator";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1720;
-    x->title="Vertices of the Polygonal Collimator";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1800;
-    x->title="Acquisition Time Synchronized";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1801;
-    x->title="Time Source";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1802;
-    x->title="Time Distribution Protocol";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1803;
-    x->title="NTP Source Address";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2001;
-    x->title="Page Number Vector";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2002;
-    x->title="Frame Label Vector";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2003;
-    x->title="Frame Primary Angle Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2004;
-    x->title="Frame Secondary Angle Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2005;
-    x->title="Slice Location Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2006;
-    x->title="Display Window Label Vector";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2010;
-    x->title="Nominal Scanned Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2020;
-    x->title="Digitizing Device Transport Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2030;
-    x->title="Rotation of Scanned Film";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2041;
-    x->title="Biopsy Target Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2042;
-    x->title="Target UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2043;
-    x->title="Localizing Cursor Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2044;
-    x->title="Calculated Target Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2045;
-    x->title="Target Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2046;
-    x->title="Displayed Z Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3100;
-    x->title="IVUS Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3101;
-    x->title="IVUS Pullback Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3102;
-    x->title="IVUS Gated Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3103;
-    x->title="IVUS Pullback Start Frame Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3104;
-    x->title="IVUS Pullback Stop Frame Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3105;
-    x->title="Lesion Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x4000;
-    x->title="Acquisition Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5000;
-    x->title="Output Power";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5010;
-    x->title="Transducer Data";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5012;
-    x->title="Focus Depth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5020;
-    x->title="Processing Function";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5021;
-    x->title="Postprocessing Function";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5022;
-    x->title="Mechanical Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5024;
-    x->title="Bone Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5026;
-    x->title="Cranial Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5027;
-    x->title="Soft Tissue Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5028;
-    x->title="Soft Tissue-focus Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5029;
-    x->title="Soft Tissue-surface Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5030;
-    x->title="Dynamic Range";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5040;
-    x->title="Total Gain";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5050;
-    x->title="Depth of Scan Field";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5100;
-    x->title="Patient Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5101;
-    x->title="View Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5104;
-    x->title="Projection Eponymous Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5210;
-    x->title="Image Transformation Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5212;
-    x->title="Image Translation Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6000;
-    x->title="Sensitivity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6011;
-    x->title="Sequence of Ultrasound Regions";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6012;
-    x->title="Region Spatial Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6014;
-    x->title="Region Data Type";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6016;
-    x->title="Region Flags";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6018;
-    x->title="Region Location Min X0";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x601A;
-    x->title="Region Location Min Y0";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x601C;
-    x->title="Region Location Max X1";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x601E;
-    x->title="Region Location Max Y1";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6020;
-    x->title="Reference Pixel X0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6022;
-    x->title="Reference Pixel Y0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6024;
-    x->title="Physical Units X Direction";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6026;
-    x->title="Physical Units Y Direction";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6028;
-    x->title="Reference Pixel Physical Value X";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x602A;
-    x->title="Reference Pixel Physical Value Y";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x602C;
-    x->title="Physical Delta X";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x602E;
-    x->title="Physical Delta Y";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6030;
-    x->title="Transducer Frequency";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6031;
-    x->title="Transducer Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6032;
-    x->title="Pulse Repetition Frequency";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6034;
-    x->title="Doppler Correction Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6036;
-    x->title="Steering Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6038;
-    x->title="Doppler Sample Volume X Position (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6039;
-    x->title="Doppler Sample Volume X Position";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603A;
-    x->title="Doppler Sample Volume Y Position (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603B;
-    x->title="Doppler Sample Volume Y Position";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603C;
-    x->title="TM-Line Position X0 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603D;
-    x->title="TM-Line Position X0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603E;
-    x->title="TM-Line Position Y0 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603F;
-    x->title="TM-Line Position Y0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6040;
-    x->title="TM-Line Position X1 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6041;
-    x->title="TM-Line Position X1";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6042;
-    x->title="TM-Line Position Y1 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6043;
-    x->title="TM-Line Position Y1";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6044;
-    x->title="Pixel Component Organization";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6046;
-    x->title="Pixel Component Mask";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6048;
-    x->title="Pixel Component Range Start";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x604A;
-    x->title="Pixel Component Range Stop";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x604C;
-    x->title="Pixel Component Physical Units";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x604E;
-    x->title="Pixel Component Data Type";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6050;
-    x->title="Number of Table Break Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6052;
-    x->title="Table of X Break Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6054;
-    x->title="Table of Y Break Points";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6056;
-    x->title="Number of Table Entries";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6058;
-    x->title="Table of Pixel Values";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x605A;
-    x->title="Table of Parameter Values";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6060;
-    x->title="R Wave Time Vector";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7000;
-    x->title="Detector Conditions Nominal Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7001;
-    x->title="Detector Temperature";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7004;
-    x->title="Detector Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7005;
-    x->title="Detector Configuration";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7006;
-    x->title="Detector Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7008;
-    x->title="Detector Mode";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x700A;
-    x->title="Detector ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x700C;
-    x->title="Date of Last Detector Calibration";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x700E;
-    x->title="Time of Last Detector Calibration";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7010;
-    x->title="Exposures on Detector Since Last Calibration";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7011;
-    x->title="Exposures on Detector Since Manufactured";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7012;
-    x->title="Detector Time Since Last Exposure";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7014;
-    x->title="Detector Active Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7016;
-    x->title="Detector Activation Offset From Exposure";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x701A;
-    x->title="Detector Binning";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7020;
-    x->title="Detector Element Physical Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7022;
-    x->title="Detector Element Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7024;
-    x->title="Detector Active Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7026;
-    x->title="Detector Active Dimension(s)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7028;
-    x->title="Detector Active Origin";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x702A;
-    x->title="Detector Manufacturer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x702B;
-    x->title="Detector Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7030;
-    x->title="Field of View Origin";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7032;
-    x->title="Field of View Rotation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7034;
-    x->title="Field of View Horizontal Flip";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7036;
-    x->title="Pixel Data Area Origin Relative To FOV";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7038;
-    x->title="Pixel Data Area Rotation Angle Relative To FOV";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7040;
-    x->title="Grid Absorbing Material";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7041;
-    x->title="Grid Spacing Material";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7042;
-    x->title="Grid Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7044;
-    x->title="Grid Pitch";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7046;
-    x->title="Grid Aspect Ratio";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7048;
-    x->title="Grid Period";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x704C;
-    x->title="Grid Focal Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7050;
-    x->title="Filter Material";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7052;
-    x->title="Filter Thickness Minimum";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7054;
-    x->title="Filter Thickness Maximum";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7056;
-    x->title="Filter Beam Path Length Minimum";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7058;
-    x->title="Filter Beam Path Length Maximum";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7060;
-    x->title="Exposure Control Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7062;
-    x->title="Exposure Control Mode Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7064;
-    x->title="Exposure Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7065;
-    x->title="Phototimer Setting";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x8150;
-    x->title="Exposure Time in µS";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x8151;
-    x->title="X-Ray Tube Current in µA";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9004;
-    x->title="Content Qualification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9005;
-    x->title="Pulse Sequence Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9006;
-    x->title="MR Imaging Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9008;
-    x->title="Echo Pulse Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9009;
-    x->title="Inversion Recovery";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9010;
-    x->title="Flow Compensation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9011;
-    x->title="Multiple Spin Echo";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9012;
-    x->title="Multi-planar Excitation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9014;
-    x->title="Phase Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9015;
-    x->title="Time of Flight Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9016;
-    x->title="Spoiling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9017;
-    x->title="Steady State Pulse Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9018;
-    x->title="Echo Planar Pulse Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9019;
-    x->title="Tag Angle First Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9020;
-    x->title="Magnetization Transfer";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9021;
-    x->title="T2 Preparation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9022;
-    x->title="Blood Signal Nulling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9024;
-    x->title="Saturation Recovery";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9025;
-    x->title="Spectrally Selected Suppression";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9026;
-    x->title="Spectrally Selected Excitation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9027;
-    x->title="Spatial Pre-saturation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9028;
-    x->title="Tagging";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9029;
-    x->title="Oversampling Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9030;
-    x->title="Tag Spacing First Dimension";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9032;
-    x->title="Geometry of k-Space Traversal";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9033;
-    x->title="Segmented k-Space Traversal";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9034;
-    x->title="Rectilinear Phase Encode Reordering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9035;
-    x->title="Tag Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9036;
-    x->title="Partial Fourier Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9037;
-    x->title="Cardiac Synchronization Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9041;
-    x->title="Receive Coil Manufacturer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9042;
-    x->title="MR Receive Coil Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9043;
-    x->title="Receive Coil Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9044;
-    x->title="Quadrature Receive Coil";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9045;
-    x->title="Multi-Coil Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9046;
-    x->title="Multi-Coil Configuration";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9047;
-    x->title="Multi-Coil Element Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9048;
-    x->title="Multi-Coil Element Used";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9049;
-    x->title="MR Transmit Coil Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9050;
-    x->title="Transmit Coil Manufacturer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9051;
-    x->title="Transmit Coil Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9052;
-    x->title="Spectral Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9053;
-    x->title="Chemical Shift Reference";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9054;
-    x->title="Volume Localization Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9058;
-    x->title="MR Acquisition Frequency Encoding Steps";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9059;
-    x->title="De-coupling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9060;
-    x->title="De-coupled Nucleus";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9061;
-    x->title="De-coupling Frequency";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9062;
-    x->title="De-coupling Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9063;
-    x->title="De-coupling Chemical Shift Reference";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9064;
-    x->title="k-space Filtering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9065;
-    x->title="Time Domain Filtering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9066;
-    x->title="Number of Zero Fills";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9067;
-    x->title="Baseline Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9069;
-    x->title="Parallel Reduction Factor In-plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9070;
-    x->title="Cardiac R-R Interval Specified";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9073;
-    x->title="Acquisition Duration";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9074;
-    x->title="Frame Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9075;
-    x->title="Diffusion Directionality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9076;
-    x->title="Diffusion Gradient Direction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9077;
-    x->title="Parallel Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9078;
-    x->title="Parallel Acquisition Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9079;
-    x->title="Inversion Times";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9080;
-    x->title="Metabolite Map Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9081;
-    x->title="Partial Fourier";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9082;
-    x->title="Effective Echo Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9083;
-    x->title="Metabolite Map Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9084;
-    x->title="Chemical Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9085;
-    x->title="Cardiac Signal Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9087;
-    x->title="Diffusion b-value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9089;
-    x->title="Diffusion Gradient Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9090;
-    x->title="Velocity Encoding Direction";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9091;
-    x->title="Velocity Encoding Minimum Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9092;
-    x->title="Velocity Encoding Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9093;
-    x->title="Number of k-Space Trajectories";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9094;
-    x->title="Coverage of k-Space";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9095;
-    x->title="Spectroscopy Acquisition Phase Rows";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9096;
-    x->title="Parallel Reduction Factor In-plane (Retired)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9098;
-    x->title="Transmitter Frequency";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9100;
-    x->title="Resonant Nucleus";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9101;
-    x->title="Frequency Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9103;
-    x->title="MR Spectroscopy FOV/Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9104;
-    x->title="Slab Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9105;
-    x->title="Slab Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9106;
-    x->title="Mid Slab Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9107;
-    x->title="MR Spatial Saturation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9112;
-    x->title="MR Timing and Related Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9114;
-    x->title="MR Echo Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9115;
-    x->title="MR Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9117;
-    x->title="MR Diffusion Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9118;
-    x->title="Cardiac Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9119;
-    x->title="MR Averages Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9125;
-    x->title="MR FOV/Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9126;
-    x->title="Volume Localization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9127;
-    x->title="Spectroscopy Acquisition Data Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9147;
-    x->title="Diffusion Anisotropy Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9151;
-    x->title="Frame Reference DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9152;
-    x->title="MR Metabolite Map Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9155;
-    x->title="Parallel Reduction Factor out-of-plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9159;
-    x->title="Spectroscopy Acquisition Out-of-plane Phase Steps";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9166;
-    x->title="Bulk Motion Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9168;
-    x->title="Parallel Reduction Factor Second In-plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9169;
-    x->title="Cardiac Beat Rejection Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9170;
-    x->title="Respiratory Motion Compensation Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9171;
-    x->title="Respiratory Signal Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9172;
-    x->title="Bulk Motion Compensation Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9173;
-    x->title="Bulk Motion Signal Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9174;
-    x->title="Applicable Safety Standard Agency";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9175;
-    x->title="Applicable Safety Standard Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9176;
-    x->title="Operating Mode Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9177;
-    x->title="Operating Mode Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9178;
-    x->title="Operating Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9179;
-    x->title="Specific Absorption Rate Definition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9180;
-    x->title="Gradient Output Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9181;
-    x->title="Specific Absorption Rate Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9182;
-    x->title="Gradient Output";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9183;
-    x->title="Flow Compensation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9184;
-    x->title="Tagging Delay";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9185;
-    x->title="Respiratory Motion Compensation Technique Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9186;
-    x->title="Respiratory Signal Source ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9195;
-    x->title="Chemical Shift Minimum Integration Limit in Hz";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9196;
-    x->title="Chemical Shift Maximum Integration Limit in Hz";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9197;
-    x->title="MR Velocity Encoding Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9198;
-    x->title="First Order Phase Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9199;
-    x->title="Water Referenced Phase Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9200;
-    x->title="MR Spectroscopy Acquisition Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9214;
-    x->title="Respiratory Cycle Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9217;
-    x->title="Velocity Encoding Maximum Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9218;
-    x->title="Tag Spacing Second Dimension";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9219;
-    x->title="Tag Angle Second Axis";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9220;
-    x->title="Frame Acquisition Duration";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9226;
-    x->title="MR Image Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9227;
-    x->title="MR Spectroscopy Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9231;
-    x->title="MR Acquisition Phase Encoding Steps in-plane";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9232;
-    x->title="MR Acquisition Phase Encoding Steps out-of-plane";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9234;
-    x->title="Spectroscopy Acquisition Phase Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9236;
-    x->title="Cardiac Cycle Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9239;
-    x->title="Specific Absorption Rate Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9240;
-    x->title="RF Echo Train Length";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9241;
-    x->title="Gradient Echo Train Length";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9250;
-    x->title="Arterial Spin Labeling Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9251;
-    x->title="MR Arterial Spin Labeling Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9252;
-    x->title="ASL Technique Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9253;
-    x->title="ASL Slab Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9254;
-    x->title="ASL Slab Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9255;
-    x->title="ASL Slab Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9256;
-    x->title="ASL Mid Slab Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9257;
-    x->title="ASL Context";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9258;
-    x->title="ASL Pulse Train Duration";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9259;
-    x->title="ASL Crusher Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925A;
-    x->title="ASL Crusher Flow Limit";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925B;
-    x->title="ASL Crusher Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925C;
-    x->title="ASL Bolus Cut-off Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925D;
-    x->title="ASL Bolus Cut-off Timing Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925E;
-    x->title="ASL Bolus Cut-off Technique";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925F;
-    x->title="ASL Bolus Cut-off Delay Time";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9260;
-    x->title="ASL Slab Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9295;
-    x->title="Chemical Shift Minimum Integration Limit in ppm";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9296;
-    x->title="Chemical Shift Maximum Integration Limit in ppm";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9297;
-    x->title="Water Reference Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9298;
-    x->title="Echo Peak Position";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9301;
-    x->title="CT Acquisition Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9302;
-    x->title="Acquisition Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9303;
-    x->title="Tube Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9304;
-    x->title="CT Acquisition Details Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9305;
-    x->title="Revolution Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9306;
-    x->title="Single Collimation Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9307;
-    x->title="Total Collimation Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9308;
-    x->title="CT Table Dynamics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9309;
-    x->title="Table Speed";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9310;
-    x->title="Table Feed per Rotation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9311;
-    x->title="Spiral Pitch Factor";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9312;
-    x->title="CT Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9313;
-    x->title="Data Collection Center (Patient)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9314;
-    x->title="CT Reconstruction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9315;
-    x->title="Reconstruction Algorithm";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9316;
-    x->title="Convolution Kernel Group";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9317;
-    x->title="Reconstruction Field of View";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9318;
-    x->title="Reconstruction Target Center (Patient)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9319;
-    x->title="Reconstruction Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9320;
-    x->title="Image Filter";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9321;
-    x->title="CT Exposure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9322;
-    x->title="Reconstruction Pixel Spacing";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9323;
-    x->title="Exposure Modulation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9324;
-    x->title="Estimated Dose Saving";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9325;
-    x->title="CT X-Ray Details Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9326;
-    x->title="CT Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9327;
-    x->title="Table Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9328;
-    x->title="Exposure Time in ms";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9329;
-    x->title="CT Image Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9330;
-    x->title="X-Ray Tube Current in mA";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9332;
-    x->title="Exposure in mAs";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9333;
-    x->title="Constant Volume Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9334;
-    x->title="Fluoroscopy Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9335;
-    x->title="Distance Source to Data Collection Center";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9337;
-    x->title="Contrast/Bolus Agent Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9338;
-    x->title="Contrast/Bolus Ingredient Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9340;
-    x->title="Contrast Administration Profile Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9341;
-    x->title="Contrast/Bolus Usage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9342;
-    x->title="Contrast/Bolus Agent Administered";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9343;
-    x->title="Contrast/Bolus Agent Detected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9344;
-    x->title="Contrast/Bolus Agent Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9345;
-    x->title="CTDIvol";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9346;
-    x->title="CTDI Phantom Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9351;
-    x->title="Calcium Scoring Mass Factor Patient";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9352;
-    x->title="Calcium Scoring Mass Factor Device";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9353;
-    x->title="Energy Weighting Factor";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9360;
-    x->title="CT Additional X-Ray Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9401;
-    x->title="Projection Pixel Calibration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9402;
-    x->title="Distance Source to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9403;
-    x->title="Distance Object to Table Top";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9404;
-    x->title="Object Pixel Spacing in Center of Beam";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9405;
-    x->title="Positioner Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9406;
-    x->title="Table Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9407;
-    x->title="Collimator Shape Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9410;
-    x->title="Planes in Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9412;
-    x->title="XA/XRF Frame Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9417;
-    x->title="Frame Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9420;
-    x->title="X-Ray Receptor Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9423;
-    x->title="Acquisition Protocol Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9424;
-    x->title="Acquisition Protocol Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9425;
-    x->title="Contrast/Bolus Ingredient Opaque";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9426;
-    x->title="Distance Receptor Plane to Detector Housing";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9427;
-    x->title="Intensifier Active Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9428;
-    x->title="Intensifier Active Dimension(s)";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9429;
-    x->title="Physical Detector Size";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9430;
-    x->title="Position of Isocenter Projection";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9432;
-    x->title="Field of View Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9433;
-    x->title="Field of View Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9434;
-    x->title="Exposure Control Sensing Regions Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9435;
-    x->title="Exposure Control Sensing Region Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9436;
-    x->title="Exposure Control Sensing Region Left Vertical Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9437;
-    x->title="Exposure Control Sensing Region Right Vertical Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9438;
-    x->title="Exposure Control Sensing Region Upper Horizontal Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9439;
-    x->title="Exposure Control Sensing Region Lower Horizontal Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9440;
-    x->title="Center of Circular Exposure Control Sensing Region";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9441;
-    x->title="Radius of Circular Exposure Control Sensing Region";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9442;
-    x->title="Vertices of the Polygonal Exposure Control Sensing Region";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9445;
-    x->title="";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9447;
-    x->title="Column Angulation (Patient)";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9449;
-    x->title="Beam Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9451;
-    x->title="Frame Detector Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9452;
-    x->title="Calculated Anatomy Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9455;
-    x->title="Calibration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9456;
-    x->title="Object Thickness Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9457;
-    x->title="Plane Identification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9461;
-    x->title="Field of View Dimension(s) in Float";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9462;
-    x->title="Isocenter Reference System Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9463;
-    x->title="Positioner Isocenter Primary Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9464;
-    x->title="Positioner Isocenter Secondary Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9465;
-    x->title="Positioner Isocenter Detector Rotation Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9466;
-    x->title="Table X Position to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9467;
-    x->title="Table Y Position to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9468;
-    x->title="Table Z Position to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9469;
-    x->title="Table Horizontal Rotation Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9470;
-    x->title="Table Head Tilt Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9471;
-    x->title="Table Cradle Tilt Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9472;
-    x->title="Frame Display Shutter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9473;
-    x->title="Acquired Image Area Dose Product";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9474;
-    x->title="C-arm Positioner Tabletop Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9476;
-    x->title="X-Ray Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9477;
-    x->title="Irradiation Event Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9504;
-    x->title="X-Ray 3D Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9506;
-    x->title="Contributing Sources Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9507;
-    x->title="X-Ray 3D Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9508;
-    x->title="Primary Positioner Scan Arc";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9509;
-    x->title="Secondary Positioner Scan Arc";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9510;
-    x->title="Primary Positioner Scan Start Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9511;
-    x->title="Secondary Positioner Scan Start Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9514;
-    x->title="Primary Positioner Increment";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9515;
-    x->title="Secondary Positioner Increment";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9516;
-    x->title="Start Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9517;
-    x->title="End Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9518;
-    x->title="Primary Positioner Increment Sign";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9519;
-    x->title="Secondary Positioner Increment Sign";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9524;
-    x->title="Application Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9525;
-    x->title="Application Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9526;
-    x->title="Application Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9527;
-    x->title="Algorithm Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9528;
-    x->title="Algorithm Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9530;
-    x->title="X-Ray 3D Reconstruction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9531;
-    x->title="Reconstruction Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9538;
-    x->title="Per Projection Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9541;
-    x->title="Detector Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9542;
-    x->title="X-Ray Acquisition Dose Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9543;
-    x->title="X-Ray Source Isocenter Primary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9544;
-    x->title="X-Ray Source Isocenter Secondary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9545;
-    x->title="Breast Support Isocenter Primary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9546;
-    x->title="Breast Support Isocenter Secondary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9547;
-    x->title="Breast Support X Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9548;
-    x->title="Breast Support Y Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9549;
-    x->title="Breast Support Z Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9550;
-    x->title="Detector Isocenter Primary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9551;
-    x->title="Detector Isocenter Secondary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9552;
-    x->title="Detector X Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9553;
-    x->title="Detector Y Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9554;
-    x->title="Detector Z Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9555;
-    x->title="X-Ray Grid Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9556;
-    x->title="X-Ray Filter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9557;
-    x->title="Detector Active Area TLHC Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9558;
-    x->title="Detector Active Area Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9559;
-    x->title="Positioner Primary Angle Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9601;
-    x->title="Diffusion b-matrix Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9602;
-    x->title="Diffusion b-value XX";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9603;
-    x->title="Diffusion b-value XY";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9604;
-    x->title="Diffusion b-value XZ";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9605;
-    x->title="Diffusion b-value YY";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9606;
-    x->title="Diffusion b-value YZ";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9607;
-    x->title="Diffusion b-value ZZ";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9621;
-    x->title="Functional MR Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9622;
-    x->title="Functional Settling Phase Frames Present";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9623;
-    x->title="Functional Sync Pulse";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9624;
-    x->title="Settling Phase Frame";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9701;
-    x->title="Decay Correction DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9715;
-    x->title="Start Density Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9716;
-    x->title="Start Relative Density Difference Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9717;
-    x->title="Start Cardiac Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9718;
-    x->title="Start Respiratory Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9719;
-    x->title="Termination Counts Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9720;
-    x->title="Termination Density Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9721;
-    x->title="Termination Relative Density Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9722;
-    x->title="Termination Time Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9723;
-    x->title="Termination Cardiac Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9724;
-    x->title="Termination Respiratory Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9725;
-    x->title="Detector Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9726;
-    x->title="Transverse Detector Separation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9727;
-    x->title="Axial Detector Dimension";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9729;
-    x->title="Radiopharmaceutical Agent Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9732;
-    x->title="PET Frame Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9733;
-    x->title="PET Detector Motion Details Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9734;
-    x->title="PET Table Dynamics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9735;
-    x->title="PET Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9736;
-    x->title="PET Frame Correction Factors Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9737;
-    x->title="Radiopharmaceutical Usage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9738;
-    x->title="Attenuation Correction Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9739;
-    x->title="Number of Iterations";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9740;
-    x->title="Number of Subsets";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9749;
-    x->title="PET Reconstruction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9751;
-    x->title="PET Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9755;
-    x->title="Time of Flight Information Used";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9756;
-    x->title="Reconstruction Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9758;
-    x->title="Decay Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9759;
-    x->title="Attenuation Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9760;
-    x->title="Scatter Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9761;
-    x->title="Dead Time Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9762;
-    x->title="Gantry Motion Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9763;
-    x->title="Patient Motion Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9764;
-    x->title="Count Loss Normalization Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9765;
-    x->title="Randoms Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9766;
-    x->title="Non-uniform Radial Sampling Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9767;
-    x->title="Sensitivity Calibrated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9768;
-    x->title="Detector Normalization Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9769;
-    x->title="Iterative Reconstruction Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9770;
-    x->title="Attenuation Correction Temporal Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9771;
-    x->title="Patient Physiological State Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9772;
-    x->title="Patient Physiological State Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9801;
-    x->title="Depth(s) of Focus";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9803;
-    x->title="Excluded Intervals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9804;
-    x->title="Exclusion Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9805;
-    x->title="Exclusion Duration";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9806;
-    x->title="US Image Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9807;
-    x->title="Image Data Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9808;
-    x->title="Data Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9809;
-    x->title="Transducer Scan Pattern Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980B;
-    x->title="Aliased Data Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980C;
-    x->title="Position Measuring Device Used";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980D;
-    x->title="Transducer Geometry Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980E;
-    x->title="Transducer Beam Steering Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980F;
-    x->title="Transducer Application Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9810;
-    x->title="Zero Velocity Pixel Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0xA001;
-    x->title="Contributing Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0xA002;
-    x->title="Contribution DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0xA003;
-    x->title="Contribution Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x000D;
-    x->title="Study Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x000E;
-    x->title="Series Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0010;
-    x->title="Study ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0011;
-    x->title="Series Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0012;
-    x->title="Acquisition Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0013;
-    x->title="Instance Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0014;
-    x->title="Isotope Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0015;
-    x->title="Phase Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0016;
-    x->title="Interval Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0017;
-    x->title="Time Slot Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0018;
-    x->title="Angle Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0019;
-    x->title="Item Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0020;
-    x->title="Patient Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0022;
-    x->title="Overlay Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0024;
-    x->title="Curve Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0026;
-    x->title="LUT Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0030;
-    x->title="Image Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0032;
-    x->title="Image Position (Patient)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0035;
-    x->title="Image Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0037;
-    x->title="Image Orientation (Patient)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0050;
-    x->title="Location";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0052;
-    x->title="Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0060;
-    x->title="Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0062;
-    x->title="Image Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0070;
-    x->title="Image Geometry Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0080;
-    x->title="Masking Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x00AA;
-    x->title="Report Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0100;
-    x->title="Temporal Position Identifier";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0105;
-    x->title="Number of Temporal Positions";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0110;
-    x->title="Temporal Resolution";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0200;
-    x->title="Synchronization Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0242;
-    x->title="SOP Instance UID of Concatenation Source";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1000;
-    x->title="Series in Study";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1001;
-    x->title="Acquisitions in Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1002;
-    x->title="Images in Acquisition";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1003;
-    x->title="Images in Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1004;
-    x->title="Acquisitions in Study";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1005;
-    x->title="Images in Study";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1020;
-    x->title="Reference";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1040;
-    x->title="Position Reference Indicator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1041;
-    x->title="Slice Location";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1070;
-    x->title="Other Study Numbers";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1200;
-    x->title="Number of Patient Related Studies";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1202;
-    x->title="Number of Patient Related Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1204;
-    x->title="Number of Patient Related Instances";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1206;
-    x->title="Number of Study Related Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1208;
-    x->title="Number of Study Related Instances";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1209;
-    x->title="Number of Series Related Instances";
-    x->vr="IS";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0020;
-    //x->tag[1]=0x31xx;
-    //x->title="Source Image IDs";
-    //x->vr="CS";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3401;
-    x->title="Modifying Device ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3402;
-    x->title="Modified Image ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3403;
-    x->title="Modified Image Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3404;
-    x->title="Modifying Device Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3405;
-    x->title="Modified Image Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3406;
-    x->title="Modified Image Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x4000;
-    x->title="Image Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x5000;
-    x->title="Original Image Identification";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x5002;
-    x->title="Original Image Identification Nomenclature";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9056;
-    x->title="Stack ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9057;
-    x->title="In-Stack Position Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9071;
-    x->title="Frame Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9072;
-    x->title="Frame Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9111;
-    x->title="Frame Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9113;
-    x->title="Plane Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9116;
-    x->title="Plane Orientation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9128;
-    x->title="Temporal Position Index";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9153;
-    x->title="Nominal Cardiac Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9154;
-    x->title="Nominal Cardiac Trigger Time Prior To R-Peak";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9155;
-    x->title="Actual Cardiac Trigger Time Prior To R-Peak";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9156;
-    x->title="Frame Acquisition Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9157;
-    x->title="Dimension Index Values";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9158;
-    x->title="Frame Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9161;
-    x->title="Concatenation UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9162;
-    x->title="In-concatenation Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9163;
-    x->title="In-concatenation Total Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9164;
-    x->title="Dimension Organization UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9165;
-    x->title="Dimension Index Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9167;
-    x->title="Functional Group Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9170;
-    x->title="Unassigned Shared Converted Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9171;
-    x->title="Unassigned Per-Frame Converted Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9172;
-    x->title="Conversion Source Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9213;
-    x->title="Dimension Index Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9221;
-    x->title="Dimension Organization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9222;
-    x->title="Dimension Index Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9228;
-    x->title="Concatenation Frame Offset Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9238;
-    x->title="Functional Group Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9241;
-    x->title="Nominal Percentage of Cardiac Phase";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9245;
-    x->title="Nominal Percentage of Respiratory Phase";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9246;
-    x->title="Starting Respiratory Amplitude";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9247;
-    x->title="Starting Respiratory Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9248;
-    x->title="Ending Respiratory Amplitude";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9249;
-    x->title="Ending Respiratory Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9250;
-    x->title="Respiratory Trigger Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9251;
-    x->title="R-R Interval Time Nominal";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9252;
-    x->title="Actual Cardiac Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9253;
-    x->title="Respiratory Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9254;
-    x->title="Respiratory Interval Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9255;
-    x->title="Nominal Respiratory Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9256;
-    x->title="Respiratory Trigger Delay Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9257;
-    x->title="Actual Respiratory Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9301;
-    x->title="Image Position (Volume)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9302;
-    x->title="Image Orientation (Volume)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9307;
-    x->title="Ultrasound Acquisition Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9308;
-    x->title="Apex Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9309;
-    x->title="Volume to Transducer Mapping Matrix";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930A;
-    x->title="Volume to Table Mapping Matrix";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930B;
-    x->title="Volume to Transducer Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930C;
-    x->title="Patient Frame of Reference Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930D;
-    x->title="Temporal Position Time Offset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930E;
-    x->title="Plane Position (Volume) Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930F;
-    x->title="Plane Orientation (Volume) Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9310;
-    x->title="Temporal Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9311;
-    x->title="Dimension Organization Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9312;
-    x->title="Volume Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9313;
-    x->title="Table Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9421;
-    x->title="Dimension Description Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9450;
-    x->title="Patient Orientation in Frame Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9453;
-    x->title="Frame Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9518;
-    x->title="Acquisition Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9529;
-    x->title="Contributing SOP Instances Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9536;
-    x->title="Reconstruction Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0001;
-    x->title="Light Path Filter Pass-Through Wavelength";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0002;
-    x->title="Light Path Filter Pass Band";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0003;
-    x->title="Image Path Filter Pass-Through Wavelength";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0004;
-    x->title="Image Path Filter Pass Band";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0005;
-    x->title="Patient Eye Movement Commanded";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0006;
-    x->title="Patient Eye Movement Command Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0007;
-    x->title="Spherical Lens Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0008;
-    x->title="Cylinder Lens Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0009;
-    x->title="Cylinder Axis";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000A;
-    x->title="Emmetropic Magnification";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000B;
-    x->title="Intra Ocular Pressure";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000C;
-    x->title="Horizontal Field of View";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000D;
-    x->title="Pupil Dilated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000E;
-    x->title="Degree of Dilation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0010;
-    x->title="Stereo Baseline Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0011;
-    x->title="Stereo Baseline Displacement";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0012;
-    x->title="Stereo Horizontal Pixel Offset";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0013;
-    x->title="Stereo Vertical Pixel Offset";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0014;
-    x->title="Stereo Rotation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0015;
-    x->title="Acquisition Device Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0016;
-    x->title="Illumination Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0017;
-    x->title="Light Path Filter Type Stack Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0018;
-    x->title="Image Path Filter Type Stack Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0019;
-    x->title="Lenses Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001A;
-    x->title="Channel Description Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001B;
-    x->title="Refractive State Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001C;
-    x->title="Mydriatic Agent Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001D;
-    x->title="Relative Image Position Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001E;
-    x->title="Camera Angle of View";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0020;
-    x->title="Stereo Pairs Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0021;
-    x->title="Left Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0022;
-    x->title="Right Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0028;
-    x->title="Stereo Pairs Present";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0030;
-    x->title="Axial Length of the Eye";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0031;
-    x->title="Ophthalmic Frame Location Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0032;
-    x->title="Reference Coordinates";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0035;
-    x->title="Depth Spatial Resolution";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0036;
-    x->title="Maximum Depth Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0037;
-    x->title="Along-scan Spatial Resolution";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0038;
-    x->title="Maximum Along-scan Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0039;
-    x->title="Ophthalmic Image Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0041;
-    x->title="Depth of Transverse Image";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0042;
-    x->title="Mydriatic Agent Concentration Units Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0048;
-    x->title="Across-scan Spatial Resolution";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0049;
-    x->title="Maximum Across-scan Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x004E;
-    x->title="Mydriatic Agent Concentration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0055;
-    x->title="Illumination Wave Length";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0056;
-    x->title="Illumination Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0057;
-    x->title="Illumination Bandwidth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0058;
-    x->title="Mydriatic Agent Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1007;
-    x->title="Ophthalmic Axial Measurements Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1008;
-    x->title="Ophthalmic Axial Measurements Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1009;
-    x->title="Ophthalmic Axial Measurements Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1010;
-    x->title="Ophthalmic Axial Length Measurements Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1012;
-    x->title="Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1019;
-    x->title="Ophthalmic Axial Length";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1024;
-    x->title="Lens Status Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1025;
-    x->title="Vitreous Status Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1028;
-    x->title="IOL Formula Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1029;
-    x->title="IOL Formula Detail";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1033;
-    x->title="Keratometer Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1035;
-    x->title="Source of Ophthalmic Axial Length Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1037;
-    x->title="Target Refraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1039;
-    x->title="Refractive Procedure Occurred";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1040;
-    x->title="Refractive Surgery Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1044;
-    x->title="Ophthalmic Ultrasound Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1050;
-    x->title="Ophthalmic Axial Length Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1053;
-    x->title="IOL Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1054;
-    x->title="Predicted Refractive Error";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1059;
-    x->title="Ophthalmic Axial Length Velocity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1065;
-    x->title="Lens Status Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1066;
-    x->title="Vitreous Status Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1090;
-    x->title="IOL Power Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1092;
-    x->title="Lens Constant Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1093;
-    x->title="IOL Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1094;
-    x->title="Lens Constant Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1095;
-    x->title="Implant Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1096;
-    x->title="Keratometry Measurement Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1097;
-    x->title="Implant Part Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1100;
-    x->title="Referenced Ophthalmic Axial Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1101;
-    x->title="Ophthalmic Axial Length Measurements Segment Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1103;
-    x->title="Refractive Error Before Refractive Surgery Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1121;
-    x->title="IOL Power For Exact Emmetropia";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1122;
-    x->title="IOL Power For Exact Target Refraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1125;
-    x->title="Anterior Chamber Depth Definition Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1127;
-    x->title="Lens Thickness Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1128;
-    x->title="Anterior Chamber Depth Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1130;
-    x->title="Lens Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1131;
-    x->title="Anterior Chamber Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1132;
-    x->title="Source of Lens Thickness Data Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1133;
-    x->title="Source of Anterior Chamber Depth Data Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1134;
-    x->title="Source of Refractive Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1135;
-    x->title="Source of Refractive Measurements Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1140;
-    x->title="Ophthalmic Axial Length Measurement Modified";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1150;
-    x->title="Ophthalmic Axial Length Data Source Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1153;
-    x->title="Ophthalmic Axial Length Acquisition Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1155;
-    x->title="Signal to Noise Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1159;
-    x->title="Ophthalmic Axial Length Data Source Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1210;
-    x->title="Ophthalmic Axial Length Measurements Total Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1211;
-    x->title="Ophthalmic Axial Length Measurements Segmental Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1212;
-    x->title="Ophthalmic Axial Length Measurements Length Summation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1220;
-    x->title="Ultrasound Ophthalmic Axial Length Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1225;
-    x->title="Optical Ophthalmic Axial Length Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1230;
-    x->title="Ultrasound Selected Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1250;
-    x->title="Ophthalmic Axial Length Selection Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1255;
-    x->title="Optical Selected Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1257;
-    x->title="Selected Segmental Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1260;
-    x->title="Selected Total Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1262;
-    x->title="Ophthalmic Axial Length Quality Metric Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1265;
-    x->title="Ophthalmic Axial Length Quality Metric Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1273;
-    x->title="Ophthalmic Axial Length Quality Metric Type Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1300;
-    x->title="Intraocular Lens Calculations Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1310;
-    x->title="Intraocular Lens Calculations Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1330;
-    x->title="Referenced Ophthalmic Axial Length Measurement QC Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1415;
-    x->title="Ophthalmic Mapping Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1420;
-    x->title="Acquisition Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1423;
-    x->title="Acquisition Method Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1436;
-    x->title="Ophthalmic Thickness Map Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1443;
-    x->title="Ophthalmic Thickness Mapping Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1445;
-    x->title="Retinal Thickness Definition Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1450;
-    x->title="Pixel Value Mapping to Coded Concept Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1452;
-    x->title="Mapped Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1454;
-    x->title="Pixel Value Mapping Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1458;
-    x->title="Ophthalmic Thickness Map Quality Threshold Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1460;
-    x->title="Ophthalmic Thickness Map Threshold Quality Rating";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1463;
-    x->title="Anatomic Structure Reference Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1465;
-    x->title="Registration to Localizer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1466;
-    x->title="Registered Localizer Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1467;
-    x->title="Registered Localizer Top Left Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1468;
-    x->title="Registered Localizer Bottom Right Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1470;
-    x->title="Ophthalmic Thickness Map Quality Rating Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1472;
-    x->title="Relevant OPT Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1512;
-    x->title="Transformation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1513;
-    x->title="Transformation Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1515;
-    x->title="Ophthalmic Axial Length Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1517;
-    x->title="Ophthalmic FOV";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1518;
-    x->title="Two Dimensional to Three Dimensional Map Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1525;
-    x->title="Wide Field Ophthalmic Photography Quality Rating Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1526;
-    x->title="Wide Field Ophthalmic Photography Quality Threshold Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1527;
-    x->title="Wide Field Ophthalmic Photography Threshold Quality Rating";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1528;
-    x->title="X Coordinates Center Pixel View Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1529;
-    x->title="Y Coordinates Center Pixel View Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1530;
-    x->title="Number of Map Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1531;
-    x->title="Two Dimensional to Three Dimensional Map Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0010;
-    x->title="Visual Field Horizontal Extent";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0011;
-    x->title="Visual Field Vertical Extent";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0012;
-    x->title="Visual Field Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0016;
-    x->title="Screening Test Mode Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0018;
-    x->title="Maximum Stimulus Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0020;
-    x->title="Background Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0021;
-    x->title="Stimulus Color Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0024;
-    x->title="Background Illumination Color Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0025;
-    x->title="Stimulus Area";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0028;
-    x->title="Stimulus Presentation Time";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0032;
-    x->title="Fixation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0033;
-    x->title="Fixation Monitoring Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0034;
-    x->title="Visual Field Catch Trial Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0035;
-    x->title="Fixation Checked Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0036;
-    x->title="Patient Not Properly Fixated Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0037;
-    x->title="Presented Visual Stimuli Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0038;
-    x->title="Number of Visual Stimuli";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0039;
-    x->title="Excessive Fixation Losses Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0040;
-    x->title="Excessive Fixation Losses";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0042;
-    x->title="Stimuli Retesting Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0044;
-    x->title="Comments on Patient's Performance of Visual Field";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0045;
-    x->title="False Negatives Estimate Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0046;
-    x->title="False Negatives Estimate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0048;
-    x->title="Negative Catch Trials Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0050;
-    x->title="False Negatives Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0051;
-    x->title="Excessive False Negatives Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0052;
-    x->title="Excessive False Negatives";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0053;
-    x->title="False Positives Estimate Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0054;
-    x->title="False Positives Estimate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0055;
-    x->title="Catch Trials Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0056;
-    x->title="Positive Catch Trials Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0057;
-    x->title="Test Point Normals Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0058;
-    x->title="Test Point Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0059;
-    x->title="Global Deviation Probability Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0060;
-    x->title="False Positives Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0061;
-    x->title="Excessive False Positives Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0062;
-    x->title="Excessive False Positives";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0063;
-    x->title="Visual Field Test Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0064;
-    x->title="Results Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0065;
-    x->title="Age Corrected Sensitivity Deviation Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0066;
-    x->title="Global Deviation From Normal";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0067;
-    x->title="Generalized Defect Sensitivity Deviation Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0068;
-    x->title="Localized Deviation From Normal";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0069;
-    x->title="Patient Reliability Indicator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0070;
-    x->title="Visual Field Mean Sensitivity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0071;
-    x->title="Global Deviation Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0072;
-    x->title="Local Deviation Probability Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0073;
-    x->title="Localized Deviation Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0074;
-    x->title="Short Term Fluctuation Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0075;
-    x->title="Short Term Fluctuation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0076;
-    x->title="Short Term Fluctuation Probability Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0077;
-    x->title="Short Term Fluctuation Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0078;
-    x->title="Corrected Localized Deviation From Normal Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0079;
-    x->title="Corrected Localized Deviation From Normal";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0080;
-    x->title="Corrected Localized Deviation From Normal Probability Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0081;
-    x->title="Corrected Localized Deviation From Normal Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0083;
-    x->title="Global Deviation Probability Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0085;
-    x->title="Localized Deviation Probability Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0086;
-    x->title="Foveal Sensitivity Measured";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0087;
-    x->title="Foveal Sensitivity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0088;
-    x->title="Visual Field Test Duration";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0089;
-    x->title="Visual Field Test Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0090;
-    x->title="Visual Field Test Point X-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0091;
-    x->title="Visual Field Test Point Y-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0092;
-    x->title="Age Corrected Sensitivity Deviation Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0093;
-    x->title="Stimulus Results";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0094;
-    x->title="Sensitivity Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0095;
-    x->title="Retest Stimulus Seen";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0096;
-    x->title="Retest Sensitivity Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0097;
-    x->title="Visual Field Test Point Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0098;
-    x->title="Quantified Defect";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0100;
-    x->title="Age Corrected Sensitivity Deviation Probability Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0102;
-    x->title="Generalized Defect Corrected Sensitivity Deviation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0103;
-    x->title="Generalized Defect Corrected Sensitivity Deviation Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0104;
-    x->title="Generalized Defect Corrected Sensitivity Deviation Probability Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0105;
-    x->title="Minimum Sensitivity Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0106;
-    x->title="Blind Spot Localized";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0107;
-    x->title="Blind Spot X-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0108;
-    x->title="Blind Spot Y-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0110;
-    x->title="Visual Acuity Measurement Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0112;
-    x->title="Refractive Parameters Used on Patient Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0113;
-    x->title="Measurement Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0114;
-    x->title="Ophthalmic Patient Clinical Information Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0115;
-    x->title="Ophthalmic Patient Clinical Information Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0117;
-    x->title="Foveal Point Normative Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0118;
-    x->title="Foveal Point Probability Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0120;
-    x->title="Screening Baseline Measured";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0122;
-    x->title="Screening Baseline Measured Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0124;
-    x->title="Screening Baseline Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0126;
-    x->title="Screening Baseline Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0202;
-    x->title="Algorithm Source";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0306;
-    x->title="Data Set Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0307;
-    x->title="Data Set Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0308;
-    x->title="Data Set Source";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0309;
-    x->title="Data Set Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0317;
-    x->title="Visual Field Test Reliability Global Index Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0320;
-    x->title="Visual Field Global Results Index Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0325;
-    x->title="Data Observation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0338;
-    x->title="Index Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0341;
-    x->title="Index Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0344;
-    x->title="Index Probability Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0002;
-    x->title="Samples per Pixel";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0003;
-    x->title="Samples per Pixel Used";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0004;
-    x->title="Photometric Interpretation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0005;
-    x->title="Image Dimensions";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0006;
-    x->title="Planar Configuration";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0008;
-    x->title="Number of Frames";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0009;
-    x->title="Frame Increment Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x000A;
-    x->title="Frame Dimension Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0010;
-    x->title="Rows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0011;
-    x->title="Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0012;
-    x->title="Planes";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0014;
-    x->title="Ultrasound Color Data Present";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0020;
-    x->title="";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0030;
-    x->title="Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0031;
-    x->title="Zoom Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0032;
-    x->title="Zoom Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0034;
-    x->title="Pixel Aspect Ratio";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0040;
-    x->title="Image Format";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0050;
-    x->title="Manipulated Image";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0051;
-    x->title="Corrected Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x005F;
-    x->title="Compression Recognition Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0060;
-    x->title="Compression Code";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0061;
-    x->title="Compression Originator";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0062;
-    x->title="Compression Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0063;
-    x->title="Compression Description";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0065;
-    x->title="Compression Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0066;
-    x->title="Compression Step Pointers";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0068;
-    x->title="Repeat Interval";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0069;
-    x->title="Bits Grouped";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0070;
-    x->title="Perimeter Table";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0071;
-    x->title="Perimeter Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0080;
-    x->title="Predictor Rows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0081;
-    x->title="Predictor Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0082;
-    x->title="Predictor Constants";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0090;
-    x->title="Blocked Pixels";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0091;
-    x->title="Block Rows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0092;
-    x->title="Block Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0093;
-    x->title="Row Overlap";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0094;
-    x->title="Column Overlap";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0100;
-    x->title="Bits Allocated";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0101;
-    x->title="Bits Stored";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0102;
-    x->title="High Bit";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0103;
-    x->title="Pixel Representation";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0104;
-    x->title="Smallest Valid Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0105;
-    x->title="Largest Valid Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0106;
-    x->title="Smallest Image Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0107;
-    x->title="Largest Image Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0108;
-    x->title="Smallest Pixel Value in Series";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0109;
-    x->title="Largest Pixel Value in Series";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0110;
-    x->title="Smallest Image Pixel Value in Plane";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0111;
-    x->title="Largest Image Pixel Value in Plane";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0120;
-    x->title="Pixel Padding Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0121;
-    x->title="Pixel Padding Range Limit";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0122;
-    x->title="Float Pixel Padding Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0123;
-    x->title="Double Float Pixel Padding Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0124;
-    x->title="Float Pixel Padding Range Limit";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0125;
-    x->title="Double Float Pixel Padding Range Limit";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0200;
-    x->title="Image Location";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0300;
-    x->title="Quality Control Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0301;
-    x->title="Burned In Annotation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0302;
-    x->title="Recognizable Visual Features";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0303;
-    x->title="Longitudinal Temporal Information Modified";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0304;
-    x->title="Referenced Color Palette Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0400;
-    x->title="Transform Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0401;
-    x->title="Transform Version Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0402;
-    x->title="Number of Transform Steps";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0403;
-    x->title="Sequence of Compressed Data";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0404;
-    x->title="Details of Coefficients";
-    x->vr="AT";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x0;
-    //x->title="Rows For Nth Order Coefficients";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x1;
-    //x->title="Columns For Nth Order Coefficients";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x2;
-    //x->title="Coefficient Coding";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x3;
-    //x->title="Coefficient Coding Pointers";
-    //x->vr="AT";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0700;
-    x->title="DCT Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0701;
-    x->title="Data Block Description";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0702;
-    x->title="Data Block";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0710;
-    x->title="Normalization Factor Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0720;
-    x->title="Zonal Map Number Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0721;
-    x->title="Zonal Map Location";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0722;
-    x->title="Zonal Map Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0730;
-    x->title="Adaptive Map Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0740;
-    x->title="Code Number Format";
-    x->vr="US";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x0;
-    //x->title="Code Label";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x2;
-    //x->title="Number of Tables";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x3;
-    //x->title="Code Table Location";
-    //x->vr="AT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x4;
-    //x->title="Bits For Code Word";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x8;
-    //x->title="Image Data Location";
-    //x->vr="AT";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0A02;
-    x->title="Pixel Spacing Calibration Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0A04;
-    x->title="Pixel Spacing Calibration Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1040;
-    x->title="Pixel Intensity Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1041;
-    x->title="Pixel Intensity Relationship Sign";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1050;
-    x->title="Window Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1051;
-    x->title="Window Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1052;
-    x->title="Rescale Intercept";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1053;
-    x->title="Rescale Slope";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1054;
-    x->title="Rescale Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1055;
-    x->title="Window Center & Width Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1056;
-    x->title="VOI LUT Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1080;
-    x->title="Gray Scale";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1090;
-    x->title="Recommended Viewing Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1100;
-    x->title="Gray Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1101;
-    x->title="Red Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1102;
-    x->title="Green Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1103;
-    x->title="Blue Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1104;
-    x->title="Alpha Palette Color Lookup Table Descriptor";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1111;
-    x->title="Large Red Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1112;
-    x->title="Large Green Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1113;
-    x->title="Large Blue Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1199;
-    x->title="Palette Color Lookup Table UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1200;
-    x->title="Gray Lookup Table Data";
-    x->vr="SS or OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1201;
-    x->title="Red Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1202;
-    x->title="Green Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1203;
-    x->title="Blue Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1204;
-    x->title="Alpha Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1211;
-    x->title="Large Red Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1212;
-    x->title="Large Green Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1213;
-    x->title="Large Blue Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1214;
-    x->title="Large Palette Color Lookup Table UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1221;
-    x->title="Segmented Red Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1222;
-    x->title="Segmented Green Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1223;
-    x->title="Segmented Blue Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1224;
-    x->title="Segmented Alpha Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1300;
-    x->title="Breast Implant Present";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1350;
-    x->title="Partial View";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1351;
-    x->title="Partial View Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1352;
-    x->title="Partial View Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x135A;
-    x->title="Spatial Locations Preserved";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1401;
-    x->title="Data Frame Assignment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1402;
-    x->title="Data Path Assignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1403;
-    x->title="Bits Mapped to Color Lookup Table";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1404;
-    x->title="Blending LUT 1 Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1405;
-    x->title="Blending LUT 1 Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1406;
-    x->title="Blending Weight Constant";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1407;
-    x->title="Blending Lookup Table Descriptor";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1408;
-    x->title="Blending Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140B;
-    x->title="Enhanced Palette Color Lookup Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140C;
-    x->title="Blending LUT 2 Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140D;
-    x->title="Blending LUT 2 Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140E;
-    x->title="Data Path ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140F;
-    x->title="RGB LUT Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1410;
-    x->title="Alpha LUT Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2000;
-    x->title="ICC Profile";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2002;
-    x->title="Color Space";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2110;
-    x->title="Lossy Image Compression";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2112;
-    x->title="Lossy Image Compression Ratio";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2114;
-    x->title="Lossy Image Compression Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3000;
-    x->title="Modality LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3002;
-    x->title="LUT Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3003;
-    x->title="LUT Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3004;
-    x->title="Modality LUT Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3006;
-    x->title="LUT Data";
-    x->vr="US or OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3010;
-    x->title="VOI LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3110;
-    x->title="Softcopy VOI LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x4000;
-    x->title="Image Presentation Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x5000;
-    x->title="Bi-Plane Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6010;
-    x->title="Representative Frame Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6020;
-    x->title="Frame Numbers of Interest (FOI)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6022;
-    x->title="Frame of Interest Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6023;
-    x->title="Frame of Interest Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6030;
-    x->title="Mask Pointer(s)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6040;
-    x->title="R Wave Pointer";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6100;
-    x->title="Mask Subtraction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6101;
-    x->title="Mask Operation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6102;
-    x->title="Applicable Frame Range";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6110;
-    x->title="Mask Frame Numbers";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6112;
-    x->title="Contrast Frame Averaging";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6114;
-    x->title="Mask Sub-pixel Shift";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6120;
-    x->title="TID Offset";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6190;
-    x->title="Mask Operation Explanation";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7000;
-    x->title="Equipment Administrator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7001;
-    x->title="Number of Display Subsystems";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7002;
-    x->title="Current Configuration ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7003;
-    x->title="Display Subsystem ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7004;
-    x->title="Display Subsystem Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7005;
-    x->title="Display Subsystem Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7006;
-    x->title="System Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7007;
-    x->title="System Status Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7008;
-    x->title="Target Luminance Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7009;
-    x->title="Luminance Characteristics ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700A;
-    x->title="Display Subsystem Configuration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700B;
-    x->title="Configuration ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700C;
-    x->title="Configuration Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700D;
-    x->title="Configuration Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700E;
-    x->title="Referenced Target Luminance Characteristics ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700F;
-    x->title="QA Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7010;
-    x->title="Display Subsystem QA Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7011;
-    x->title="Configuration QA Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7012;
-    x->title="Measurement Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7013;
-    x->title="Measurement Functions";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7014;
-    x->title="Measurement Equipment Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7015;
-    x->title="Visual Evaluation Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7016;
-    x->title="Display Calibration Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7017;
-    x->title="DDL Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7018;
-    x->title="CIExy White Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7019;
-    x->title="Display Function Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701A;
-    x->title="Gamma Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701B;
-    x->title="Number of Luminance Points";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701C;
-    x->title="Luminance Response Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701D;
-    x->title="Target Minimum Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701E;
-    x->title="Target Maximum Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701F;
-    x->title="Luminance Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7020;
-    x->title="Luminance Response Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7021;
-    x->title="White Point Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7022;
-    x->title="Display Device Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7023;
-    x->title="Display Subsystem Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7024;
-    x->title="Luminance Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7025;
-    x->title="Ambient Light Value Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7026;
-    x->title="Measured Characteristics";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7027;
-    x->title="Luminance Uniformity Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7028;
-    x->title="Visual Evaluation Test Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7029;
-    x->title="Test Result";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702A;
-    x->title="Test Result Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702B;
-    x->title="Test Image Validation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702C;
-    x->title="Test Pattern Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702D;
-    x->title="Measurement Pattern Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702E;
-    x->title="Visual Evaluation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7FE0;
-    x->title="Pixel Data Provider URL";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9001;
-    x->title="Data Point Rows";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9002;
-    x->title="Data Point Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9003;
-    x->title="Signal Domain Columns";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9099;
-    x->title="Largest Monochrome Pixel Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9108;
-    x->title="Data Representation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9110;
-    x->title="Pixel Measures Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9132;
-    x->title="Frame VOI LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9145;
-    x->title="Pixel Value Transformation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9235;
-    x->title="Signal Domain Rows";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9411;
-    x->title="Display Filter Percentage";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9415;
-    x->title="Frame Pixel Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9416;
-    x->title="Subtraction Item ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9422;
-    x->title="Pixel Intensity Relationship LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9443;
-    x->title="Frame Pixel Data Properties Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9444;
-    x->title="Geometrical Properties";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9445;
-    x->title="Geometric Maximum Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9446;
-    x->title="Image Processing Applied";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9454;
-    x->title="Mask Selection Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9474;
-    x->title="LUT Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9478;
-    x->title="Mask Visibility Percentage";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9501;
-    x->title="Pixel Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9502;
-    x->title="Region Pixel Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9503;
-    x->title="Vertices of the Region";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9505;
-    x->title="Multi-frame Presentation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9506;
-    x->title="Pixel Shift Frame Range";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9507;
-    x->title="LUT Frame Range";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9520;
-    x->title="Image to Equipment Mapping Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9537;
-    x->title="Equipment Coordinate System Identification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x000A;
-    x->title="Study Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x000C;
-    x->title="Study Priority ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0012;
-    x->title="Study ID Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0032;
-    x->title="Study Verified Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0033;
-    x->title="Study Verified Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0034;
-    x->title="Study Read Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0035;
-    x->title="Study Read Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1000;
-    x->title="Scheduled Study Start Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1001;
-    x->title="Scheduled Study Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1010;
-    x->title="Scheduled Study Stop Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1011;
-    x->title="Scheduled Study Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1020;
-    x->title="Scheduled Study Location";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1021;
-    x->title="Scheduled Study Location AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1030;
-    x->title="Reason for Study";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1031;
-    x->title="Requesting Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1032;
-    x->title="Requesting Physician";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1033;
-    x->title="Requesting Service";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1034;
-    x->title="Requesting Service Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1040;
-    x->title="Study Arrival Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1041;
-    x->title="Study Arrival Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1050;
-    x->title="Study Completion Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1051;
-    x->title="Study Completion Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1055;
-    x->title="Study Component Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1060;
-    x->title="Requested Procedure Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1064;
-    x->title="Requested Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1070;
-    x->title="Requested Contrast Agent";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x4000;
-    x->title="Study Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0004;
-    x->title="Referenced Patient Alias Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0008;
-    x->title="Visit Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0010;
-    x->title="Admission ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0011;
-    x->title="Issuer of Admission ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0014;
-    x->title="Issuer of Admission ID Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0016;
-    x->title="Route of Admissions";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001A;
-    x->title="Scheduled Admission Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001B;
-    x->title="Scheduled Admission Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001C;
-    x->title="Scheduled Discharge Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001D;
-    x->title="Scheduled Discharge Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001E;
-    x->title="Scheduled Patient Institution Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0020;
-    x->title="Admitting Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0021;
-    x->title="Admitting Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0030;
-    x->title="Discharge Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0032;
-    x->title="Discharge Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0040;
-    x->title="Discharge Diagnosis Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0044;
-    x->title="Discharge Diagnosis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0050;
-    x->title="Special Needs";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0060;
-    x->title="Service Episode ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0061;
-    x->title="Issuer of Service Episode ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0062;
-    x->title="Service Episode Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0064;
-    x->title="Issuer of Service Episode ID Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0100;
-    x->title="Pertinent Documents Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0101;
-    x->title="Pertinent Resources Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0102;
-    x->title="Resource Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0300;
-    x->title="Current Patient Location";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0400;
-    x->title="Patient's Institution Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0500;
-    x->title="Patient State";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0502;
-    x->title="Patient Clinical Trial Participation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x4000;
-    x->title="Visit Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0004;
-    x->title="Waveform Originality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0005;
-    x->title="Number of Waveform Channels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0010;
-    x->title="Number of Waveform Samples";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x001A;
-    x->title="Sampling Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0020;
-    x->title="Multiplex Group Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0200;
-    x->title="Channel Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0202;
-    x->title="Waveform Channel Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0203;
-    x->title="Channel Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0205;
-    x->title="Channel Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0208;
-    x->title="Channel Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0209;
-    x->title="Channel Source Modifiers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x020A;
-    x->title="Source Waveform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x020C;
-    x->title="Channel Derivation Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0210;
-    x->title="Channel Sensitivity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0211;
-    x->title="Channel Sensitivity Units Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0212;
-    x->title="Channel Sensitivity Correction Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0213;
-    x->title="Channel Baseline";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0214;
-    x->title="Channel Time Skew";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0215;
-    x->title="Channel Sample Skew";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0218;
-    x->title="Channel Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x021A;
-    x->title="Waveform Bits Stored";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0220;
-    x->title="Filter Low Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0221;
-    x->title="Filter High Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0222;
-    x->title="Notch Filter Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0223;
-    x->title="Notch Filter Bandwidth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0230;
-    x->title="Waveform Data Display Scale";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0231;
-    x->title="Waveform Display Background CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0240;
-    x->title="Waveform Presentation Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0241;
-    x->title="Presentation Group Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0242;
-    x->title="Channel Display Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0244;
-    x->title="Channel Recommended Display CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0245;
-    x->title="Channel Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0246;
-    x->title="Display Shading Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0247;
-    x->title="Fractional Channel Display Scale";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0248;
-    x->title="Absolute Channel Display Scale";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0300;
-    x->title="Multiplexed Audio Channels Description Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0301;
-    x->title="Channel Identification Code";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0302;
-    x->title="Channel Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0001;
-    x->title="Scheduled Station AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0002;
-    x->title="Scheduled Procedure Step Start Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0003;
-    x->title="Scheduled Procedure Step Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0004;
-    x->title="Scheduled Procedure Step End Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0005;
-    x->title="Scheduled Procedure Step End Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0006;
-    x->title="Scheduled Performing Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0007;
-    x->title="Scheduled Procedure Step Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0008;
-    x->title="Scheduled Protocol Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0009;
-    x->title="Scheduled Procedure Step ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x000A;
-    x->title="Stage Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x000B;
-    x->title="Scheduled Performing Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0010;
-    x->title="Scheduled Station Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0011;
-    x->title="Scheduled Procedure Step Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0012;
-    x->title="Pre-Medication";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0020;
-    x->title="Scheduled Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0026;
-    x->title="Order Placer Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0027;
-    x->title="Order Filler Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0031;
-    x->title="Local Namespace Entity ID";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0032;
-    x->title="Universal Entity ID";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0033;
-    x->title="Universal Entity ID Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0035;
-    x->title="Identifier Type Code";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0036;
-    x->title="Assigning Facility Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0039;
-    x->title="Assigning Jurisdiction Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x003A;
-    x->title="Assigning Agency or Department Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0100;
-    x->title="Scheduled Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0220;
-    x->title="Referenced Non-Image Composite SOP Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0241;
-    x->title="Performed Station AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0242;
-    x->title="Performed Station Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0243;
-    x->title="Performed Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0244;
-    x->title="Performed Procedure Step Start Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0245;
-    x->title="Performed Procedure Step Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0250;
-    x->title="Performed Procedure Step End Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0251;
-    x->title="Performed Procedure Step End Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0252;
-    x->title="Performed Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0253;
-    x->title="Performed Procedure Step ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0254;
-    x->title="Performed Procedure Step Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0255;
-    x->title="Performed Procedure Type Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0260;
-    x->title="Performed Protocol Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0261;
-    x->title="Performed Protocol Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0270;
-    x->title="Scheduled Step Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0275;
-    x->title="Request Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0280;
-    x->title="Comments on the Performed Procedure Step";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0281;
-    x->title="Performed Procedure Step Discontinuation Reason Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0293;
-    x->title="Quantity Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0294;
-    x->title="Quantity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0295;
-    x->title="Measuring Units Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0296;
-    x->title="Billing Item Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0300;
-    x->title="Total Time of Fluoroscopy";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0301;
-    x->title="Total Number of Exposures";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0302;
-    x->title="Entrance Dose";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0303;
-    x->title="Exposed Area";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0306;
-    x->title="Distance Source to Entrance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0307;
-    x->title="Distance Source to Support";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x030E;
-    x->title="Exposure Dose Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0310;
-    x->title="Comments on Radiation Dose";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0312;
-    x->title="X-Ray Output";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0314;
-    x->title="Half Value Layer";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0316;
-    x->title="Organ Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0318;
-    x->title="Organ Exposed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0320;
-    x->title="Billing Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0321;
-    x->title="Film Consumption Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0324;
-    x->title="Billing Supplies and Devices Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0330;
-    x->title="Referenced Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0340;
-    x->title="Performed Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0400;
-    x->title="Comments on the Scheduled Procedure Step";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0440;
-    x->title="Protocol Context Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0441;
-    x->title="Content Item Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0500;
-    x->title="Scheduled Specimen Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x050A;
-    x->title="Specimen Accession Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0512;
-    x->title="Container Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0513;
-    x->title="Issuer of the Container Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0515;
-    x->title="Alternate Container Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0518;
-    x->title="Container Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x051A;
-    x->title="Container Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0520;
-    x->title="Container Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0550;
-    x->title="Specimen Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0551;
-    x->title="Specimen Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0552;
-    x->title="Specimen Description Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0553;
-    x->title="Specimen Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0554;
-    x->title="Specimen UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0555;
-    x->title="Acquisition Context Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0556;
-    x->title="Acquisition Context Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x059A;
-    x->title="Specimen Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0560;
-    x->title="Specimen Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0562;
-    x->title="Issuer of the Specimen Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0600;
-    x->title="Specimen Short Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0602;
-    x->title="Specimen Detailed Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0610;
-    x->title="Specimen Preparation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0612;
-    x->title="Specimen Preparation Step Content Item Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0620;
-    x->title="Specimen Localization Content Item Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x06FA;
-    x->title="Slide Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x071A;
-    x->title="Image Center Point Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x072A;
-    x->title="X Offset in Slide Coordinate System";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x073A;
-    x->title="Y Offset in Slide Coordinate System";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x074A;
-    x->title="Z Offset in Slide Coordinate System";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x08D8;
-    x->title="Pixel Spacing Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x08DA;
-    x->title="Coordinate System Axis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x08EA;
-    x->title="Measurement Units Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x09F8;
-    x->title="Vital Stain Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1001;
-    x->title="Requested Procedure ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1002;
-    x->title="Reason for the Requested Procedure";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1003;
-    x->title="Requested Procedure Priority";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1004;
-    x->title="Patient Transport Arrangements";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1005;
-    x->title="Requested Procedure Location";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1006;
-    x->title="Placer Order Number / Procedure";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1007;
-    x->title="Filler Order Number / Procedure";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1008;
-    x->title="Confidentiality Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1009;
-    x->title="Reporting Priority";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x100A;
-    x->title="Reason for Requested Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1010;
-    x->title="Names of Intended Recipients of Results";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1011;
-    x->title="Intended Recipients of Results Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1012;
-    x->title="Reason For Performed Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1060;
-    x->title="Requested Procedure Description (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1101;
-    x->title="Person Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1102;
-    x->title="Person's Address";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1103;
-    x->title="Person's Telephone Numbers";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1104;
-    x->title="Person's Telecom Information";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1400;
-    x->title="Requested Procedure Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2001;
-    x->title="Reason for the Imaging Service Request";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2004;
-    x->title="Issue Date of Imaging Service Request";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2005;
-    x->title="Issue Time of Imaging Service Request";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2006;
-    x->title="Placer Order Number / Imaging Service Request (Retired)";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2007;
-    x->title="Filler Order Number / Imaging Service Request (Retired)";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2008;
-    x->title="Order Entered By";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2009;
-    x->title="Order Enterer's Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2010;
-    x->title="Order Callback Phone Number";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2011;
-    x->title="Order Callback Telecom Information";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2016;
-    x->title="Placer Order Number / Imaging Service Request";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2017;
-    x->title="Filler Order Number / Imaging Service Request";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2400;
-    x->title="Imaging Service Request Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x3001;
-    x->title="Confidentiality Constraint on Patient Data Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4001;
-    x->title="General Purpose Scheduled Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4002;
-    x->title="General Purpose Performed Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4003;
-    x->title="General Purpose Scheduled Procedure Step Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4004;
-    x->title="Scheduled Processing Applications Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4005;
-    x->title="Scheduled Procedure Step Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4006;
-    x->title="Multiple Copies Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4007;
-    x->title="Performed Processing Applications Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4009;
-    x->title="Human Performer Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4010;
-    x->title="Scheduled Procedure Step Modification DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4011;
-    x->title="Expected Completion DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4015;
-    x->title="Resulting General Purpose Performed Procedure Steps Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4016;
-    x->title="Referenced General Purpose Scheduled Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4018;
-    x->title="Scheduled Workitem Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4019;
-    x->title="Performed Workitem Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4020;
-    x->title="Input Availability Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4021;
-    x->title="Input Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4022;
-    x->title="Relevant Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4023;
-    x->title="Referenced General Purpose Scheduled Procedure Step Transaction UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4025;
-    x->title="Scheduled Station Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4026;
-    x->title="Scheduled Station Class Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4027;
-    x->title="Scheduled Station Geographic Location Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4028;
-    x->title="Performed Station Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4029;
-    x->title="Performed Station Class Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4030;
-    x->title="Performed Station Geographic Location Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4031;
-    x->title="Requested Subsequent Workitem Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4032;
-    x->title="Non-DICOM Output Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4033;
-    x->title="Output Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4034;
-    x->title="Scheduled Human Performers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4035;
-    x->title="Actual Human Performers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4036;
-    x->title="Human Performer's Organization";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4037;
-    x->title="Human Performer's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4040;
-    x->title="Raw Data Handling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4041;
-    x->title="Input Readiness State";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4050;
-    x->title="Performed Procedure Step Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4051;
-    x->title="Performed Procedure Step End DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4052;
-    x->title="Procedure Step Cancellation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4070;
-    x->title="Output Destination Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4071;
-    x->title="DICOM Storage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4072;
-    x->title="STOW-RS Storage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4073;
-    x->title="Storage URL";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4074;
-    x->title="XDS Storage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x8302;
-    x->title="Entrance Dose in mGy";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9092;
-    x->title="Parametric Map Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9094;
-    x->title="Referenced Image Real World Value Mapping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9096;
-    x->title="Real World Value Mapping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9098;
-    x->title="Pixel Value Mapping Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9210;
-    x->title="LUT Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9211;
-    x->title="Real World Value Last Value Mapped";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9212;
-    x->title="Real World Value LUT Data";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9213;
-    x->title="Double Float Real World Value Last Value Mapped";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9214;
-    x->title="Double Float Real World Value First Value Mapped";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9216;
-    x->title="Real World Value First Value Mapped";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9220;
-    x->title="Quantity Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9224;
-    x->title="Real World Value Intercept";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9225;
-    x->title="Real World Value Slope";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA007;
-    x->title="Findings Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA010;
-    x->title="Relationship Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA020;
-    x->title="Findings Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA021;
-    x->title="Findings Group UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA022;
-    x->title="Referenced Findings Group UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA023;
-    x->title="Findings Group Recording Date (Trial)";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA024;
-    x->title="Findings Group Recording Time (Trial)";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA026;
-    x->title="Findings Source Category Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA027;
-    x->title="Verifying Organization";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA028;
-    x->title="Documenting Organization Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA030;
-    x->title="Verification DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA032;
-    x->title="Observation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA040;
-    x->title="Value Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA043;
-    x->title="Concept Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA047;
-    x->title="Measurement Precision Description (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA050;
-    x->title="Continuity Of Content";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA057;
-    x->title="Urgency or Priority Alerts (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA060;
-    x->title="Sequencing Indicator (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA066;
-    x->title="Document Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA067;
-    x->title="Document Author (Trial)";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA068;
-    x->title="Document Author Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA070;
-    x->title="Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA073;
-    x->title="Verifying Observer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA074;
-    x->title="Object Binary Identifier (Trial)";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA075;
-    x->title="Verifying Observer Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA076;
-    x->title="Documenting Observer Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA078;
-    x->title="Author Observer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA07A;
-    x->title="Participant Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA07C;
-    x->title="Custodial Organization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA080;
-    x->title="Participation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA082;
-    x->title="Participation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA084;
-    x->title="Observer Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA085;
-    x->title="Procedure Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA088;
-    x->title="Verifying Observer Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA089;
-    x->title="Object Directory Binary Identifier (Trial)";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA090;
-    x->title="Equivalent CDA Document Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA0B0;
-    x->title="Referenced Waveform Channels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA110;
-    x->title="Date of Document or Verbal Transaction (Trial)";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA112;
-    x->title="Time of Document Creation or Verbal Transaction (Trial)";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA120;
-    x->title="DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA121;
-    x->title="Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA122;
-    x->title="Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA123;
-    x->title="Person Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA124;
-    x->title="UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA125;
-    x->title="Report Status ID (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA130;
-    x->title="Temporal Range Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA132;
-    x->title="Referenced Sample Positions";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA136;
-    x->title="Referenced Frame Numbers";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA138;
-    x->title="Referenced Time Offsets";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA13A;
-    x->title="Referenced DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA160;
-    x->title="Text Value";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA161;
-    x->title="Floating Point Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA162;
-    x->title="Rational Numerator Value";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA163;
-    x->title="Rational Denominator Value";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA167;
-    x->title="Observation Category Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA168;
-    x->title="Concept Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA16A;
-    x->title="Bibliographic Citation (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA170;
-    x->title="Purpose of Reference Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA171;
-    x->title="Observation UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA172;
-    x->title="Referenced Observation UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA173;
-    x->title="Referenced Observation Class (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA174;
-    x->title="Referenced Object Observation Class (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA180;
-    x->title="Annotation Group Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA192;
-    x->title="Observation Date (Trial)";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA193;
-    x->title="Observation Time (Trial)";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA194;
-    x->title="Measurement Automation (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA195;
-    x->title="Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA224;
-    x->title="Identification Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA290;
-    x->title="Coordinates Set Geometric Type (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA296;
-    x->title="Algorithm Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA297;
-    x->title="Algorithm Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA29A;
-    x->title="Pixel Coordinates Set (Trial)";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA300;
-    x->title="Measured Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA301;
-    x->title="Numeric Value Qualifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA307;
-    x->title="Current Observer (Trial)";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA30A;
-    x->title="Numeric Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA313;
-    x->title="Referenced Accession Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA33A;
-    x->title="Report Status Comment (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA340;
-    x->title="Procedure Context Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA352;
-    x->title="Verbal Source (Trial)";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA353;
-    x->title="Address (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA354;
-    x->title="Telephone Number (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA358;
-    x->title="Verbal Source Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA360;
-    x->title="Predecessor Documents Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA370;
-    x->title="Referenced Request Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA372;
-    x->title="Performed Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA375;
-    x->title="Current Requested Procedure Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA380;
-    x->title="Report Detail Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA385;
-    x->title="Pertinent Other Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA390;
-    x->title="HL7 Structured Document Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA402;
-    x->title="Observation Subject UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA403;
-    x->title="Observation Subject Class (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA404;
-    x->title="Observation Subject Type Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA491;
-    x->title="Completion Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA492;
-    x->title="Completion Flag Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA493;
-    x->title="Verification Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA494;
-    x->title="Archive Requested";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA496;
-    x->title="Preliminary Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA504;
-    x->title="Content Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA525;
-    x->title="Identical Documents Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA600;
-    x->title="Observation Subject Context Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA601;
-    x->title="Observer Context Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA603;
-    x->title="Procedure Context Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA730;
-    x->title="Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA731;
-    x->title="Relationship Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA732;
-    x->title="Relationship Type Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA744;
-    x->title="Language Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA992;
-    x->title="Uniform Resource Locator (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xB020;
-    x->title="Waveform Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB00;
-    x->title="Template Identifier";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB06;
-    x->title="Template Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB07;
-    x->title="Template Local Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB0B;
-    x->title="Template Extension Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB0C;
-    x->title="Template Extension Organization UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB0D;
-    x->title="Template Extension Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB73;
-    x->title="Referenced Content Item Identifier";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE001;
-    x->title="HL7 Instance Identifier";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE004;
-    x->title="HL7 Document Effective Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE006;
-    x->title="HL7 Document Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE008;
-    x->title="Document Class Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE010;
-    x->title="Retrieve URI";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE011;
-    x->title="Retrieve Location UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE020;
-    x->title="Type of Instances";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE021;
-    x->title="DICOM Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE022;
-    x->title="DICOM Media Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE023;
-    x->title="WADO Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE024;
-    x->title="XDS Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE025;
-    x->title="WADO-RS Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE030;
-    x->title="Repository Unique ID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE031;
-    x->title="Home Community ID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0010;
-    x->title="Document Title";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0011;
-    x->title="Encapsulated Document";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0012;
-    x->title="MIME Type of Encapsulated Document";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0013;
-    x->title="Source Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0014;
-    x->title="List of MIME Types";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0001;
-    x->title="Product Package Identifier";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0002;
-    x->title="Substance Administration Approval";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0003;
-    x->title="Approval Status Further Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0004;
-    x->title="Approval Status DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0007;
-    x->title="Product Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0008;
-    x->title="Product Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0009;
-    x->title="Product Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x000A;
-    x->title="Product Lot Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x000B;
-    x->title="Product Expiration DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0010;
-    x->title="Substance Administration DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0011;
-    x->title="Substance Administration Notes";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0012;
-    x->title="Substance Administration Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0013;
-    x->title="Product Parameter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0019;
-    x->title="Substance Administration Parameter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0012;
-    x->title="Lens Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0014;
-    x->title="Right Lens Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0015;
-    x->title="Left Lens Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0016;
-    x->title="Unspecified Laterality Lens Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0018;
-    x->title="Cylinder Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0028;
-    x->title="Prism Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0030;
-    x->title="Horizontal Prism Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0032;
-    x->title="Horizontal Prism Base";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0034;
-    x->title="Vertical Prism Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0036;
-    x->title="Vertical Prism Base";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0038;
-    x->title="Lens Segment Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0040;
-    x->title="Optical Transmittance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0042;
-    x->title="Channel Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0044;
-    x->title="Pupil Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0046;
-    x->title="Corneal Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0050;
-    x->title="Autorefraction Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0052;
-    x->title="Autorefraction Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0060;
-    x->title="Distance Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0062;
-    x->title="Near Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0063;
-    x->title="Intermediate Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0064;
-    x->title="Other Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0070;
-    x->title="Keratometry Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0071;
-    x->title="Keratometry Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0074;
-    x->title="Steep Keratometric Axis Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0075;
-    x->title="Radius of Curvature";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0076;
-    x->title="Keratometric Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0077;
-    x->title="Keratometric Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0080;
-    x->title="Flat Keratometric Axis Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0092;
-    x->title="Background Color";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0094;
-    x->title="Optotype";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0095;
-    x->title="Optotype Presentation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0097;
-    x->title="Subjective Refraction Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0098;
-    x->title="Subjective Refraction Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0100;
-    x->title="Add Near Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0101;
-    x->title="Add Intermediate Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0102;
-    x->title="Add Other Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0104;
-    x->title="Add Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0106;
-    x->title="Viewing Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0121;
-    x->title="Visual Acuity Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0122;
-    x->title="Visual Acuity Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0123;
-    x->title="Visual Acuity Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0124;
-    x->title="Visual Acuity Both Eyes Open Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0125;
-    x->title="Viewing Distance Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0135;
-    x->title="Visual Acuity Modifiers";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0137;
-    x->title="Decimal Visual Acuity";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0139;
-    x->title="Optotype Detailed Definition";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0145;
-    x->title="Referenced Refractive Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0146;
-    x->title="Sphere Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0147;
-    x->title="Cylinder Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0201;
-    x->title="Corneal Topography Surface";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0202;
-    x->title="Corneal Vertex Location";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0203;
-    x->title="Pupil Centroid X-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0204;
-    x->title="Pupil Centroid Y-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0205;
-    x->title="Equivalent Pupil Radius";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0207;
-    x->title="Corneal Topography Map Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0208;
-    x->title="Vertices of the Outline of Pupil";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0210;
-    x->title="Corneal Topography Mapping Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0211;
-    x->title="Maximum Corneal Curvature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0212;
-    x->title="Maximum Corneal Curvature";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0213;
-    x->title="Maximum Corneal Curvature Location";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0215;
-    x->title="Minimum Keratometric Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0218;
-    x->title="Simulated Keratometric Cylinder Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0220;
-    x->title="Average Corneal Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0224;
-    x->title="Corneal I-S Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0227;
-    x->title="Analyzed Area";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0230;
-    x->title="Surface Regularity Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0232;
-    x->title="Surface Asymmetry Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0234;
-    x->title="Corneal Eccentricity Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0236;
-    x->title="Keratoconus Prediction Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0238;
-    x->title="Decimal Potential Visual Acuity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0242;
-    x->title="Corneal Topography Map Quality Evaluation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0244;
-    x->title="Source Image Corneal Processed Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0247;
-    x->title="Corneal Point Location";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0248;
-    x->title="Corneal Point Estimated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0249;
-    x->title="Axial Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0250;
-    x->title="Tangential Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0251;
-    x->title="Refractive Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0252;
-    x->title="Relative Elevation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0253;
-    x->title="Corneal Wavefront";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0001;
-    x->title="Imaged Volume Width";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0002;
-    x->title="Imaged Volume Height";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0003;
-    x->title="Imaged Volume Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0006;
-    x->title="Total Pixel Matrix Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0007;
-    x->title="Total Pixel Matrix Rows";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0008;
-    x->title="Total Pixel Matrix Origin Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0010;
-    x->title="Specimen Label in Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0011;
-    x->title="Focus Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0012;
-    x->title="Extended Depth of Field";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0013;
-    x->title="Number of Focal Planes";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0014;
-    x->title="Distance Between Focal Planes";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0015;
-    x->title="Recommended Absent Pixel CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0100;
-    x->title="Illuminator Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0102;
-    x->title="Image Orientation (Slide)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0105;
-    x->title="Optical Path Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0106;
-    x->title="Optical Path Identifier";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0107;
-    x->title="Optical Path Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0108;
-    x->title="Illumination Color Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0110;
-    x->title="Specimen Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0111;
-    x->title="Condenser Lens Power";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0112;
-    x->title="Objective Lens Power";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0113;
-    x->title="Objective Lens Numerical Aperture";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0120;
-    x->title="Palette Color Lookup Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0200;
-    x->title="Referenced Image Navigation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0201;
-    x->title="Top Left Hand Corner of Localizer Area";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0202;
-    x->title="Bottom Right Hand Corner of Localizer Area";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0207;
-    x->title="Optical Path Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x021A;
-    x->title="Plane Position (Slide) Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x021E;
-    x->title="Column Position In Total Image Pixel Matrix";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x021F;
-    x->title="Row Position In Total Image Pixel Matrix";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0301;
-    x->title="Pixel Origin Interpretation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0004;
-    x->title="Calibration Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0010;
-    x->title="Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0012;
-    x->title="Container Component Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0013;
-    x->title="Container Component Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0014;
-    x->title="Device Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0015;
-    x->title="Container Component Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0016;
-    x->title="Device Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0017;
-    x->title="Device Diameter Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0018;
-    x->title="Device Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0019;
-    x->title="Inter-Marker Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001A;
-    x->title="Container Component Material";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001B;
-    x->title="Container Component ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001C;
-    x->title="Container Component Length";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001D;
-    x->title="Container Component Diameter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001E;
-    x->title="Container Component Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0020;
-    x->title="Device Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0001;
-    x->title="Contrast/Bolus Ingredient Percent by Volume";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0002;
-    x->title="OCT Focal Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0003;
-    x->title="Beam Spot Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0004;
-    x->title="Effective Refractive Index";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0006;
-    x->title="OCT Acquisition Domain";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0007;
-    x->title="OCT Optical Center Wavelength";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0008;
-    x->title="Axial Resolution";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0009;
-    x->title="Ranging Depth";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0011;
-    x->title="A-line Rate";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0012;
-    x->title="A-lines Per Frame";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0013;
-    x->title="Catheter Rotational Rate";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0014;
-    x->title="A-line Pixel Spacing";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0016;
-    x->title="Mode of Percutaneous Access Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0025;
-    x->title="Intravascular OCT Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0026;
-    x->title="OCT Z Offset Applied";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0027;
-    x->title="Intravascular Frame Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0028;
-    x->title="Intravascular Longitudinal Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0029;
-    x->title="Intravascular OCT Frame Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0030;
-    x->title="OCT Z Offset Correction";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0031;
-    x->title="Catheter Direction of Rotation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0033;
-    x->title="Seam Line Location";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0034;
-    x->title="First A-line Location";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0036;
-    x->title="Seam Line Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0038;
-    x->title="Number of Padded A-lines";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0039;
-    x->title="Interpolation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x003A;
-    x->title="Refractive Index Applied";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0010;
-    x->title="Energy Window Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0011;
-    x->title="Number of Energy Windows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0012;
-    x->title="Energy Window Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0013;
-    x->title="Energy Window Range Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0014;
-    x->title="Energy Window Lower Limit";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0015;
-    x->title="Energy Window Upper Limit";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0016;
-    x->title="Radiopharmaceutical Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0017;
-    x->title="Residual Syringe Counts";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0018;
-    x->title="Energy Window Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0020;
-    x->title="Detector Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0021;
-    x->title="Number of Detectors";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0022;
-    x->title="Detector Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0030;
-    x->title="Phase Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0031;
-    x->title="Number of Phases";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0032;
-    x->title="Phase Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0033;
-    x->title="Number of Frames in Phase";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0036;
-    x->title="Phase Delay";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0038;
-    x->title="Pause Between Frames";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0039;
-    x->title="Phase Description";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0050;
-    x->title="Rotation Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0051;
-    x->title="Number of Rotations";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0052;
-    x->title="Rotation Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0053;
-    x->title="Number of Frames in Rotation";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0060;
-    x->title="R-R Interval Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0061;
-    x->title="Number of R-R Intervals";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0062;
-    x->title="Gated Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0063;
-    x->title="Data Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0070;
-    x->title="Time Slot Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0071;
-    x->title="Number of Time Slots";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0072;
-    x->title="Time Slot Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0073;
-    x->title="Time Slot Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0080;
-    x->title="Slice Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0081;
-    x->title="Number of Slices";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0090;
-    x->title="Angular View Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0100;
-    x->title="Time Slice Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0101;
-    x->title="Number of Time Slices";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0200;
-    x->title="Start Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0202;
-    x->title="Type of Detector Motion";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0210;
-    x->title="Trigger Vector";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0211;
-    x->title="Number of Triggers in Phase";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0220;
-    x->title="View Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0222;
-    x->title="View Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0300;
-    x->title="Radionuclide Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0302;
-    x->title="Administration Route Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0304;
-    x->title="Radiopharmaceutical Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0306;
-    x->title="Calibration Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0308;
-    x->title="Energy Window Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0400;
-    x->title="Image ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0410;
-    x->title="Patient Orientation Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0412;
-    x->title="Patient Orientation Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0414;
-    x->title="Patient Gantry Relationship Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0500;
-    x->title="Slice Progression Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0501;
-    x->title="Scan Progression Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1000;
-    x->title="Series Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1001;
-    x->title="Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1002;
-    x->title="Counts Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1004;
-    x->title="Reprojection Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1006;
-    x->title="SUV Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1100;
-    x->title="Randoms Correction Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1101;
-    x->title="Attenuation Correction Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1102;
-    x->title="Decay Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1103;
-    x->title="Reconstruction Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1104;
-    x->title="Detector Lines of Response Used";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1105;
-    x->title="Scatter Correction Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1200;
-    x->title="Axial Acceptance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1201;
-    x->title="Axial Mash";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1202;
-    x->title="Transverse Mash";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1203;
-    x->title="Detector Element Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1210;
-    x->title="Coincidence Window Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1220;
-    x->title="Secondary Counts Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1300;
-    x->title="Frame Reference Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1310;
-    x->title="Primary (Prompts) Counts Accumulated";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1311;
-    x->title="Secondary Counts Accumulated";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1320;
-    x->title="Slice Sensitivity Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1321;
-    x->title="Decay Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1322;
-    x->title="Dose Calibration Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1323;
-    x->title="Scatter Fraction Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1324;
-    x->title="Dead Time Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1330;
-    x->title="Image Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1400;
-    x->title="Counts Included";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1401;
-    x->title="Dead Time Correction Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3000;
-    x->title="Histogram Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3002;
-    x->title="Histogram Number of Bins";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3004;
-    x->title="Histogram First Bin Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3006;
-    x->title="Histogram Last Bin Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3008;
-    x->title="Histogram Bin Width";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3010;
-    x->title="Histogram Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3020;
-    x->title="Histogram Data";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0001;
-    x->title="Segmentation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0002;
-    x->title="Segment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0003;
-    x->title="Segmented Property Category Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0004;
-    x->title="Segment Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0005;
-    x->title="Segment Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0006;
-    x->title="Segment Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0008;
-    x->title="Segment Algorithm Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0009;
-    x->title="Segment Algorithm Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000A;
-    x->title="Segment Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000B;
-    x->title="Referenced Segment Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000C;
-    x->title="Recommended Display Grayscale Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000D;
-    x->title="Recommended Display CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000E;
-    x->title="Maximum Fractional Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000F;
-    x->title="Segmented Property Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0010;
-    x->title="Segmentation Fractional Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0011;
-    x->title="Segmented Property Type Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0012;
-    x->title="Used Segments Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0020;
-    x->title="Tracking ID";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0021;
-    x->title="Tracking UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0002;
-    x->title="Deformable Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0003;
-    x->title="Source Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0005;
-    x->title="Deformable Registration Grid Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0007;
-    x->title="Grid Dimensions";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0008;
-    x->title="Grid Resolution";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0009;
-    x->title="Vector Grid Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x000F;
-    x->title="Pre Deformation Matrix Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0010;
-    x->title="Post Deformation Matrix Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0001;
-    x->title="Number of Surfaces";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0002;
-    x->title="Surface Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0003;
-    x->title="Surface Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0004;
-    x->title="Surface Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0009;
-    x->title="Surface Processing";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000A;
-    x->title="Surface Processing Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000B;
-    x->title="Surface Processing Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000C;
-    x->title="Recommended Presentation Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000D;
-    x->title="Recommended Presentation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000E;
-    x->title="Finite Volume";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0010;
-    x->title="Manifold";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0011;
-    x->title="Surface Points Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0012;
-    x->title="Surface Points Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0013;
-    x->title="Surface Mesh Primitives Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0015;
-    x->title="Number of Surface Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0016;
-    x->title="Point Coordinates Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0017;
-    x->title="Point Position Accuracy";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0018;
-    x->title="Mean Point Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0019;
-    x->title="Maximum Point Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001A;
-    x->title="Points Bounding Box Coordinates";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001B;
-    x->title="Axis of Rotation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001C;
-    x->title="Center of Rotation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001E;
-    x->title="Number of Vectors";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001F;
-    x->title="Vector Dimensionality";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0020;
-    x->title="Vector Accuracy";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0021;
-    x->title="Vector Coordinate Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0023;
-    x->title="Triangle Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0024;
-    x->title="Edge Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0025;
-    x->title="Vertex Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0026;
-    x->title="Triangle Strip Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0027;
-    x->title="Triangle Fan Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0028;
-    x->title="Line Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0029;
-    x->title="Primitive Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002A;
-    x->title="Surface Count";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002B;
-    x->title="Referenced Surface Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002C;
-    x->title="Referenced Surface Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002D;
-    x->title="Segment Surface Generation Algorithm Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002E;
-    x->title="Segment Surface Source Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002F;
-    x->title="Algorithm Family Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0030;
-    x->title="Algorithm Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0031;
-    x->title="Algorithm Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0032;
-    x->title="Algorithm Parameters";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0034;
-    x->title="Facet Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0035;
-    x->title="Surface Processing Algorithm Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0036;
-    x->title="Algorithm Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0037;
-    x->title="Recommended Point Radius";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0038;
-    x->title="Recommended Line Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0040;
-    x->title="Long Primitive Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0041;
-    x->title="Long Triangle Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0042;
-    x->title="Long Edge Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0043;
-    x->title="Long Vertex Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0101;
-    x->title="Track Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0102;
-    x->title="Track Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0103;
-    x->title="Recommended Display CIELab Value List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0104;
-    x->title="Tracking Algorithm Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0105;
-    x->title="Track Set Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0106;
-    x->title="Track Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0107;
-    x->title="Track Set Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0108;
-    x->title="Track Set Anatomical Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0121;
-    x->title="Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0124;
-    x->title="Track Set Statistics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0125;
-    x->title="Floating Point Values";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0129;
-    x->title="Track Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0130;
-    x->title="Track Statistics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0132;
-    x->title="Measurement Values Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0133;
-    x->title="Diffusion Acquisition Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0134;
-    x->title="Diffusion Model Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6210;
-    x->title="Implant Size";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6221;
-    x->title="Implant Template Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6222;
-    x->title="Replaced Implant Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6223;
-    x->title="Implant Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6224;
-    x->title="Derivation Implant Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6225;
-    x->title="Original Implant Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6226;
-    x->title="Effective DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6230;
-    x->title="Implant Target Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6260;
-    x->title="Information From Manufacturer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6265;
-    x->title="Notification From Manufacturer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6270;
-    x->title="Information Issue DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6280;
-    x->title="Information Summary";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62A0;
-    x->title="Implant Regulatory Disapproval Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62A5;
-    x->title="Overall Template Spatial Tolerance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62C0;
-    x->title="HPGL Document Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62D0;
-    x->title="HPGL Document ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62D5;
-    x->title="HPGL Document Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62E0;
-    x->title="View Orientation Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62F0;
-    x->title="View Orientation Modifier";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62F2;
-    x->title="HPGL Document Scaling";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6300;
-    x->title="HPGL Document";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6310;
-    x->title="HPGL Contour Pen Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6320;
-    x->title="HPGL Pen Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6330;
-    x->title="HPGL Pen Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6340;
-    x->title="HPGL Pen Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6345;
-    x->title="HPGL Pen Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6346;
-    x->title="Recommended Rotation Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6347;
-    x->title="Bounding Rectangle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6350;
-    x->title="Implant Template 3D Model Surface Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6360;
-    x->title="Surface Model Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6380;
-    x->title="Surface Model Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6390;
-    x->title="Surface Model Scaling Factor";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63A0;
-    x->title="Materials Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63A4;
-    x->title="Coating Materials Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63A8;
-    x->title="Implant Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63AC;
-    x->title="Fixation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63B0;
-    x->title="Mating Feature Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63C0;
-    x->title="Mating Feature Set ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63D0;
-    x->title="Mating Feature Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63E0;
-    x->title="Mating Feature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63F0;
-    x->title="Mating Feature ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6400;
-    x->title="Mating Feature Degree of Freedom Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6410;
-    x->title="Degree of Freedom ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6420;
-    x->title="Degree of Freedom Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6430;
-    x->title="2D Mating Feature Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6440;
-    x->title="Referenced HPGL Document ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6450;
-    x->title="2D Mating Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6460;
-    x->title="2D Mating Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6470;
-    x->title="2D Degree of Freedom Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6490;
-    x->title="3D Degree of Freedom Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64A0;
-    x->title="Range of Freedom";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64C0;
-    x->title="3D Mating Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64D0;
-    x->title="3D Mating Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64F0;
-    x->title="2D Degree of Freedom Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6500;
-    x->title="Planning Landmark Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6510;
-    x->title="Planning Landmark Line Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6520;
-    x->title="Planning Landmark Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6530;
-    x->title="Planning Landmark ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6540;
-    x->title="Planning Landmark Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6545;
-    x->title="Planning Landmark Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6550;
-    x->title="2D Point Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6560;
-    x->title="2D Point Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6590;
-    x->title="3D Point Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65A0;
-    x->title="2D Line Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65B0;
-    x->title="2D Line Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65D0;
-    x->title="3D Line Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65E0;
-    x->title="2D Plane Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65F0;
-    x->title="2D Plane Intersection";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6610;
-    x->title="3D Plane Origin";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6620;
-    x->title="3D Plane Normal";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0001;
-    x->title="Graphic Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0002;
-    x->title="Graphic Layer";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0003;
-    x->title="Bounding Box Annotation Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0004;
-    x->title="Anchor Point Annotation Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0005;
-    x->title="Graphic Annotation Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0006;
-    x->title="Unformatted Text Value";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0008;
-    x->title="Text Object Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0009;
-    x->title="Graphic Object Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0010;
-    x->title="Bounding Box Top Left Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0011;
-    x->title="Bounding Box Bottom Right Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0012;
-    x->title="Bounding Box Text Horizontal Justification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0014;
-    x->title="Anchor Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0015;
-    x->title="Anchor Point Visibility";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0020;
-    x->title="Graphic Dimensions";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0021;
-    x->title="Number of Graphic Points";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0022;
-    x->title="Graphic Data";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0023;
-    x->title="Graphic Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0024;
-    x->title="Graphic Filled";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0040;
-    x->title="Image Rotation (Retired)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0041;
-    x->title="Image Horizontal Flip";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0042;
-    x->title="Image Rotation";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0050;
-    x->title="Displayed Area Top Left Hand Corner (Trial)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0051;
-    x->title="Displayed Area Bottom Right Hand Corner (Trial)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0052;
-    x->title="Displayed Area Top Left Hand Corner";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0053;
-    x->title="Displayed Area Bottom Right Hand Corner";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x005A;
-    x->title="Displayed Area Selection Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0060;
-    x->title="Graphic Layer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0062;
-    x->title="Graphic Layer Order";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0066;
-    x->title="Graphic Layer Recommended Display Grayscale Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0067;
-    x->title="Graphic Layer Recommended Display RGB Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0068;
-    x->title="Graphic Layer Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0080;
-    x->title="Content Label";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0081;
-    x->title="Content Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0082;
-    x->title="Presentation Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0083;
-    x->title="Presentation Creation Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0084;
-    x->title="Content Creator's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0086;
-    x->title="Content Creator's Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0087;
-    x->title="Alternate Content Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0100;
-    x->title="Presentation Size Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0101;
-    x->title="Presentation Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0102;
-    x->title="Presentation Pixel Aspect Ratio";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0103;
-    x->title="Presentation Pixel Magnification Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0207;
-    x->title="Graphic Group Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0208;
-    x->title="Graphic Group Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0209;
-    x->title="Compound Graphic Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0226;
-    x->title="Compound Graphic Instance ID";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0227;
-    x->title="Font Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0228;
-    x->title="Font Name Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0229;
-    x->title="CSS Font Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0230;
-    x->title="Rotation Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0231;
-    x->title="Text Style Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0232;
-    x->title="Line Style Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0233;
-    x->title="Fill Style Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0234;
-    x->title="Graphic Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0241;
-    x->title="Text Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0242;
-    x->title="Horizontal Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0243;
-    x->title="Vertical Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0244;
-    x->title="Shadow Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0245;
-    x->title="Shadow Offset X";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0246;
-    x->title="Shadow Offset Y";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0247;
-    x->title="Shadow Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0248;
-    x->title="Underlined";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0249;
-    x->title="Bold";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0250;
-    x->title="Italic";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0251;
-    x->title="Pattern On Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0252;
-    x->title="Pattern Off Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0253;
-    x->title="Line Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0254;
-    x->title="Line Dashing Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0255;
-    x->title="Line Pattern";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0256;
-    x->title="Fill Pattern";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0257;
-    x->title="Fill Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0258;
-    x->title="Shadow Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0261;
-    x->title="Gap Length";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0262;
-    x->title="Diameter of Visibility";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0273;
-    x->title="Rotation Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0274;
-    x->title="Tick Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0278;
-    x->title="Show Tick Label";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0279;
-    x->title="Tick Label Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0282;
-    x->title="Compound Graphic Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0284;
-    x->title="Pattern On Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0285;
-    x->title="Pattern Off Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0287;
-    x->title="Major Ticks Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0288;
-    x->title="Tick Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0289;
-    x->title="Tick Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0294;
-    x->title="Compound Graphic Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0295;
-    x->title="Graphic Group ID";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0306;
-    x->title="Shape Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0308;
-    x->title="Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0309;
-    x->title="Matrix Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030A;
-    x->title="Matrix Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030B;
-    x->title="Frame of Reference to Displayed Coordinate System Transformation Matrix";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030C;
-    x->title="Frame of Reference Transformation Matrix Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030D;
-    x->title="Registration Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030F;
-    x->title="Fiducial Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0310;
-    x->title="Fiducial Identifier";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0311;
-    x->title="Fiducial Identifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0312;
-    x->title="Contour Uncertainty Radius";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0314;
-    x->title="Used Fiducials Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0318;
-    x->title="Graphic Coordinates Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x031A;
-    x->title="Fiducial UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x031C;
-    x->title="Fiducial Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x031E;
-    x->title="Fiducial Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0401;
-    x->title="Graphic Layer Recommended Display CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0402;
-    x->title="Blending Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0403;
-    x->title="Relative Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0404;
-    x->title="Referenced Spatial Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0405;
-    x->title="Blending Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1101;
-    x->title="Presentation Display Collection UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1102;
-    x->title="Presentation Sequence Collection UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1103;
-    x->title="Presentation Sequence Position Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1104;
-    x->title="Rendered Image Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1201;
-    x->title="Volumetric Presentation State Input Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1202;
-    x->title="Presentation Input Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1203;
-    x->title="Input Sequence Position Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1204;
-    x->title="Crop";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1205;
-    x->title="Cropping Specification Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1206;
-    x->title="Compositing Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1207;
-    x->title="Volumetric Presentation Input Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1208;
-    x->title="Image Volume Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1301;
-    x->title="Volume Cropping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1302;
-    x->title="Volume Cropping Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1303;
-    x->title="Bounding Box Crop";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1304;
-    x->title="Oblique Cropping Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1305;
-    x->title="Plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1306;
-    x->title="Plane Normal";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1309;
-    x->title="Cropping Specification Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1501;
-    x->title="Multi-Planar Reconstruction Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1502;
-    x->title="MPR Thickness Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1503;
-    x->title="MPR Slab Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1505;
-    x->title="MPR Top Left Hand Corner";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1507;
-    x->title="MPR View Width Direction";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1508;
-    x->title="MPR View Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x150C;
-    x->title="Number of Volumetric Curve Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x150D;
-    x->title="Volumetric Curve Points";
-    x->vr="OD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1511;
-    x->title="MPR View Height Direction";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1512;
-    x->title="MPR View Height";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1801;
-    x->title="Presentation State Classification Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1802;
-    x->title="Component Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1803;
-    x->title="Component Input Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1804;
-    x->title="Volumetric Presentation Input Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1805;
-    x->title="Presentation State Compositor Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1806;
-    x->title="Weighting Transfer Function Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1807;
-    x->title="Weighting Lookup Table Descriptor";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1808;
-    x->title="Weighting Lookup Table Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1901;
-    x->title="Volumetric Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1903;
-    x->title="Referenced Structured Context Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1904;
-    x->title="Referenced Content Item";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1905;
-    x->title="Volumetric Presentation Input Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1907;
-    x->title="Annotation Clipping";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A01;
-    x->title="Presentation Animation Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A03;
-    x->title="Recommended Animation Rate";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A04;
-    x->title="Animation Curve Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A05;
-    x->title="Animation Step Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0002;
-    x->title="Hanging Protocol Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0004;
-    x->title="Hanging Protocol Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0006;
-    x->title="Hanging Protocol Level";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0008;
-    x->title="Hanging Protocol Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x000A;
-    x->title="Hanging Protocol Creation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x000C;
-    x->title="Hanging Protocol Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x000E;
-    x->title="Hanging Protocol User Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0010;
-    x->title="Hanging Protocol User Group Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0012;
-    x->title="Source Hanging Protocol Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0014;
-    x->title="Number of Priors Referenced";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0020;
-    x->title="Image Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0022;
-    x->title="Image Set Selector Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0024;
-    x->title="Image Set Selector Usage Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0026;
-    x->title="Selector Attribute";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0028;
-    x->title="Selector Value Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0030;
-    x->title="Time Based Image Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0032;
-    x->title="Image Set Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0034;
-    x->title="Image Set Selector Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0038;
-    x->title="Relative Time";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x003A;
-    x->title="Relative Time Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x003C;
-    x->title="Abstract Prior Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x003E;
-    x->title="Abstract Prior Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0040;
-    x->title="Image Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0050;
-    x->title="Selector Attribute VR";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0052;
-    x->title="Selector Sequence Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0054;
-    x->title="Selector Sequence Pointer Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0056;
-    x->title="Selector Attribute Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x005E;
-    x->title="Selector AE Value";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x005F;
-    x->title="Selector AS Value";
-    x->vr="AS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0060;
-    x->title="Selector AT Value";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0061;
-    x->title="Selector DA Value";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0062;
-    x->title="Selector CS Value";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0063;
-    x->title="Selector DT Value";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0064;
-    x->title="Selector IS Value";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0065;
-    x->title="Selector OB Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0066;
-    x->title="Selector LO Value";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0067;
-    x->title="Selector OF Value";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0068;
-    x->title="Selector LT Value";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0069;
-    x->title="Selector OW Value";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006A;
-    x->title="Selector PN Value";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006B;
-    x->title="Selector TM Value";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006C;
-    x->title="Selector SH Value";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006D;
-    x->title="Selector UN Value";
-    x->vr="UN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006E;
-    x->title="Selector ST Value";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006F;
-    x->title="Selector UC Value";
-    x->vr="UC";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0070;
-    x->title="Selector UT Value";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0071;
-    x->title="Selector UR Value";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0072;
-    x->title="Selector DS Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0073;
-    x->title="Selector OD Value";
-    x->vr="OD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0074;
-    x->title="Selector FD Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0075;
-    x->title="Selector OL Value";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0076;
-    x->title="Selector FL Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0078;
-    x->title="Selector UL Value";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007A;
-    x->title="Selector US Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007C;
-    x->title="Selector SL Value";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007E;
-    x->title="Selector SS Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007F;
-    x->title="Selector UI Value";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0080;
-    x->title="Selector Code Sequence Value";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0100;
-    x->title="Number of Screens";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0102;
-    x->title="Nominal Screen Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0104;
-    x->title="Number of Vertical Pixels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0106;
-    x->title="Number of Horizontal Pixels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0108;
-    x->title="Display Environment Spatial Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x010A;
-    x->title="Screen Minimum Grayscale Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x010C;
-    x->title="Screen Minimum Color Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x010E;
-    x->title="Application Maximum Repaint Time";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0200;
-    x->title="Display Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0202;
-    x->title="Display Set Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0203;
-    x->title="Display Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0204;
-    x->title="Display Set Presentation Group";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0206;
-    x->title="Display Set Presentation Group Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0208;
-    x->title="Partial Data Display Handling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0210;
-    x->title="Synchronized Scrolling Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0212;
-    x->title="Display Set Scrolling Group";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0214;
-    x->title="Navigation Indicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0216;
-    x->title="Navigation Display Set";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0218;
-    x->title="Reference Display Sets";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0300;
-    x->title="Image Boxes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0302;
-    x->title="Image Box Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0304;
-    x->title="Image Box Layout Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0306;
-    x->title="Image Box Tile Horizontal Dimension";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0308;
-    x->title="Image Box Tile Vertical Dimension";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0310;
-    x->title="Image Box Scroll Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0312;
-    x->title="Image Box Small Scroll Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0314;
-    x->title="Image Box Small Scroll Amount";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0316;
-    x->title="Image Box Large Scroll Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0318;
-    x->title="Image Box Large Scroll Amount";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0320;
-    x->title="Image Box Overlap Priority";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0330;
-    x->title="Cine Relative to Real-Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0400;
-    x->title="Filter Operations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0402;
-    x->title="Filter-by Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0404;
-    x->title="Filter-by Attribute Presence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0406;
-    x->title="Filter-by Operator";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0420;
-    x->title="Structured Display Background CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0421;
-    x->title="Empty Image Box CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0422;
-    x->title="Structured Display Image Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0424;
-    x->title="Structured Display Text Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0427;
-    x->title="Referenced First Frame Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0430;
-    x->title="Image Box Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0432;
-    x->title="Synchronized Image Box List";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0434;
-    x->title="Type of Synchronization";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0500;
-    x->title="Blending Operation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0510;
-    x->title="Reformatting Operation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0512;
-    x->title="Reformatting Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0514;
-    x->title="Reformatting Interval";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0516;
-    x->title="Reformatting Operation Initial View Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0520;
-    x->title="3D Rendering Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0600;
-    x->title="Sorting Operations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0602;
-    x->title="Sort-by Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0604;
-    x->title="Sorting Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0700;
-    x->title="Display Set Patient Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0702;
-    x->title="VOI Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0704;
-    x->title="Pseudo-Color Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0705;
-    x->title="Pseudo-Color Palette Instance Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0706;
-    x->title="Show Grayscale Inverted";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0710;
-    x->title="Show Image True Size Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0712;
-    x->title="Show Graphic Annotation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0714;
-    x->title="Show Patient Demographics Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0716;
-    x->title="Show Acquisition Techniques Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0717;
-    x->title="Display Set Horizontal Justification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0718;
-    x->title="Display Set Vertical Justification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x0120;
-    x->title="Continuation Start Meterset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x0121;
-    x->title="Continuation End Meterset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1000;
-    x->title="Procedure Step State";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1002;
-    x->title="Procedure Step Progress Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1004;
-    x->title="Procedure Step Progress";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1006;
-    x->title="Procedure Step Progress Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1008;
-    x->title="Procedure Step Communications URI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x100A;
-    x->title="Contact URI";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x100C;
-    x->title="Contact Display Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x100E;
-    x->title="Procedure Step Discontinuation Reason Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1020;
-    x->title="Beam Task Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1022;
-    x->title="Beam Task Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1024;
-    x->title="Beam Order Index (Trial)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1025;
-    x->title="Autosequence Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1026;
-    x->title="Table Top Vertical Adjusted Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1027;
-    x->title="Table Top Longitudinal Adjusted Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1028;
-    x->title="Table Top Lateral Adjusted Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102A;
-    x->title="Patient Support Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102B;
-    x->title="Table Top Eccentric Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102C;
-    x->title="Table Top Pitch Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102D;
-    x->title="Table Top Roll Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1030;
-    x->title="Delivery Verification Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1032;
-    x->title="Verification Image Timing";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1034;
-    x->title="Double Exposure Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1036;
-    x->title="Double Exposure Ordering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1038;
-    x->title="Double Exposure Meterset (Trial)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x103A;
-    x->title="Double Exposure Field Delta (Trial)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1040;
-    x->title="Related Reference RT Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1042;
-    x->title="General Machine Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1044;
-    x->title="Conventional Machine Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1046;
-    x->title="Ion Machine Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1048;
-    x->title="Failed Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x104A;
-    x->title="Overridden Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x104C;
-    x->title="Conventional Control Point Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x104E;
-    x->title="Ion Control Point Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1050;
-    x->title="Attribute Occurrence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1052;
-    x->title="Attribute Occurrence Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1054;
-    x->title="Attribute Item Selector";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1056;
-    x->title="Attribute Occurrence Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1057;
-    x->title="Selector Sequence Pointer Items";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1200;
-    x->title="Scheduled Procedure Step Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1202;
-    x->title="Worklist Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1204;
-    x->title="Procedure Step Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1210;
-    x->title="Scheduled Processing Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1212;
-    x->title="Performed Processing Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1216;
-    x->title="Unified Procedure Step Performed Procedure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1220;
-    x->title="Related Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1222;
-    x->title="Procedure Step Relationship Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1224;
-    x->title="Replaced Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1230;
-    x->title="Deletion Lock";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1234;
-    x->title="Receiving AE";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1236;
-    x->title="Requesting AE";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1238;
-    x->title="Reason for Cancellation";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1242;
-    x->title="SCP Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1244;
-    x->title="Subscription List Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1246;
-    x->title="Unified Procedure Step List Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1324;
-    x->title="Beam Order Index";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1338;
-    x->title="Double Exposure Meterset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x133A;
-    x->title="Double Exposure Field Delta";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1401;
-    x->title="Brachy Task Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1402;
-    x->title="Continuation Start Total Reference Air Kerma";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1403;
-    x->title="Continuation End Total Reference Air Kerma";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1404;
-    x->title="Continuation Pulse Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1405;
-    x->title="Channel Delivery Order Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1406;
-    x->title="Referenced Channel Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1407;
-    x->title="Start Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1408;
-    x->title="End Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1409;
-    x->title="Omitted Channel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140A;
-    x->title="Reason for Channel Omission";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140B;
-    x->title="Reason for Channel Omission Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140C;
-    x->title="Channel Delivery Order Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140D;
-    x->title="Channel Delivery Continuation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140E;
-    x->title="Omitted Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0001;
-    x->title="Implant Assembly Template Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0003;
-    x->title="Implant Assembly Template Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0006;
-    x->title="Implant Assembly Template Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0008;
-    x->title="Replaced Implant Assembly Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x000A;
-    x->title="Implant Assembly Template Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x000C;
-    x->title="Original Implant Assembly Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x000E;
-    x->title="Derivation Implant Assembly Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0010;
-    x->title="Implant Assembly Template Target Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0020;
-    x->title="Procedure Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0030;
-    x->title="Surgical Technique";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0032;
-    x->title="Component Types Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0034;
-    x->title="Component Type Code Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0036;
-    x->title="Exclusive Component Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0038;
-    x->title="Mandatory Component Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0040;
-    x->title="Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0055;
-    x->title="Component ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0060;
-    x->title="Component Assembly Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0070;
-    x->title="Component 1 Referenced ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0080;
-    x->title="Component 1 Referenced Mating Feature Set ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0090;
-    x->title="Component 1 Referenced Mating Feature ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x00A0;
-    x->title="Component 2 Referenced ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x00B0;
-    x->title="Component 2 Referenced Mating Feature Set ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x00C0;
-    x->title="Component 2 Referenced Mating Feature ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0001;
-    x->title="Implant Template Group Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0010;
-    x->title="Implant Template Group Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0020;
-    x->title="Implant Template Group Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0024;
-    x->title="Implant Template Group Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0026;
-    x->title="Replaced Implant Template Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0028;
-    x->title="Implant Template Group Target Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x002A;
-    x->title="Implant Template Group Members Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x002E;
-    x->title="Implant Template Group Member ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0050;
-    x->title="3D Implant Template Group Member Matching Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0060;
-    x->title="3D Implant Template Group Member Matching Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0070;
-    x->title="Implant Template Group Member Matching 2D Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0090;
-    x->title="2D Implant Template Group Member Matching Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00A0;
-    x->title="2D Implant Template Group Member Matching Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B0;
-    x->title="Implant Template Group Variation Dimension Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B2;
-    x->title="Implant Template Group Variation Dimension Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B4;
-    x->title="Implant Template Group Variation Dimension Rank Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B6;
-    x->title="Referenced Implant Template Group Member ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B8;
-    x->title="Implant Template Group Variation Dimension Rank";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0001;
-    x->title="Surface Scan Acquisition Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0002;
-    x->title="Surface Scan Mode Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0003;
-    x->title="Registration Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0004;
-    x->title="Shot Duration Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0005;
-    x->title="Shot Offset Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0006;
-    x->title="Surface Point Presentation Value Data";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0007;
-    x->title="Surface Point Color CIELab Value Data";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0008;
-    x->title="UV Mapping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0009;
-    x->title="Texture Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0010;
-    x->title="U Value Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0011;
-    x->title="V Value Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0012;
-    x->title="Referenced Texture Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0013;
-    x->title="Referenced Surface Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0001;
-    x->title="Assessment Summary";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0003;
-    x->title="Assessment Summary Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0004;
-    x->title="Assessed SOP Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0005;
-    x->title="Referenced Comparison SOP Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0006;
-    x->title="Number of Assessment Observations";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0007;
-    x->title="Assessment Observations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0008;
-    x->title="Observation Significance";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x000A;
-    x->title="Observation Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x000C;
-    x->title="Structured Constraint Observation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0010;
-    x->title="Assessed Attribute Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0016;
-    x->title="Assessment Set ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0017;
-    x->title="Assessment Requester Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0018;
-    x->title="Selector Attribute Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0019;
-    x->title="Selector Attribute Keyword";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0021;
-    x->title="Assessment Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0022;
-    x->title="Observation Basis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0023;
-    x->title="Assessment Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0032;
-    x->title="Constraint Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0033;
-    x->title="Specification Selection Guidance";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0034;
-    x->title="Constraint Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0035;
-    x->title="Recommended Default Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0036;
-    x->title="Constraint Violation Significance";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0037;
-    x->title="Constraint Violation Condition";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0130;
-    x->title="Storage Media File-set ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0140;
-    x->title="Storage Media File-set UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0200;
-    x->title="Icon Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0904;
-    x->title="Topic Title";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0906;
-    x->title="Topic Subject";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0910;
-    x->title="Topic Author";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0912;
-    x->title="Topic Keywords";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0410;
-    x->title="SOP Instance Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0420;
-    x->title="SOP Authorization DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0424;
-    x->title="SOP Authorization Comment";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0426;
-    x->title="Authorization Equipment Certification Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0005;
-    x->title="MAC ID Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0010;
-    x->title="MAC Calculation Transfer Syntax UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0015;
-    x->title="MAC Algorithm";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0020;
-    x->title="Data Elements Signed";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0100;
-    x->title="Digital Signature UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0105;
-    x->title="Digital Signature DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0110;
-    x->title="Certificate Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0115;
-    x->title="Certificate of Signer";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0120;
-    x->title="Signature";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0305;
-    x->title="Certified Timestamp Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0310;
-    x->title="Certified Timestamp";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0315;
-    x->title="";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0401;
-    x->title="Digital Signature Purpose Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0402;
-    x->title="Referenced Digital Signature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0403;
-    x->title="Referenced SOP Instance MAC Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0404;
-    x->title="MAC";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0500;
-    x->title="Encrypted Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0510;
-    x->title="Encrypted Content Transfer Syntax UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0520;
-    x->title="Encrypted Content";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0550;
-    x->title="Modified Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0561;
-    x->title="Original Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0562;
-    x->title="Attribute Modification DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0563;
-    x->title="Modifying System";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0564;
-    x->title="Source of Previous Values";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0565;
-    x->title="Reason for the Attribute Modification";
-    x->vr="CS";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx0;
-    //x->title="Escape Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx1;
-    //x->title="Run Length Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx2;
-    //x->title="Huffman Table Size";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx3;
-    //x->title="Huffman Table Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx4;
-    //x->title="Shift Table Size";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx5;
-    //x->title="Shift Table Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1010;
-    //x->tag[1]=0xxxxx;
-    //x->title="Zonal Map";
-    //x->vr="US";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0010;
-    x->title="Number of Copies";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x001E;
-    x->title="Printer Configuration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0020;
-    x->title="Print Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0030;
-    x->title="Medium Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0040;
-    x->title="Film Destination";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0050;
-    x->title="Film Session Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0060;
-    x->title="Memory Allocation";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0061;
-    x->title="Maximum Memory Allocation";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0062;
-    x->title="Color Image Printing Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0063;
-    x->title="Collation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0065;
-    x->title="Annotation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0067;
-    x->title="Image Overlay Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0069;
-    x->title="Presentation LUT Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x006A;
-    x->title="Image Box Presentation LUT Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A0;
-    x->title="Memory Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A1;
-    x->title="Printing Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A2;
-    x->title="Media Installed Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A4;
-    x->title="Other Media Available Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A8;
-    x->title="Supported Image Display Formats Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0500;
-    x->title="Referenced Film Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0510;
-    x->title="Referenced Stored Print Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0010;
-    x->title="Image Display Format";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0030;
-    x->title="Annotation Display Format ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0040;
-    x->title="Film Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0050;
-    x->title="Film Size ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0052;
-    x->title="Printer Resolution ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0054;
-    x->title="Default Printer Resolution ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0060;
-    x->title="Magnification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0080;
-    x->title="Smoothing Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A6;
-    x->title="Default Magnification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A7;
-    x->title="Other Magnification Types Available";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A8;
-    x->title="Default Smoothing Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A9;
-    x->title="Other Smoothing Types Available";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0100;
-    x->title="Border Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0110;
-    x->title="Empty Image Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0120;
-    x->title="Min Density";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0130;
-    x->title="Max Density";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0140;
-    x->title="Trim";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0150;
-    x->title="Configuration Information";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0152;
-    x->title="Configuration Information Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0154;
-    x->title="Maximum Collated Films";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x015E;
-    x->title="Illumination";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0160;
-    x->title="Reflected Ambient Light";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0376;
-    x->title="Printer Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0500;
-    x->title="Referenced Film Session Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0510;
-    x->title="Referenced Image Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0520;
-    x->title="Referenced Basic Annotation Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0010;
-    x->title="Image Box Position";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0020;
-    x->title="Polarity";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0030;
-    x->title="Requested Image Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0040;
-    x->title="Requested Decimate/Crop Behavior";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0050;
-    x->title="Requested Resolution ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x00A0;
-    x->title="Requested Image Size Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x00A2;
-    x->title="Decimate/Crop Result";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0110;
-    x->title="Basic Grayscale Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0111;
-    x->title="Basic Color Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0130;
-    x->title="Referenced Image Overlay Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0140;
-    x->title="Referenced VOI LUT Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2030;
-    x->tag[1]=0x0010;
-    x->title="Annotation Position";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2030;
-    x->tag[1]=0x0020;
-    x->title="Text String";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0010;
-    x->title="Referenced Overlay Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0011;
-    x->title="Referenced Overlay Plane Groups";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0020;
-    x->title="Overlay Pixel Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0060;
-    x->title="Overlay Magnification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0070;
-    x->title="Overlay Smoothing Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0072;
-    x->title="Overlay or Image Magnification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0074;
-    x->title="Magnify to Number of Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0080;
-    x->title="Overlay Foreground Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0082;
-    x->title="Overlay Background Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0090;
-    x->title="Overlay Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0100;
-    x->title="Threshold Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0500;
-    x->title="Referenced Image Box Sequence (Retired)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2050;
-    x->tag[1]=0x0010;
-    x->title="Presentation LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2050;
-    x->tag[1]=0x0020;
-    x->title="Presentation LUT Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2050;
-    x->tag[1]=0x0500;
-    x->title="Referenced Presentation LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0010;
-    x->title="Print Job ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0020;
-    x->title="Execution Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0030;
-    x->title="Execution Status Info";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0040;
-    x->title="Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0050;
-    x->title="Creation Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0070;
-    x->title="Originator";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0140;
-    x->title="Destination AE";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0160;
-    x->title="Owner ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0170;
-    x->title="Number of Films";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0500;
-    x->title="Referenced Print Job Sequence (Pull Stored Print)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0010;
-    x->title="Printer Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0020;
-    x->title="Printer Status Info";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0030;
-    x->title="Printer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0099;
-    x->title="Print Queue ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2120;
-    x->tag[1]=0x0010;
-    x->title="Queue Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2120;
-    x->tag[1]=0x0050;
-    x->title="Print Job Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2120;
-    x->tag[1]=0x0070;
-    x->title="Referenced Print Job Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0010;
-    x->title="Print Management Capabilities Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0015;
-    x->title="Printer Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0030;
-    x->title="Film Box Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0040;
-    x->title="Image Box Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0050;
-    x->title="Annotation Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0060;
-    x->title="Image Overlay Box Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0080;
-    x->title="Presentation LUT Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x00A0;
-    x->title="Proposed Study Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x00C0;
-    x->title="Original Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0001;
-    x->title="Label Using Information Extracted From Instances";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0002;
-    x->title="Label Text";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0003;
-    x->title="Label Style Selection";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0004;
-    x->title="Media Disposition";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0005;
-    x->title="Barcode Value";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0006;
-    x->title="Barcode Symbology";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0007;
-    x->title="Allow Media Splitting";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0008;
-    x->title="Include Non-DICOM Objects";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0009;
-    x->title="Include Display Application";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000A;
-    x->title="Preserve Composite Instances After Media Creation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000B;
-    x->title="Total Number of Pieces of Media Created";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000C;
-    x->title="Requested Media Application Profile";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000D;
-    x->title="Referenced Storage Media Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000E;
-    x->title="Failure Attributes";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000F;
-    x->title="Allow Lossy Compression";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0020;
-    x->title="Request Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0002;
-    x->title="RT Image Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0003;
-    x->title="RT Image Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0004;
-    x->title="RT Image Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000A;
-    x->title="Reported Values Origin";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000C;
-    x->title="RT Image Plane";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000D;
-    x->title="X-Ray Image Receptor Translation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000E;
-    x->title="X-Ray Image Receptor Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0010;
-    x->title="RT Image Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0011;
-    x->title="Image Plane Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0012;
-    x->title="RT Image Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0020;
-    x->title="Radiation Machine Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0022;
-    x->title="Radiation Machine SAD";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0024;
-    x->title="Radiation Machine SSD";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0026;
-    x->title="RT Image SID";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0028;
-    x->title="Source to Reference Object Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0029;
-    x->title="Fraction Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0030;
-    x->title="Exposure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0032;
-    x->title="Meterset Exposure";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0034;
-    x->title="Diaphragm Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0040;
-    x->title="Fluence Map Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0041;
-    x->title="Fluence Data Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0042;
-    x->title="Fluence Data Scale";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0050;
-    x->title="Primary Fluence Mode Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0051;
-    x->title="Fluence Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0052;
-    x->title="Fluence Mode ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0001;
-    x->title="DVH Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0002;
-    x->title="Dose Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0004;
-    x->title="Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0005;
-    x->title="Spatial Transform of Dose";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0006;
-    x->title="Dose Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0008;
-    x->title="Normalization Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x000A;
-    x->title="Dose Summation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x000C;
-    x->title="Grid Frame Offset Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x000E;
-    x->title="Dose Grid Scaling";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0010;
-    x->title="RT Dose ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0012;
-    x->title="Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0014;
-    x->title="Tissue Heterogeneity Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0040;
-    x->title="DVH Normalization Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0042;
-    x->title="DVH Normalization Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0050;
-    x->title="DVH Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0052;
-    x->title="DVH Dose Scaling";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0054;
-    x->title="DVH Volume Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0056;
-    x->title="DVH Number of Bins";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0058;
-    x->title="DVH Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0060;
-    x->title="DVH Referenced ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0062;
-    x->title="DVH ROI Contribution Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0070;
-    x->title="DVH Minimum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0072;
-    x->title="DVH Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0074;
-    x->title="DVH Mean Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0002;
-    x->title="Structure Set Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0004;
-    x->title="Structure Set Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0006;
-    x->title="Structure Set Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0008;
-    x->title="Structure Set Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0009;
-    x->title="Structure Set Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0010;
-    x->title="Referenced Frame of Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0012;
-    x->title="RT Referenced Study Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0014;
-    x->title="RT Referenced Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0016;
-    x->title="Contour Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0018;
-    x->title="Predecessor Structure Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0020;
-    x->title="Structure Set ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0022;
-    x->title="ROI Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0024;
-    x->title="Referenced Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0026;
-    x->title="ROI Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0028;
-    x->title="ROI Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x002A;
-    x->title="ROI Display Color";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x002C;
-    x->title="ROI Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0030;
-    x->title="RT Related ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0033;
-    x->title="RT ROI Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0036;
-    x->title="ROI Generation Algorithm";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0038;
-    x->title="ROI Generation Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0039;
-    x->title="ROI Contour Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0040;
-    x->title="Contour Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0042;
-    x->title="Contour Geometric Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0044;
-    x->title="Contour Slab Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0045;
-    x->title="Contour Offset Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0046;
-    x->title="Number of Contour Points";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0048;
-    x->title="Contour Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0049;
-    x->title="Attached Contours";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0050;
-    x->title="Contour Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0080;
-    x->title="RT ROI Observations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0082;
-    x->title="Observation Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0084;
-    x->title="Referenced ROI Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0085;
-    x->title="ROI Observation Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0086;
-    x->title="RT ROI Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0088;
-    x->title="ROI Observation Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00A0;
-    x->title="Related RT ROI Observations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00A4;
-    x->title="RT ROI Interpreted Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00A6;
-    x->title="ROI Interpreter";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B0;
-    x->title="ROI Physical Properties Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B2;
-    x->title="ROI Physical Property";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B4;
-    x->title="ROI Physical Property Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B6;
-    x->title="ROI Elemental Composition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B7;
-    x->title="ROI Elemental Composition Atomic Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B8;
-    x->title="ROI Elemental Composition Atomic Mass Fraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B9;
-    x->title="Additional RT ROI Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C0;
-    x->title="Frame of Reference Relationship Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C2;
-    x->title="Related Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C4;
-    x->title="Frame of Reference Transformation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C6;
-    x->title="Frame of Reference Transformation Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C8;
-    x->title="Frame of Reference Transformation Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0010;
-    x->title="Measured Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0012;
-    x->title="Measured Dose Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0014;
-    x->title="Measured Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0016;
-    x->title="Measured Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0020;
-    x->title="Treatment Session Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0021;
-    x->title="Treatment Session Ion Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0022;
-    x->title="Current Fraction Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0024;
-    x->title="Treatment Control Point Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0025;
-    x->title="Treatment Control Point Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x002A;
-    x->title="Treatment Termination Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x002B;
-    x->title="Treatment Termination Code";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x002C;
-    x->title="Treatment Verification Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0030;
-    x->title="Referenced Treatment Record Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0032;
-    x->title="Specified Primary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0033;
-    x->title="Specified Secondary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0036;
-    x->title="Delivered Primary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0037;
-    x->title="Delivered Secondary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x003A;
-    x->title="Specified Treatment Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x003B;
-    x->title="Delivered Treatment Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0040;
-    x->title="Control Point Delivery Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0041;
-    x->title="Ion Control Point Delivery Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0042;
-    x->title="Specified Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0044;
-    x->title="Delivered Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0045;
-    x->title="Meterset Rate Set";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0046;
-    x->title="Meterset Rate Delivered";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0047;
-    x->title="Scan Spot Metersets Delivered";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0048;
-    x->title="Dose Rate Delivered";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0050;
-    x->title="Treatment Summary Calculated Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0052;
-    x->title="Cumulative Dose to Dose Reference";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0054;
-    x->title="First Treatment Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0056;
-    x->title="Most Recent Treatment Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x005A;
-    x->title="Number of Fractions Delivered";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0060;
-    x->title="Override Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0061;
-    x->title="Parameter Sequence Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0062;
-    x->title="Override Parameter Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0063;
-    x->title="Parameter Item Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0064;
-    x->title="Measured Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0065;
-    x->title="Parameter Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0066;
-    x->title="Override Reason";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0068;
-    x->title="Corrected Parameter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x006A;
-    x->title="Correction Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0070;
-    x->title="Calculated Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0072;
-    x->title="Calculated Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0074;
-    x->title="Calculated Dose Reference Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0076;
-    x->title="Calculated Dose Reference Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0078;
-    x->title="Start Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x007A;
-    x->title="End Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0080;
-    x->title="Referenced Measured Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0082;
-    x->title="Referenced Measured Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0090;
-    x->title="Referenced Calculated Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0092;
-    x->title="Referenced Calculated Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00A0;
-    x->title="Beam Limiting Device Leaf Pairs Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00B0;
-    x->title="Recorded Wedge Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00C0;
-    x->title="Recorded Compensator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00D0;
-    x->title="Recorded Block Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00E0;
-    x->title="Treatment Summary Measured Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F0;
-    x->title="Recorded Snout Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F2;
-    x->title="Recorded Range Shifter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F4;
-    x->title="Recorded Lateral Spreading Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F6;
-    x->title="Recorded Range Modulator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0100;
-    x->title="Recorded Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0105;
-    x->title="Source Serial Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0110;
-    x->title="Treatment Session Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0116;
-    x->title="Application Setup Check";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0120;
-    x->title="Recorded Brachy Accessory Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0122;
-    x->title="Referenced Brachy Accessory Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0130;
-    x->title="Recorded Channel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0132;
-    x->title="Specified Channel Total Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0134;
-    x->title="Delivered Channel Total Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0136;
-    x->title="Specified Number of Pulses";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0138;
-    x->title="Delivered Number of Pulses";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x013A;
-    x->title="Specified Pulse Repetition Interval";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x013C;
-    x->title="Delivered Pulse Repetition Interval";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0140;
-    x->title="Recorded Source Applicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0142;
-    x->title="Referenced Source Applicator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0150;
-    x->title="Recorded Channel Shield Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0152;
-    x->title="Referenced Channel Shield Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0160;
-    x->title="Brachy Control Point Delivered Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0162;
-    x->title="Safe Position Exit Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0164;
-    x->title="Safe Position Exit Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0166;
-    x->title="Safe Position Return Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0168;
-    x->title="Safe Position Return Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0171;
-    x->title="Pulse Specific Brachy Control Point Delivered Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0172;
-    x->title="Pulse Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0173;
-    x->title="Brachy Pulse Control Point Delivered Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0200;
-    x->title="Current Treatment Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0202;
-    x->title="Treatment Status Comment";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0220;
-    x->title="Fraction Group Summary Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0223;
-    x->title="Referenced Fraction Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0224;
-    x->title="Fraction Group Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0230;
-    x->title="Beam Stopper Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0240;
-    x->title="Fraction Status Summary Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0250;
-    x->title="Treatment Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0251;
-    x->title="Treatment Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0002;
-    x->title="RT Plan Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0003;
-    x->title="RT Plan Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0004;
-    x->title="RT Plan Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0006;
-    x->title="RT Plan Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0007;
-    x->title="RT Plan Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0009;
-    x->title="Treatment Protocols";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000A;
-    x->title="Plan Intent";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000B;
-    x->title="Treatment Sites";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000C;
-    x->title="RT Plan Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000E;
-    x->title="Prescription Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0010;
-    x->title="Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0012;
-    x->title="Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0013;
-    x->title="Dose Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0014;
-    x->title="Dose Reference Structure Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0015;
-    x->title="Nominal Beam Energy Unit";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0016;
-    x->title="Dose Reference Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0018;
-    x->title="Dose Reference Point Coordinates";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x001A;
-    x->title="Nominal Prior Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0020;
-    x->title="Dose Reference Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0021;
-    x->title="Constraint Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0022;
-    x->title="Delivery Warning Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0023;
-    x->title="Delivery Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0025;
-    x->title="Target Minimum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0026;
-    x->title="Target Prescription Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0027;
-    x->title="Target Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0028;
-    x->title="Target Underdose Volume Fraction";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002A;
-    x->title="Organ at Risk Full-volume Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002B;
-    x->title="Organ at Risk Limit Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002C;
-    x->title="Organ at Risk Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002D;
-    x->title="Organ at Risk Overdose Volume Fraction";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0040;
-    x->title="Tolerance Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0042;
-    x->title="Tolerance Table Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0043;
-    x->title="Tolerance Table Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0044;
-    x->title="Gantry Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0046;
-    x->title="Beam Limiting Device Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0048;
-    x->title="Beam Limiting Device Tolerance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004A;
-    x->title="Beam Limiting Device Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004B;
-    x->title="Snout Position Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004C;
-    x->title="Patient Support Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004E;
-    x->title="Table Top Eccentric Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004F;
-    x->title="Table Top Pitch Angle Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0050;
-    x->title="Table Top Roll Angle Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0051;
-    x->title="Table Top Vertical Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0052;
-    x->title="Table Top Longitudinal Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0053;
-    x->title="Table Top Lateral Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0055;
-    x->title="RT Plan Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0070;
-    x->title="Fraction Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0071;
-    x->title="Fraction Group Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0072;
-    x->title="Fraction Group Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0078;
-    x->title="Number of Fractions Planned";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0079;
-    x->title="Number of Fraction Pattern Digits Per Day";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x007A;
-    x->title="Repeat Fraction Cycle Length";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x007B;
-    x->title="Fraction Pattern";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0080;
-    x->title="Number of Beams";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0082;
-    x->title="Beam Dose Specification Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0084;
-    x->title="Beam Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0086;
-    x->title="Beam Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0088;
-    x->title="Beam Dose Point Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0089;
-    x->title="Beam Dose Point Equivalent Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008A;
-    x->title="Beam Dose Point SSD";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008B;
-    x->title="Beam Dose Meaning";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008C;
-    x->title="Beam Dose Verification Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008D;
-    x->title="Average Beam Dose Point Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008E;
-    x->title="Average Beam Dose Point Equivalent Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008F;
-    x->title="Average Beam Dose Point SSD";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0090;
-    x->title="Beam Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0091;
-    x->title="Alternate Beam Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0092;
-    x->title="Alternate Beam Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00A0;
-    x->title="Number of Brachy Application Setups";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00A2;
-    x->title="Brachy Application Setup Dose Specification Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00A4;
-    x->title="Brachy Application Setup Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B0;
-    x->title="Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B2;
-    x->title="Treatment Machine Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B3;
-    x->title="Primary Dosimeter Unit";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B4;
-    x->title="Source-Axis Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B6;
-    x->title="Beam Limiting Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B8;
-    x->title="RT Beam Limiting Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BA;
-    x->title="Source to Beam Limiting Device Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BB;
-    x->title="Isocenter to Beam Limiting Device Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BC;
-    x->title="Number of Leaf/Jaw Pairs";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BE;
-    x->title="Leaf Position Boundaries";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C0;
-    x->title="Beam Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C2;
-    x->title="Beam Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C3;
-    x->title="Beam Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C4;
-    x->title="Beam Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C5;
-    x->title="Beam Delivery Duration Limit";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C6;
-    x->title="Radiation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C7;
-    x->title="High-Dose Technique Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C8;
-    x->title="Reference Image Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00CA;
-    x->title="Planned Verification Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00CC;
-    x->title="Imaging Device-Specific Acquisition Parameters";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00CE;
-    x->title="Treatment Delivery Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D0;
-    x->title="Number of Wedges";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D1;
-    x->title="Wedge Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D2;
-    x->title="Wedge Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D3;
-    x->title="Wedge Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D4;
-    x->title="Wedge ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D5;
-    x->title="Wedge Angle";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D6;
-    x->title="Wedge Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D7;
-    x->title="Total Wedge Tray Water-Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D8;
-    x->title="Wedge Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D9;
-    x->title="Isocenter to Wedge Tray Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DA;
-    x->title="Source to Wedge Tray Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DB;
-    x->title="Wedge Thin Edge Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DC;
-    x->title="Bolus ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DD;
-    x->title="Bolus Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DE;
-    x->title="Effective Wedge Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E0;
-    x->title="Number of Compensators";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E1;
-    x->title="Material ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E2;
-    x->title="Total Compensator Tray Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E3;
-    x->title="Compensator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E4;
-    x->title="Compensator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E5;
-    x->title="Compensator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E6;
-    x->title="Source to Compensator Tray Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E7;
-    x->title="Compensator Rows";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E8;
-    x->title="Compensator Columns";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E9;
-    x->title="Compensator Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EA;
-    x->title="Compensator Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EB;
-    x->title="Compensator Transmission Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EC;
-    x->title="Compensator Thickness Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00ED;
-    x->title="Number of Boli";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EE;
-    x->title="Compensator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EF;
-    x->title="Compensator Tray ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F0;
-    x->title="Number of Blocks";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F2;
-    x->title="Total Block Tray Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F3;
-    x->title="Total Block Tray Water-Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F4;
-    x->title="Block Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F5;
-    x->title="Block Tray ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F6;
-    x->title="Source to Block Tray Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F7;
-    x->title="Isocenter to Block Tray Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F8;
-    x->title="Block Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F9;
-    x->title="Accessory Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FA;
-    x->title="Block Divergence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FB;
-    x->title="Block Mounting Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FC;
-    x->title="Block Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FE;
-    x->title="Block Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0100;
-    x->title="Block Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0102;
-    x->title="Block Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0104;
-    x->title="Block Number of Points";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0106;
-    x->title="Block Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0107;
-    x->title="Applicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0108;
-    x->title="Applicator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0109;
-    x->title="Applicator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x010A;
-    x->title="Applicator Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x010C;
-    x->title="Cumulative Dose Reference Coefficient";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x010E;
-    x->title="Final Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0110;
-    x->title="Number of Control Points";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0111;
-    x->title="Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0112;
-    x->title="Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0114;
-    x->title="Nominal Beam Energy";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0115;
-    x->title="Dose Rate Set";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0116;
-    x->title="Wedge Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0118;
-    x->title="Wedge Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011A;
-    x->title="Beam Limiting Device Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011C;
-    x->title="Leaf/Jaw Positions";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011E;
-    x->title="Gantry Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011F;
-    x->title="Gantry Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0120;
-    x->title="Beam Limiting Device Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0121;
-    x->title="Beam Limiting Device Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0122;
-    x->title="Patient Support Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0123;
-    x->title="Patient Support Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0124;
-    x->title="Table Top Eccentric Axis Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0125;
-    x->title="Table Top Eccentric Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0126;
-    x->title="Table Top Eccentric Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0128;
-    x->title="Table Top Vertical Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0129;
-    x->title="Table Top Longitudinal Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x012A;
-    x->title="Table Top Lateral Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x012C;
-    x->title="Isocenter Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x012E;
-    x->title="Surface Entry Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0130;
-    x->title="Source to Surface Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0131;
-    x->title="Average Beam Dose Point Source to External Contour Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0132;
-    x->title="Source to External Contour Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0133;
-    x->title="External Contour Entry Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0134;
-    x->title="Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0140;
-    x->title="Table Top Pitch Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0142;
-    x->title="Table Top Pitch Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0144;
-    x->title="Table Top Roll Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0146;
-    x->title="Table Top Roll Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0148;
-    x->title="Head Fixation Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x014A;
-    x->title="Gantry Pitch Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x014C;
-    x->title="Gantry Pitch Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x014E;
-    x->title="Gantry Pitch Angle Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0150;
-    x->title="Fixation Eye";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0151;
-    x->title="Chair Head Frame Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0152;
-    x->title="Head Fixation Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0153;
-    x->title="Chair Head Frame Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0154;
-    x->title="Fixation Light Azimuthal Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0155;
-    x->title="Fixation Light Polar Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0180;
-    x->title="Patient Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0182;
-    x->title="Patient Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0183;
-    x->title="Patient Setup Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0184;
-    x->title="Patient Additional Position";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0190;
-    x->title="Fixation Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0192;
-    x->title="Fixation Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0194;
-    x->title="Fixation Device Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0196;
-    x->title="Fixation Device Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0198;
-    x->title="Fixation Device Position";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0199;
-    x->title="Fixation Device Pitch Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x019A;
-    x->title="Fixation Device Roll Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A0;
-    x->title="Shielding Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A2;
-    x->title="Shielding Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A4;
-    x->title="Shielding Device Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A6;
-    x->title="Shielding Device Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A8;
-    x->title="Shielding Device Position";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B0;
-    x->title="Setup Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B2;
-    x->title="Setup Technique Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B4;
-    x->title="Setup Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B6;
-    x->title="Setup Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B8;
-    x->title="Setup Device Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01BA;
-    x->title="Setup Device Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01BC;
-    x->title="Setup Device Parameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D0;
-    x->title="Setup Reference Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D2;
-    x->title="Table Top Vertical Setup Displacement";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D4;
-    x->title="Table Top Longitudinal Setup Displacement";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D6;
-    x->title="Table Top Lateral Setup Displacement";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0200;
-    x->title="Brachy Treatment Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0202;
-    x->title="Brachy Treatment Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0206;
-    x->title="Treatment Machine Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0210;
-    x->title="Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0212;
-    x->title="Source Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0214;
-    x->title="Source Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0216;
-    x->title="Source Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0218;
-    x->title="Active Source Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x021A;
-    x->title="Active Source Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x021B;
-    x->title="Source Model ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x021C;
-    x->title="Source Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0222;
-    x->title="Source Encapsulation Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0224;
-    x->title="Source Encapsulation Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0226;
-    x->title="Source Isotope Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0228;
-    x->title="Source Isotope Half Life";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0229;
-    x->title="Source Strength Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022A;
-    x->title="Reference Air Kerma Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022B;
-    x->title="Source Strength";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022C;
-    x->title="Source Strength Reference Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022E;
-    x->title="Source Strength Reference Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0230;
-    x->title="Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0232;
-    x->title="Application Setup Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0234;
-    x->title="Application Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0236;
-    x->title="Application Setup Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0238;
-    x->title="Application Setup Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0240;
-    x->title="Template Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0242;
-    x->title="Template Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0244;
-    x->title="Template Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0250;
-    x->title="Total Reference Air Kerma";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0260;
-    x->title="Brachy Accessory Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0262;
-    x->title="Brachy Accessory Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0263;
-    x->title="Brachy Accessory Device ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0264;
-    x->title="Brachy Accessory Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0266;
-    x->title="Brachy Accessory Device Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x026A;
-    x->title="Brachy Accessory Device Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x026C;
-    x->title="Brachy Accessory Device Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0280;
-    x->title="Channel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0282;
-    x->title="Channel Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0284;
-    x->title="Channel Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0286;
-    x->title="Channel Total Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0288;
-    x->title="Source Movement Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x028A;
-    x->title="Number of Pulses";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x028C;
-    x->title="Pulse Repetition Interval";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0290;
-    x->title="Source Applicator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0291;
-    x->title="Source Applicator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0292;
-    x->title="Source Applicator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0294;
-    x->title="Source Applicator Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0296;
-    x->title="Source Applicator Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0298;
-    x->title="Source Applicator Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x029C;
-    x->title="Source Applicator Wall Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x029E;
-    x->title="Source Applicator Wall Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02A0;
-    x->title="Source Applicator Step Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02A2;
-    x->title="Transfer Tube Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02A4;
-    x->title="Transfer Tube Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B0;
-    x->title="Channel Shield Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B2;
-    x->title="Channel Shield Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B3;
-    x->title="Channel Shield ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B4;
-    x->title="Channel Shield Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B8;
-    x->title="Channel Shield Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02BA;
-    x->title="Channel Shield Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02C8;
-    x->title="Final Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D0;
-    x->title="Brachy Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D2;
-    x->title="Control Point Relative Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D4;
-    x->title="Control Point 3D Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D6;
-    x->title="Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E0;
-    x->title="Compensator Divergence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E1;
-    x->title="Compensator Mounting Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E2;
-    x->title="Source to Compensator Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E3;
-    x->title="Total Compensator Tray Water-Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E4;
-    x->title="Isocenter to Compensator Tray Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E5;
-    x->title="Compensator Column Offset";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E6;
-    x->title="Isocenter to Compensator Distances";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E7;
-    x->title="Compensator Relative Stopping Power Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E8;
-    x->title="Compensator Milling Tool Diameter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02EA;
-    x->title="Ion Range Compensator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02EB;
-    x->title="Compensator Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0302;
-    x->title="Radiation Mass Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0304;
-    x->title="Radiation Atomic Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0306;
-    x->title="Radiation Charge State";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0308;
-    x->title="Scan Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0309;
-    x->title="Modulated Scan Mode Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030A;
-    x->title="Virtual Source-Axis Distances";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030C;
-    x->title="Snout Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030D;
-    x->title="Snout Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030F;
-    x->title="Snout ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0312;
-    x->title="Number of Range Shifters";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0314;
-    x->title="Range Shifter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0316;
-    x->title="Range Shifter Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0318;
-    x->title="Range Shifter ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0320;
-    x->title="Range Shifter Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0322;
-    x->title="Range Shifter Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0330;
-    x->title="Number of Lateral Spreading Devices";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0332;
-    x->title="Lateral Spreading Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0334;
-    x->title="Lateral Spreading Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0336;
-    x->title="Lateral Spreading Device ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0338;
-    x->title="Lateral Spreading Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x033A;
-    x->title="Lateral Spreading Device Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x033C;
-    x->title="Lateral Spreading Device Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0340;
-    x->title="Number of Range Modulators";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0342;
-    x->title="Range Modulator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0344;
-    x->title="Range Modulator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0346;
-    x->title="Range Modulator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0348;
-    x->title="Range Modulator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x034A;
-    x->title="Range Modulator Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x034C;
-    x->title="Beam Current Modulation ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0350;
-    x->title="Patient Support Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0352;
-    x->title="Patient Support ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0354;
-    x->title="Patient Support Accessory Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0355;
-    x->title="Tray Accessory Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0356;
-    x->title="Fixation Light Azimuthal Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0358;
-    x->title="Fixation Light Polar Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x035A;
-    x->title="Meterset Rate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0360;
-    x->title="Range Shifter Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0362;
-    x->title="Range Shifter Setting";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0364;
-    x->title="Isocenter to Range Shifter Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0366;
-    x->title="Range Shifter Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0370;
-    x->title="Lateral Spreading Device Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0372;
-    x->title="Lateral Spreading Device Setting";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0374;
-    x->title="Isocenter to Lateral Spreading Device Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0380;
-    x->title="Range Modulator Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0382;
-    x->title="Range Modulator Gating Start Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0384;
-    x->title="Range Modulator Gating Stop Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0386;
-    x->title="Range Modulator Gating Start Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0388;
-    x->title="Range Modulator Gating Stop Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x038A;
-    x->title="Isocenter to Range Modulator Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0390;
-    x->title="Scan Spot Tune ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0391;
-    x->title="Scan Spot Prescribed Indices";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0392;
-    x->title="Number of Scan Spot Positions";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0393;
-    x->title="Scan Spot Reordered";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0394;
-    x->title="Scan Spot Position Map";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0395;
-    x->title="Scan Spot Reordering Allowed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0396;
-    x->title="Scan Spot Meterset Weights";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0398;
-    x->title="Scanning Spot Size";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x039A;
-    x->title="Number of Paintings";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A0;
-    x->title="Ion Tolerance Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A2;
-    x->title="Ion Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A4;
-    x->title="Ion Beam Limiting Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A6;
-    x->title="Ion Block Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A8;
-    x->title="Ion Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03AA;
-    x->title="Ion Wedge Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03AC;
-    x->title="Ion Wedge Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0401;
-    x->title="Referenced Setup Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0402;
-    x->title="Setup Image Comment";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0410;
-    x->title="Motion Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0412;
-    x->title="Control Point Orientation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0420;
-    x->title="General Accessory Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0421;
-    x->title="General Accessory ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0422;
-    x->title="General Accessory Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0423;
-    x->title="General Accessory Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0424;
-    x->title="General Accessory Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0425;
-    x->title="Source to General Accessory Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0431;
-    x->title="Applicator Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0432;
-    x->title="Applicator Aperture Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0433;
-    x->title="Applicator Opening";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0434;
-    x->title="Applicator Opening X";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0435;
-    x->title="Applicator Opening Y";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0436;
-    x->title="Source to Applicator Mounting Position Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0440;
-    x->title="Number of Block Slab Items";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0441;
-    x->title="Block Slab Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0442;
-    x->title="Block Slab Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0443;
-    x->title="Block Slab Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0450;
-    x->title="Device Motion Control Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0451;
-    x->title="Device Motion Execution Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0452;
-    x->title="Device Motion Observation Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0453;
-    x->title="Device Motion Parameter Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0501;
-    x->title="Distal Depth Fraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0502;
-    x->title="Distal Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0503;
-    x->title="Nominal Range Modulation Fractions";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0504;
-    x->title="Nominal Range Modulated Region Depths";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0505;
-    x->title="Depth Dose Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0506;
-    x->title="Delivered Depth Dose Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0507;
-    x->title="Delivered Distal Depth Fraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0508;
-    x->title="Delivered Distal Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0509;
-    x->title="Delivered Nominal Range Modulation Fractions";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0510;
-    x->title="Delivered Nominal Range Modulated Region Depths";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0511;
-    x->title="Delivered Reference Dose Definition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0512;
-    x->title="Reference Dose Definition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0002;
-    x->title="Referenced RT Plan Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0004;
-    x->title="Referenced Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0006;
-    x->title="Referenced Beam Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0007;
-    x->title="Referenced Reference Image Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0008;
-    x->title="Start Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0009;
-    x->title="End Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x000A;
-    x->title="Referenced Brachy Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x000C;
-    x->title="Referenced Brachy Application Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x000E;
-    x->title="Referenced Source Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0020;
-    x->title="Referenced Fraction Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0022;
-    x->title="Referenced Fraction Group Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0040;
-    x->title="Referenced Verification Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0042;
-    x->title="Referenced Reference Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0050;
-    x->title="Referenced Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0051;
-    x->title="Referenced Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0055;
-    x->title="Brachy Referenced Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0060;
-    x->title="Referenced Structure Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x006A;
-    x->title="Referenced Patient Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0080;
-    x->title="Referenced Dose Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00A0;
-    x->title="Referenced Tolerance Table Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00B0;
-    x->title="Referenced Bolus Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00C0;
-    x->title="Referenced Wedge Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00D0;
-    x->title="Referenced Compensator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00E0;
-    x->title="Referenced Block Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F0;
-    x->title="Referenced Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F2;
-    x->title="Referenced Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F4;
-    x->title="Referenced Start Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F6;
-    x->title="Referenced Stop Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0100;
-    x->title="Referenced Range Shifter Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0102;
-    x->title="Referenced Lateral Spreading Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0104;
-    x->title="Referenced Range Modulator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0111;
-    x->title="Omitted Beam Task Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0112;
-    x->title="Reason for Omission";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0113;
-    x->title="Reason for Omission Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0002;
-    x->title="Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0004;
-    x->title="Review Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0005;
-    x->title="Review Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0008;
-    x->title="Reviewer Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4000;
-    x->tag[1]=0x0010;
-    x->title="Arbitrary";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4000;
-    x->tag[1]=0x4000;
-    x->title="Text Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0040;
-    x->title="Results ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0042;
-    x->title="Results ID Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0050;
-    x->title="Referenced Interpretation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x00FF;
-    x->title="Report Production Status (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0100;
-    x->title="Interpretation Recorded Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0101;
-    x->title="Interpretation Recorded Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0102;
-    x->title="Interpretation Recorder";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0103;
-    x->title="Reference to Recorded Sound";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0108;
-    x->title="Interpretation Transcription Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0109;
-    x->title="Interpretation Transcription Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x010A;
-    x->title="Interpretation Transcriber";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x010B;
-    x->title="Interpretation Text";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x010C;
-    x->title="Interpretation Author";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0111;
-    x->title="Interpretation Approver Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0112;
-    x->title="Interpretation Approval Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0113;
-    x->title="Interpretation Approval Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0114;
-    x->title="Physician Approving Interpretation";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0115;
-    x->title="Interpretation Diagnosis Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0117;
-    x->title="Interpretation Diagnosis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0118;
-    x->title="Results Distribution List Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0119;
-    x->title="Distribution Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x011A;
-    x->title="Distribution Address";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0200;
-    x->title="Interpretation ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0202;
-    x->title="Interpretation ID Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0210;
-    x->title="Interpretation Type ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0212;
-    x->title="Interpretation Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0300;
-    x->title="Impressions";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x4000;
-    x->title="Results Comments";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x0001;
-    x->title="Low Energy Detectors";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x0002;
-    x->title="High Energy Detectors";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x0004;
-    x->title="Detector Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1001;
-    x->title="Threat ROI Voxel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1004;
-    x->title="Threat ROI Base";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1005;
-    x->title="Threat ROI Extents";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1006;
-    x->title="Threat ROI Bitmap";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1007;
-    x->title="Route Segment ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1008;
-    x->title="Gantry Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1009;
-    x->title="OOI Owner Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x100A;
-    x->title="Route Segment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1010;
-    x->title="Potential Threat Object ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1011;
-    x->title="Threat Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1012;
-    x->title="Threat Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1013;
-    x->title="Threat Category Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1014;
-    x->title="ATD Ability Assessment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1015;
-    x->title="ATD Assessment Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1016;
-    x->title="ATD Assessment Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1017;
-    x->title="Mass";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1018;
-    x->title="Density";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1019;
-    x->title="Z Effective";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101A;
-    x->title="Boarding Pass ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101B;
-    x->title="Center of Mass";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101C;
-    x->title="Center of PTO";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101D;
-    x->title="Bounding Polygon";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101E;
-    x->title="Route Segment Start Location ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101F;
-    x->title="Route Segment End Location ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1020;
-    x->title="Route Segment Location ID Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1021;
-    x->title="Abort Reason";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1023;
-    x->title="Volume of PTO";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1024;
-    x->title="Abort Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1025;
-    x->title="Route Segment Start Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1026;
-    x->title="Route Segment End Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1027;
-    x->title="TDR Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1028;
-    x->title="International Route Segment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1029;
-    x->title="Threat Detection Algorithm and Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x102A;
-    x->title="Assigned Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x102B;
-    x->title="Alarm Decision Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1031;
-    x->title="Alarm Decision";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1033;
-    x->title="Number of Total Objects";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1034;
-    x->title="Number of Alarm Objects";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1037;
-    x->title="PTO Representation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1038;
-    x->title="ATD Assessment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1039;
-    x->title="TIP Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x103A;
-    x->title="Version";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1041;
-    x->title="OOI Owner Creation Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1042;
-    x->title="OOI Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1043;
-    x->title="OOI Size";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1044;
-    x->title="Acquisition Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1045;
-    x->title="Basis Materials Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1046;
-    x->title="Phantom Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1047;
-    x->title="OOI Owner Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1048;
-    x->title="Scan Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1051;
-    x->title="Itinerary ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1052;
-    x->title="Itinerary ID Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1053;
-    x->title="Itinerary ID Assigning Authority";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1054;
-    x->title="Route ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1055;
-    x->title="Route ID Assigning Authority";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1056;
-    x->title="Inbound Arrival Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1058;
-    x->title="Carrier ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1059;
-    x->title="Carrier ID Assigning Authority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1060;
-    x->title="Source Orientation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1061;
-    x->title="Source Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1062;
-    x->title="Belt Height";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1064;
-    x->title="Algorithm Routing Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1067;
-    x->title="Transport Classification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1068;
-    x->title="OOI Type Descriptor";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1069;
-    x->title="Total Processing Time";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106C;
-    x->title="Detector Calibration Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106D;
-    x->title="Additional Screening Performed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106E;
-    x->title="Additional Inspection Selection Criteria";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106F;
-    x->title="Additional Inspection Method Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1070;
-    x->title="AIT Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1071;
-    x->title="QR Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1072;
-    x->title="Target Material Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1073;
-    x->title="SNR Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1075;
-    x->title="Image Scale Representation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1076;
-    x->title="Referenced PTO Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1077;
-    x->title="Referenced TDR Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1078;
-    x->title="PTO Location Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1079;
-    x->title="Anomaly Locator Indicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107A;
-    x->title="Anomaly Locator Indicator";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107B;
-    x->title="PTO Region Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107C;
-    x->title="Inspection Selection Criteria";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107D;
-    x->title="Secondary Inspection Method Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107E;
-    x->title="PRCS to RCS Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4FFE;
-    x->tag[1]=0x0001;
-    x->title="MAC Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0005;
-    //x->title="Curve Dimensions";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0010;
-    //x->title="Number of Points";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0020;
-    //x->title="Type of Data";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0022;
-    //x->title="Curve Description";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0030;
-    //x->title="Axis Units";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0040;
-    //x->title="Axis Labels";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0103;
-    //x->title="Data Value Representation";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0104;
-    //x->title="Minimum Coordinate Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0105;
-    //x->title="Maximum Coordinate Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0106;
-    //x->title="Curve Range";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0110;
-    //x->title="Curve Data Descriptor";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0112;
-    //x->title="Coordinate Start Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0114;
-    //x->title="Coordinate Step Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x1001;
-    //x->title="Curve Activation Layer";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2000;
-    //x->title="Audio Type";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2002;
-    //x->title="Audio Sample Format";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2004;
-    //x->title="Number of Channels";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2006;
-    //x->title="Number of Samples";
-    //x->vr="UL";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2008;
-    //x->title="Sample Rate";
-    //x->vr="UL";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x200A;
-    //x->title="Total Time";
-    //x->vr="UL";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x200C;
-    //x->title="Audio Sample Data";
-    //x->vr="OB";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x200E;
-    //x->title="Audio Comments";
-    //x->vr="LT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2500;
-    //x->title="Curve Label";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2600;
-    //x->title="Curve Referenced Overlay Sequence";
-    //x->vr="SQ";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2610;
-    //x->title="Curve Referenced Overlay Group";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x3000;
-    //x->title="Curve Data";
-    //x->vr="OB";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5200;
-    x->tag[1]=0x9229;
-    x->title="Shared Functional Groups Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5200;
-    x->tag[1]=0x9230;
-    x->title="Per-frame Functional Groups Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x0100;
-    x->title="Waveform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x0110;
-    x->title="Channel Minimum Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x0112;
-    x->title="Channel Maximum Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x1004;
-    x->title="Waveform Bits Allocated";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x1006;
-    x->title="Waveform Sample Interpretation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x100A;
-    x->title="Waveform Padding Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x1010;
-    x->title="Waveform Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5600;
-    x->tag[1]=0x0010;
-    x->title="First Order Phase Correction Angle";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5600;
-    x->tag[1]=0x0020;
-    x->title="Spectroscopy Data";
-    x->vr="OF";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0010;
-    //x->title="Overlay Rows";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0011;
-    //x->title="Overlay Columns";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0012;
-    //x->title="Overlay Planes";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0015;
-    //x->title="Number of Frames in Overlay";
-    //x->vr="IS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0022;
-    //x->title="Overlay Description";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0040;
-    //x->title="Overlay Type";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0045;
-    //x->title="Overlay Subtype";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0050;
-    //x->title="Overlay Origin";
-    //x->vr="SS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0051;
-    //x->title="Image Frame Origin";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0052;
-    //x->title="Overlay Plane Origin";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0060;
-    //x->title="Overlay Compression Code";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0061;
-    //x->title="Overlay Compression Originator";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0062;
-    //x->title="Overlay Compression Label";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0063;
-    //x->title="Overlay Compression Description";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0066;
-    //x->title="Overlay Compression Step Pointers";
-    //x->vr="AT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0068;
-    //x->title="Overlay Repeat Interval";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0069;
-    //x->title="Overlay Bits Grouped";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0100;
-    //x->title="Overlay Bits Allocated";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0102;
-    //x->title="Overlay Bit Position";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0110;
-    //x->title="Overlay Format";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0200;
-    //x->title="Overlay Location";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0800;
-    //x->title="Overlay Code Label";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0802;
-    //x->title="Overlay Number of Tables";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0803;
-    //x->title="Overlay Code Table Location";
-    //x->vr="AT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0804;
-    //x->title="Overlay Bits For Code Word";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1001;
-    //x->title="Overlay Activation Layer";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1100;
-    //x->title="Overlay Descriptor - Gray";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1101;
-    //x->title="Overlay Descriptor - Red";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1102;
-    //x->title="Overlay Descriptor - Green";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1103;
-    //x->title="Overlay Descriptor - Blue";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1200;
-    //x->title="Overlays - Gray";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1201;
-    //x->title="Overlays - Red";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1202;
-    //x->title="Overlays - Green";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1203;
-    //x->title="Overlays - Blue";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1301;
-    //x->title="ROI Area";
-    //x->vr="IS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1302;
-    //x->title="ROI Mean";
-    //x->vr="DS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1303;
-    //x->title="ROI Standard Deviation";
-    //x->vr="DS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1500;
-    //x->title="Overlay Label";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x3000;
-    //x->title="Overlay Data";
-    //x->vr="OB";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x4000;
-    //x->title="Overlay Comments";
-    //x->vr="LT";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0008;
-    x->title="Float Pixel Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0009;
-    x->title="Double Float Pixel Data";
-    x->vr="OD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0010;
-    x->title="Pixel Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0020;
-    x->title="Coefficients SDVN";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0030;
-    x->title="Coefficients SDHN";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0040;
-    x->title="Coefficients SDDN";
-    x->vr="OW";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0010;
-    //x->title="Variable Pixel Data";
-    //x->vr="OB";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0011;
-    //x->title="Variable Next Data Group";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0020;
-    //x->title="Variable Coefficients SDVN";
-    //x->vr="OW";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0030;
-    //x->title="Variable Coefficients SDHN";
-    //x->vr="OW";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0040;
-    //x->title="Variable Coefficients SDDN";
-    //x->vr="OW";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFA;
-    x->tag[1]=0xFFFA;
-    x->title="Digital Signatures Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFC;
-    x->tag[1]=0xFFFC;
-    x->title="Data Set Trailing Padding";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFE;
-    x->tag[1]=0xE000;
-    x->title="Item";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFE;
-    x->tag[1]=0xE00D;
-    x->title="Item Delimitation Item";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFE;
-    x->tag[1]=0xE0DD;
-    x->title="Sequence Delimitation Item";
-    x->vr="";
-    lib.append(x);
+constexpr int dictionarySize = sizeof(dictionary)/sizeof(dictionary[0]);
+
+constexpr bool dictionarySorted() {
+    for (int i = 1; i < dictionarySize; i++)
+        if (dictionary[i-1].tag >= dictionary[i].tag) {
+            return false;
+        }
+    return true;
 }
+static_assert(dictionarySorted(), "DICOM dictionary entries must be sorted by tag without duplicates");
+
+// Open addressing (linear probing) index over the packed 32 bit tags, with at
+// least twice as many slots as entries to keep the probe sequences short
+constexpr int indexBits = 13;
+constexpr unsigned int indexSize = 1u << indexBits;
+static_assert(indexSize >= 2*dictionarySize, "DICOM dictionary index is too small");
 
-database::~database() {
-	for (int i = 0; i < lib.size(); i++) {
-		delete lib[i];
-	}
-	lib.clear();
+constexpr unsigned int hashTag(unsigned int tag) {
+    return (tag*2654435761u) >> (32-indexBits);
 }
 
-Reference database::binSearch(unsigned short int one, unsigned short int two,
-                              int min, int max) {
-    if (min == (max+min)/2) {
-        return *lib[min];
+struct DictionaryIndex {
+    unsigned short int slot[indexSize]; // Index of the entry + 1, 0 if empty
+};
+
+constexpr DictionaryIndex buildIndex() {
+    DictionaryIndex index {};
+    for (int i = 0; i < dictionarySize; i++) {
+        unsigned int h = hashTag(dictionary[i].tag);
+        while (index.slot[h]) {
+            h = (h+1) & (indexSize-1);
+        }
+        index.slot[h] = i+1;
     }
+    return index;
+}
+
+constexpr DictionaryIndex dictionaryIndex = buildIndex();
 
-    if (lib[(max+min)/2]->tag[0] > one) {
-        return binSearch(one, two, min, (max+min)/2);
+}
+
+/***
+Function: find
+--------------
+Process: Looks up a tag in the data dictionary
+Output:  The dictionary entry, or NULL if the tag isn't in the dictionary
+***/
+const Reference *database::find(unsigned short int one, unsigned short int two) {
+    unsigned int tag = ((unsigned int)one << 16) | two;
+    for (unsigned int h = hashTag(tag); dictionaryIndex.slot[h]; h = (h+1) & (indexSize-1)) {
+        const Reference *ref = &dictionary[dictionaryIndex.slot[h]-1];
+        if (ref->tag == tag) {
+            return ref;
+        }
     }
-    else if (lib[(max+min)/2]->tag[0] < one) {
-        return binSearch(one, two, (max+min)/2, max);
+    return NULL;
+}
+
+/***
+Function: vrCode
+----------------
+Process: Converts the two characters of an explicit VR to its code
+Output:  The VRCode, VR_NONE if the characters aren't a known VR
+***/
+unsigned char database::vrCode(unsigned char a, unsigned char b) {
+    switch (((unsigned int)a << 8) | b) {
+    case ('A' << 8) | 'E':
+        return VR_AE;
+    case ('A' << 8) | 'S':
+        return VR_AS;
+    case ('A' << 8) | 'T':
+        return VR_AT;
+    case ('C' << 8) | 'S':
+        return VR_CS;
+    case ('D' << 8) | 'A':
+        return VR_DA;
+    case ('D' << 8) | 'S':
+        return VR_DS;
+    case ('D' << 8) | 'T':
+        return VR_DT;
+    case ('F' << 8) | 'D':
+        return VR_FD;
+    case ('F' << 8) | 'L':
+        return VR_FL;
+    case ('I' << 8) | 'S':
+        return VR_IS;
+    case ('L' << 8) | 'O':
+        return VR_LO;
+    case ('L' << 8) | 'T':
+        return VR_LT;
+    case ('O' << 8) | 'B':
+        return VR_OB;
+    case ('O' << 8) | 'D':
+        return VR_OD;
+    case ('O' << 8) | 'F':
+        return VR_OF;
+    case ('O' << 8) | 'L':
+        return VR_OL;
+    case ('O' << 8) | 'V':
+        return VR_OV;
+    case ('O' << 8) | 'W':
+        return VR_OW;
+    case ('P' << 8) | 'N':
+        return VR_PN;
+    case ('S' << 8) | 'H':
+        return VR_SH;
+    case ('S' << 8) | 'L':
+        return VR_SL;
+    case ('S' << 8) | 'Q':
+        return VR_SQ;
+    case ('S' << 8) | 'S':
+        return VR_SS;
+    case ('S' << 8) | 'T':
+        return VR_ST;
+    case ('S' << 8) | 'V':
+        return VR_SV;
+    case ('T' << 8) | 'M':
+        return VR_TM;
+    case ('U' << 8) | 'C':
+        return VR_UC;
+    case ('U' << 8) | 'I':
+        return VR_UI;
+    case ('U' << 8) | 'L':
+        return VR_UL;
+    case ('U' << 8) | 'N':
+        return VR_UN;
+    case ('U' << 8) | 'R':
+        return VR_UR;
+    case ('U' << 8) | 'S':
+        return VR_US;
+    case ('U' << 8) | 'T':
+        return VR_UT;
+    case ('U' << 8) | 'V':
+        return VR_UV;
+    default:
+        return VR_NONE;
     }
-    else {
-        if (lib[(max+min)/2]->tag[1] > two) {
-            return binSearch(one, two, min, (max+min)/2);
-        }
-        else if (lib[(max+min)/2]->tag[1] < two) {
-            return binSearch(one, two, (max+min)/2, max);
-        }
-        else {
-            return *lib[(max+min)/2];
-        }
+}
+
+/***
+Function: validVR
+-----------------
+Output: true if vr is a known value representation
+***/
+bool database::validVR(unsigned char vr) {
+    return vr != VR_NONE;
+}
+
+/***
+Function: implicitVR
+--------------------
+Output: true if an explicit element with this VR has two reserved bytes after
+        the VR and a 4 byte length, rather than a 2 byte length
+***/
+bool database::implicitVR(unsigned char vr) {
+    switch (vr) {
+    case VR_OB:
+    case VR_OD:
+    case VR_OF:
+    case VR_OL:
+    case VR_OV:
+    case VR_OW:
+    case VR_SQ:
+    case VR_SV:
+    case VR_UC:
+    case VR_UN:
+    case VR_UR:
+    case VR_UT:
+    case VR_UV:
+        return true;
+    default:
+        return false;
     }
-}
\ No newline at end of file
+}
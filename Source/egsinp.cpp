@@ -49,6 +49,7 @@ It also is used to get the location of the spectra and muen file (if it hasnt be
 //#include <boost/algorithm/string.hpp>
 
 #include "egsinp.h"
+#include "egsphant.h"
 
 
 
@@ -608,36 +609,29 @@ void egsinp::create_egsinp_phantom(QString element, QString seed_found, QString
 //          //Searches for "media =" and creates a vector caontaining each media
     QString search_for = "media = ";
 
-    //need to unzip file
+    // A .egsphant.gz is inflated as its header is read, the file itself is
+    // left as is
     if (phant_file.endsWith(".gz")) {
         gzip = true;
-        std::cout<<"Need to unzip the egsphant file to obtain the media \n";
-        QProcess *qzip = new QProcess();
-        qzip->setProcessChannelMode(QProcess::MergedChannels);
-        qzip->setReadChannel(QProcess::StandardOutput);
-
-        //Actual line of exectuion
-        QString command = "gunzip " + phant_file;
-        qzip->execute(command);
-        phant_file.remove(phant_file.size()-3, 3);
     }
 
-
-
     QStringList mediaList;
-    QFile *file = new QFile(phant_file);
-    if (file->open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream input(file);
-        if (phant_file.endsWith(".egsphant")) {
-            //egsphant format
-            int num_media =  input.readLine().toInt(); //first line is num media
-            int i=0;
-            while (i < num_media) { //next lines are the media
-                mediaList << input.readLine().trimmed();
-                i++;
-            }
+    if (phant_file.endsWith(".egsphant") || phant_file.endsWith(".egsphant.gz")) {
+        //egsphant format, the media are listed after their number on the first line
+        EGSPhant header;
+        header.loadEGSfirstlines(phant_file);
+        for (int i = 0; i < header.media.size(); i++) {
+            mediaList << header.media[i];
+        }
+        if (mediaList.isEmpty()) {
+            std::cout << "Was not able to read media from " << phant_file.toStdString() << "\n";
         }
-        else {   //geom format, look for 'media ='
+    }
+    else {
+        QFile *file = new QFile(phant_file);
+        if (file->open(QIODevice::ReadOnly | QIODevice::Text)) {
+            QTextStream input(file);
+            //geom format, look for 'media ='
 
             while (!input.atEnd()) {
                 QString line = input.readLine();
@@ -648,11 +642,11 @@ void egsinp::create_egsinp_phantom(QString element, QString seed_found, QString
 
             }
         }
+        else {
+            std::cout << "Was not able to read media from " << phant_file.toStdString() << "\n";
+        }
+        delete file;
     }
-    else {
-        std::cout << "Was not able to read media from " << phant_file.toStdString() << "\n";
-    }
-    delete file;
 
 //----------------------------------------------------------------------------------------------------------------------
 //-----------------------------------------------------------------------------------------------------------------------
@@ -682,13 +676,7 @@ void egsinp::create_egsinp_phantom(QString element, QString seed_found, QString
         *egsinp_file<<"	calculation = first" <<endl;
         *egsinp_file<<"	geometry error limit = 1000" <<endl;
         if (gzip) {
-            QProcess *qzip = new QProcess();
-            qzip->setProcessChannelMode(QProcess::MergedChannels);
-            qzip->setReadChannel(QProcess::StandardOutput);
-            QString command = "gzip -f " + phant_file;  //-f used if exisitng .gz file, -f forces it
-            qzip->execute(command);
             *egsinp_file<<"	egsdat file format = gzip" <<endl <<endl;
-            phant_file.append(".gz");
         }
         *egsinp_file<<":stop run control:" <<endl <<endl;
         *egsinp_file<<"#----------------------------------------------------------------------------------------------------" <<endl <<endl;
@@ -40,6 +40,222 @@
 //This class was created by Martin Martinov
 
 #include "egsphant.h"
+#include <QtConcurrent>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <climits>
+#include <zlib.h>
+
+// A read only QIODevice inflating a gzip file as QTextStream reads it, gzread
+// passes a file that isn't compressed through unchanged
+class GzipReader : public QIODevice {
+public:
+    GzipReader(QString path) {
+        gz = gzopen(QFile::encodeName(path).constData(), "rb");
+        if (gz) {
+            gzbuffer(gz, 1 << 17);
+            open(QIODevice::ReadOnly);
+        }
+    }
+    ~GzipReader() {
+        close();
+    }
+
+    bool isSequential() const override {
+        return true;
+    }
+    void close() override {
+        if (gz) {
+            gzclose(gz);
+            gz = NULL;
+        }
+        QIODevice::close();
+    }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override {
+        int n = gzread(gz, data, unsigned(qMin(maxSize, qint64(1 << 30))));
+        return n < 0 ? -1 : n;
+    }
+    qint64 writeData(const char *, qint64) override {
+        return -1;
+    }
+
+private:
+    gzFile gz;
+};
+
+// Open an egsphant file to be read as text, .gz files are inflated as they are
+// read without touching the file on disk
+static QIODevice *openEGSPhant(QString path) {
+    QIODevice *file;
+    if (path.endsWith(".gz")) {
+        file = new GzipReader(path);
+    }
+    else {
+        file = new QFile(path);
+        file->open(QIODevice::ReadOnly | QIODevice::Text);
+    }
+
+    if (!file->isOpen()) {
+        delete file;
+        return NULL;
+    }
+    return file;
+}
+
+// Text of the phantom on its way to the file, length is its size before it was
+// compressed and crc the gzip CRC-32 of that text
+struct PhantBlock {
+    QByteArray data;
+    quint32 crc;
+    qint64 length;
+    bool ok = true; // false if it could not be compressed
+};
+
+// Where saveEGSPhantFile writes the phantom.  Plain files get the text as is.
+// Gzip files either get one deflate stream fed block by block, or, if
+// parallel, each block is deflated on its own in the task that formatted it
+// and ended with a sync flush so the blocks join into one stream, with their
+// CRCs joined by crc32_combine (as pigz does).  Any zlib or write error
+// marks the writer failed, which close reports.
+class PhantWriter {
+public:
+    PhantWriter(QString path, bool parallelGzip) {
+        gzip = path.endsWith(".gz");
+        parallel = gzip && parallelGzip;
+        failed = false;
+        crc = 0;
+        size = 0;
+        file.setFileName(path);
+        if (!file.open(gzip ? QIODevice::WriteOnly : QIODevice::WriteOnly | QIODevice::Text)) {
+            return;
+        }
+
+        if (parallel) {
+            // gzip header: deflate, no name or time, unix
+            static const char header[10] = {'\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, 3};
+            put(header, 10);
+        }
+        else if (gzip) {
+            memset(&stream, 0, sizeof(stream));
+            if (deflateInit2(&stream, LEVEL, Z_DEFLATED, 15+16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+                failed = true;
+                gzip = false; // Nothing to end in close
+            }
+        }
+    }
+
+    bool isOpen() const {
+        return file.isOpen();
+    }
+
+    // Called from the slice tasks, compresses the block if blocks are
+    // compressed in parallel
+    void prepare(PhantBlock &block) const {
+        block.length = block.data.size();
+        if (!parallel) {
+            return;
+        }
+
+        block.crc = crc32(0, reinterpret_cast<const Bytef *>(block.data.constData()), block.length);
+        z_stream s;
+        memset(&s, 0, sizeof(s));
+        if (deflateInit2(&s, LEVEL, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            block.ok = false;
+            return;
+        }
+        QByteArray out(deflateBound(&s, block.length)+16, 0);
+        s.next_in = reinterpret_cast<Bytef *>(block.data.data());
+        s.avail_in = block.length;
+        s.next_out = reinterpret_cast<Bytef *>(out.data());
+        s.avail_out = out.size();
+        // The bound leaves room for the sync flush, so all of it goes in one call
+        block.ok = deflate(&s, Z_SYNC_FLUSH) == Z_OK && s.avail_in == 0;
+        out.resize(out.size()-s.avail_out);
+        deflateEnd(&s);
+        block.data = out;
+    }
+
+    // Write the blocks in file order
+    void write(PhantBlock &block) {
+        if (failed) {
+            return;
+        }
+        if (!block.ok) {
+            failed = true;
+        }
+        else if (parallel) {
+            crc = crc32_combine(crc, block.crc, block.length);
+            size += block.length;
+            put(block.data.constData(), block.data.size());
+        }
+        else if (gzip) {
+            stream.next_in = reinterpret_cast<Bytef *>(block.data.data());
+            stream.avail_in = block.data.size();
+            deflateOut(Z_NO_FLUSH);
+        }
+        else {
+            put(block.data.constData(), block.data.size());
+        }
+    }
+
+    // Finishes the file, false if anything could not be compressed or written
+    bool close() {
+        if (parallel && !failed) {
+            // An empty final block ends the deflate stream, then the trailer
+            static const char last[2] = {3, 0};
+            put(last, 2);
+            char trailer[8];
+            for (int n = 0; n < 4; n++) {
+                trailer[n] = char(crc >> (8*n));
+                trailer[4+n] = char(size >> (8*n));
+            }
+            put(trailer, 8);
+        }
+        else if (gzip && !parallel) {
+            if (!failed) {
+                stream.avail_in = 0;
+                deflateOut(Z_FINISH);
+            }
+            deflateEnd(&stream);
+        }
+        if (!file.flush()) {
+            failed = true;
+        }
+        file.close();
+        return !failed;
+    }
+
+private:
+    void put(const char *data, qint64 n) {
+        if (!failed && file.write(data, n) != n) {
+            failed = true;
+        }
+    }
+
+    // Deflate what is in stream to the file
+    void deflateOut(int flush) {
+        char out[1 << 16];
+        do {
+            stream.next_out = reinterpret_cast<Bytef *>(out);
+            stream.avail_out = sizeof(out);
+            if (deflate(&stream, flush) == Z_STREAM_ERROR) {
+                failed = true;
+                return;
+            }
+            put(out, sizeof(out)-stream.avail_out);
+        } while (stream.avail_out == 0 && !failed);
+    }
+
+    static const int LEVEL = 6; // the gzip default
+    QFile file;
+    bool gzip, parallel, failed;
+    z_stream stream;
+    quint32 crc;
+    quint64 size;
+};
 
 EGSPhant::EGSPhant() {
     nx = ny = nz = 0;
@@ -54,191 +270,386 @@ void EGSPhant::makeMask(EGSPhant *mask) {
     y = mask->y;
     z = mask->z;
     maxDensity = mask->maxDensity;
-    {
-        QVector <char> mz(nz, 49);
-        QVector <QVector <char> > my(ny, mz);
-        QVector <QVector <QVector <char> > > mx(nx, my);
-        m = mx;
-        QVector <double> dz(nz, 0);
-        QVector <QVector <double> > dy(ny, dz);
-        QVector <QVector <QVector <double> > > dx(nx, dy);
-        d = dx;
-    }
+    allocate();
+    m.fill(49);
     media << "OTHER" << "TARGET";
 }
 
-void EGSPhant::loadEGSPhantFile(QString path) {
-    QFile file(path);
-
-    // Increment size of the status bar
-    double increment;
+// Copy the grid, voxels and media of another EGSPhant, the voxel arrays are
+// shared until either one writes to them
+void EGSPhant::copyFrom(const EGSPhant &phant) {
+    nx = phant.nx;
+    ny = phant.ny;
+    nz = phant.nz;
+    x = phant.x;
+    y = phant.y;
+    z = phant.z;
+    m = phant.m;
+    contour = phant.contour;
+    d = phant.d;
+    media = phant.media;
+    maxDensity = phant.maxDensity;
+}
 
-    // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream input(&file);
-        QString line = input.readLine();
+// Size the voxel arrays to the current nx, ny and nz, every voxel zeroed
+void EGSPhant::allocate(bool withContour) {
+    m.fill(0, size());
+    d.fill(0, size());
+    if (withContour) {
+        contour.fill(0, size());
+    }
+    else {
+        contour.clear();
+    }
+}
 
-        // read in the number of media
-        int num = line.trimmed().toInt();
-        media.resize(num);
+// Crop the phantom to voxels [i0,i1)x[j0,j1)x[k0,k1), the boundaries kept are
+// x[i0..i1], y[j0..j1] and z[k0..k1].  Indices past the phantom are clamped to
+// it, and a start past its end leaves that axis empty.
+void EGSPhant::crop(int i0, int i1, int j0, int j1, int k0, int k1) {
+    i1 = qBound(0, i1, nx);
+    j1 = qBound(0, j1, ny);
+    k1 = qBound(0, k1, nz);
+    i0 = qBound(0, i0, i1);
+    j0 = qBound(0, j0, j1);
+    k0 = qBound(0, k0, k1);
+
+    int cx = i1-i0, cy = j1-j0, cz = k1-k0;
+    qint64 n = qint64(cx)*cy*cz;
+    bool withContour = contour.size() == size();
+
+    QVector <char> cm(n);
+    QVector <Density> cd(n);
+    QVector <quint16> cc(withContour?n:0);
+
+    // Rows stay contiguous, so copy them whole
+    qint64 o = 0;
+    for (int k = k0; k < k1; k++)
+        for (int j = j0; j < j1; j++, o += cx) {
+            qint64 from = index(i0,j,k);
+            std::copy(m.constData()+from, m.constData()+from+cx, cm.data()+o);
+            std::copy(d.constData()+from, d.constData()+from+cx, cd.data()+o);
+            if (withContour)
+                std::copy(contour.constData()+from, contour.constData()+from+cx,
+                          cc.data()+o);
+        }
+
+    m = cm;
+    d = cd;
+    contour = cc;
+    x = x.mid(i0, cx+1);
+    y = y.mid(j0, cy+1);
+    z = z.mid(k0, cz+1);
+    nx = cx;
+    ny = cy;
+    nz = cz;
+}
 
-        // read the media into an array
-        for (int i = 0; i < num; i++) {
-            media[i] = input.readLine().trimmed();
+// The whole of an egsphant file in memory, mapped if it is a plain file and
+// inflated into a buffer if it is a .gz
+class PhantFile {
+public:
+    PhantFile(QString path) {
+        begin = end = NULL;
+        if (path.endsWith(".gz")) {
+            GzipReader gz(path);
+            if (gz.isOpen()) {
+                inflated = gz.readAll();
+                begin = inflated.constData();
+                end = begin + inflated.size();
+            }
+            return;
         }
 
-        // skim over the the ESTEP info
-        line = input.readLine().trimmed();
-
-        // read in the dimensions of the egsphant file and
-        // store the size and resize the matrices holding the boundaries
-        input.skipWhiteSpace();
-        input >> nx;
-        x.fill(0,nx+1);
-        input.skipWhiteSpace();
-        input >> ny;
-        y.fill(0,ny+1);
-        input.skipWhiteSpace();
-        input >> nz;
-        z.fill(0,nz+1);
-
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
+        file.setFileName(path);
+        if (file.open(QIODevice::ReadOnly)) {
+            const uchar *mapped = file.size() > 0 ? file.map(0, file.size()) : NULL;
+            if (mapped) {
+                begin = reinterpret_cast<const char *>(mapped);
+                end = begin + file.size();
+            }
+            else {
+                inflated = file.readAll();
+                begin = inflated.constData();
+                end = begin + inflated.size();
+            }
         }
+    }
 
-        // read in all the boundaries of the phantom
-        input.skipWhiteSpace();
-        for (int i = 0; i <= nx; i++) {
-            input >> x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            input >> y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            input >> z[i];
-        }
+    const char *begin, *end;
 
-        // Determine the increment this egsphant file gets
-        increment = MAX_PROGRESS/double(nz-1);
+private:
+    QFile file;
+    QByteArray inflated;
+};
 
-        // Read in all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input.skipWhiteSpace();
-                    input >> m[i][j][k];
-                }
-            emit progressMade(increment); // Update progress bar
-        }
+// The whitespace QTextStream::skipWhiteSpace skips
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
 
-        file.close();
+static const char *skipBlanks(const char *c, const char *end) {
+    while (c < end && isBlank(*c)) {
+        c++;
     }
+    return c;
 }
 
-void EGSPhant::loadEGSPhantFilePlus(QString path) {
-    QFile file(path);
+// The line at c without its end of line, c is moved to the start of the next
+static QString readLine(const char *&c, const char *end) {
+    const char *e = static_cast<const char *>(memchr(c, '\n', end-c));
+    if (!e) {
+        e = end;
+    }
+    QString line = QString::fromLatin1(c, e-c);
+    c = e < end ? e+1 : end;
+    return line;
+}
 
-    // Increment size of the status bar
-    double increment;
+// Parse the number at c (after any whitespace) into v, 0 if it isn't one, and
+// move c past it
+template <class T>
+static void readNumber(const char *&c, const char *end, T &v) {
+    c = skipBlanks(c, end);
+    if (c < end && *c == '+') {
+        c++;
+    }
+    std::from_chars_result r = std::from_chars(c, end, v);
+    if (r.ec != std::errc()) {
+        v = 0;
+    }
+    c = r.ptr;
+    while (c < end && !isBlank(*c)) {
+        c++;
+    }
+}
 
-    // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream input(&file);
-        QString line = input.readLine();
+/***
+Function: loadEGSPhantText
+--------------------------
+Process: Loads the media (and the densities if asked) of an egsphant text file
+         held whole in memory.  The media are the first nx*ny*nz characters
+         that aren't whitespace after the boundaries and the densities the
+         nx*ny*nz numbers after that, wherever the lines break.  Both sections
+         are cut into blocks that are counted in parallel, a prefix sum of the
+         counts gives the first voxel of each block, and the blocks are then
+         decoded in parallel with std::from_chars straight into m and d.
+Input:   mediaShare and densityShare, the part of a slice's progress increment
+         emitted for each slice of media and of densities read.
+Output:  false if the file can't be read, its dimensions don't fit in it or
+         it runs out before the last medium (or density if asked).
+***/
+bool EGSPhant::loadEGSPhantText(QString path, bool densities, double mediaShare, double densityShare) {
+    PhantFile text(path);
+    if (!text.begin) {
+        std::cout << "Could not open " << path.toStdString() << "\n";
+        return false;
+    }
+    const char *c = text.begin, *end = text.end;
 
-        // read in the number of media
-        int num = line.trimmed().toInt();
-        media.resize(num);
+    // read in the number of media, each of them takes a line
+    int num = readLine(c, end).trimmed().toInt();
+    if (num < 0 || num > end-c) {
+        std::cout << path.toStdString() << " is not an egsphant file\n";
+        return false;
+    }
+    media.resize(num);
 
-        // read the media into an array
-        for (int i = 0; i < num; i++) {
-            media[i] = input.readLine().trimmed();
-        }
+    // read the media into an array
+    for (int i = 0; i < num; i++) {
+        media[i] = readLine(c, end).trimmed();
+    }
 
-        // skim over the the ESTEP info
-        line = input.readLine().trimmed();
+    // skim over the the ESTEP info
+    readLine(c, end);
+
+    // read in the dimensions of the egsphant file and
+    // store the size and resize the matrices holding the boundaries
+    readNumber(c, end, nx);
+    x.fill(0,nx+1);
+    readNumber(c, end, ny);
+    y.fill(0,ny+1);
+    readNumber(c, end, nz);
+
+    // Every medium takes at least a character of the file
+    qint64 room = end-c;
+    if (nx <= 0 || ny <= 0 || nz <= 0 || ny > room/nx || nz > room/(qint64(nx)*ny) ||
+        qint64(nx)*ny*nz > INT_MAX) {
+        std::cout << path.toStdString() << " has dimensions " << nx << "x" << ny << "x" << nz
+                  << " that don't fit in the file\n";
+        nx = ny = nz = 0;
+        return false;
+    }
+    x.fill(0,nx+1);
+    y.fill(0,ny+1);
+    z.fill(0,nz+1);
 
-        // read in the dimensions of the egsphant file
-        input.skipWhiteSpace();
-        input >> nx;
-        x.fill(0,nx+1);
-        input.skipWhiteSpace();
-        input >> ny;
-        y.fill(0,ny+1);
-        input.skipWhiteSpace();
-        input >> nz;
-        z.fill(0,nz+1);
+    // resize the flat arrays to hold all media and densities
+    allocate();
 
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+    // read in all the boundaries of the phantom
+    for (int i = 0; i <= nx; i++) {
+        readNumber(c, end, x[i]);
+    }
+    for (int i = 0; i <= ny; i++) {
+        readNumber(c, end, y[i]);
+    }
+    for (int i = 0; i <= nz; i++) {
+        readNumber(c, end, z[i]);
+    }
 
-        // read in all the boundaries of the phantom
-        input.skipWhiteSpace();
-        for (int i = 0; i <= nx; i++) {
-            input >> x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            input >> y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            input >> z[i];
+    // Determine the increment this egsphant file gets
+    double increment = MAX_PROGRESS/double(nz-1);
+
+    const qint64 voxels = size();
+    const qint64 BLOCK = 1 << 22; // bytes of text per task
+    int threads = qMax(1, QThread::idealThreadCount());
+    QVector <int> tasks;
+
+    // Count the media characters of a batch of blocks at a time, until the
+    // block holding the last one is found
+    QVector <const char *> cuts;
+    QVector <qint64> first; // voxel index of the first medium in each block
+    cuts << c;
+    first << 0;
+    const char *mediaEnd = end; // if the text runs out, keep the media there were
+    bool found = voxels == 0;
+    while (!found && cuts.last() < end) {
+        int n0 = cuts.size()-1;
+        for (int n = 0; n < threads && cuts.last() < end; n++) {
+            cuts << cuts.last() + qMin(BLOCK, qint64(end-cuts.last()));
+        }
+
+        QVector <qint64> count(cuts.size()-1-n0, 0);
+        tasks.resize(count.size());
+        for (int n = 0; n < tasks.size(); n++) {
+            tasks[n] = n;
+        }
+        QtConcurrent::blockingMap(tasks, [&](int n) {
+            for (const char *t = cuts[n0+n]; t < cuts[n0+n+1]; t++)
+                if (!isBlank(*t)) {
+                    count[n]++;
+                }
+        });
+
+        for (int n = 0; n < count.size(); n++) {
+            if (first.last()+count[n] >= voxels) {
+                // The last medium is in this block, end the media there
+                qint64 left = voxels-first.last();
+                const char *t = cuts[n0+n];
+                for (; left > 0; t++)
+                    if (!isBlank(*t)) {
+                        left--;
+                    }
+                mediaEnd = t;
+                cuts.resize(n0+n+2);
+                cuts.last() = mediaEnd;
+                found = true;
+                break;
+            }
+            first << first.last()+count[n];
         }
+    }
+    if (voxels == 0) {
+        mediaEnd = c;
+    }
+    if (!found) {
+        std::cout << path.toStdString() << " ends before its last medium\n";
+        return false;
+    }
 
-        // Determine the increment this egsphant file gets
-        increment = MAX_PROGRESS/double(nz-1);
+    // Read in all the media
+    tasks.resize(cuts.size()-1);
+    for (int n = 0; n < tasks.size(); n++) {
+        tasks[n] = n;
+    }
+    char *med = m.data();
+    QtConcurrent::blockingMap(tasks, [&](int n) {
+        qint64 v = first[n];
+        for (const char *t = cuts[n]; t < cuts[n+1] && v < voxels; t++)
+            if (!isBlank(*t)) {
+                med[v++] = *t;
+            }
+    });
+    emit progressMade(increment*mediaShare*nz); // Update progress bar
 
-        // Read in all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input.skipWhiteSpace();
-                    input >> m[i][j][k];
-                }
-            emit progressMade(increment/100.0*10.0); // Update progress bar
-        }
+    if (!densities) {
+        return true;
+    }
 
-        // Read in all the densities
-        maxDensity = 0;
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input.skipWhiteSpace();
-                    input >> d[i][j][k];
-                    if (d[i][j][k] > maxDensity) {
-                        maxDensity = d[i][j][k];
-                    }
+    // Cut the densities into blocks on whitespace, so no number is split, and
+    // count the numbers in each
+    int blocks = qMax(threads*4, int((end-mediaEnd)/BLOCK)+1);
+    cuts.clear();
+    cuts << mediaEnd;
+    for (int n = 1; n < blocks; n++) {
+        const char *t = qMax(cuts.last(), mediaEnd + (end-mediaEnd)*n/blocks);
+        while (t < end && !isBlank(*t)) {
+            t++;
+        }
+        cuts << t;
+    }
+    cuts << end;
 
-                }
-            emit progressMade(increment/100.0*90.0); // Update progress bar
+    QVector <qint64> count(blocks, 0);
+    tasks.resize(blocks);
+    for (int n = 0; n < blocks; n++) {
+        tasks[n] = n;
+    }
+    QtConcurrent::blockingMap(tasks, [&](int n) {
+        bool blank = true;
+        for (const char *t = cuts[n]; t < cuts[n+1]; t++) {
+            if (blank && !isBlank(*t)) {
+                count[n]++;
+            }
+            blank = isBlank(*t);
         }
+    });
+    first.fill(0, blocks);
+    for (int n = 1; n < blocks; n++) {
+        first[n] = first[n-1]+count[n-1];
+    }
+    if (first[blocks-1]+count[blocks-1] < voxels) {
+        std::cout << path.toStdString() << " ends before its last density\n";
+        return false;
+    }
 
-        file.close();
+    // Read in all the densities, QTextStream reads a float as a double too
+    Density *den = d.data();
+    QVector <double> blockMax(blocks, 0);
+    QtConcurrent::blockingMap(tasks, [&](int n) {
+        const char *t = cuts[n];
+        double value, maxValue = 0;
+        for (qint64 v = first[n]; v < first[n]+count[n] && v < voxels; v++) {
+            readNumber(t, cuts[n+1], value);
+            den[v] = value;
+            maxValue = qMax(maxValue, double(den[v]));
+        }
+        blockMax[n] = maxValue;
+    });
+
+    maxDensity = 0;
+    for (int n = 0; n < blocks; n++) {
+        maxDensity = qMax(maxDensity, blockMax[n]);
     }
+    emit progressMade(increment*densityShare*nz); // Update progress bar
+    return true;
+}
+
+bool EGSPhant::loadEGSPhantFile(QString path) {
+    return loadEGSPhantText(path, false, 1.0, 0);
+}
+
+bool EGSPhant::loadEGSPhantFilePlus(QString path) {
+    return loadEGSPhantText(path, true, 0.1, 0.9);
 }
 
 void EGSPhant::loadEGSfirstlines(QString path) {
-    QFile file(path);
+    QScopedPointer <QIODevice> file(openEGSPhant(path));
 
-    // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream input(&file);
+    // Open up the file specified at path, inflating it if it is a .gz
+    if (file) {
+        QTextStream input(file.data());
         QString line = input.readLine();
 
         // read in the number of media
@@ -265,17 +676,7 @@ void EGSPhant::loadEGSfirstlines(QString path) {
         input >> nz;
         z.fill(0,nz+1);
 
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+        // Only the header is wanted, so the voxel arrays are left empty
 
         // read in all the boundaries of the phantom
         input.skipWhiteSpace();
@@ -289,87 +690,15 @@ void EGSPhant::loadEGSfirstlines(QString path) {
             input >> z[i];
         }
 
-        file.close();
+        file->close();
     }
 
 }
 
 
 
-void EGSPhant::loadEGSPhantFilePhntom(QString path) {
-    QFile file(path);
-
-    // Increment size of the status bar
-    double increment;
-
-    // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream input(&file);
-        QString line = input.readLine();
-
-        // read in the number of media
-        int num = line.trimmed().toInt();
-        media.resize(num);
-
-        // read the media into an array
-        for (int i = 0; i < num; i++) {
-            media[i] = input.readLine().trimmed();
-        }
-
-        // skim over the the ESTEP info
-        line = input.readLine().trimmed();
-
-        // read in the dimensions of the egsphant file
-        input.skipWhiteSpace();
-        input >> nx;
-        x.fill(0,nx+1);
-        input.skipWhiteSpace();
-        input >> ny;
-        y.fill(0,ny+1);
-        input.skipWhiteSpace();
-        input >> nz;
-        z.fill(0,nz+1);
-
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
-
-        // read in all the boundaries of the phantom
-        input.skipWhiteSpace();
-        for (int i = 0; i <= nx; i++) {
-            input >> x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            input >> y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            input >> z[i];
-        }
-
-        // Determine the increment this egsphant file gets
-        increment = MAX_PROGRESS/double(nz-1);
-
-        // Read in all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input.skipWhiteSpace();
-                    input >> m[i][j][k];
-                }
-            emit progressMade(increment/100.0*10.0); // Update progress bar
-        }
-
-
-        file.close();
-    }
+bool EGSPhant::loadEGSPhantFilePhntom(QString path) {
+    return loadEGSPhantText(path, false, 0.1, 0);
 }
 
 
@@ -385,7 +714,7 @@ void EGSPhant::saveEGSPhantDensityFile(QString path) {
         for (int k = 0; k < ceil(nz/2); k++) {
             for (int j = 0; j < ny; j++) {
                 for (int i = 0; i < nx; i++) {
-                    output << d[i][j][k] << " ";
+                    output << d[index(i,j,k)] << " ";
                 }
                 output << "\n";
             }
@@ -450,7 +779,7 @@ void EGSPhant::saveEGSPhantPhantFile(QString path) {
             output<<"\n\n" <<k <<"    " <<z[k] <<"\n\n";
             for (int j = 0; j < ny; j++) {
                 for (int i = 0; i < nx; i++) {
-                    output << m[i][j][k]; // <<" ";
+                    output << m[index(i,j,k)]; // <<" ";
                 }
                 output << "\n";
             }
@@ -462,14 +791,15 @@ void EGSPhant::saveEGSPhantPhantFile(QString path) {
     }
 }
 
-void EGSPhant::saveEGSPhantFile(QString path) {
-    QFile file(path);
+bool EGSPhant::saveEGSPhantFile(QString path, bool parallelGzip) {
+    PhantWriter file(path, parallelGzip);
     // Increment size of the status bar
     double increment;
 
     // Open up the file specified at path
-    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QTextStream output(&file);
+    if (file.isOpen()) {
+        PhantBlock header;
+        QTextStream output(&header.data, QIODevice::WriteOnly);
 
         // read out the number of media
         output << media.size() << "\n";
@@ -511,266 +841,395 @@ void EGSPhant::saveEGSPhantFile(QString path) {
         // Determine the increment this egsphant file gets
         increment = MAX_PROGRESS/double(nz-1);
 
-        // Read out all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++) {
-                for (int i = 0; i < nx; i++) {
-                    output << m[i][j][k];
-                }
-                output << "\n";
-            }
-            emit progressMade(increment/100.0*10.0); // Update progress bar
-            output << "\n";
-        }
+        output.flush();
+        file.prepare(header);
+        file.write(header);
 
-        //Read out all the densities
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++) {
-                for (int i = 0; i < nx; i++) {
-                    output << d[i][j][k] << " ";
-                }
-                output << "\n";
-            }
-            emit progressMade(increment/100.0*90.0); // Update progress bar
-            output << "\n";
+        // Read out all the media and then all the densities, the slices are
+        // formatted (and compressed) in parallel and written in order
+        writeSlices(file, false, increment/100.0*10.0);
+        writeSlices(file, true, increment/100.0*90.0);
+
+        if (file.close()) {
+            return true;
         }
 
-        file.close();
+        // Don't leave half a phantom behind for egs_brachy to read
+        QFile::remove(path);
     }
-}
 
+    std::cout << "Could not write the egsphant file " << path.toStdString() << ".\n";
+    return false;
+}
 
 
-void EGSPhant::loadbEGSPhantFile(QString path) {
-    QFile file(path);
-
-    // Increment size of the status bar
-    double increment;
-
-    // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly)) {
-        QDataStream input(&file);
-        // read in the number of media
-        unsigned char num;
-        input >> num;
-        media.resize(num);
-
-        // read the media into an array
-        char *temp2;
-        for (int i = 0; i < num; i++) {
-            input >> temp2;
-            media[i] = QString(temp2);
-        }
-
-        // skim over the the ESTEP info
-        double temp;
-        for (int i = 0; i < num; i++) {
-            input >> temp;
-        }
 
-        // read in the dimensions of the egsphant file
-        // store the size and resize the matrices holding the boundaries
-        input >> nx;
-        x.fill(0,nx+1);
-        input >> ny;
-        y.fill(0,ny+1);
-        input >> nz;
-        z.fill(0,nz+1);
-
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+// Append slice k of the media to text, one row per line as QTextStream wrote them
+static void formatMediaSlice(const EGSPhant &phant, int k, QByteArray &text) {
+    const char *m = phant.m.constData() + phant.index(0, 0, k);
+    text.reserve(phant.ny*(phant.nx+1)+1);
+    for (int j = 0; j < phant.ny; j++, m += phant.nx) {
+        text.append(m, phant.nx);
+        text.append('\n');
+    }
+    text.append('\n');
+}
 
-        // read in all the boundaries of the phantom
-        for (int i = 0; i <= nx; i++) {
-            input >> x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            input >> y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            input >> z[i];
-        }
+// Append slice k of the densities to text, each followed by a space and
+// formatted as QTextStream does by default (%g, 6 significant digits)
+static void formatDensitySlice(const EGSPhant &phant, int k, QByteArray &text) {
+    const int MAX_CHARS = 16; // "-1.23457e-308" and a space, with room to spare
+    const Density *d = phant.d.constData() + phant.index(0, 0, k);
+    text.resize(phant.ny*(phant.nx*MAX_CHARS+1)+1);
+    char *c = text.data();
+    for (int j = 0; j < phant.ny; j++) {
+        for (int i = 0; i < phant.nx; i++, d++) {
+            c = std::to_chars(c, c+MAX_CHARS, double(*d), std::chars_format::general, 6).ptr;
+            *c++ = ' ';
+        }
+        *c++ = '\n';
+    }
+    *c++ = '\n';
+    text.resize(c-text.data());
+}
 
-        // Determine the increment this egsphant file gets
-        increment = MAX_PROGRESS/double(nz-1);
+/***
+Function: writeSlices
+---------------------
+Process: Writes every slice of the media, or of the densities, to out in the
+         egsphant text format.  A batch of slices is formatted in parallel into
+         one buffer each (and compressed there, if out deflates in parallel),
+         and the buffers are then written in order so the file is the same as
+         one written value by value.
+***/
+void EGSPhant::writeSlices(PhantWriter &out, bool density, double increment) {
+    int batch = qMax(1, QThread::idealThreadCount())*2;
+    for (int k0 = 0; k0 < nz; k0 += batch) {
+        QVector <int> slices;
+        for (int k = k0; k < qMin(k0+batch, nz); k++) {
+            slices << k;
+        }
+
+        QVector <PhantBlock> blocks(slices.size());
+        QtConcurrent::blockingMap(slices, [&](int k) {
+            PhantBlock &block = blocks[k-k0];
+            if (density) {
+                formatDensitySlice(*this, k, block.data);
+            }
+            else {
+                formatMediaSlice(*this, k, block.data);
+            }
+            out.prepare(block);
+        });
 
-        // Read in all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input >> num;
-                    m[i][j][k] = num;
-                }
+        for (int n = 0; n < blocks.size(); n++) {
+            out.write(blocks[n]);
             emit progressMade(increment); // Update progress bar
         }
+    }
+}
 
-        file.close();
+// Binary phantoms are little endian whatever the machine writing them
+template <class T>
+static void appendLittle(QByteArray &out, const T *v, qint64 n) {
+    int at = out.size();
+    out.resize(at + n*sizeof(T));
+    memcpy(out.data()+at, v, n*sizeof(T));
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    for (qint64 e = 0; e < n; e++) {
+        std::reverse(out.data()+at+e*sizeof(T), out.data()+at+(e+1)*sizeof(T));
     }
+#endif
 }
 
-void EGSPhant::loadbEGSPhantFilePlus(QString path) {
-    QFile file(path);
+template <class T>
+static void appendLittle(QByteArray &out, T v) {
+    appendLittle(out, &v, 1);
+}
 
-    // Increment size of the status bar
-    double increment;
+// Take n little endian values from c into v, false if there aren't enough
+template <class T>
+static bool takeLittle(const char *&c, const char *end, T *v, qint64 n) {
+    if (end-c < qint64(n*sizeof(T))) {
+        return false;
+    }
+    memcpy(v, c, n*sizeof(T));
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    for (qint64 e = 0; e < n; e++) {
+        char *b = reinterpret_cast<char *>(v+e);
+        std::reverse(b, b+sizeof(T));
+    }
+#endif
+    c += n*sizeof(T);
+    return true;
+}
 
-    // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly)) {
-        QDataStream input(&file);
-        // read in the number of media
-        unsigned char num;
-        input >> num;
-        media.resize(num);
+// Copy n densities stored in bytes wide floats at c into d
+static void takeDensities(const char *c, int bytes, Density *d, qint64 n) {
+    if (bytes == 4) {
+        QVector <float> v(n);
+        takeLittle(c, c+n*4, v.data(), n);
+        std::copy(v.constBegin(), v.constEnd(), d);
+    }
+    else {
+        QVector <double> v(n);
+        takeLittle(c, c+n*8, v.data(), n);
+        std::copy(v.constBegin(), v.constEnd(), d);
+    }
+}
 
-        // read the media into an array
-        char *temp2;
-        for (int i = 0; i < num; i++) {
-            input >> temp2;
-            media[i] = QString(temp2);
-        }
+bool EGSPhant::loadbEGSPhantFile(QString path) {
+    return loadbEGSPhantSlab(path, 0, -1, false);
+}
 
-        // skim over the the ESTEP info
-        double temp;
-        for (int i = 0; i < num; i++) {
-            input >> temp;
-        }
+bool EGSPhant::loadbEGSPhantFilePlus(QString path) {
+    return loadbEGSPhantSlab(path, 0, -1, true);
+}
 
-        // read in the dimensions of the egsphant file
-        // store the size and resize the matrices holding the boundaries
-        input >> nx;
-        x.fill(0,nx+1);
-        input >> ny;
-        y.fill(0,ny+1);
-        input >> nz;
-        z.fill(0,nz+1);
+/***
+Function: loadbEGSPhantSlab
+---------------------------
+Process: Loads slices [k0,k1) of a binary phantom (all of them if k1 is -1)
+         as a phantom of k1-k0 slices.  Only the compressed slabs holding
+         those slices are read from the mapped file, and they are inflated in
+         parallel.  The densities are skipped unless asked for.
+Output:  false if the file isn't a binary phantom, its header doesn't hold
+         together (the phantom is then left unchanged) or a slab of it can't
+         be inflated.
+***/
+bool EGSPhant::loadbEGSPhantSlab(QString path, int k0, int k1, bool densities) {
+    PhantFile file(path);
+    if (!file.begin) {
+        std::cout << "Could not open " << path.toStdString() << "\n";
+        return false;
+    }
+    const char *c = file.begin, *end = file.end;
+
+    // Fixed part of the header
+    char magic[8];
+    quint32 version, dims[3], num;
+    quint8 densityBytes, hasContour;
+    quint16 slabDepth;
+    bool ok = takeLittle(c, end, magic, 8) && !memcmp(magic, BINARY_MAGIC, 8) &&
+              takeLittle(c, end, &version, 1) && version == BINARY_VERSION &&
+              takeLittle(c, end, dims, 3) && takeLittle(c, end, &densityBytes, 1) &&
+              takeLittle(c, end, &hasContour, 1) && takeLittle(c, end, &slabDepth, 1) &&
+              takeLittle(c, end, &num, 1) && (densityBytes == 4 || densityBytes == 8) && slabDepth > 0;
+
+    // Every count below is taken as an int and dims[i]+1 boundaries are read
+    for (int i = 0; ok && i < 3; i++) {
+        ok = dims[i] > 0 && dims[i] < quint32(INT_MAX);
+    }
+    ok = ok && slabDepth <= dims[2];
 
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
+    // Media table
+    QVector <QString> names;
+    for (quint32 i = 0; ok && i < num; i++) {
+        quint32 length;
+        ok = takeLittle(c, end, &length, 1) && quint64(end-c) >= length;
+        if (ok) {
+            names << QString::fromUtf8(c, length);
+            c += length;
         }
+    }
 
-        // read in all the boundaries of the phantom
-        for (int i = 0; i <= nx; i++) {
-            input >> x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            input >> y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            input >> z[i];
-        }
+    // Boundaries, max density and the offset and size of every slab, the
+    // boundaries have to be in the file before they are made room for
+    ok = ok && quint64(dims[0])+dims[1]+dims[2]+3 <= quint64(end-c)/8;
+    QVector <double> bx(ok ? dims[0]+1 : 0), by(ok ? dims[1]+1 : 0), bz(ok ? dims[2]+1 : 0);
+    double maxD = 0;
+    quint32 chunks = 0;
+    ok = ok && takeLittle(c, end, bx.data(), bx.size()) && takeLittle(c, end, by.data(), by.size()) &&
+         takeLittle(c, end, bz.data(), bz.size()) && takeLittle(c, end, &maxD, 1) &&
+         takeLittle(c, end, &chunks, 1) && chunks == (dims[2]+slabDepth-1)/slabDepth;
+    QVector <quint64> offset(ok ? chunks : 0), packed(ok ? chunks : 0);
+    for (quint32 n = 0; ok && n < chunks; n++) {
+        ok = takeLittle(c, end, &offset[n], 1) && takeLittle(c, end, &packed[n], 1) &&
+             offset[n] <= quint64(end-file.begin) && packed[n] <= quint64(end-file.begin)-offset[n];
+    }
 
-        // Determine the increment this egsphant file gets
-        increment = MAX_PROGRESS/double(nz-1);
+    // Each slab has to come after the index and be able to inflate to the
+    // slices it is said to hold, zlib never does better than about 1032:1,
+    // so a damaged header can't have us allocate much more than the file
+    qint64 plane = qint64(dims[0])*dims[1];
+    qint64 bytesPerVoxel = 1+densityBytes+(hasContour?2:0);
+    for (quint32 n = 0; ok && n < chunks; n++) {
+        qint64 depth = qMin(qint64(slabDepth), qint64(dims[2])-qint64(n)*slabDepth);
+        ok = offset[n] >= quint64(c-file.begin) && plane <= qint64(INT_MAX)/bytesPerVoxel/depth &&
+             plane*depth*bytesPerVoxel <= qint64(packed[n])*1032+64;
+    }
 
-        // Read in all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input >> num;
-                    m[i][j][k] = num;
-                }
-            emit progressMade(increment/100.0*50.0); // Update progress bar
-        }
+    if (!ok) {
+        std::cout << path.toStdString() << " is not a version " << BINARY_VERSION << " binary egsphant file\n";
+        return false;
+    }
 
-        // Read in all the densities
-        maxDensity = 0;
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input >> d[i][j][k];
-                    if (d[i][j][k] > maxDensity) {
-                        maxDensity = d[i][j][k];
-                    }
-                }
-            emit progressMade(increment/100.0*50.0); // Update progress bar
+    // The slices asked for, which have to fit in the voxel arrays
+    if (k1 < 0 || k1 > int(dims[2])) {
+        k1 = dims[2];
+    }
+    k0 = qBound(0, k0, k1);
+    if (plane*(k1-k0) > qint64(INT_MAX)/qint64(sizeof(Density))) {
+        std::cout << path.toStdString() << " has too many voxels to load\n";
+        return false;
+    }
+
+    nx = dims[0];
+    ny = dims[1];
+    nz = k1-k0;
+    x = bx;
+    y = by;
+    z = bz.mid(k0, nz+1);
+    media = names;
+    maxDensity = maxD;
+    allocate(hasContour);
+
+    // Inflate the slabs holding the slices in parallel
+    QVector <int> slabs;
+    for (int n = k0/slabDepth; nz > 0 && n <= (k1-1)/slabDepth; n++) {
+        slabs << n;
+    }
+    char *med = m.data();
+    Density *den = d.data();
+    quint16 *con = contour.data();
+    std::atomic<bool> bad(false);
+    QtConcurrent::blockingMap(slabs, [&](int n) {
+        int first = n*slabDepth, depth = qMin(int(slabDepth), int(dims[2])-first);
+        qint64 voxels = plane*depth;
+        uLongf rawSize = voxels*(1+densityBytes+(hasContour?2:0));
+        QByteArray raw(rawSize, 0);
+        if (uncompress(reinterpret_cast<Bytef *>(raw.data()), &rawSize,
+                       reinterpret_cast<const Bytef *>(file.begin+offset[n]), packed[n]) != Z_OK ||
+                rawSize != uLongf(raw.size())) {
+            bad = true;
+            return;
+        }
+
+        // The media, densities and structures of the slab each follow the last
+        const char *rawM = raw.constData(), *rawD = rawM+voxels, *rawC = rawD+voxels*densityBytes;
+        for (int k = qMax(first, k0); k < qMin(first+depth, k1); k++) {
+            qint64 from = (k-first)*plane, to = (k-k0)*plane;
+            memcpy(med+to, rawM+from, plane);
+            if (densities) {
+                takeDensities(rawD+from*densityBytes, densityBytes, den+to, plane);
+            }
+            if (hasContour) {
+                const char *t = rawC+from*2;
+                takeLittle(t, t+plane*2, con+to, plane);
+            }
         }
+    });
+    emit progressMade(MAX_PROGRESS); // Update progress bar
 
-        file.close();
-        std::cout<<"x,y,z size: " <<x.size() <<" " <<y.size() <<" " <<z.size() <<"\n";
+    if (bad) {
+        std::cout << "The slabs of " << path.toStdString() << " could not be inflated\n";
+        return false;
     }
+    return true;
 }
 
-void EGSPhant::savebEGSPhantFile(QString path) {
+/***
+Function: savebEGSPhantFile
+---------------------------
+Process: Writes the phantom in the binary format loadbEGSPhantSlab reads, all
+         little endian:
+           "EGSPHANT", version, nx, ny, nz (quint32),
+           bytes per density, has structures (quint8), slab depth (quint16),
+           number of media then each medium as its UTF-8 length and bytes,
+           the x, y and z boundaries and the max density (double),
+           number of slabs then each slab's file offset and size (quint64),
+           the slabs.
+         A slab is slab depth slices (fewer in the last), zlib compressed,
+         holding its media (one character each), then its densities, then
+         its structures (quint16) if the phantom has them.  The slabs are
+         compressed in parallel.
+Output:  false if the file couldn't be written, nothing is left at path then
+***/
+bool EGSPhant::savebEGSPhantFile(QString path) {
     QFile file(path);
 
-    // Increment size of the status bar
-    double increment;
-
     // Open up the file specified at path
-    if (file.open(QIODevice::WriteOnly)) {
-        QDataStream output(&file);
-
-        // read out the number of media
-        output << media.size();
-
-        // read out the media into an array
-        for (int i = 0; i < media.size(); i++) {
-            output << media[i];
-        }
-
-        // print generic ESTEP info
-        double temp = 0.5;
-        for (int i = 0; i < media.size(); i++) {
-            output << temp;
-        }
-
-        // read out the dimensions of the egsphant file
-        // store the size and resize the matrices holding the boundaries
-        output << nx;
-        output << ny;
-        output << nz;
-
-        // read out all the boundaries of the phantom
-        for (int i = 0; i <= nx; i++) {
-            output << x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            output << y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            output << z[i];
-        }
-
-        // Determine the increment this egsphant file gets
-        increment = MAX_PROGRESS/double(nz-1);
-
-        // Read out all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    output << m[i][j][k];
-                }
-            emit progressMade(increment/100.0*50.0); // Update progress bar
-        }
+    if (!file.open(QIODevice::WriteOnly)) {
+        std::cout << "Could not write " << path.toStdString() << "\n";
+        return false;
+    }
 
-        // Read out all the densities
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    output << d[i][j][k];
-                }
-            emit progressMade(increment/100.0*50.0); // Update progress bar
-        }
+    bool withContour = contour.size() == size();
+    qint64 plane = qint64(nx)*ny;
+    qint64 bytesPerVoxel = 1+sizeof(Density)+(withContour?2:0);
+    int slabDepth = qBound(1, int(BINARY_SLAB_BYTES/qMax(qint64(1), plane*bytesPerVoxel)), qMin(qMax(nz, 1), 65535));
+    int chunks = (nz+slabDepth-1)/slabDepth;
+
+    // Compress the slabs in parallel
+    QVector <QByteArray> packed(chunks);
+    QVector <int> slabs(chunks);
+    for (int n = 0; n < chunks; n++) {
+        slabs[n] = n;
+    }
+    std::atomic<bool> bad(false);
+    QtConcurrent::blockingMap(slabs, [&](int n) {
+        int first = n*slabDepth, depth = qMin(slabDepth, nz-first);
+        qint64 voxels = plane*depth, from = index(0, 0, first);
+        QByteArray raw;
+        raw.reserve(voxels*bytesPerVoxel);
+        appendLittle(raw, m.constData()+from, voxels);
+        appendLittle(raw, d.constData()+from, voxels);
+        if (withContour) {
+            appendLittle(raw, contour.constData()+from, voxels);
+        }
+
+        uLongf size = compressBound(raw.size());
+        packed[n].resize(size);
+        if (compress2(reinterpret_cast<Bytef *>(packed[n].data()), &size,
+                      reinterpret_cast<const Bytef *>(raw.constData()), raw.size(), 6) != Z_OK) {
+            bad = true;
+        }
+        packed[n].resize(size);
+    });
+
+    QByteArray header;
+    header.append(BINARY_MAGIC, 8);
+    appendLittle(header, quint32(BINARY_VERSION));
+    appendLittle(header, quint32(nx));
+    appendLittle(header, quint32(ny));
+    appendLittle(header, quint32(nz));
+    appendLittle(header, quint8(sizeof(Density)));
+    appendLittle(header, quint8(withContour));
+    appendLittle(header, quint16(slabDepth));
+    appendLittle(header, quint32(media.size()));
+    for (int i = 0; i < media.size(); i++) {
+        QByteArray name = media[i].toUtf8();
+        appendLittle(header, quint32(name.size()));
+        header.append(name);
+    }
+    appendLittle(header, x.constData(), x.size());
+    appendLittle(header, y.constData(), y.size());
+    appendLittle(header, z.constData(), z.size());
+    appendLittle(header, maxDensity);
+    appendLittle(header, quint32(chunks));
+
+    // The slabs follow the offset index
+    quint64 offset = header.size() + chunks*16;
+    for (int n = 0; n < chunks; n++) {
+        appendLittle(header, offset);
+        appendLittle(header, quint64(packed[n].size()));
+        offset += packed[n].size();
+    }
 
-        file.close();
+    bool ok = !bad && file.write(header) == header.size();
+    for (int n = 0; ok && n < chunks; n++) {
+        ok = file.write(packed[n]) == packed[n].size();
+    }
+    ok = ok && file.flush();
+    file.close();
+    emit progressMade(MAX_PROGRESS); // Update progress bar
+
+    if (!ok) {
+        std::cout << "Could not write " << path.toStdString() << "\n";
+        file.remove();
+        return false;
     }
+    return true;
 }
 
 char EGSPhant::getMedia(double px, double py, double pz) {
@@ -807,7 +1266,7 @@ char EGSPhant::getMedia(double px, double py, double pz) {
 
     // This is to insure that no area outside the vectors is accessed
     if (ix < nx && ix >= 0 && iy < ny && iy >= 0 && iz < nz && iz >= 0) {
-        return m[ix][iy][iz];
+        return m[index(ix,iy,iz)];
     }
 
     return 0; // We are not within our bounds
@@ -848,7 +1307,7 @@ double EGSPhant::getDensity(double px, double py, double pz) {
 
     // This is to insure that no area outside the vectors is accessed
     if (ix < nx && ix >= 0 && iy < ny && iy >= 0 && iz < nz && iz >= 0) {
-        return d[ix][iy][iz];
+        return d[index(ix,iy,iz)];
     }
 
     return 0; // We are not within our bounds
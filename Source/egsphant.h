@@ -44,6 +44,29 @@
 #include <iostream>
 #include <math.h>
 
+// Densities are stored in double unless the build asks for float, which halves
+// the largest of the voxel arrays
+#ifdef EGSPHANT_FLOAT_DENSITY
+typedef float Density;
+#else
+typedef double Density;
+#endif
+
+// A 2D view into one of the flat voxel arrays, element (a,b) sits at
+// data[a*strideA+b*strideB]
+template <class T>
+struct VoxelSlice {
+    T *data;
+    int na, nb;
+    qint64 strideA, strideB;
+
+    T &operator()(int a, int b) const {
+        return data[a*strideA+b*strideB];
+    }
+};
+
+class PhantWriter;
+
 class EGSPhant : public QObject {
     Q_OBJECT
 
@@ -55,21 +78,61 @@ public:
 
     int nx, ny, nz; // these hold the number of voxels
     QVector <double> x, y, z; // these hold the boundaries of the above voxels
-    QVector <QVector <QVector <char> > > m; // this holds all the media
-    QVector <QVector <QVector <int> > > contour; // this holds the structure/contour/organ
-    QVector <QVector <QVector <double> > > d; // this holds all the densities
+    // The voxel arrays are flat and in egsphant file order (x fastest, then y,
+    // then z), use index(i,j,k) to find a voxel
+    QVector <char> m; // this holds all the media
+    QVector <quint16> contour; // this holds the structure/contour/organ
+    QVector <Density> d; // this holds all the densities
     QVector <QString> media; // this holds all the possible media
     double maxDensity;
 
+    qint64 index(int i, int j, int k) const {
+        return i + nx*(j + qint64(ny)*k);
+    }
+    qint64 size() const {
+        return qint64(nx)*ny*nz;
+    }
+    // Size m and d (and contour if asked) to nx*ny*nz zeroed voxels
+    void allocate(bool withContour = false);
+    // Keep voxels [i0,i1)x[j0,j1)x[k0,k1) and the boundaries around them
+    void crop(int i0, int i1, int j0, int j1, int k0, int k1);
+
+    // View of slice n perpendicular to axis (0 = x, 1 = y, 2 = z) of one of
+    // the voxel arrays, indexed by the two remaining axes in x, y, z order
+    template <class T>
+    VoxelSlice<T> slice(QVector <T> &v, int axis, int n) {
+        qint64 sx = 1, sy = nx, sz = qint64(nx)*ny;
+        VoxelSlice<T> s;
+        if (axis == 0) {
+            s.data = v.data() + n*sx;
+            s.na = ny; s.strideA = sy; s.nb = nz; s.strideB = sz;
+        }
+        else if (axis == 1) {
+            s.data = v.data() + n*sy;
+            s.na = nx; s.strideA = sx; s.nb = nz; s.strideB = sz;
+        }
+        else {
+            s.data = v.data() + n*sz;
+            s.na = nx; s.strideA = sx; s.nb = ny; s.strideB = sy;
+        }
+        return s;
+    }
+
     void loadEGSfirstlines(QString path);
-    void loadEGSPhantFile(QString path);
-    void loadEGSPhantFilePlus(QString path);
-    void loadbEGSPhantFile(QString path);
-    void loadbEGSPhantFilePlus(QString path);
-    void loadEGSPhantFilePhntom(QString path);
-
-    void saveEGSPhantFile(QString path);
-    void savebEGSPhantFile(QString path);
+    bool loadEGSPhantFile(QString path); // false if it isn't a readable egsphant
+    bool loadEGSPhantFilePlus(QString path);
+    bool loadbEGSPhantFile(QString path); // false if it isn't a readable binary phantom
+    bool loadbEGSPhantFilePlus(QString path);
+    bool loadEGSPhantFilePhntom(QString path);
+    // Load only slices [k0,k1) of a binary phantom (k1 = -1 for the rest)
+    bool loadbEGSPhantSlab(QString path, int k0, int k1, bool densities = true);
+
+    // Paths ending in .gz are written gzip compressed, in blocks compressed in
+    // parallel unless parallelGzip is false
+    bool saveEGSPhantFile(QString path, bool parallelGzip = true); // false (and no file) if it couldn't be written
+    // Binary phantoms: a versioned header, then zlib compressed slabs of
+    // slices with an offset index so that any slab can be read on its own
+    bool savebEGSPhantFile(QString path);
     void saveEGSPhantDensityFile(QString path);
     void saveEGSPhantPhantFile(QString path);
 
@@ -85,12 +148,27 @@ public:
     // Make a mask template
     void makeMask(EGSPhant *mask);
 
+    // Take the grid, voxels and media of another EGSPhant (QObjects can't be copied)
+    void copyFrom(const EGSPhant &phant);
+
     // Image Processing
     void loadMaps();
 
     // Progress bar resolution
     const static int MAX_PROGRESS = 1000000000;
 
+    // Binary phantom format, version 1 was the headerless QDataStream layout
+    static constexpr const char *BINARY_MAGIC = "EGSPHANT";
+    const static quint32 BINARY_VERSION = 2;
+    const static qint64 BINARY_SLAB_BYTES = 1 << 22; // uncompressed size a slab aims for
+
+private:
+    // Read an egsphant text file, with or without its densities
+    bool loadEGSPhantText(QString path, bool densities, double mediaShare, double densityShare);
+
+    // Write the media (or densities) section of an egsphant file
+    void writeSlices(PhantWriter &out, bool density, double increment);
+
 };
 
 #endif
@@ -43,6 +43,7 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <algorithm>
 
 /*
 
@@ -97,7 +98,8 @@ Inputs: nx, ny, nz: number of voxels in the x,y,z plane
         contour_tas_name: vector of contour names, order in the vector correlates with it's index in the media array
 ***/
 void metrics::get_data(int nx, int ny, int nz, QVector<double> xbounds, QVector<double> ybounds, QVector<double> zbounds,
-                       QVector <QVector <QVector <int> > > media, QVector<double> val, QVector<double> err, QMap <int, QString> contour_tas_name) {
+                       QVector <quint16> media, QVector<double> val, QVector<double> err, QMap <int, QString> contour_tas_name,
+                       const StructMembership &overlap) {
 
     QTextStream out(stdout);
     out<<endl <<"Calculating metrics..." <<endl;
@@ -110,6 +112,7 @@ void metrics::get_data(int nx, int ny, int nz, QVector<double> xbounds, QVector<
     zbound = zbounds;
     media_vect = media;
     unique_media = contour_tas_name;
+    membership = overlap;
     val_vect = val;
     err_vect = err;
 
@@ -861,6 +864,58 @@ void metrics::outputStatsAll() {
 
 
 
+/***
+Function: reset
+---------------
+Process: Empties the membership and sizes it for an x by y by z phantom
+***/
+void StructMembership::reset(int x, int y, int z) {
+    nx = x;
+    ny = y;
+    nz = z;
+    rows.clear();
+    rows.resize(ny*nz);
+}
+
+/***
+Function: matches
+-----------------
+Process: Checks that the membership was made for an x by y by z grid
+***/
+bool StructMembership::matches(int x, int y, int z) const {
+    return !isEmpty() && nx == x && ny == y && nz == z;
+}
+
+bool StructMembership::isEmpty() const {
+    return rows.isEmpty();
+}
+
+/***
+Function: compactRow
+--------------------
+Process: Sorts the runs of row by struct then start, and merges the runs of a
+         struct that overlap or touch
+***/
+void StructMembership::compactRow(QVector <MemberRun> &row) {
+    std::sort(row.begin(), row.end(), [](const MemberRun &a, const MemberRun &b) {
+        return a.s < b.s || (a.s == b.s && a.i0 < b.i0);
+    });
+
+    int n = 0;
+    for (int r = 0; r < row.size(); r++) {
+        if (row[r].i0 >= row[r].i1) {
+            continue;
+        }
+        if (n > 0 && row[n-1].s == row[r].s && row[r].i0 <= row[n-1].i1) {
+            row[n-1].i1 = qMax(row[n-1].i1, row[r].i1);
+        }
+        else {
+            row[n++] = row[r];
+        }
+    }
+    row.resize(n);
+}
+
 int metrics::get_idx_from_ijk(int ii, int jj, int kk)
 // get_idx_from_ijk takes and (i,j,k) tuple of a 3ddose distribution
 // and returns the voxel index
@@ -915,52 +970,63 @@ QString metrics::plot_region(int med,
     //int counter = 0;
     // Iterate through every voxel for either the whole thing, a region or
     // several media
-    for (int k = 0; k < z; k++) {
-        for (int j = 0; j < x; j++) {
-            for (int i = 0; i < y; i++) {
-                if (media_vect[i][j][k] == med) {
-
-                    if (n == 0) { //initialize the values
-                        *max = *min = val_vect[get_idx_from_ijk(i,j,k)];
-                        *eMin = *eMax = err_vect[get_idx_from_ijk(i,j,k)];
-                        *maxErr = err_vect[get_idx_from_ijk(i,j,k)];
-                    }
-
-                    // Compute averages first
-                    v = (xbound[i+1]-xbound[i])*(ybound[j+1]-ybound[j])*(zbound[k+1]-zbound[k]);
-                    *totVol += v;
-                    *avg += val_vect[get_idx_from_ijk(i,j,k)]*v;
-                    *eAvg += pow(err_vect[get_idx_from_ijk(i,j,k)],2)*v;
-                    *meanErr += err_vect[get_idx_from_ijk(i,j,k)]*v;
-
-                    // Check mins & maxs
-                    if (*max < val_vect[get_idx_from_ijk(i,j,k)]) {
-                        *max = val_vect[get_idx_from_ijk(i,j,k)];
-                        *eMax = err_vect[get_idx_from_ijk(i,j,k)];
-                    }
-                    if (*min > val_vect[get_idx_from_ijk(i,j,k)]) {
-                        *min = val_vect[get_idx_from_ijk(i,j,k)];
-                        *eMin = err_vect[get_idx_from_ijk(i,j,k)];
-                    }
-                    if (*min == val_vect[get_idx_from_ijk(i,j,k)])
-                        if (*eMin < err_vect[get_idx_from_ijk(i,j,k)]) {
-                            *min = val_vect[get_idx_from_ijk(i,j,k)];
-                            *eMin = err_vect[get_idx_from_ijk(i,j,k)];
-                        }
-                    if (*maxErr < err_vect[get_idx_from_ijk(i,j,k)]) {
-                        *maxErr = err_vect[get_idx_from_ijk(i,j,k)];
-                    }
+    auto addVoxel = [&](int i, int j, int k) {
+        int idx = get_idx_from_ijk(i,j,k);
+        if (n == 0) { //initialize the values
+            *max = *min = val_vect[idx];
+            *eMin = *eMax = err_vect[idx];
+            *maxErr = err_vect[idx];
+        }
 
-                    // Add voxel dose to data[n]
-                    data[n].dose = val_vect[get_idx_from_ijk(i,j,k)];
-                    // Add voxel volume to data[n]
-                    data[n].vol = v;
-                    n++;
+        // Compute averages first
+        v = (xbound[i+1]-xbound[i])*(ybound[j+1]-ybound[j])*(zbound[k+1]-zbound[k]);
+        *totVol += v;
+        *avg += val_vect[idx]*v;
+        *eAvg += pow(err_vect[idx],2)*v;
+        *meanErr += err_vect[idx]*v;
+
+        // Check mins & maxs
+        if (*max < val_vect[idx]) {
+            *max = val_vect[idx];
+            *eMax = err_vect[idx];
+        }
+        if (*min > val_vect[idx]) {
+            *min = val_vect[idx];
+            *eMin = err_vect[idx];
+        }
+        if (*min == val_vect[idx])
+            if (*eMin < err_vect[idx]) {
+                *min = val_vect[idx];
+                *eMin = err_vect[idx];
+            }
+        if (*maxErr < err_vect[idx]) {
+            *maxErr = err_vect[idx];
+        }
 
+        // Add voxel dose to data[n]
+        data[n].dose = val_vect[idx];
+        // Add voxel volume to data[n]
+        data[n].vol = v;
+        n++;
+    };
+
+    // The membership counts a voxel in every contour covering it, the media
+    // only in the one that won it on priority
+    if (membership.matches(x, y, z)) {
+        membership.forEach(med, addVoxel);
+        updateProgress(small_increment*z);
+    }
+    else {
+        for (int k = 0; k < z; k++) {
+            for (int j = 0; j < y; j++) {
+                for (int i = 0; i < x; i++) {
+                    if (media_vect[get_idx_from_ijk(i, j, k)] == med) {
+                        addVoxel(i, j, k);
+                    }
                 }
             }
+            updateProgress(small_increment);
         }
-        updateProgress(small_increment);
     }
 
     *avg /= (*totVol);
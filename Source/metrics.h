@@ -58,6 +58,38 @@ struct DVHpoints {
     double vol;
 };
 
+// Voxels i0 to i1-1 of a phantom row lying in struct s
+struct MemberRun {
+    int s, i0, i1;
+};
+
+// Every struct covering each voxel of a phantom, not only the one that won it
+// on priority.  Each row j+ny*k holds its runs sorted by struct then i0, with
+// the runs of one struct never overlapping.
+class StructMembership {
+public:
+    int nx = 0, ny = 0, nz = 0;
+    QVector <QVector <MemberRun> > rows;
+
+    void reset(int x, int y, int z);
+    bool matches(int x, int y, int z) const;
+    bool isEmpty() const;
+    static void compactRow(QVector <MemberRun> &row);
+
+    // Calls f(i, j, k) on every voxel of struct s
+    template <class F> void forEach(int s, F f) const {
+        for (int k = 0; k < nz; k++)
+            for (int j = 0; j < ny; j++) {
+                const QVector <MemberRun> &row = rows[j+ny*k];
+                for (int r = 0; r < row.size(); r++)
+                    if (row[r].s == s)
+                        for (int i = row[r].i0; i < row[r].i1; i++) {
+                            f(i, j, k);
+                        }
+            }
+    }
+};
+
 struct metrics_data {
     QString name;
     QString plot_path; //output in folder with the path name as the media name
@@ -178,8 +210,9 @@ public:
 
 
 
-    void get_data(int nx, int ny, int nz, QVector<double> xbounds, QVector<double> ybounds, QVector<double> zbounds, QVector <QVector <QVector <int> > > media,
-                  QVector<double> val, QVector<double> err, QMap <int, QString> contour_tas_name);  //Initializes the metrics class
+    void get_data(int nx, int ny, int nz, QVector<double> xbounds, QVector<double> ybounds, QVector<double> zbounds, QVector <quint16> media,
+                  QVector<double> val, QVector<double> err, QMap <int, QString> contour_tas_name,
+                  const StructMembership &overlap = StructMembership());  //Initializes the metrics class
 
 
 
@@ -201,8 +234,9 @@ private:
     //values obtained from the 3ddose file
     int x, y, z;
     QVector<double> xbound, ybound, zbound;
-    QVector <QVector <QVector <int> > > media_vect;
+    QVector <quint16> media_vect;                //contour of each voxel, x fastest as in the egsphant
     QMap <int, QString> unique_media;
+    StructMembership membership;            //every contour of each voxel, when they overlap
     QVector<double> val_vect;
     QVector<double> err_vect;
 
@@ -114,6 +114,33 @@ void Options::createLayout() {
     chunk_Layout->addWidget(numb_chunk, 1, 0, 1, 2);
     number_chunk_box->setLayout(chunk_Layout);
 
+    //Generate the phantom on a coarser grid
+    QGroupBox *voxel_size_box = new QGroupBox(tr("Change the phantom voxel size (mm)"));
+    voxel_size_box->setToolTip(tr("Leave empty to keep the CT voxels.  Each   \n") +
+                               tr("phantom voxel is made of whole CT voxels,  \n") +
+                               tr("as close to this size as possible."));
+    voxel_size = new QLineEdit();
+    refine_radius = new QLineEdit();
+    refine_radius->setToolTip(tr("Leave empty for the same voxel size everywhere.\n") +
+                              tr("Otherwise the CT voxels are kept within this   \n") +
+                              tr("many mm of the seeds and targets, and the      \n") +
+                              tr("voxels grow toward the voxel size further out."));
+    vote_priority = new QCheckBox(tr("Weight the media vote by contour priority"));
+    QGridLayout *voxel_size_Layout = new QGridLayout();
+    voxel_size_Layout->addWidget(voxel_size, 1, 0, 1, 2);
+    voxel_size_Layout->addWidget(new QLabel(tr("Keep the CT voxels near seeds and targets (mm)")), 2, 0, 1, 2);
+    voxel_size_Layout->addWidget(refine_radius, 3, 0, 1, 2);
+    voxel_size_Layout->addWidget(vote_priority, 4, 0, 1, 2);
+    sub_samples = new QSpinBox();
+    sub_samples->setRange(1, 8);
+    sub_samples->setValue(1);
+    sub_samples->setToolTip(tr("Each voxel goes to the contour covering most  \n") +
+                            tr("of this many by this many points, instead of  \n") +
+                            tr("the one at its centre."));
+    voxel_size_Layout->addWidget(new QLabel(tr("Contour samples along each voxel side")), 5, 0, 1, 1);
+    voxel_size_Layout->addWidget(sub_samples, 5, 1, 1, 1);
+    voxel_size_box->setLayout(voxel_size_Layout);
+
     //Change score energy deposition
     QGroupBox *energy_deposition_box = new QGroupBox(tr("Score energy deposition"));
     energy_deposition_box->setToolTip(tr("The dafault value is no. \n") +
@@ -175,8 +202,9 @@ void Options::createLayout() {
     options_layout->addWidget(energy_deposition_box, 4, 0, 1, 1);
     options_layout->addWidget(muen_box, 5, 0, 1, 1);
     options_layout->addWidget(material_box, 6, 0, 1, 1);
-    options_layout->addWidget(transportBox, 7, 0);
-    options_layout->addWidget(ExitFrame,  8, 3, 1, 1);
+    options_layout->addWidget(voxel_size_box, 7, 0, 1, 1);
+    options_layout->addWidget(transportBox, 8, 0);
+    options_layout->addWidget(ExitFrame,  9, 3, 1, 1);
 
     options_layout->setColumnStretch(0, 2);
     options_layout->setColumnStretch(1, 1);
@@ -224,6 +252,8 @@ void Options::set_values() {
     number_hist = numb_histories->text().toDouble();
     number_batch = numb_batch->text().toDouble();
     number_chunk = numb_chunk->text().toDouble();
+    double size = voxel_size->text().toDouble();
+    double radius = refine_radius->text().toDouble();
 
     checked_score_energy_deposition = false;  //set the default value
 
@@ -247,8 +277,26 @@ void Options::set_values() {
         msgBox.setWindowTitle(tr("Error"));
         msgBox.exec();
 
+    }
+    else if ((size <= 0) && (!voxel_size->text().trimmed().isEmpty())) { //ERROR, must be positive, user can try again
+        QMessageBox msgBox;
+        msgBox.setText(tr("The phantom voxel size must be a positive number of mm."));
+        msgBox.setWindowTitle(tr("Error"));
+        msgBox.exec();
+
+    }
+    else if (!refine_radius->text().trimmed().isEmpty() && (radius <= 0 || voxel_size->text().trimmed().isEmpty())) { //ERROR, needs a positive radius and the coarsest size
+        QMessageBox msgBox;
+        msgBox.setText(tr("The distance to keep CT voxels must be a positive number of mm, and needs a phantom voxel size."));
+        msgBox.setWindowTitle(tr("Error"));
+        msgBox.exec();
+
     }
     else {
+        phantom_voxel_size = voxel_size->text().trimmed().isEmpty() ? 0 : size;
+        phantom_refine_radius = refine_radius->text().trimmed().isEmpty() ? 0 : radius;
+        priority_vote = vote_priority->isChecked();
+        phantom_sub_samples = sub_samples->value();
 
         if (score_yes->isChecked()) {
             checked_score_energy_deposition = true;
@@ -384,6 +432,10 @@ void Options::close_options() {
     else {
         score_yes->setChecked(false);    //not checked
     }
+    voxel_size->setText(voxel_size_startup);
+    refine_radius->setText(refine_radius_startup);
+    vote_priority->setChecked(priority_vote_startup);
+    sub_samples->setValue(sub_samples_startup);
 
     muen_file = muen_on_startup;
     material_file = material_on_startup;
@@ -411,6 +463,11 @@ void Options::save_options_on_startup(QString egsinp) {
         checked_energy_startup = false;
     }
 
+    voxel_size_startup = voxel_size->text();
+    refine_radius_startup = refine_radius->text();
+    priority_vote_startup = vote_priority->isChecked();
+    sub_samples_startup = sub_samples->value();
+
     muen_on_startup = muen_file;
     material_on_startup = material_file;
     transp_index_startup = transport_selection->currentRow();
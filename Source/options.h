@@ -56,6 +56,10 @@ private:
     double number_chunk_startup;
     double number_batch_startup;
     bool checked_energy_startup;
+    QString voxel_size_startup;
+    QString refine_radius_startup;
+    int sub_samples_startup;
+    bool priority_vote_startup;
 
     QString egsinp_path;
 
@@ -67,6 +71,10 @@ private:
     QLineEdit *numb_histories;
     QLineEdit *numb_batch;
     QLineEdit *numb_chunk;
+    QLineEdit *voxel_size;
+    QLineEdit *refine_radius;
+    QSpinBox *sub_samples;
+    QCheckBox *vote_priority;
 
     QGroupBox *transportBox;
     QPushButton *select_transport;
@@ -106,6 +114,10 @@ public:
     double number_hist = 1e8; //default value
     double number_batch = 1; //default value
     double number_chunk = 10; //default value
+    double phantom_voxel_size = 0; //in mm, 0 keeps the CT voxels
+    double phantom_refine_radius = 0; //in mm, CT voxels are kept this close to seeds and targets, 0 for a uniform grid
+    bool priority_vote = false; //weight the media vote of resampled voxels by contour priority
+    int phantom_sub_samples = 1; //contour samples along each side of a voxel
     QString muen_file;
     QString material_file;
     QString transport_param_path;
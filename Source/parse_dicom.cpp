@@ -39,19 +39,158 @@
 
 #include "parse_dicom.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
 //#define OUTPUT_ALL
 //#define OUTPUT_TAG
 //#define OUTPUT_SQ
 #define MAX_DATA_PRINT 0 // 0 means any size
 
 Attribute::Attribute() {
-    vf = NULL; // This stops seg faults when calling the destructor below
+    vf = NULL;
+    vl = 0;
+    desc = "";
+    vr = VR_NONE;
+}
+
+// Drops the padding around a single value as well as a leading plus sign,
+// which from_chars doesn't accept
+static void trimValue(const char *&b, const char *&e) {
+    while (b < e && (*b == ' ' || *b == '\0')) {
+        b++;
+    }
+    while (e > b && (e[-1] == ' ' || e[-1] == '\0')) {
+        e--;
+    }
+    if (e-b > 1 && *b == '+') {
+        b++;
+    }
+}
+
+static double parseDecimal(const char *b, const char *e) {
+    trimValue(b, e);
+#ifdef __cpp_lib_to_chars
+    double v = 0;
+    std::from_chars_result r = std::from_chars(b, e, v);
+    return (r.ec == std::errc() && r.ptr == e) ? v : 0;
+#else // Older libstdc++ only has the integer from_chars
+    bool ok;
+    double v = QByteArray::fromRawData(b, e-b).toDouble(&ok);
+    return ok ? v : 0;
+#endif
+}
+
+static int parseInt(const char *b, const char *e) {
+    trimValue(b, e);
+#if __cplusplus >= 201703L
+    int v = 0;
+    std::from_chars_result r = std::from_chars(b, e, v);
+    return (r.ec == std::errc() && r.ptr == e) ? v : 0;
+#else
+    bool ok;
+    int v = QByteArray::fromRawData(b, e-b).toInt(&ok);
+    return ok ? v : 0;
+#endif
+}
+
+// Finds the bounds of value n in a backslash separated value field, returns
+// false if there aren't that many values
+static bool findValue(const unsigned char *vf, unsigned long int vl, int n, const char *&b, const char *&e) {
+    const char *pos = (const char *)vf, *end = pos+vl;
+    if (vf == NULL || vl == 0) {
+        return false;
+    }
+
+    for (int i = 0; i < n; i++) {
+        pos = (const char *)memchr(pos, '\\', end-pos);
+        if (pos == NULL) {
+            return false;
+        }
+        pos++;
+    }
+
+    b = pos;
+    e = (const char *)memchr(pos, '\\', end-pos);
+    if (e == NULL) {
+        e = end;
+    }
+    return true;
+}
+
+QString Attribute::asString() const {
+    if (vf == NULL) {
+        return QString();
+    }
+    return QString::fromLatin1((const char *)vf, vl);
+}
+
+int Attribute::valueCount() const {
+    if (vf == NULL || vl == 0) {
+        return 0;
+    }
+
+    int n = 1;
+    const char *pos = (const char *)vf, *end = pos+vl;
+    while ((pos = (const char *)memchr(pos, '\\', end-pos)) != NULL) {
+        pos++;
+        n++;
+    }
+    return n;
+}
+
+int Attribute::asInt(int n) const {
+    const char *b, *e;
+    return findValue(vf, vl, n, b, e) ? parseInt(b, e) : 0;
+}
+
+double Attribute::asDecimal(int n) const {
+    const char *b, *e;
+    return findValue(vf, vl, n, b, e) ? parseDecimal(b, e) : 0;
+}
+
+/***
+Function: asDecimalArray
+------------------------
+Process: Parses up to max backslash separated decimal strings from vf into out
+         in a single pass, returning how many were written
+***/
+int Attribute::asDecimalArray(double *out, int max) const {
+    if (vf == NULL || vl == 0) {
+        return 0;
+    }
+
+    const char *pos = (const char *)vf, *end = pos+vl, *next;
+    int n = 0;
+    while (n < max) {
+        next = (const char *)memchr(pos, '\\', end-pos);
+        out[n++] = parseDecimal(pos, next == NULL ? end : next);
+        if (next == NULL) {
+            break;
+        }
+        pos = next+1;
+    }
+    return n;
+}
+
+QVector <double> Attribute::asDecimalArray() const {
+    QVector <double> values(valueCount());
+    values.resize(asDecimalArray(values.data(), values.size()));
+    return values;
 }
 
-Attribute::~Attribute() {
-    if (vf != NULL) {
-        delete[] vf;
+unsigned short int Attribute::asUS(bool bigEndian) const {
+    if (vf == NULL || vl < 2) {
+        return 0;
+    }
+    if (bigEndian) {
+        return (unsigned short int)((vf[0] << 8) | vf[1]);
     }
+    return (unsigned short int)((vf[1] << 8) | vf[0]);
 }
 
 SequenceItem::SequenceItem(unsigned long int size, unsigned char *data) {
@@ -59,22 +198,43 @@ SequenceItem::SequenceItem(unsigned long int size, unsigned char *data) {
     vf = data;
 }
 
-SequenceItem::~SequenceItem() {
-    if (vf != NULL) {
-        delete[] vf;
-    }
+DicomArena::~DicomArena() {
+    clear();
 }
 
-Sequence::~Sequence() {
-    for (int i = 0; i < items.size(); i++) {
-        delete items[i];
-    }
-    items.clear();
+/***
+Function: allocate
+------------------
+Process: Hands out the next size bytes of the current block, starting a new
+         block when it is full.  Anything bigger than a block gets a block of
+         its own.
+***/
+void *DicomArena::allocate(size_t size, size_t align) {
+    char *p = (char *)(((quintptr)cur+align-1) & ~(quintptr)(align-1));
+    if (cur == NULL || p+size > limit) {
+        size_t header = (sizeof(Block)+alignof(std::max_align_t)-1) & ~(alignof(std::max_align_t)-1);
+        size_t bytes = qMax(blockSize, header+size+align);
+        Block *block = (Block *)malloc(bytes);
+        if (block == NULL) {
+            throw std::bad_alloc();
+        }
+        block->next = blocks;
+        blocks = block;
+        cur = (char *)block+header;
+        limit = (char *)block+bytes;
+        p = (char *)(((quintptr)cur+align-1) & ~(quintptr)(align-1));
+    }
+    cur = p+size;
+    return p;
 }
 
-DICOM::DICOM(database *l) {
-    lib = l;
-    isImplicit = isBigEndian = false;
+void DicomArena::clear() {
+    while (blocks != NULL) {
+        Block *next = blocks->next;
+        free(blocks);
+        blocks = next;
+    }
+    cur = limit = NULL;
 }
 
 DICOM::DICOM() {
@@ -82,769 +242,598 @@ DICOM::DICOM() {
 }
 
 DICOM::~DICOM() {
-    // for (int i = 0; i < data.size(); i++) {
-    // delete data[i];
-    // }
-    // data.clear();
+    releaseData();
+}
+
+/***
+Function: releaseData
+---------------------
+Process: Frees the parsed attributes and then the mapping they point into.
+         Anything still needed (like the header values of a CT slice) has to
+         be copied out before this is called.
+***/
+void DICOM::releaseData() {
+    // The attributes only hold views into the mapping, so they must go first,
+    // and they all go together with the arena
+    data.clear();
+    arena.clear();
+    releaseMapping();
+}
+
+/***
+Function: openMapping
+---------------------
+Process: Memory maps the file at path so that parse can read the data elements
+         in place.  If the file system doesn't support mapping, the file is read
+         into a single buffer with one call instead.
+Output:  true if there is any data to parse
+***/
+bool DICOM::openMapping() {
+    releaseMapping();
+
+    mapFile = new QFile(path);
+    if (!mapFile->open(QIODevice::ReadOnly)) {
+        delete mapFile;
+        mapFile = NULL;
+        return false;
+    }
+
+    mapSize = mapFile->size();
+    if (mapSize > 0) {
+        mapData = mapFile->map(0, mapSize);
+    }
+
+    if (mapData == NULL) { // Fall back on reading the whole file at once
+        mapBuffer = mapFile->readAll();
+        mapData = (unsigned char *)mapBuffer.data();
+        mapSize = mapBuffer.size();
+    }
+
+    // The mapping outlives the file handle, closing it keeps us from running out
+    // of descriptors on large series
+    mapFile->close();
+    return mapSize > 0;
+}
+
+/***
+Function: releaseMapping
+------------------------
+Process: Unmaps the file (deleting the QFile unmaps it) and frees the fallback
+         buffer.  Any value field that is not owned is invalid after this call.
+***/
+void DICOM::releaseMapping() {
+    if (mapFile != NULL) {
+        delete mapFile;
+        mapFile = NULL;
+    }
+    mapBuffer.clear();
+    mapData = NULL;
+    mapSize = 0;
 }
 
-int DICOM::readSequence(QDataStream *in, Attribute *att) {
-    bool flag = true;
+/***
+Function: findItemEnd
+---------------------
+Process: Scans forward from start for the item delimiter (FFFE,E00D) that closes
+         a sequence item of undefined length, skipping over the delimiters of
+         any nested sequences of undefined length
+Output:  Pointer to the item delimiter tag, or NULL if the data runs out first
+***/
+const unsigned char *DICOM::findItemEnd(const unsigned char *start, const unsigned char *end) {
     int depth = 0;
-    unsigned int *tag, size;
-    unsigned char *dat;
-    while (flag) {
-        tag = new unsigned int;
-        if (in->readRawData((char *)tag, 4) != 4) {
-            // Not a DICOM file
-            delete tag;
-            return 0;
+    for (const unsigned char *p = start+4; p <= end; p++) {
+        // Is there a subsequence we are parsing
+        if (p-start >= 8 && p[-1] == 0xFF && p[-2] == 0xFF && p[-3] == 0xFF && p[-4] == 0xFF) {
+            if (!isImplicit) {
+                if (p[-8] == 'S' && p[-7] == 'Q' && p[-6] == 0 && p[-5] == 0) {
+                    depth++; // Increase depth to skip delimiters until we exit subsequence
+                }
+            }
+            else {
+                unsigned short int tag[2];
+                tag[0] = ((unsigned short int)(p[-7]) << 8) + (unsigned short int)p[-8];
+                tag[1] = ((unsigned short int)(p[-5]) << 8) + (unsigned short int)p[-6];
+                const Reference *nearest = database::find(tag[0], tag[1]);
+                if (nearest != NULL && nearest->vr == VR_SQ) {
+                    depth++; // Increase depth to skip delimiters until we exit subsequence
+                }
+            }
+        }
+
+        unsigned int last = ((unsigned int)(p[-1]) << 24) +
+                            ((unsigned int)(p[-2]) << 16) +
+                            ((unsigned int)(p[-3]) << 8) +
+                            (unsigned int)p[-4];
+
+        // ...until we reach the sequence item delimiter
+        if (last == (unsigned int)0xE00DFFFE && !depth) {
+            return p-4;
         }
-        if (in->readRawData((char *)(&size), 4) != 4) {
+        else if (last == (unsigned int)0xE0DDFFFE) {
+            depth--;
+        }
+    }
+    return NULL;
+}
+
+int DICOM::readSequence(const unsigned char *&pos, const unsigned char *end, Attribute *att) {
+    unsigned int tag, size;
+    while (true) {
+        if (end-pos < 8) {
             // Not a DICOM file
-            delete tag;
             return 0;
         }
+        tag = ((unsigned int)(pos[3]) << 24) + ((unsigned int)(pos[2]) << 16) +
+              ((unsigned int)(pos[1]) << 8) + (unsigned int)pos[0];
+        size = ((unsigned int)(pos[7]) << 24) + ((unsigned int)(pos[6]) << 16) +
+               ((unsigned int)(pos[5]) << 8) + (unsigned int)pos[4];
+        pos += 8;
 
-        if (*tag == (unsigned int)0xE0DDFFFE) { // sequence delimiter
-            flag = false;
+        if (tag == (unsigned int)0xE0DDFFFE) { // sequence delimiter
+            return 1;
         }
         else if (size != (unsigned int)0xFFFFFFFF) {
             // sequence item with defined size
-            dat = new unsigned char[size];
-            if ((unsigned int)in->readRawData((char *)dat, size) != size) {
+            if ((unsigned long int)(end-pos) < size) {
                 // Not a DICOM file
-                delete tag;
-                delete[] dat;
                 return 0;
             }
-            att->seq.items.append(new SequenceItem(size, dat));
+            att->seq.items.append(arena, arena.make<SequenceItem>((unsigned long int)size, (unsigned char *)pos));
+            pos += size;
         }
-        else if (size == (unsigned int)0xFFFFFFFF) {
+        else {
             // sequence item with undefined size
-            QByteArray buffer;
-            depth = 0;
-            dat = new unsigned char[1];
-            while (true) { // Keeping appending data one char at a time...
-                if (in->readRawData((char *)dat, 1) != 1) {
-                    std::cout<<dat <<"reading data \n";
-                    //Not a DICOM file
-                    delete tag;
-                    delete[] dat;
-                    return 0;
-                }
-
-                buffer.append(*dat);
-
-                // Is there a subsequence we are parsing
-                if (buffer.endsWith("")) { //FFFF FFFF
-                    if (!isImplicit) {
-                        if (buffer.endsWith("SQ\0\0")) {
-                            depth++; // Increase depth to skip delimiters until we exit subsequence
-                        }
-                    }
-                    else {
-                        unsigned short int tag[2];
-                        tag[0] = *(unsigned short int *)(buffer.right(8).left(2).data());
-                        tag[1] = *(unsigned short int *)(buffer.right(6).left(2).data());
-                        Reference nearest = lib->binSearch(tag[0], tag[1], 0, lib->lib.size()-1);
-                        if (nearest.tag[0] == tag[0] && nearest.tag[1] == tag[1] && !nearest.vr.compare("SQ")) {
-                            depth++; // Increase depth to skip delimiters until we exit subsequence
-                        }
-                    }
-                }
-
-                // ...until we reach the sequence item delimiter
-                if (*((unsigned int *)buffer.right(4).data()) == (unsigned int)0xE00DFFFE && !depth) {
-                    buffer.chop(4);
-                    delete[] dat;
-                    dat = new unsigned char[4];
-                    if (in->readRawData((char *)dat, 4) != 4) {
-                        // Not a DICOM file
-                        delete tag;
-                        delete[] dat;
-                        return 0;
-                    }
-                    delete[] dat;
-                    dat = new unsigned char[buffer.size()];
-                    for (int i = 0; i < buffer.size(); i++) {
-                        dat[i] = buffer[i];
-                    }
-                    att->seq.items.append(new SequenceItem(buffer.size(),dat));
-                    break;
-                }
-                else if (*((unsigned int *)buffer.right(4).data()) == (unsigned int)0xE0DDFFFE) {
-                    depth--;
-                }
+            const unsigned char *itemEnd = findItemEnd(pos, end);
+            if (itemEnd == NULL || end-itemEnd < 8) {
+                // Not a DICOM file
+                return 0;
             }
+            att->seq.items.append(arena, arena.make<SequenceItem>((unsigned long int)(itemEnd-pos), (unsigned char *)pos));
+            pos = itemEnd+8; // Skip the item delimiter and its (zero) length
         }
-
-        delete tag;
     }
-    return 1;
 }
 
-int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n) {
-    int depth = 0;
-    unsigned int *tag, size;
-    unsigned char *dat;
-    while (n > 0) {
-        tag = new unsigned int;
-        if (in->readRawData((char *)tag, 4) != 4) {
-            // Not a DICOM file
-            delete tag;
-            return 0;
-        }
-        if (in->readRawData((char *)(&size), 4) != 4) {
+int DICOM::readDefinedSequence(const unsigned char *&pos, const unsigned char *end, Attribute *att, unsigned long int n) {
+    unsigned int size;
+    const unsigned char *seqEnd = pos+n;
+    if (n > (unsigned long int)(end-pos)) {
+        // Not a DICOM file
+        return 0;
+    }
+
+    while (pos < seqEnd) {
+        if (seqEnd-pos < 8) {
             // Not a DICOM file
-            delete tag;
             return 0;
         }
-        n-=8;
+        size = ((unsigned int)(pos[7]) << 24) + ((unsigned int)(pos[6]) << 16) +
+               ((unsigned int)(pos[5]) << 8) + (unsigned int)pos[4];
+        pos += 8;
 
         if (size != (unsigned int)0xFFFFFFFF) {
             // sequence item with defined size
-            dat = new unsigned char[size];
-            if ((unsigned int)in->readRawData((char *)dat, size) != size) {
+            if ((unsigned long int)(seqEnd-pos) < size) {
                 // Not a DICOM file
-                delete tag;
-                delete[] dat;
                 return 0;
             }
-            att->seq.items.append(new SequenceItem(size, dat));
-            n-=size;
+            att->seq.items.append(arena, arena.make<SequenceItem>((unsigned long int)size, (unsigned char *)pos));
+            pos += size;
         }
-        else if (size == (unsigned int)0xFFFFFFFF) {
+        else {
             // sequence item with undefined size
-            QByteArray buffer;
-            dat = new unsigned char[1];
-            while (true) { // Keeping appending data one char at a time...
-                if (in->readRawData((char *)dat, 1) != 1) {
-                    // Not a DICOM file
-                    delete tag;
-                    delete[] dat;
-                    return 0;
-                }
-                buffer.append(*dat);
-
-                // Is there a subsequence we are parsing
-                if (buffer.endsWith("")) {
-                    if (!isImplicit) {
-                        if (buffer.endsWith("SQ\0\0")) {
-                            depth++; // Increase depth to skip delimiters until we exit subsequence
-                        }
-                    }
-                    else {
-                        unsigned short int tag[2];
-                        tag[0] = *(unsigned short int *)(buffer.right(8).left(2).data());
-                        tag[1] = *(unsigned short int *)(buffer.right(6).left(2).data());
-                        Reference nearest = lib->binSearch(tag[0], tag[1], 0, lib->lib.size()-1);
-                        if (nearest.tag[0] == tag[0] && nearest.tag[1] == tag[1] && !nearest.vr.compare("SQ")) {
-                            depth++; // Increase depth to skip delimiters until we exit subsequence
-                        }
-                    }
-                }
-
-                // ...until we reach the sequence item delimiter
-                if (*((unsigned int *)buffer.right(4).data()) == (unsigned int)0xE00DFFFE && !depth) {
-                    delete[] dat;
-                    dat = new unsigned char[4];
-                    if (in->readRawData((char *)dat, 4) != 4) {
-                        // Not a DICOM file
-                        delete tag;
-                        delete[] dat;
-                        return 0;
-                    }
-                    delete[] dat;
-                    dat = new unsigned char[buffer.size()];
-                    for (int i = 0; i < buffer.size(); i++) {
-                        dat[i] = buffer[i];
-                    }
-                    att->seq.items.append(new SequenceItem(buffer.size(),dat));
-                    n-=buffer.size();
-                    break;
-                }
-                else if (*((unsigned int *)buffer.right(4).data()) == (unsigned int)0xE0DDFFFE) {
-                    depth--;
-                }
+            const unsigned char *itemEnd = findItemEnd(pos, seqEnd);
+            if (itemEnd == NULL || seqEnd-itemEnd < 8) {
+                // Not a DICOM file
+                return 0;
             }
+            att->seq.items.append(arena, arena.make<SequenceItem>((unsigned long int)(itemEnd-pos), (unsigned char *)pos));
+            pos = itemEnd+8;
         }
-
-        delete tag;
     }
     return 1;
 }
 
-int DICOM::parse(QString p) {
-    path = p;
-    QFile file(path);
-    int k = 0, l = 0;
-    if (file.open(QIODevice::ReadOnly)) {
-        unsigned char *dat;
-        QDataStream in(&file);
-        in.setByteOrder(QDataStream::LittleEndian);
+/***
+Function: readElementHeader
+---------------------------
+Process: Reads the tag, VR and value length of the data element at pos and
+         advances pos to the start of its value field
+Output:  false if the header runs past the end of the buffer
+***/
+bool DICOM::readElementHeader(const unsigned char *&pos, const unsigned char *end, unsigned short int tag[2], unsigned char &vr, unsigned long int &vl) {
+    const unsigned char *dat;
 
-        /*============================================================================*/
-        /*DICOM HEADER READER=========================================================*/
-        // Skip the first bit of white space in DICOM
-        dat = new unsigned char[128];
-        if (in.readRawData((char *)dat, 128) != 128) {
-            // Not a DICOM file
-            delete[] dat;
-            file.close();
-            return 0;
-        }
-        delete[] dat;
+    // Get the tag
+    if (end-pos < 4) {
+        return false;
+    }
+    tag[0]= ((unsigned short int)(pos[1]) << 8) +
+            (unsigned short int)pos[0];
+    tag[1]= ((unsigned short int)(pos[3]) << 8) +
+            (unsigned short int)pos[2];
+    pos += 4;
 
-        // Read in DICM characters at start of file
-        dat = new unsigned char[4];
-        if (in.readRawData((char *)dat, 4) != 4) {
-            // Not a DICOM file
-            delete[] dat;
-            file.close();
-            return 0;
+    // Get the VR
+    if (!isImplicit || tag[0] == 0x0002) {
+        if (end-pos < 4) {
+            return false;
         }
-        else if ((QString(dat[0])+dat[1]+dat[2]+dat[3]) != "DICM") {
-            // Not a DICOM file
-            delete[] dat;
-            file.close();
-            return 0;
+        dat = pos;
+        pos += 4;
+        vr = database::vrCode(dat[0], dat[1]);
+    }
+    else {
+        // Tags missing from the dictionary are treated as unknown data
+        dat = NULL;
+        const Reference *ref = database::find(tag[0], tag[1]);
+        vr = ref != NULL ? ref->vr : (unsigned char)VR_UN;
+    }
+
+    // Get size, either a full 4 bytes after the VR or the last 2 bytes of the VR field
+    if ((tag[0] != 0x0002 && isImplicit) || database::implicitVR(vr)) {
+        if (end-pos < 4) {
+            return false;
         }
-        delete[] dat;
+        dat = pos;
+        pos += 4;
+        vl = ((unsigned int)(dat[3]) << 24) +
+             ((unsigned int)(dat[2]) << 16) +
+             ((unsigned int)(dat[1]) << 8) +
+             (unsigned int)dat[0];
+    }
+    else if (database::validVR(vr))
+        vl = ((unsigned short int)(dat[3]) << 8) +
+             (unsigned short int)dat[2];
+    else
+        vl = ((unsigned int)(dat[3]) << 24) +
+             ((unsigned int)(dat[2]) << 16) +
+             ((unsigned int)(dat[1]) << 8) +
+             (unsigned int)dat[0];
 
-        /*============================================================================*/
-        /*BEGINNING OF DATA ELEMENT READING LOOP======================================*/
-        Attribute *temp;
-        unsigned int size;
-        QString VR;
-        bool nested = false;
-        while (!in.atEnd()) {
-            temp = new Attribute();
-
-            /*============================================================================*/
-            /*RETRIEVE ELEMENT TAG========================================================*/
-            // Get the tag
-            k++; // iterate
-#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
-            std::cout << std::dec << k << ") " << "Tag ";
-#endif
-            dat = new unsigned char[4];
-            if (in.readRawData((char *)dat,4) != 4) {
-                // Not a DICOM file
-                delete[] dat;
-                file.close();
-                return 0;
-            }
-            temp->tag[0]= ((unsigned short int)(dat[1]) << 8) +
-                          (unsigned short int)dat[0];
-            temp->tag[1]= ((unsigned short int)(dat[3]) << 8) +
-                          (unsigned short int)dat[2];
-#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
-            std::cout << std::hex << temp->tag[0] << ","
-                      <<  temp->tag[1] << " | Representation ";
+    return true;
+}
+
+/***
+Function: readElement
+---------------------
+Process: Reads one data element (tag, VR, length and value) starting at pos and
+         advances pos past it.  The value field is not copied, temp->vf points
+         at the bytes in the buffer, and sequences are split into items that
+         also point into the buffer.
+Input:   known is set if the tag was found in the dictionary
+Output:  false if the element runs past the end of the buffer
+***/
+bool DICOM::readElement(const unsigned char *&pos, const unsigned char *end, Attribute *temp, bool &known) {
+    unsigned char VR;
+    bool nested = false;
+    known = false;
+
+    if (!readElementHeader(pos, end, temp->tag, temp->vr, temp->vl)) {
+        return false;
+    }
+    VR = temp->vr;
+#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG) || defined(OUTPUT_SQ)
+    std::cout << std::hex << temp->tag[0] << "," <<  temp->tag[1] << " | Representation ";
+    std::cout << (int)VR << " | Size ";
 #endif
-            delete[] dat;
 
-            if (temp->tag[0] == 0xFFFE && (temp->tag[1] == 0xE0DD || temp->tag[1] == 0xE00D)) {
-                // Not a DICOM file
-                std::cout << "Misreading sequence delimiters as top level data elements, something has gone wrong \n";
-                //delete[] dat;
-                //file.close();
-                //return 0;
-            }
-
-            /*============================================================================*/
-            /*NON-NESTED PROCEDURE: GET VR, SIZE AND DATA=================================*/
-            // Normal data elements
-            // Get the VR
-            dat = new unsigned char[4];
-
-            if (!isImplicit || temp->tag[0] == 0x0002) {
-                if (in.readRawData((char *)dat,4) != 4) {
-                    // Not a DICOM file
-                    delete[] dat;
-                    file.close();
-                    return 0;
-                }
+    // We have a sequence
+    if (VR == VR_SQ && temp->vl == (unsigned int)0xFFFFFFFF) {
+        nested = true;
+        if (!readSequence(pos, end, temp)) {
+            return false;
+        }
+    }
+    else if (VR == VR_SQ) {
+        nested = true;
+        if (!readDefinedSequence(pos, end, temp, temp->vl)) {
+            return false;
+        }
+    }
 
-                VR = QString(dat[0])+dat[1];
+    if (temp->vl == (unsigned int)0xFFFFFFFF) {
+        temp->vl = 0;
+    }
 
-#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
-                std::cout << ((unsigned short int)(dat[0]) << 8) +
-                          (unsigned short int)dat[1]
-                          << " -> " << VR.toStdString() << " | Size ";
+#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG) || defined(OUTPUT_SQ)
+    std::cout << std::dec << temp->vl << "\n";
 #endif
+
+    const Reference *closest = database::find(temp->tag[0], temp->tag[1]);
+    if (closest != NULL) {
+        temp->desc = closest->title;
+        known = true;
+    }
+    else {
+        temp->desc = "Unknown Tag";
+    }
+
+    // Get data, which is left where it is in the buffer
+    if (!nested) {
+        if ((unsigned long int)(end-pos) < temp->vl) {
+            return false;
+        }
+        temp->vf = (unsigned char *)pos;
+        pos += temp->vl;
+
+#ifdef OUTPUT_ALL
+        unsigned long int avoidWarning = (unsigned long int)MAX_DATA_PRINT;
+        if (avoidWarning == 0 || temp->vl < avoidWarning)
+            for (unsigned long int i = 0; i < temp->vl; i++) {
+                std::cout << temp->vf[i];
             }
-            else {
-                VR = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1).vr;
-#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
-                std::cout << VR.toStdString() << " (implicit) | Size ";
+        else {
+            std::cout << "Data larger than " << std::dec << avoidWarning;
+        }
+        std::cout << "\n";
+#endif
+    }
+#if defined(OUTPUT_ALL) || defined(OUTPUT_SQ)
+    else {
+        std::cout << "Nested data\n";
+        for (int i = 0; i < temp->seq.items.size(); i++) {
+            std::cout << "\t" << std::dec << i+1 << ") " << temp->seq.items[i]->vl << " bytes\n";
+        }
+    }
 #endif
-            }
 
-            // Get size
-            if ((temp->tag[0] != 0x0002 && isImplicit) || (lib->implicitVR.contains(VR))) {
-                if (in.readRawData((char *)dat,4) != 4) { //Reread for size
-                    // Not a DICOM file
-                    delete[] dat;
-                    file.close();
-                    return 0;
-                }
-                temp->vl = ((unsigned int)(dat[3]) << 24) +
-                           ((unsigned int)(dat[2]) << 16) +
-                           ((unsigned int)(dat[1]) << 8) +
-                           (unsigned int)dat[0];
-
-                // We have a sequence
-                if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
-                    nested = true;
-                    if (!readSequence(&in, temp)) {
-                        return 0;
-                    }
-                }
-                else if (!VR.compare("SQ")) {
-                    nested = true;
-                    if (!readDefinedSequence(&in, temp, temp->vl)) {
-                        return 0;
-                    }
-                }
-            }
-            else {
-                if (isImplicit && temp->tag[0] != 0x0002)
-                    if (in.readRawData((char *)dat,4) != 4) {
-                        // Not a DICOM file
-                        delete[] dat;
-                        file.close();
-                        return 0;
-                    }
+    return true;
+}
 
-                if (lib->validVR.contains(VR))
-                    temp->vl = ((unsigned short int)(dat[3]) << 8) +
-                               (unsigned short int)dat[2];
-                else
-                    temp->vl = ((unsigned int)(dat[3]) << 24) +
-                               ((unsigned int)(dat[2]) << 16) +
-                               ((unsigned int)(dat[1]) << 8) +
-                               (unsigned int)dat[0];
-
-                // We have a sequence
-                if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
-                    nested = true;
-                    if (!readSequence(&in, temp)) {
-                        return 0;
-                    }
-                }
-                else if (!VR.compare("SQ")) {
-                    nested = true;
-                    if (!readDefinedSequence(&in, temp, temp->vl)) {
-                        return 0;
-                    }
-                }
-            }
+/***
+Function: parse
+---------------
+Process: Parses every data element of the file at p into data.  If headerOnly
+         is set, parsing stops after the pixel data element (7FE0,0010) has
+         been located, without reading any of its values, so files can be
+         sorted before we decide which ones need decoding.
+Output:  Number of data elements found in the dictionary, 0 if the file could
+         not be parsed
+***/
+int DICOM::parse(QString p, bool headerOnly) {
+    path = p;
+    fromIndex = false;
+    int k = 0, l = 0;
+    if (!openMapping()) {
+        return 0;
+    }
 
-            if (temp->vl == (unsigned int)0xFFFFFFFF) {
-                temp->vl = 0;
-            }
+    const unsigned char *pos = mapData;
+    const unsigned char *end = mapData+mapSize;
 
-            size = temp->vl;
+    /*============================================================================*/
+    /*DICOM HEADER READER=========================================================*/
+    // Skip the first bit of white space in DICOM, then check the DICM characters
+    if (mapSize < 132 || memcmp(pos+128, "DICM", 4)) {
+        // Not a DICOM file
+        releaseMapping();
+        return 0;
+    }
+    pos += 132;
 
+    /*============================================================================*/
+    /*BEGINNING OF DATA ELEMENT READING LOOP======================================*/
+    Attribute *temp;
+    bool known;
+    while (pos < end) {
+        temp = arena.make<Attribute>();
+        k++; // iterate
 #if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
-            std::cout << temp->vl << " -> " << std::dec << size << "\n";
+        std::cout << std::dec << k << ") " << "Tag ";
 #endif
 
-            Reference closest = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1);
-            if (closest.tag[0] == temp->tag[0] && closest.tag[1] == temp->tag[1]) {
-                temp->desc = closest.title;
-                l++;
+        if (!readElement(pos, end, temp, known)) {
+            // Not a DICOM file, the partial element goes with the arena
+            return 0;
+        }
+        if (known) {
+            l++;
+        }
+
+        if (temp->tag[0] == 0xFFFE && (temp->tag[1] == 0xE0DD || temp->tag[1] == 0xE00D)) {
+            std::cout << "Misreading sequence delimiters as top level data elements, something has gone wrong \n";
+        }
+
+        // Save what is needed to sort the files before any pixels are decoded
+        if (temp->tag[0] == 0x0008 && temp->tag[1] == 0x0060) {
+            modality = QString::fromLatin1((char *)temp->vf, temp->vl).trimmed();
+        }
+        else if (temp->tag[0] == 0x0008 && temp->tag[1] == 0x0018) {
+            sopUID = QString::fromLatin1((char *)temp->vf, temp->vl).remove(QChar('\0')).trimmed();
+        }
+        else if (temp->tag[0] == 0x0020 && temp->tag[1] == 0x000e) {
+            seriesUID = QString::fromLatin1((char *)temp->vf, temp->vl).remove(QChar('\0')).trimmed();
+        }
+        else if (temp->tag[0] == 0x0028 && temp->tag[1] == 0x0008) {
+            numFrames = qMax(1, temp->asInt());
+        }
+        else if (temp->tag[0] == 0x7fe0 && temp->tag[1] == 0x0010 && temp->vf != NULL) {
+            pixelOffset = temp->vf-mapData;
+            pixelLength = temp->vl;
+            if (headerOnly) {
+                data.append(temp);
+                break;
+            }
+        }
+
+        // Save proper transfer syntax for farther parsing
+        if (temp->tag[0] == 0x0002 && temp->tag[1] == 0x0010) {
+            QString TransSyntax = QString::fromLatin1((char *)temp->vf, temp->vl);
+            while (TransSyntax.endsWith(QChar('\0')) || TransSyntax.endsWith(' ')) {
+                TransSyntax.chop(1);
+            }
+            if (!TransSyntax.compare("1.2.840.10008.1.2.1")) {
+                isImplicit = false;
+                isBigEndian = false;
+            }
+            else if (!TransSyntax.compare("1.2.840.10008.1.2.2")) {
+                isImplicit = false;
+                isBigEndian = true;
+            }
+            else if (!TransSyntax.compare("1.2.840.10008.1.2")) {
+                isImplicit = true;
+                isBigEndian = false;
             }
             else {
-                temp->desc = "Unknown Tag";
+                std::cout << "Unknown transfer syntax, assuming explicit and little endian\n";
+                isImplicit = false;
+                isBigEndian = false;
             }
+        }
 
-#ifdef OUTPUT_ALL
-            std::cout << temp->desc.toStdString() << ": ";
-#endif
-            delete[] dat;
-
-            // Get data
-            if (!nested) {
-                temp->vf = new unsigned char[size];
-                if (size > 0 && size < (unsigned long int)INT_MAX) {
-                    if (in.readRawData((char *)temp->vf,size) != (long int)size) {
-                        // Not a DICOM file
-                        file.close();
-                        return 0;
-                    }
-                }
-                else if (size > 0) { // In case we need to read in more data
-                    // then the buffer can handle
-                    unsigned char *pt = temp->vf;
-                    for (int i = 0; (unsigned long int)i <
-                            size/((unsigned long int)INT_MAX); i++) {
-                        if (in.readRawData((char *)pt,INT_MAX) != INT_MAX) {
-                            // Not a DICOM file
-                            file.close();
-                            return 0;
-                        }
-                        pt += sizeof(char)*INT_MAX;
-                    }
-                }
+        // Save slice height for later sorting
+        if (temp->tag[0] == 0x0020 && temp->tag[1] == 0x0032) {
+            z = temp->asDecimal(2);
+        }
 
-#ifdef OUTPUT_ALL
-                unsigned long int avoidWarning =
-                    (unsigned long int)MAX_DATA_PRINT;
-                if (avoidWarning == 0 || size < avoidWarning)
-                    // It's a string
-                    if (!VR.compare("UI") || !VR.compare("SH") || !VR.compare("AE") || !VR.compare("DA") ||
-                            !VR.compare("TM") || !VR.compare("LO") || !VR.compare("ST") || !VR.compare("PN") ||
-                            !VR.compare("DT") || !VR.compare("LT") || !VR.compare("UT") || !VR.compare("IS") ||
-                            !VR.compare("OW") || !VR.compare("DS") || !VR.compare("CS") || !VR.compare("AS"))
-                        for (unsigned long int i = 0; i < size; i++) {
-                            std::cout << dat[i];
-                        }
-                // It's a tag
-                    else if (!VR.compare("AT"))
-                        std::cout << ((unsigned int)(dat[3]) << 24) +
-                                  ((unsigned int)(dat[2]) << 16) +
-                                  ((unsigned int)(dat[1]) << 8) +
-                                  (unsigned int)(dat[0]);
-                    else if (!VR.compare("FL"))
-                        if (isBigEndian)
-                            std::cout << std::dec << float(((int)(dat[0]) << 24) +
-                                                           ((int)(dat[1]) << 16) +
-                                                           ((int)(dat[2]) << 8) +
-                                                           (int)(dat[3])) << std::hex;
-                        else
-                            std::cout << std::dec << float(((int)(dat[3]) << 24) +
-                                                           ((int)(dat[2]) << 16) +
-                                                           ((int)(dat[1]) << 8) +
-                                                           (int)(dat[0])) << std::hex;
-                    else if (!VR.compare("FD"))
-                        if (isBigEndian)
-                            std::cout << std::dec << double(((long int)(dat[0]) << 56) +
-                                                            ((long int)(dat[1]) << 48) +
-                                                            ((long int)(dat[2]) << 40) +
-                                                            ((long int)(dat[3]) << 32) +
-                                                            ((long int)(dat[4]) << 24) +
-                                                            ((long int)(dat[5]) << 16) +
-                                                            ((long int)(dat[6]) << 8) +
-                                                            (long int)(dat[7])) << std::hex;
-                        else
-                            std::cout << std::dec << double(((long int)(dat[7]) << 56) +
-                                                            ((long int)(dat[6]) << 48) +
-                                                            ((long int)(dat[5]) << 40) +
-                                                            ((long int)(dat[4]) << 32) +
-                                                            ((long int)(dat[3]) << 24) +
-                                                            ((long int)(dat[2]) << 16) +
-                                                            ((long int)(dat[1]) << 8) +
-                                                            (long int)(dat[0])) << std::hex;
-                    else if (!VR.compare("SL"))
-                        if (isBigEndian)
-                            std::cout << std::dec << (((int)(dat[0]) << 24) +
-                                                      ((int)(dat[1]) << 16) +
-                                                      ((int)(dat[2]) << 8) +
-                                                      (int)(dat[3])) << std::hex;
-                        else
-                            std::cout << std::dec << (((int)(dat[3]) << 24) +
-                                                      ((int)(dat[2]) << 16) +
-                                                      ((int)(dat[1]) << 8) +
-                                                      (int)(dat[0])) << std::hex;
-                    else if (!VR.compare("SS"))
-                        if (isBigEndian)
-                            std::cout << std::dec << (((short int)(dat[0]) << 8) +
-                                                      (short int)(dat[1])) << std::hex;
-                        else
-                            std::cout << std::dec << (((short int)(dat[1]) << 8) +
-                                                      (short int)(dat[0])) << std::hex;
-                    else if (!VR.compare("UL"))
-                        if (isBigEndian)
-                            std::cout << std::dec << (unsigned int)(((int)(dat[0]) << 24) +
-                                                                    ((int)(dat[1]) << 16) +
-                                                                    ((int)(dat[2]) << 8) +
-                                                                    (int)(dat[3])) << std::hex;
-                        else
-                            std::cout << std::dec << (unsigned int)(((int)(dat[3]) << 24) +
-                                                                    ((int)(dat[2]) << 16) +
-                                                                    ((int)(dat[1]) << 8) +
-                                                                    (int)(dat[0])) << std::hex;
-                    else if (!VR.compare("US"))
-                        if (isBigEndian)
-                            std::cout << std::dec << (unsigned short int)(((short int)(dat[0]) << 8) +
-                                      (short int)(dat[1])) << std::hex;
-                        else
-                            std::cout << std::dec << (unsigned short int)(((short int)(dat[1]) << 8) +
-                                      (short int)(dat[0])) << std::hex;
-                    else if (!VR.compare("SQ")) {
-                        std::cout << "Sequence printed as strings below";
-                    }
-                    else {
-                        std::cout << "Unsupported format";
-                    }
-                else
-                    std::cout << "Data larger than " << std::dec
-                              << avoidWarning << std::hex;
-                std::cout << "\n";
-#endif
-#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
-                std::cout << std::dec << "\n";
-#endif
+        data.append(temp);
+        /*============================================================================*/
+        /*REPEAT UNTIL EOF============================================================*/
+    }
+    return l;
+}
 
-                // Save proper transfer syntax for farther parsing
-                if (temp->tag[0] == 0x0002 && temp->tag[1] == 0x0010) {
-                    QString TransSyntax((char *)temp->vf);
-                    if (!TransSyntax.compare("1.2.840.10008.1.2.1")) {
-                        isImplicit = false;
-                        isBigEndian = false;
-                    }
-                    else if (!TransSyntax.compare("1.2.840.10008.1.2.2")) {
-                        isImplicit = false;
-                        isBigEndian = true;
-                    }
-                    else if (!TransSyntax.compare("1.2.840.10008.1.2")) {
-                        isImplicit = true;
-                        isBigEndian = false;
-                    }
-                    else {
-                        std::cout << "Unknown transfer syntax, assuming explicit and little endian\n";
-                        isImplicit = false;
-                        isBigEndian = false;
-                    }
-                }
+SequenceCursor::SequenceCursor(DICOM *owner, const unsigned char *begin, const unsigned char *end) :
+    owner(owner), pos(begin), end(end) {
+}
 
-                // Save slice height for later sorting
-                if (temp->tag[0] == 0x0020 && temp->tag[1] == 0x0032) {
-                    QString tempS = "";
-                    for (unsigned int s = 0; s < temp->vl; s++) {
-                        tempS.append(temp->vf[s]);
-                    }
+/***
+Function: next
+--------------
+Process: Steps over the next item header, finding the item delimiter if the
+         item is of undefined length.  Stops at the sequence delimiter or the
+         end of the sequence's value.
+Output:  true if there is a current item
+***/
+bool SequenceCursor::next() {
+    if (bad || done || pos == end) {
+        return false;
+    }
+    if (end-pos < 8) {
+        // Not a DICOM file
+        bad = true;
+        return false;
+    }
 
-                    z = (tempS.split('\\',QString::SkipEmptyParts)[2]).toDouble();
-                }
-            }
-            else if (nested) {
-#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
-                std::cout << "Nested data\n";
-                for (int i = 0; i < temp->seq.items.size(); i++) {
-                    std::cout << "\t" << std::dec << i+1 << ") ";
-                    unsigned long int avoidWarning = (unsigned long int)MAX_DATA_PRINT;
-                    if (avoidWarning == 0 || temp->seq.items[i]->vl < avoidWarning)
-                        for (unsigned int j = 0; j < temp->seq.items[i]->vl; j++) {
-                            std::cout << std::hex << (*(temp->seq.items[i])).vf[j];
-                        }
-                    else {
-                        std::cout << "Data larger than " << std::dec << avoidWarning << std::hex;
-                    }
+    unsigned int tag, size;
+    tag = ((unsigned int)(pos[3]) << 24) + ((unsigned int)(pos[2]) << 16) +
+          ((unsigned int)(pos[1]) << 8) + (unsigned int)pos[0];
+    size = ((unsigned int)(pos[7]) << 24) + ((unsigned int)(pos[6]) << 16) +
+           ((unsigned int)(pos[5]) << 8) + (unsigned int)pos[4];
+    pos += 8;
 
-                    std::cout << std::hex << "\n";
-                }
-                std::cout << "\n";
-#endif
-                nested = false;
-            }
-            data.append(temp);
-            /*============================================================================*/
-            /*REPEAT UNTIL EOF============================================================*/
+    if (tag == (unsigned int)0xE0DDFFFE) { // sequence delimiter
+        done = true;
+        return false;
+    }
+    else if (size != (unsigned int)0xFFFFFFFF) {
+        // sequence item with defined size
+        if ((unsigned long int)(end-pos) < size) {
+            bad = true;
+            return false;
         }
-        file.close();
-        return l;
+        itemBegin = pos;
+        itemLength = size;
+        pos += size;
     }
-    return 0;
-}
-
-int DICOM::parseSequence(QDataStream *in, QVector <Attribute *> *att) {
-    unsigned char *dat;
-    in->setByteOrder(QDataStream::LittleEndian);
-    Attribute *temp;
-    unsigned int size;
-    QString VR;
-    bool nested = false;
-#if defined(OUTPUT_SQ)
-    std::cout << "\nEntering the parsing loop\n";
-    std::cout.flush();
-#endif
-    while (!in->atEnd()) {
-        nested = false;
-        temp = new Attribute();
-
-        // Get the tag
-        dat = new unsigned char[4];
-        if (in->readRawData((char *)dat,4) != 4) {
-            // Not a DICOM file
-            delete[] dat;
-            delete temp;
-            return 1;
+    else {
+        // sequence item with undefined size
+        const unsigned char *itemEnd = owner->findItemEnd(pos, end);
+        if (itemEnd == NULL || end-itemEnd < 8) {
+            bad = true;
+            return false;
         }
-#if defined(OUTPUT_SQ)
-        std::cout << "Tag ";
-        std::cout.flush();
-#endif
+        itemBegin = pos;
+        itemLength = itemEnd-pos;
+        pos = itemEnd+8; // Skip the item delimiter and its (zero) length
+    }
+    return true;
+}
 
-        temp->tag[0]= ((unsigned short int)(dat[1]) << 8) +
-                      (unsigned short int)dat[0];
-        temp->tag[1]= ((unsigned short int)(dat[3]) << 8) +
-                      (unsigned short int)dat[2];
-        delete[] dat;
-#if defined(OUTPUT_SQ)
-        std::cout << std::hex << temp->tag[0] << "," <<  temp->tag[1] << " | Representation " << std::dec;
-        std::cout.flush();
-#endif
+DataSetCursor SequenceCursor::item() const {
+    return DataSetCursor(owner, itemBegin, itemLength);
+}
 
-        // Get the VR
-        dat = new unsigned char[4];
-        if (!isImplicit || temp->tag[0] == 0x0002) {
-            if (in->readRawData((char *)dat,4) != 4) {
-                // Not a DICOM file
-                delete[] dat;
-                delete temp;
-                return 0;
-            }
+DataSetCursor::DataSetCursor(DICOM *owner, const unsigned char *begin, unsigned long int n) :
+    owner(owner), pos(begin), end(begin+n) {
+}
 
-            VR = QString(dat[0])+dat[1];
-#if defined(OUTPUT_SQ)
-            std::cout << ((unsigned short int)(dat[0]) << 8) + (unsigned short int)dat[1] << " -> " << VR.toStdString() << " | Size ";
-            std::cout.flush();
-#endif
-        }
-        else {
-            VR = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1).vr;
-#if defined(OUTPUT_SQ)
-            std::cout << VR.toStdString() << " (implicit) | Size ";
-            std::cout.flush();
-#endif
-        }
+DataSetCursor::DataSetCursor(DICOM *owner, const SequenceItem *item) :
+    owner(owner), pos(item->vf), end(item->vf+item->vl) {
+}
 
-        // Get size
-        if ((temp->tag[0] != 0x0002 && isImplicit) || (lib->implicitVR.contains(VR))) {
-            if (in->readRawData((char *)dat,4) != 4) { //Reread for size
-                // Not a DICOM file
-                delete[] dat;
-                delete temp;
-                return 0;
-            }
-            temp->vl = ((unsigned int)(dat[3]) << 24) +
-                       ((unsigned int)(dat[2]) << 16) +
-                       ((unsigned int)(dat[1]) << 8) +
-                       (unsigned int)dat[0];
-
-            // We have a sequence
-            if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
-                nested = true;
-                if (!readSequence(in, temp)) {
-                    delete[] dat;
-                    delete temp;
-                    return 0;
-                }
-            }
-            else if (!VR.compare("SQ")) {
-                nested = true;
-                if (!readDefinedSequence(in, temp, temp->vl)) {
-                    delete[] dat;
-                    delete temp;
-                    return 0;
-                }
-            }
-        }
-        else {
-            if (isImplicit && temp->tag[0] != 0x0002)
-                if (in->readRawData((char *)dat,4) != 4) {
-                    // Not a DICOM file
-                    delete[] dat;
-                    delete temp;
-                    return 0;
-                }
+/***
+Function: next
+--------------
+Process: Reads the header of the next data element and skips over its value.
+         A sequence of undefined length has to have its items walked to find
+         where it ends, but they aren't kept.
+Output:  true if there is a current element
+***/
+bool DataSetCursor::next() {
+    if (bad || end-pos < 4) {
+        return false;
+    }
 
-            if (lib->validVR.contains(VR))
-                temp->vl = ((unsigned short int)(dat[3]) << 8) +
-                           (unsigned short int)dat[2];
-            else
-                temp->vl = ((unsigned int)(dat[3]) << 24) +
-                           ((unsigned int)(dat[2]) << 16) +
-                           ((unsigned int)(dat[1]) << 8) +
-                           (unsigned int)dat[0];
-
-            // We have a sequence
-            if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
-                nested = true;
-                if (!readSequence(in, temp)) {
-                    delete[] dat;
-                    delete temp;
-                    return 0;
-                }
-            }
-            else if (!VR.compare("SQ")) {
-                nested = true;
-                if (!readDefinedSequence(in, temp, temp->vl)) {
-                    delete[] dat;
-                    delete temp;
-                    return 0;
-                }
-            }
-        }
+    unsigned long int vl;
+    const unsigned char *p = pos;
+    if (!owner->readElementHeader(p, end, tag, vrCode, vl)) {
+        bad = true;
+        return false;
+    }
+    current.vf = NULL; // Filled in again by value() if it's wanted
 
-        if (temp->vl == (unsigned int)0xFFFFFFFF) {
-            temp->vl = 0;
+    if (vrCode == VR_SQ && vl == (unsigned int)0xFFFFFFFF) {
+        SequenceCursor seq(owner, p, end);
+        while (seq.next());
+        if (seq.failed() || !seq.finished()) {
+            bad = true;
+            return false;
         }
-
-        size = temp->vl;
-#if defined(OUTPUT_SQ)
-        std::cout << temp->vl << " -> " << std::dec << size << "\n";
-#endif
-
-        Reference closest = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1);
-        if (closest.tag[0] == temp->tag[0] && closest.tag[1] == temp->tag[1]) {
-            temp->desc = closest.title;
+        vf = p;
+        vfEnd = seq.position();
+    }
+    else {
+        if (vl == (unsigned int)0xFFFFFFFF) {
+            vl = 0;
         }
-        else {
-            temp->desc = "Unknown Tag";
+        if ((unsigned long int)(end-p) < vl) {
+            bad = true;
+            return false;
         }
+        vf = p;
+        vfEnd = p+vl;
+    }
 
-        delete[] dat;
+    pos = vfEnd;
+    return true;
+}
 
-        // Get data
-        if (!nested) {
-            temp->vf = new unsigned char[size];
-            if (size > 0 && size < (unsigned long int)INT_MAX) {
-                if (in->readRawData((char *)temp->vf,size) != (long int)size) {
-                    // Not a DICOM file
-                    delete temp;
-                    return 0;
-                }
-            }
-            else if (size > 0) { // In case we need to read in more data then the buffer can handle
-                unsigned char *pt = temp->vf;
-                for (int i = 0; (unsigned long int)i < size/((unsigned long int)INT_MAX); i++) {
-                    if (in->readRawData((char *)pt,INT_MAX) != INT_MAX) {
-                        // Not a DICOM file
-                        delete temp;
-                        return 0;
-                    }
-                    pt += sizeof(char)*INT_MAX;
-                }
-            }
+bool DataSetCursor::find(unsigned short int group, unsigned short int element) {
+    while (next())
+        if (is(group, element)) {
+            return true;
         }
+    return false;
+}
 
-#if defined(OUTPUT_SQ)
-        if (!nested) {
-            QString tempS = "";
-            for (unsigned int s = 0; s < temp->vl; s++) {
-                tempS.append(temp->vf[s]);
-            }
-            std::cout << tempS.toStdString() << "\n";
-        }
-        else {
-            for (int i = 0; i < temp->seq.items.size(); i++) {
-                std::cout << i << ") ";
-                for (unsigned int j = 0; j < temp->seq.items[i]->vl; j++) {
-                    std::cout << (*(temp->seq.items[i])).vf[j];
-                }
-                std::cout << "\n";
-            }
-        }
-#endif
+const Attribute &DataSetCursor::value() {
+    if (current.vf == NULL) {
+        current.tag[0] = tag[0];
+        current.tag[1] = tag[1];
+        current.vr = vrCode;
+        current.vf = (unsigned char *)vf;
+        current.vl = vrCode == VR_SQ ? 0 : vfEnd-vf;
+    }
+    return current;
+}
 
-        att->append(temp);
+SequenceCursor DataSetCursor::items() const {
+    if (vrCode != VR_SQ) {
+        return SequenceCursor(owner, vfEnd, vfEnd);
     }
-    return att->size();
+    return SequenceCursor(owner, vf, vfEnd);
 }
 
 double Interface::interp(double x, double x1, double x2, double y1, double y2) {
@@ -978,6 +967,7 @@ Interface::~Interface() {
 
     delete launchButton;
     delete PreviewButton;
+    delete tg43Button;
     delete run;
     delete close;
 
@@ -1152,6 +1142,7 @@ void Interface::createLayout() {
 //Launch/run/peview buttons  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     launchButton = new QPushButton(tr("Launch egs_brachy"));
     PreviewButton = new QPushButton(tr("Preview the Phantom"));
+    tg43Button = new QPushButton(tr("Create a TG-43 phantom to compare"));
     run = new QPushButton(tr("Create input files"));
 
     close = new QPushButton(tr("Close"));
@@ -1165,17 +1156,23 @@ void Interface::createLayout() {
                              tr("created by selecting the \'Create Input Files\'\n") +
                              tr("button"));
 
+    tg43Button->setToolTip(tr("Writes a water (TG-43) phantom next to the egsphant,\n") +
+                           tr("using the same contours and priorities. Button is\n") +
+                           tr("enabled after a non TG-43 phantom has been created."));
+
     run->setToolTip(tr("Button is enabled once DICOM files are parsed"));
 
     launchButton->setEnabled(0);
     trim_button->setEnabled(0);
     PreviewButton->setEnabled(0);
+    tg43Button->setEnabled(0);
     run->setEnabled(0);
 
     outLayout = new QGridLayout();
     outLayout->addWidget(PreviewButton, 1, 0, 1, 1); //want to make span multiple columns
     outLayout->addWidget(run, 0, 0, 1, 1);
     outLayout->addWidget(launchButton, 2, 0, 1, 1);
+    outLayout->addWidget(tg43Button, 3, 0, 1, 1);
 
     outFrame = new QGroupBox(tr("Execution"));
     outFrame->setLayout(outLayout);
@@ -1598,6 +1595,9 @@ void Interface::connectLayout() {
     connect(PreviewButton, SIGNAL(clicked()),
             this, SLOT(show_preview()));
 
+    connect(tg43Button, SIGNAL(clicked()),
+            this, SLOT(create_tg43_comparison()));
+
 
 }
 
@@ -1945,7 +1945,7 @@ void Interface::read_3ddose_output_metrics() {
                 }
 
             calc_metrics->get_data(dose->x, dose->y, dose->z, dose->cx, dose->cy, dose->cz, phant.contour,
-                                   dose->val, dose->err, names);
+                                   dose->val, dose->err, names, membership);
 
             connect(calc_metrics, SIGNAL(closed()), this, SLOT(closed_metrics()));
 
@@ -2170,6 +2170,7 @@ void Interface::load_dicom() {
 
     PreviewButton->setDisabled(true);
     launchButton->setDisabled(true);
+    tg43Button->setDisabled(true);
     run->setDisabled(true);
     this->setDisabled(true);
 
@@ -2221,12 +2222,14 @@ void Interface::load_dicom() {
         this->setDisabled(true);
 
         get_data = new DICOM;
-        get_data ->extract(tempS2);
+        get_data ->extract(tempS2, dir_path);
 
         //-------------------------
         //Initialize the phantom -if all data has been loaded
         //-------------------------
         if (get_data->loadedct) {
+            ctPhant.nx = 0; // Nothing resampled from this CT yet
+
             // Assume first slice matches the rest and set x, y, and z boundaries
             phant.nx = get_data->xPix[0];
             phant.ny = get_data->yPix[0];
@@ -2235,20 +2238,8 @@ void Interface::load_dicom() {
             phant.y.fill(0,phant.ny+1);
             phant.z.fill(0,phant.nz+1);
 
-            {
-                QVector <char> mz(phant.nz, 0);
-                QVector <QVector <char> > my(phant.ny, mz);
-                QVector <QVector <QVector <char> > > mx(phant.nx, my);
-                phant.m = mx;
-                QVector <double> dz(phant.nz, 0);
-                QVector <QVector <double> > dy(phant.ny, dz);
-                QVector <QVector <QVector <double> > > dx(phant.nx, dy);
-                phant.d = dx;
-                QVector <int> sz(phant.nz, 0);
-                QVector <QVector <int> > sy(phant.ny, sz);
-                QVector <QVector <QVector <int> > > sx(phant.nx, sy);
-                phant.contour = sx;
-            }
+            phant.allocate(true);
+            membership = StructMembership(); // Made for the previous phantom
 
             // Define xy bound values, still assuming first slice matches the rest
             for (int i = 0; i <= phant.nx; i++) {
@@ -2324,7 +2315,102 @@ void Interface::load_dicom() {
 }
 
 
-void DICOM::extract(QVector<QString> tempS2) {
+const char *DicomIndex::fileName = ".egs_brachy_gui_index";
+
+// Bumped whenever DicomIndexEntry changes, older indices are then just rebuilt
+#define DICOM_INDEX_MAGIC 0x45424749
+#define DICOM_INDEX_VERSION 3
+
+/***
+Function: cachePath
+-------------------
+Process: Where the index of dir is kept, named after a hash of its absolute
+         path so the patient directory itself is never written to
+***/
+QString DicomIndex::cachePath(QString dir) {
+    QString hash = QCryptographicHash::hash(QDir(dir).absolutePath().toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/dicom_index/" + hash;
+}
+
+/***
+Function: load
+--------------
+Process: Reads the index of dir from the cache.  An index that is missing,
+         from another version or damaged is treated as empty, so every file
+         just gets parsed again.
+***/
+QHash <QString, DicomIndexEntry> DicomIndex::load(QString dir) {
+    QHash <QString, DicomIndexEntry> entries;
+    QFile file(cachePath(dir));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return entries;
+    }
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_0);
+    quint32 magic, version, n;
+    in >> magic >> version >> n;
+    if (in.status() != QDataStream::Ok || magic != DICOM_INDEX_MAGIC || version != DICOM_INDEX_VERSION) {
+        return entries;
+    }
+
+    entries.reserve(n);
+    for (quint32 i = 0; i < n && in.status() == QDataStream::Ok; i++) {
+        QString key;
+        DicomIndexEntry e;
+        CTSlice &g = e.geometry;
+        in >> key >> e.size >> e.mtime >> e.isDicom >> e.modality >> e.seriesUID >> e.sopUID
+           >> e.z >> e.pixelOffset >> e.pixelLength >> e.numFrames >> e.bigEndian >> e.enhanced
+           >> g.spacing[0] >> g.spacing[1] >> g.thickness >> g.pos[0] >> g.pos[1] >> g.pos[2]
+           >> g.rows >> g.cols >> g.m >> g.b >> g.hasSpacing >> g.hasThickness >> g.hasPos
+           >> g.hasRows >> g.hasCols >> g.hasSlope >> g.hasIntercept;
+        entries.insert(key, e);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        std::cout << "The DICOM index " << file.fileName().toStdString() << " is damaged, ignoring it.\n";
+        entries.clear();
+    }
+    return entries;
+}
+
+/***
+Function: save
+--------------
+Process: Writes the index of dir into the cache.  QSaveFile is used so a
+         crash never leaves half an index.
+Output:  false if it couldn't be written
+***/
+bool DicomIndex::save(QString dir, const QHash <QString, DicomIndexEntry> &entries) {
+    QString path = cachePath(dir);
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QSaveFile file(path);
+    if (file.open(QIODevice::WriteOnly)) {
+        QDataStream out(&file);
+        out.setVersion(QDataStream::Qt_5_0);
+        out << quint32(DICOM_INDEX_MAGIC) << quint32(DICOM_INDEX_VERSION) << quint32(entries.size());
+        for (QHash <QString, DicomIndexEntry>::const_iterator it = entries.constBegin(); it != entries.constEnd(); it++) {
+            const DicomIndexEntry &e = it.value();
+            const CTSlice &g = e.geometry;
+            out << it.key() << e.size << e.mtime << e.isDicom << e.modality << e.seriesUID << e.sopUID
+                << e.z << e.pixelOffset << e.pixelLength << e.numFrames << e.bigEndian << e.enhanced
+                << g.spacing[0] << g.spacing[1] << g.thickness << g.pos[0] << g.pos[1] << g.pos[2]
+                << g.rows << g.cols << g.m << g.b << g.hasSpacing << g.hasThickness << g.hasPos
+                << g.hasRows << g.hasCols << g.hasSlope << g.hasIntercept;
+        }
+
+        if (file.commit()) {
+            return true;
+        }
+    }
+
+    std::cout << "Could not save the DICOM index for " << dir.toStdString() << ".\n";
+    return false;
+}
+
+
+void DICOM::extract(QVector<QString> tempS2, QString indexDir) {
     create_progress_bar_dicom();
     setup_progress_bar_dicom("Parsing DICOM Files", "");
 
@@ -2336,29 +2422,157 @@ void DICOM::extract(QVector<QString> tempS2) {
     // PARSE INPUT AND PUT INTO THE CORRECT VECTOR                //
     // ---------------------------------------------------------- //
 
-    double increment = 1000000000/(2*tempS2.size());
+    // Older versions kept the index alongside the data, it isn't one of the files
+    for (int i = 0; i < tempS2.size(); i++)
+        if (QFileInfo(tempS2[i]).fileName() == DicomIndex::fileName) {
+            tempS2.remove(i--);
+        }
+
+    double increment = 1000000000/(2*qMax(1, tempS2.size()));
     updateProgress(increment);
 
 
-    database dat;
     QVector <DICOM *> dicom;
     QVector <DICOM *> dicomExtra;
     DICOM *dicomPlan = NULL;
     DICOM *dicomStruct = NULL;
+    QVector <DICOM *> parsed; // Every file that parsed, they are unmapped once extracted
 
+    // Files with the same size and modification time as when they were last
+    // indexed aren't parsed here, only the ones that end up being used are
+    QDir root(indexDir);
+    QHash <QString, DicomIndexEntry> index;
+    if (!indexDir.isEmpty()) {
+        index = DicomIndex::load(indexDir);
+    }
+
+    QVector <QString> keys(tempS2.size());
+    QVector <DicomIndexEntry> entries(tempS2.size());
+    QVector <bool> cached(tempS2.size(), false);
+    int numCached = 0;
     for (int i = 0; i < tempS2.size(); i++) {
-        QString path(tempS2[i]);
+        QFileInfo info(tempS2[i]);
+        keys[i] = indexDir.isEmpty() ? tempS2[i] : root.relativeFilePath(tempS2[i]);
+
+        QHash <QString, DicomIndexEntry>::const_iterator it = index.constFind(keys[i]);
+        if (it != index.constEnd() && it->size == info.size() && it->mtime == info.lastModified().toMSecsSinceEpoch()) {
+            entries[i] = it.value();
+            cached[i] = true;
+            numCached++;
+        }
+        else {
+            entries[i].size = info.size();
+            entries[i].mtime = info.lastModified().toMSecsSinceEpoch();
+        }
+    }
 
-        DICOM *d = new DICOM(&dat);
-        if (d->parse(path)) {
-            std::cout << std::dec << "Successfully parsed " << path.toStdString() << ".\n";
-            dicomExtra.append(d);
+    // The DICOM objects are widgets so they have to be made here on the GUI
+    // thread, but the files are independent so they are parsed on the pool
+    QVector <DICOM *> candidates(tempS2.size(), NULL);
+    QVector <int> parseResult(tempS2.size(), 0);
+    QVector <int> fileIndex;
+    for (int i = 0; i < tempS2.size(); i++) {
+        if (!cached[i]) {
+            candidates[i] = new DICOM();
+            fileIndex.append(i);
+        }
+        else if (entries[i].isDicom) {
+            candidates[i] = new DICOM();
+            candidates[i]->path = tempS2[i];
+            candidates[i]->modality = entries[i].modality;
+            candidates[i]->seriesUID = entries[i].seriesUID;
+            candidates[i]->sopUID = entries[i].sopUID;
+            candidates[i]->z = entries[i].z;
+            candidates[i]->pixelOffset = entries[i].pixelOffset;
+            candidates[i]->pixelLength = entries[i].pixelLength;
+            candidates[i]->numFrames = entries[i].numFrames;
+            candidates[i]->isBigEndian = entries[i].bigEndian;
+            candidates[i]->enhanced = entries[i].enhanced;
+            candidates[i]->geometry = entries[i].geometry;
+            candidates[i]->geometry.source = candidates[i];
+            candidates[i]->fromIndex = true;
+        }
+    }
+
+    {
+        DICOM **cand = candidates.data();
+        int *result = parseResult.data();
+        const QString *files = tempS2.constData();
+        std::atomic<int> done(0);
+        waitForWorkers(QtConcurrent::map(fileIndex, [cand, result, files, &done](int i) {
+            result[i] = cand[i]->parse(files[i], true);
+            if (result[i] && cand[i]->modality == "CT") {
+                cand[i]->readGeometry();
+            }
+            done++;
+        }), &done, increment*tempS2.size()/qMax(1, fileIndex.size()));
+    }
+
+    // Keep the file order (and log) the same as a serial parse
+    for (int i = 0; i < tempS2.size(); i++) {
+        if (cached[i]) {
+            if (candidates[i] != NULL) {
+                dicomExtra.append(candidates[i]);
+                parsed.append(candidates[i]);
+            }
+        }
+        else if (parseResult[i]) {
+            std::cout << std::dec << "Successfully parsed " << tempS2[i].toStdString() << ".\n";
+            dicomExtra.append(candidates[i]);
+            parsed.append(candidates[i]);
+
+            entries[i].isDicom = true;
+            entries[i].modality = candidates[i]->modality;
+            entries[i].seriesUID = candidates[i]->seriesUID;
+            entries[i].sopUID = candidates[i]->sopUID;
+            entries[i].z = candidates[i]->z;
+            entries[i].pixelOffset = candidates[i]->pixelOffset;
+            entries[i].pixelLength = candidates[i]->pixelLength;
+            entries[i].numFrames = candidates[i]->numFrames;
+            entries[i].bigEndian = candidates[i]->isBigEndian;
+            entries[i].enhanced = candidates[i]->enhanced;
+            entries[i].geometry = candidates[i]->geometry;
+            entries[i].geometry.source = NULL;
         }
         else {
-            std::cout << "Unsuccessfully parsed " << path.toStdString() << "\n";
+            std::cout << "Unsuccessfully parsed " << tempS2[i].toStdString() << "\n";
+            delete candidates[i];
+        }
+    }
+
+    if (numCached > 0) {
+        std::cout << "Skipped parsing " << numCached << " files that are unchanged since they were indexed.\n";
+    }
+
+    // Rewrite the index if anything was parsed or any file has gone away
+    if (!indexDir.isEmpty() && (fileIndex.size() > 0 || index.size() != tempS2.size())) {
+        QHash <QString, DicomIndexEntry> updated;
+        updated.reserve(tempS2.size());
+        for (int i = 0; i < tempS2.size(); i++) {
+            updated.insert(keys[i], entries[i]);
         }
+        DicomIndex::save(indexDir, updated);
+    }
+
+    // The same instance is sometimes exported twice (say a copy in another
+    // subdirectory), only keep the first so it isn't decoded twice
+    {
+        QSet <QString> seen;
+        for (int i = 0; i < dicomExtra.size(); i++) {
+            if (dicomExtra[i]->sopUID.isEmpty()) {
+                continue;
+            }
 
-        updateProgress(increment);
+            if (seen.contains(dicomExtra[i]->sopUID)) {
+                std::cout << "Skipping " << dicomExtra[i]->path.toStdString() << ", it is a duplicate of SOP instance "
+                          << dicomExtra[i]->sopUID.toStdString() << ".\n";
+                dicomExtra[i]->releaseData();
+                dicomExtra.remove(i--);
+            }
+            else {
+                seen.insert(dicomExtra[i]->sopUID);
+            }
+        }
     }
 
 
@@ -2382,27 +2596,17 @@ void DICOM::extract(QVector<QString> tempS2) {
             ctFlag = false;
             rsFlag = false;
             rpFlag = false;
-            for (int j = 0; j < dicomExtra[i]->data.size(); j++) {
-                if (dicomExtra[i]->data[j]->tag[0] == 0x0008 && dicomExtra[i]->data[j]->tag[1] == 0x0060) {
-                    QString temp = "";
-                    for (unsigned int s = 0; s < dicomExtra[i]->data[j]->vl; s++) {
-                        temp.append(dicomExtra[i]->data[j]->vf[s]);
-                    }
-
-                    temp = temp.trimmed();
-                    if (temp =="CT") {
-                        ctFlag = true;
-                        loadedct = true;
-                    }
-                    if (temp == "RTSTRUCT") {
-                        loadedstruct = true;
-                        rsFlag = true;
-                    }
-                    if (temp == "RTPLAN") {
-                        loadedplan = true;
-                        rpFlag = true;
-                    }
-                }
+            if (dicomExtra[i]->modality == "CT") {
+                ctFlag = true;
+                loadedct = true;
+            }
+            if (dicomExtra[i]->modality == "RTSTRUCT") {
+                loadedstruct = true;
+                rsFlag = true;
+            }
+            if (dicomExtra[i]->modality == "RTPLAN") {
+                loadedplan = true;
+                rpFlag = true;
             }
 
             if (ctFlag) {
@@ -2430,6 +2634,118 @@ void DICOM::extract(QVector<QString> tempS2) {
             std::cout<<"Warning: Parsed multiple DICOM plan files." <<count_rp <<" \n" ;
         }
 
+        // Slices of different CT series (a scout, a second scan) would be
+        // interleaved in z, so when there are several ask which one to load.
+        // The one with the most slices (an enhanced CT counts each frame) is
+        // the default, and cancelling keeps every series as before.
+        if (dicom.size() > 0) {
+            QMap <QString, int> seriesCount;
+            for (int i = 0; i < dicom.size(); i++) {
+                seriesCount[dicom[i]->seriesUID] += dicom[i]->numFrames;
+            }
+
+            if (seriesCount.size() > 1) {
+                QStringList items;
+                int most = 0, best = 0;
+                for (QMap <QString, int>::const_iterator it = seriesCount.constBegin(); it != seriesCount.constEnd(); it++) {
+                    if (it.value() > most) {
+                        most = it.value();
+                        best = items.size();
+                    }
+                    items << tr("%1 slices, series %2").arg(it.value()).arg(it.key());
+                }
+
+                bool ok;
+                QString item = QInputDialog::getItem(this, tr("Select the CT series"),
+                                                     tr("The directory holds %1 CT series, select the one to load:").arg(seriesCount.size()),
+                                                     items, best, false, &ok);
+                if (ok && !item.isEmpty()) {
+                    QString series = seriesCount.keys()[items.indexOf(item)];
+                    std::cout << "Found " << seriesCount.size() << " CT series, using " << series.toStdString()
+                              << " and dropping the slices of the others.\n";
+                    for (int i = 0; i < dicom.size(); i++) {
+                        if (dicom[i]->seriesUID != series) {
+                            dicom[i]->releaseData();
+                            dicom.remove(i--);
+                        }
+                    }
+                }
+                else {
+                    std::cout << "Warning: Found " << seriesCount.size() << " CT series, loading the slices of all of them.\n";
+                }
+            }
+        }
+
+        // Nothing is needed from the remaining files, so unmap them right away
+        for (int i = 0; i < dicomExtra.size(); i++) {
+            dicomExtra[i]->releaseData();
+        }
+
+        // Files that were only looked up in the index are opened now that it
+        // is known they will be used.  Single frame CT slices are decoded
+        // straight from the indexed geometry and only need mapping, the rest
+        // are parsed, as is one slice for the patient and study details.
+        QVector <DICOM *> unparsed;
+        QVector <bool> fullParse;
+        for (int i = 0; i < dicom.size(); i++)
+            if (dicom[i]->fromIndex) {
+                unparsed.append(dicom[i]);
+                fullParse.append(i == 0 || dicom[i]->numFrames != 1 || dicom[i]->enhanced);
+            }
+        if (dicomPlan != NULL && dicomPlan->fromIndex) {
+            unparsed.append(dicomPlan);
+            fullParse.append(true);
+        }
+        if (dicomStruct != NULL && dicomStruct->fromIndex) {
+            unparsed.append(dicomStruct);
+            fullParse.append(true);
+        }
+
+        if (unparsed.size() > 0) {
+            QVector <int> result(unparsed.size(), 0);
+            {
+                DICOM **cand = unparsed.data();
+                const bool *full = fullParse.constData();
+                int *res = result.data();
+                std::atomic<int> done(0);
+                QVector <int> which(unparsed.size());
+                for (int i = 0; i < which.size(); i++) {
+                    which[i] = i;
+                }
+                waitForWorkers(QtConcurrent::map(which, [cand, full, res, &done](int i) {
+                    if (full[i]) {
+                        res[i] = cand[i]->parse(cand[i]->path, true);
+                        if (res[i] && cand[i]->modality == "CT") {
+                            cand[i]->readGeometry();
+                        }
+                    }
+                    else {
+                        res[i] = cand[i]->openMapping();
+                    }
+                    done++;
+                }), &done, 0);
+            }
+
+            // Only possible if a file was rewritten without its size or time changing
+            for (int i = 0; i < unparsed.size(); i++)
+                if (!result[i]) {
+                    std::cout << "Unsuccessfully parsed " << unparsed[i]->path.toStdString() << "\n";
+                    unparsed[i]->releaseData();
+                    if (unparsed[i] == dicomPlan) {
+                        dicomPlan = NULL;
+                        loadedplan = false;
+                    }
+                    else if (unparsed[i] == dicomStruct) {
+                        dicomStruct = NULL;
+                        loadedstruct = false;
+                    }
+                    else {
+                        dicom.removeOne(unparsed[i]);
+                        loadedct = dicom.size() > 0;
+                    }
+                }
+        }
+
 
 
         progress2->setValue(1000000000);
@@ -2449,114 +2765,151 @@ void DICOM::extract(QVector<QString> tempS2) {
             duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
             std::cout << "Sorted the " << dicom.size() << " DICOM CT files along z.  Time elapsed is " << duration << " s.\n";
 
-            numZ = dicom.size(); //variab needed for initializing phant
-            if (numZ > 0) {
-                extract_data_for_dicomdose(dicom[0]);
-            }
+            // Slices decoded from the index alone have no header data
+            for (int i = 0; i < dicom.size(); i++)
+                if (dicom[i]->data.size() > 0) {
+                    extract_data_for_dicomdose(dicom[i]);
+                    break;
+                }
 
+            // Gather every slice first, an enhanced CT file holds a whole
+            // stack of them as frames described by its functional groups
+            QVector <CTSlice> slices;
+            bool multiFrame = false;
             for (int i = 0; i < dicom.size(); i++) {
-                rescaleFlag = 0;
-                for (int j = 0; j < dicom[i]->data.size(); j++) {
-                    // Pixel Spacing (Decimal String), row spacing and then column spacing (in mm)
-                    if (dicom[i]->data[j]->tag[0] == 0x0028 && dicom[i]->data[j]->tag[1] == 0x0030) {
-                        xySpacing.resize(xySpacing.size()+1);
-                        xySpacing.last().resize(2);
-
-                        QString temp = "";
-                        for (unsigned int s = 0; s < dicom[i]->data[j]->vl; s++) {
-                            temp.append(dicom[i]->data[j]->vf[s]);
-                        }
+                CTSlice file = dicom[i]->geometry;
+                file.source = dicom[i];
+                if (dicom[i]->pixelOffset >= 0 && dicom[i]->mapData != NULL) {
+                    file.pixels = dicom[i]->mapData+dicom[i]->pixelOffset;
+                    file.length = dicom[i]->pixelLength;
+                }
 
-                        xySpacing.last()[0] = (temp.split('\\',QString::SkipEmptyParts)[0]).toDouble();
-                        xySpacing.last()[1] = (temp.split('\\',QString::SkipEmptyParts)[1]).toDouble();
-                    } // Slice Thickness (Decimal String, in mm)
-                    else if (dicom[i]->data[j]->tag[0] == 0x0018 && dicom[i]->data[j]->tag[1] == 0x0050) {
-                        QString temp = "";
-                        for (unsigned int s = 0; s < dicom[i]->data[j]->vl; s++) {
-                            temp.append(dicom[i]->data[j]->vf[s]);
-                        }
+                if (dicom[i]->numFrames == 1 && !dicom[i]->enhanced) {
+                    slices.append(file);
+                    continue;
+                }
 
-                        zSpacing.append(temp.toDouble());
-                    } // Image Position [x,y,z] (Decimal String, in mm)
-                    else if (dicom[i]->data[j]->tag[0] == 0x0020 && dicom[i]->data[j]->tag[1] == 0x0032) {
-                        imagePos.resize(imagePos.size()+1);
-                        imagePos.last().resize(3);
+                const Attribute *shared = NULL, *perFrame = NULL;
+                dicom[i]->readGeometry(&shared, &perFrame);
 
-                        QString temp = "";
-                        for (unsigned int s = 0; s < dicom[i]->data[j]->vl; s++) {
-                            temp.append(dicom[i]->data[j]->vf[s]);
-                        }
+                // Enhanced CT, the frames follow each other in the pixel data
+                // so each one is decoded straight out of the mapping
+                multiFrame = true;
+                if (shared != NULL && shared->seq.items.size() > 0) {
+                    dicom[i]->readFunctionalGroups(shared->seq.items[0], file);
+                }
+                unsigned long int frameBytes = 2*(unsigned long int)file.rows*file.cols;
+                for (int f = 0; f < dicom[i]->numFrames; f++) {
+                    CTSlice frame = file;
+                    frame.frame = f;
+                    if (perFrame != NULL && f < perFrame->seq.items.size()) {
+                        dicom[i]->readFunctionalGroups(perFrame->seq.items[f], frame);
+                    }
+                    if (frame.pixels != NULL) {
+                        unsigned long int start = qMin(file.length, f*frameBytes);
+                        frame.pixels += start;
+                        frame.length = qMin(frameBytes, file.length-start);
+                    }
+                    slices.append(frame);
+                }
+                std::cout << "Found enhanced CT " << dicom[i]->path.toStdString() << " with " << dicom[i]->numFrames << " frames.\n";
+            }
 
-                        imagePos.last()[0] = (temp.split('\\',QString::SkipEmptyParts)[0]).toDouble();
-                        imagePos.last()[1] = (temp.split('\\',QString::SkipEmptyParts)[1]).toDouble();
-                        imagePos.last()[2] = (temp.split('\\',QString::SkipEmptyParts)[2]).toDouble();
-                    } // Rows
-                    else if (dicom[i]->data[j]->tag[0] == 0x0028 && dicom[i]->data[j]->tag[1] == 0x0010) {
-                        if (dicom[i]->isBigEndian)
-                            xPix.append((unsigned short int)(((short int)(dicom[i]->data[j]->vf[0]) << 8) +
-                                                             (short int)(dicom[i]->data[j]->vf[1])));
-                        else
-                            xPix.append((unsigned short int)(((short int)(dicom[i]->data[j]->vf[1]) << 8) +
-                                                             (short int)(dicom[i]->data[j]->vf[0])));
-                    } // Columns
-                    else if (dicom[i]->data[j]->tag[0] == 0x0028 && dicom[i]->data[j]->tag[1] == 0x0011) {
-                        if (dicom[i]->isBigEndian)
-                            yPix.append((unsigned short int)(((short int)(dicom[i]->data[j]->vf[0]) << 8) +
-                                                             (short int)(dicom[i]->data[j]->vf[1])));
-                        else
-                            yPix.append((unsigned short int)(((short int)(dicom[i]->data[j]->vf[1]) << 8) +
-                                                             (short int)(dicom[i]->data[j]->vf[0])));
-                    } // Rescale HU slope (assuming type is HU)
-                    else if (dicom[i]->data[j]->tag[0] == 0x0028 && dicom[i]->data[j]->tag[1] == 0x1053) {
-                        QString temp = "";
-                        for (unsigned int s = 0; s < dicom[i]->data[j]->vl; s++) {
-                            temp.append(dicom[i]->data[j]->vf[s]);
-                        }
+            // Single frame files are already in order, frames have to be
+            // sorted by their own positions
+            if (multiFrame) {
+                std::stable_sort(slices.begin(), slices.end(), [](const CTSlice &a, const CTSlice &b) {
+                    return (a.hasPos ? a.pos[2] : 0) < (b.hasPos ? b.pos[2] : 0);
+                });
+            }
 
-                        rescaleM = temp.toDouble();
-                        rescaleFlag++;
-                    } // Rescale HU intercept (assuming type is HU)
-                    else if (dicom[i]->data[j]->tag[0] == 0x0028 && dicom[i]->data[j]->tag[1] == 0x1052) {
-                        QString temp = "";
-                        for (unsigned int s = 0; s < dicom[i]->data[j]->vl; s++) {
-                            temp.append(dicom[i]->data[j]->vf[s]);
-                        }
+            numZ = slices.size(); //variab needed for initializing phant
 
-                        rescaleB = temp.toDouble();
-                        rescaleFlag++;
-                    } // HU values (assuming 2-bytes as I have yet to encounter anything different, ie, assumes TAG (0028,0100) = 16)
-                    else if (dicom[i]->data[j]->tag[0] == 0x7fe0 && dicom[i]->data[j]->tag[1] == 0x0010) {
-                        HU.resize(HU.size()+1);
-                        if (HU.size() == xPix.size() && HU.size() == yPix.size()) {
-                            HU.last().resize(yPix.last());
-                            for (unsigned int k = 0; k < yPix.last(); k++) {
-                                HU.last()[k].resize(xPix.last());
-                            }
+            QVector <PixelJob> pixelJobs;
+            int pixelSlices = 0;
 
-                            short int temp;
-                            if (dicom[i]->isBigEndian)
-                                for (unsigned int s = 0; s < dicom[i]->data[j]->vl; s+=2) {
-                                    temp  = (dicom[i]->data[j]->vf[s+1]);
-                                    temp += (short int)(dicom[i]->data[j]->vf[s]) << 8;
+            for (int i = 0; i < slices.size(); i++) {
+                if (slices[i].hasSpacing) {
+                    xySpacing.resize(xySpacing.size()+1);
+                    xySpacing.last().resize(2);
+                    xySpacing.last()[0] = slices[i].spacing[0];
+                    xySpacing.last()[1] = slices[i].spacing[1];
+                }
+                if (slices[i].hasThickness) {
+                    zSpacing.append(slices[i].thickness);
+                }
+                if (slices[i].hasPos) {
+                    imagePos.resize(imagePos.size()+1);
+                    imagePos.last().resize(3);
+                    for (int l = 0; l < 3; l++) {
+                        imagePos.last()[l] = slices[i].pos[l];
+                    }
+                }
+                if (slices[i].hasRows) {
+                    xPix.append(slices[i].rows);
+                }
+                if (slices[i].hasCols) {
+                    yPix.append(slices[i].cols);
+                }
+                if (slices[i].pixels != NULL) {
+                    pixelSlices++;
+                    if (pixelSlices == xPix.size() && pixelSlices == yPix.size()) {
+                        // Decoded below once the volume has been allocated
+                        PixelJob job;
+                        job.source = slices[i].source;
+                        job.slice = pixelSlices-1;
+                        job.pixels = slices[i].pixels;
+                        job.length = slices[i].length;
+                        job.nx = xPix.last();
+                        job.ny = yPix.last();
+                        job.bigEndian = slices[i].source->isBigEndian;
+                        job.rescale = slices[i].hasSlope && slices[i].hasIntercept;
+                        job.m = slices[i].m;
+                        job.b = slices[i].b;
+                        pixelJobs.append(job);
+                    }
+                }
+            }
 
-                                    HU.last()[int(int(s/2)/xPix.last())][int(s/2)%xPix.last()] =
-                                        rescaleFlag == 2 ? rescaleM*temp+rescaleB : temp;
-                                }
-                            else
-                                for (unsigned int s = 0; s < dicom[i]->data[j]->vl; s+=2) {
-                                    temp  = (dicom[i]->data[j]->vf[s]);
-                                    temp += (short int)(dicom[i]->data[j]->vf[s+1]) << 8;
+            // Every slice goes in one block sized by the first slice, the
+            // phantom is built on that grid so odd sized slices can't be used
+            if (pixelJobs.size() > 0) {
+                HU.allocate(xPix[0], yPix[0], slices.size());
+            }
+            else {
+                HU.clear();
+            }
 
-                                    HU.last()[int(int(s/2)/xPix.last())][int(s/2)%xPix.last()] =
-                                        rescaleFlag == 2 ? rescaleM*temp+rescaleB : temp;
-                                }
-                        }
+            for (int i = pixelJobs.size()-1; i >= 0; i--)
+                if (pixelJobs[i].nx != HU.nx || pixelJobs[i].ny != HU.ny) {
+                    std::cout << "Slice " << pixelJobs[i].source->path.toStdString() << " is " << pixelJobs[i].nx << "x" << pixelJobs[i].ny
+                              << " instead of " << HU.nx << "x" << HU.ny << ", its HU data will be left as 0.\n";
+                    if (pixelJobs[i].source->numFrames == 1) {
+                        pixelJobs[i].source->releaseData();
                     }
+                    pixelJobs.remove(i);
                 }
-                updateProgress(increment);
+
+            // The slices don't share any data, so decode them all on the pool,
+            // unmapping each single frame file as soon as its pixels are in HU.
+            // Enhanced CT files are shared by all their frames and are only
+            // unmapped once every frame is done.
+            {
+                std::atomic<int> done(0);
+                waitForWorkers(QtConcurrent::map(pixelJobs, [this, &done](const PixelJob &job) {
+                    decodeSlice(job);
+                    if (job.source->numFrames == 1) {
+                        job.source->releaseData();
+                    }
+                    done++;
+                }), &done, increment*dicom.size()/qMax(1, pixelJobs.size()));
             }
+            for (int i = 0; i < dicom.size(); i++)
+                if (dicom[i]->numFrames > 1) {
+                    dicom[i]->releaseData();
+                }
 
-            if (HU.size() > 0) {
+            if (!HU.isEmpty()) {
                 duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
                 std::cout << "Extracted all HU data for the " << xPix[0] << "x" << yPix[0] << " slices.  Time elapsed is " << duration << " s.\n";
             }
@@ -2570,11 +2923,7 @@ void DICOM::extract(QVector<QString> tempS2) {
         // FETCH RS FILE STRUCTURE DATA                               //
         // ---------------------------------------------------------- //
         if (loadedstruct) {
-            // Data for parsing singly and doubly nested SQ sets and point data strings
-            QVector <Attribute *> *att, *att2;
             QVector<QString> ROI_type;
-            QByteArray tempData, tempData2;
-            QStringList pointData;
             QVector<int> structNum_roiSequence;
 
             QVector <QVector <cont>> contourPoints;
@@ -2582,157 +2931,111 @@ void DICOM::extract(QVector<QString> tempS2) {
             for (int j = 0; j < dicomStruct->data.size(); j++) {
                 //Save data to dicomHeader (used to generate the dicom dose file)
                 if (dicomStruct->data[j]->tag[0] == 0x0008 && dicomStruct->data[j]->tag[1] == 0x0016) { //SOP Class UID
-                    QString temp = "";
-                    for (unsigned int s = 0; s < dicomStruct->data[j]->vl; s++) {
-                        temp.append(dicomStruct->data[j]->vf[s]);
-                    }
+                    QString temp = dicomStruct->data[j]->asString();
                     dicomHeader.insert("00081150", temp); //A reference to the struct UID
 
                 }
                 else if (dicomStruct->data[j]->tag[0] == 0x0008 && dicomStruct->data[j]->tag[1] == 0x0018) {   //SOP Instance UID
-                    QString temp = "";
-                    for (unsigned int s = 0; s < dicomStruct->data[j]->vl; s++) {
-                        temp.append(dicomStruct->data[j]->vf[s]);
-                    }
+                    QString temp = dicomStruct->data[j]->asString();
                     dicomHeader.insert("00081155", temp); //A reference to the struct UID
                 } // Structure info (looking for structure names and nums)
                 else if (dicomStruct->data[j]->tag[0] == 0x3006 && dicomStruct->data[j]->tag[1] == 0x0020) {
                     for (int k = 0; k < dicomStruct->data[j]->seq.items.size(); k++) {
-                        tempData = QByteArray((char *)dicomStruct->data[j]->seq.items[k]->vf,dicomStruct->data[j]->seq.items[k]->vl);
-                        QDataStream dataStream(tempData);
+                        DataSetCursor att(dicomStruct, dicomStruct->data[j]->seq.items[k]);
 
-                        att = new QVector <Attribute *>;
-                        if (!dicomStruct->parseSequence(&dataStream, att)) {
+                        QString tempS = ""; // Get the name
+                        int tempI = 0; // Get the number
+                        while (att.next()) {
+                            if (att.is(0x3006, 0x0026)) {
+                                tempS += att.value().asString();
+                            }
+                            else if (att.is(0x3006, 0x0022)) {
+                                tempI = att.value().asInt();
+                            }
+                        }
+                        if (att.failed()) {
                             std::cout << "Failed to parse sequence data for tag (3006,0020), contour structure info \n";
                         }
 
-                        QString tempS = ""; // Get the name
-                        QString tempI = ""; // Get the number
-                        for (int l = 0; l < att->size(); l++) {
-                            if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0026)
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempS.append(att->at(l)->vf[s]);
-                                }
-                            else if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0022)
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempI.append(att->at(l)->vf[s]);
-                                }
-                        }
-
                         structName.append(tempS.trimmed());
-                        structNum.append(tempI.toInt());
-                        structLookup[tempI.toInt()] = structName.size()-1;
-
-                        for (int l = 0; l < att->size(); l++) {
-                            delete att->at(l);
-                        }
-                        delete att;
+                        structNum.append(tempI);
+                        structLookup[tempI] = structName.size()-1;
                     }
                 } // Structure data (looking for contour definitions)
                 else if (dicomStruct->data[j]->tag[0] == 0x3006 && dicomStruct->data[j]->tag[1] == 0x0039) {
                     for (int k = 0; k < dicomStruct->data[j]->seq.items.size(); k++) {
-                        tempData = QByteArray((char *)dicomStruct->data[j]->seq.items[k]->vf,dicomStruct->data[j]->seq.items[k]->vl);
-                        QDataStream dataStream(tempData);
-
-                        att = new QVector <Attribute *>;
-                        if (!dicomStruct->parseSequence(&dataStream, att)) {
-                            std::cout << "Failed to parse sequence data for tag (3006,0039), contour structure data \n";
-                        }
+                        DataSetCursor att(dicomStruct, dicomStruct->data[j]->seq.items[k]);
 
-                        QString tempS = ""; // Get the contour, it's another nested sequence, so we must go deeper with parseSequence
-                        for (int l = 0; l < att->size(); l++) {
-                            if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0040) {
+                        // Get the contour, it's another nested sequence, so we walk its items in place
+                        while (att.next()) {
+                            if (att.is(0x3006, 0x0040)) {
                                 structZ.resize(structZ.size()+1);
                                 structPos.resize(structPos.size()+1);
                                 contourPoints.resize(contourPoints.size()+1);
-                                for (int k = 0; k < att->at(l)->seq.items.size(); k++) {
+                                SequenceCursor contours = att.items();
+                                while (contours.next()) {
 
                                     structPos.last().resize(structPos.last().size()+1);
-                                    tempData2 = QByteArray((char *)att->at(l)->seq.items[k]->vf,att->at(l)->seq.items[k]->vl);
-                                    QDataStream dataStream2(tempData2);
+                                    DataSetCursor att2 = contours.item();
 
-                                    att2 = new QVector <Attribute *>;
-                                    if (!dicomStruct->parseSequence(&dataStream2, att2)) {
+                                    QVector <double> pointData; // Get the points
+                                    while (att2.next())
+                                        if (att2.is(0x3006, 0x0050)) {
+                                            pointData = att2.value().asDecimalArray();
+                                        }
+                                    if (att2.failed()) {
                                         std::cout << "Failed to parse sequence data for tag (3006,0040), contour data points \n";
                                     }
 
-                                    QString tempS = ""; // Get the points
-                                    for (int m = 0; m < att2->size(); m++)
-                                        if (att2->at(m)->tag[0] == 0x3006 && att2->at(m)->tag[1] == 0x0050)
-                                            for (unsigned int s = 0; s < att2->at(m)->vl; s++) {
-                                                tempS.append(att2->at(m)->vf[s]);
-                                            }
-
-                                    pointData = tempS.split('\\');
-
-                                    structZ.last().append(pointData[2].toDouble()/10.0);
+                                    structZ.last().append(pointData.size() > 2 ? pointData[2]/10.0 : 0);
 
-
-                                    for (int m = 0; m < pointData.size(); m+=3) {
-                                        structPos.last().last() << QPointF(pointData[m].toDouble()/10.0, pointData[m+1].toDouble()/10.0);
+                                    structPos.last().last().reserve(pointData.size()/3);
+                                    contourPoints.last().reserve(contourPoints.last().size()+pointData.size()/3);
+                                    for (int m = 0; m+2 < pointData.size(); m+=3) {
+                                        structPos.last().last() << QPointF(pointData[m]/10.0, pointData[m+1]/10.0);
                                         cont point;
-                                        point.x = pointData[m].toDouble()/10.0 ;
-                                        point.y = pointData[m+1].toDouble()/10.0;
-                                        point.z = pointData[m+2].toDouble()/10.0;
+                                        point.x = pointData[m]/10.0 ;
+                                        point.y = pointData[m+1]/10.0;
+                                        point.z = pointData[m+2]/10.0;
                                         contourPoints.last().append(point);
                                     }
-
-
-                                    for (int m = 0; m < att2->size(); m++) {
-                                        delete att2->at(m);
-                                    }
-                                    delete att2;
+                                }
+                                if (contours.failed()) {
+                                    std::cout << "Failed to parse sequence data for tag (3006,0040), contour data points \n";
                                 }
 
                             }
-                            else if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0084) {
-                                QString tempI = ""; // Get the number
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempI.append(att->at(l)->vf[s]);
-                                }
-                                structReference.append(tempI.toInt());
+                            else if (att.is(0x3006, 0x0084)) {
+                                structReference.append(att.value().asInt()); // Get the number
 
                             }
                         }
-
-                        for (int l = 0; l < att->size(); l++) {
-                            delete att->at(l);
+                        if (att.failed()) {
+                            std::cout << "Failed to parse sequence data for tag (3006,0039), contour structure data \n";
                         }
-                        delete att;
                     }
                 } //RT ROI Observation Sequence
                 else if (dicomStruct->data[j]->tag[0] == 0x3006 && dicomStruct->data[j]->tag[1] == 0x0080) {
                     for (int k = 0; k < dicomStruct->data[j]->seq.items.size(); k++) {
-                        tempData = QByteArray((char *)dicomStruct->data[j]->seq.items[k]->vf,dicomStruct->data[j]->seq.items[k]->vl);
-                        QDataStream dataStream(tempData);
-
-                        att = new QVector <Attribute *>;
-                        if (!dicomStruct->parseSequence(&dataStream, att)) {
-                            std::cout << "Failed to parse sequence data for tag (3006,0080)\n";
-                            //return 0;
-                        }
+                        DataSetCursor att(dicomStruct, dicomStruct->data[j]->seq.items[k]);
 
-                        QString tempS = ""; // Get the name
-                        QString tempI = ""; // Get the number
-                        for (int l = 0; l < att->size(); l++) {
-                            if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0084)
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempS.append(att->at(l)->vf[s]);
-                                }
-                            else if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x00a4)
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempI.append(att->at(l)->vf[s]);
-                                }
+                        int tempS = 0; // Get the number
+                        QString tempI = ""; // Get the type
+                        while (att.next()) {
+                            if (att.is(0x3006, 0x0084)) {
+                                tempS = att.value().asInt();
+                            }
+                            else if (att.is(0x3006, 0x00a4)) {
+                                tempI += att.value().asString();
+                            }
 
                         }
+                        if (att.failed()) {
+                            std::cout << "Failed to parse sequence data for tag (3006,0080)\n";
+                        }
 
                         ROI_type.append(tempI.trimmed());
-                        structNum_roiSequence.append(tempS.toInt());
-
-                        for (int l = 0; l < att->size(); l++) {
-                            delete att->at(l);
-                        }
-                        delete att;
+                        structNum_roiSequence.append(tempS);
                     }
                 }
                 updateProgress(increment);
@@ -2861,26 +3164,19 @@ void DICOM::extract(QVector<QString> tempS2) {
         // ---------------------------------------------------------- //
         if (loadedplan) {
 
-            QVector <Attribute *> *att, *att2;
-            QByteArray tempData, tempData2;
             double half_life = 0;
             //double t_end = 0; // Unused
             double max_time = 0;
 
 
-            // Data for parsing singly and doubly nested SQ sets and point data strings
-            QVector <Attribute *> *att3;
-            QByteArray  tempData3;
-            QStringList pointData2;
+            // Point data strings from the nested SQ sets
+            QVector <double> pointData2;
 
 
             for (int j = 0; j < dicomPlan->data.size(); j++) {
                 //Save data to dicomHeader (used to generate the dicom dose file)
                 if (dicomPlan->data[j]->tag[0] == 0x0008 && dicomPlan->data[j]->tag[1] == 0x0016) { //SOP Class UID
-                    QString temp = "";
-                    for (unsigned int s = 0; s < dicomPlan->data[j]->vl; s++) {
-                        temp.append(dicomPlan->data[j]->vf[s]);
-                    }
+                    QString temp = dicomPlan->data[j]->asString();
                     if (dicomHeader.contains("00081150")) { //Data from both the plan and struct file (plan is first)
                         QString value = dicomHeader.value("00081150");
                         QString new_value = temp + "\\" + value;
@@ -2891,10 +3187,7 @@ void DICOM::extract(QVector<QString> tempS2) {
                     }
                 }
                 else if (dicomPlan->data[j]->tag[0] == 0x0008 && dicomPlan->data[j]->tag[1] == 0x0018) {   //SOP Instance UID (plan is first)
-                    QString temp = "";
-                    for (unsigned int s = 0; s < dicomPlan->data[j]->vl; s++) {
-                        temp.append(dicomPlan->data[j]->vf[s]);
-                    }
+                    QString temp = dicomPlan->data[j]->asString();
                     if (dicomHeader.contains("00081155")) { //Data from both the plan and struct file
                         QString value = dicomHeader.value("00081155");
                         QString new_value = temp + "\\" + value;
@@ -2905,146 +3198,98 @@ void DICOM::extract(QVector<QString> tempS2) {
                     }
                 } // Treatment Type
                 else if (dicomPlan->data[j]->tag[0] == 0x300a && dicomPlan->data[j]->tag[1] == 0x0202) {
-                    QString temp = "";
-                    for (unsigned int s = 0; s < dicomPlan->data[j]->vl; s++) {
-                        temp.append(dicomPlan->data[j]->vf[s]);
-                    }
+                    QString temp = dicomPlan->data[j]->asString();
                     treatment_type = temp.trimmed();
 
                 } //Treatment technique
                 else if (dicomPlan->data[j]->tag[0] == 0x300a && dicomPlan->data[j]->tag[1] == 0x0200) {
-                    QString temp = "";
-                    for (unsigned int s = 0; s < dicomPlan->data[j]->vl; s++) {
-                        temp.append(dicomPlan->data[j]->vf[s]);
-                    }
+                    QString temp = dicomPlan->data[j]->asString();
 
                     treatment_technique = temp.trimmed();
                 } //Source sequence
                 else if (dicomPlan->data[j]->tag[0] == 0x300a && dicomPlan->data[j]->tag[1] == 0x0210) {
                     for (int k = 0; k < dicomPlan->data[j]->seq.items.size(); k++) {
-                        tempData = QByteArray((char *)dicomPlan->data[j]->seq.items[k]->vf,dicomPlan->data[j]->seq.items[k]->vl);
-                        QDataStream dataStream(tempData);
-
-                        att = new QVector <Attribute *>;
-                        if (!dicomPlan->parseSequence(&dataStream, att)) {
-                            std::cout << "Failed to parse sequence data for tag (300a,0210), Source Sequence\n";
-                        }
+                        DataSetCursor att(dicomPlan, dicomPlan->data[j]->seq.items[k]);
 
-                        QString tempS = ""; // Get the air kerma
-                        QString tempI = ""; // Get the half life
+                        double tempS = 0; // Get the air kerma
+                        double tempI = 0; // Get the half life
                         QString tempE = ""; //Get the isotope name
 
-                        for (int l = 0; l < att->size(); l++) {
-                            if (att->at(l)->tag[0] == 0x300a && att->at(l)->tag[1] == 0x022a)
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempS.append(att->at(l)->vf[s]);
-                                }
-                            else if (att->at(l)->tag[0] == 0x300a && att->at(l)->tag[1] == 0x0228)
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempI.append(att->at(l)->vf[s]);
-                                }
-                            else if (att->at(l)->tag[0] == 0x300a && att->at(l)->tag[1] == 0x0226)
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    tempE.append(att->at(l)->vf[s]);
-                                }
-                            else if (att->at(l)->tag[0] % 2 != 0) { //look for odd tags - private elements and save the data to search for seed
-                                QString temp = "";
-                                for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                    temp.append(att->at(l)->vf[s]);
-                                }
+                        while (att.next()) {
+                            if (att.is(0x300a, 0x022a)) {
+                                tempS = att.value().asDecimal();
+                            }
+                            else if (att.is(0x300a, 0x0228)) {
+                                tempI = att.value().asDecimal();
+                            }
+                            else if (att.is(0x300a, 0x0226)) {
+                                tempE += att.value().asString();
+                            }
+                            else if (att.group() % 2 != 0) { //look for odd tags - private elements and save the data to search for seed
+                                QString temp = att.value().asString();
                                 Seed_info.append(temp);
 
                             }
                         }
+                        if (att.failed()) {
+                            std::cout << "Failed to parse sequence data for tag (300a,0210), Source Sequence\n";
+                        }
 
-                        air_kerma = tempS.toDouble();
-                        half_life = tempI.toDouble();
+                        air_kerma = tempS;
+                        half_life = tempI;
                         isotope_name = tempE.trimmed();
-
-                        for (int l = 0; l < att->size(); l++) {
-                            delete att->at(l);
-                        }
-                        delete att;
                     }
                 } // Application Setup Sequence (looking for control point position)
                 else if (dicomPlan->data[j]->tag[0] == 0x300a && dicomPlan->data[j]->tag[1] == 0x0230) {
 
                     for (int k = 0; k < dicomPlan->data[j]->seq.items.size(); k++) {
-                        tempData = QByteArray((char *)dicomPlan->data[j]->seq.items[k]->vf,dicomPlan->data[j]->seq.items[k]->vl);
-                        QDataStream dataStream(tempData);
+                        DataSetCursor att(dicomPlan, dicomPlan->data[j]->seq.items[k]);
 
-                        att = new QVector <Attribute *>;
-                        if (!dicomPlan->parseSequence(&dataStream, att)) {
-                            std::cout << "Failed to parse sequence data for tag (300a,0230),  source information\n";
-                            //return 0;
-                        }
-
-                        QString tempS = ""; // Get the channel, it's another nested sequence, so we must go deeper with parseSequence
-                        for (int l = 0; l < att->size(); l++) {
-                            if (att->at(l)->tag[0] == 0x300a && att->at(l)->tag[1] == 0x0280) {
+                        // Get the channel, it's another nested sequence, so we walk its items in place
+                        while (att.next()) {
+                            if (att.is(0x300a, 0x0280)) {
                                 double final_cumulative_time_weight =0.0, channel_total_time = 0.0;
 
                                 //std::cout<<" Found 300a, 0280, new sequence \n";
-                                for (int k = 0; k < att->at(l)->seq.items.size(); k++) {
-                                    tempData2 = QByteArray((char *)att->at(l)->seq.items[k]->vf,att->at(l)->seq.items[k]->vl);
-                                    QDataStream dataStream2(tempData2);
-
-                                    att2 = new QVector <Attribute *>;
-                                    if (!dicomPlan->parseSequence(&dataStream2, att2)) {
-                                        std::cout << "Failed to parse sequence data for tag (300a,0280) \n";
-                                    }
+                                SequenceCursor channels = att.items();
+                                while (channels.next()) {
+                                    DataSetCursor att2 = channels.item();
 
-                                    QString tempS = ""; // Get the brachy sequence, it's another nested sequence, so we must go deeper with parseSequence
-                                    for (int m = 0; m < att2->size(); m++) {
-                                        if (att2->at(m)->tag[0] == 0x300a && att2->at(m)->tag[1] == 0x02d0) { //Control sequence
+                                    // Get the brachy sequence, it's another nested sequence, so we walk its items in place
+                                    while (att2.next()) {
+                                        if (att2.is(0x300a, 0x02d0)) { //Control sequence
                                             QVector<coordinate> dwell_position;
                                             QVector<double> dwell_time;
                                             QVector<coordinate> position;
                                             QVector <double> cumulative_time_weight;
 
-                                            for (int k2 = 0; k2 < att2->at(m)->seq.items.size(); k2++) {
-                                                tempData3 = QByteArray((char *)att2->at(m)->seq.items[k2]->vf,att2->at(m)->seq.items[k2]->vl);
-                                                QDataStream dataStream3(tempData3);
-
-                                                att3 = new QVector <Attribute *>;
-                                                if (!dicomPlan->parseSequence(&dataStream3, att3)) {
-                                                    std::cout << "Failed to parse sequence data for tag (300a,02d0), source points data \n";
-                                                }
-
-
-                                                QString tempS = ""; // Get the points
-                                                QString tempT = "";
-                                                for (int n = 0; n < att3->size(); n++) {
-                                                    if (att3->at(n)->tag[0] == 0x300a && att3->at(n)->tag[1] == 0x02d4) { //Seed position
-
-                                                        for (unsigned int s = 0; s < att3->at(n)->vl; s++) {
-                                                            tempS.append(att3->at(n)->vf[s]);
-                                                        }
+                                            SequenceCursor points = att2.items();
+                                            while (points.next()) {
+                                                DataSetCursor att3 = points.item();
 
-                                                        pointData2 = tempS.split('\\');
-                                                        for (int p = 0; p < pointData2.size(); p+=3) {
+                                                while (att3.next()) {
+                                                    if (att3.is(0x300a, 0x02d4)) { //Seed position
+                                                        pointData2 = att3.value().asDecimalArray();
+                                                        for (int p = 0; p+2 < pointData2.size(); p+=3) {
                                                             coordinate pos;
-                                                            pos.x = pointData2[p].toDouble()/10.0;
-                                                            pos.y = pointData2[p+1].toDouble()/10.0;
-                                                            pos.z = pointData2[p+2].toDouble()/10.0;
+                                                            pos.x = pointData2[p]/10.0;
+                                                            pos.y = pointData2[p+1]/10.0;
+                                                            pos.z = pointData2[p+2]/10.0;
 
                                                             position.append(pos);
                                                         }
                                                     }
-                                                    else if (att3->at(n)->tag[0] == 0x300a && att3->at(n)->tag[1] == 0x02d6) { //Seed time weight
-
-                                                        for (unsigned int s = 0; s < att3->at(n)->vl; s++) {
-                                                            tempT.append(att3->at(n)->vf[s]);
-                                                        }
-
-                                                        cumulative_time_weight.append(tempT.toDouble());
+                                                    else if (att3.is(0x300a, 0x02d6)) { //Seed time weight
+                                                        cumulative_time_weight.append(att3.value().asDecimal());
 
                                                     }
                                                 }
-                                                for (int n = 0; n < att3->size(); n++) {
-                                                    delete att3->at(n);
+                                                if (att3.failed()) {
+                                                    std::cout << "Failed to parse sequence data for tag (300a,02d0), source points data \n";
                                                 }
-                                                delete att3;
+                                            }
+                                            if (points.failed()) {
+                                                std::cout << "Failed to parse sequence data for tag (300a,02d0), source points data \n";
                                             }
                                             //Calculate the dwell position
                                             for (int q=1; q< position.size(); q++) {
@@ -3068,30 +3313,27 @@ void DICOM::extract(QVector<QString> tempS2) {
 
 
                                         } //Culmulative time weight
-                                        else if (att2->at(m)->tag[0] == 0x300a && att2->at(m)->tag[1] == 0x02c8) {
-                                            QString tempS = "";
-                                            for (unsigned int s = 0; s < att2->at(m)->vl; s++) {
-                                                tempS.append(att2->at(m)->vf[s]);
-                                            }
-                                            final_cumulative_time_weight = tempS.toDouble();
+                                        else if (att2.is(0x300a, 0x02c8)) {
+                                            final_cumulative_time_weight = att2.value().asDecimal();
 
                                         } //Channel total time
-                                        else if (att2->at(m)->tag[0] == 0x300a && att2->at(m)->tag[1] == 0x0286) {
-                                            QString tempS = "";
-                                            for (unsigned int s = 0; s < att2->at(m)->vl; s++) {
-                                                tempS.append(att2->at(m)->vf[s]);
-                                            }
-                                            channel_total_time= tempS.toDouble();
+                                        else if (att2.is(0x300a, 0x0286)) {
+                                            channel_total_time = att2.value().asDecimal();
 
                                         }
                                     }
-									for (int n = 0; n < att2->size(); n++) {
-										delete att2->at(n);
-									}
-									delete att2;
+                                    if (att2.failed()) {
+                                        std::cout << "Failed to parse sequence data for tag (300a,0280) \n";
+                                    }
+                                }
+                                if (channels.failed()) {
+                                    std::cout << "Failed to parse sequence data for tag (300a,0280) \n";
                                 }
                             }
                         }
+                        if (att.failed()) {
+                            std::cout << "Failed to parse sequence data for tag (300a,0230),  source information\n";
+                        }
                     }
                 }
                 updateProgress(increment);
@@ -3125,6 +3367,11 @@ void DICOM::extract(QVector<QString> tempS2) {
         progWin2->hide();
     }
 
+    // Everything needed has been copied out, so release the mapped files
+    for (int i = 0; i < parsed.size(); i++) {
+        delete parsed[i];
+    }
+
 }
 
 
@@ -3140,66 +3387,39 @@ void DICOM::extract_data_for_dicomdose(DICOM *dicom) {
     for (int i = 0; i < dicom->data.size(); i++) {
 
         if (dicom->data[i]->tag[0] == 0x0008 && dicom->data[i]->tag[1] == 0x0050) { //Accession Number attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00080050", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0010 && dicom->data[i]->tag[1] == 0x0010) {   //Patient Name attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00100010", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0010 && dicom->data[i]->tag[1] == 0x0020) {   //Patient Id attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00100020", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0010 && dicom->data[i]->tag[1] == 0x0030) {   //Patient Birth date attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00100030", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0010 && dicom->data[i]->tag[1] == 0x0040) {   //Patient Sex attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00100040", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0020 && dicom->data[i]->tag[1] == 0x000d) {   //Stude Instance UID attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("0020000d", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0020 && dicom->data[i]->tag[1] == 0x0052) {   //Frame of reference UID attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00200052", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0008 && dicom->data[i]->tag[1] == 0x0090) {   //Physician Name attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00080090", temp);
         }
         else if (dicom->data[i]->tag[0] == 0x0008 && dicom->data[i]->tag[1] == 0x0070) {   //Manufacturer attribute
-            QString temp = "";
-            for (unsigned int s = 0; s < dicom->data[i]->vl; s++) {
-                temp.append(dicom->data[i]->vf[s]);
-            }
+            QString temp = dicom->data[i]->asString();
             dicomHeader.insert("00080070", temp);
         }
     }
@@ -3207,6 +3427,426 @@ void DICOM::extract_data_for_dicomdose(DICOM *dicom) {
 }
 
 
+HUVolume::~HUVolume() {
+    clear();
+}
+
+/***
+Function: allocate
+------------------
+Process: Replaces the volume with a zero filled x by y by z one, with each row
+         padded out to a multiple of 16 voxels
+***/
+void HUVolume::allocate(int x, int y, int z) {
+    clear();
+    if (x <= 0 || y <= 0 || z <= 0) {
+        return;
+    }
+
+    size_t bytes = sizeof(short int)*qint64((x+15)/16*16)*y*z;
+    voxels = (short int *)qMallocAligned(bytes, 32);
+    if (voxels == NULL) {
+        std::cout << "Could not allocate " << bytes << " bytes for the HU data.\n";
+        return;
+    }
+    memset(voxels, 0, bytes);
+
+    nx = x;
+    ny = y;
+    nz = z;
+    rowStride = (x+15)/16*16;
+    sliceStride = rowStride*y;
+}
+
+void HUVolume::clear() {
+    if (voxels != NULL) {
+        qFreeAligned(voxels);
+    }
+    voxels = NULL;
+    nx = ny = nz = 0;
+    rowStride = sliceStride = 0;
+}
+
+/***
+Function: crop
+--------------
+Process: Keeps only voxels i0 to i1, j0 to j1 and k0 to k1 (inclusive), moving
+         them into a new block so the volume stays contiguous
+***/
+void HUVolume::crop(int i0, int i1, int j0, int j1, int k0, int k1) {
+    if (voxels == NULL) {
+        return;
+    }
+
+    i0 = qMax(i0, 0);
+    j0 = qMax(j0, 0);
+    k0 = qMax(k0, 0);
+    i1 = qMin(i1, nx-1);
+    j1 = qMin(j1, ny-1);
+    k1 = qMin(k1, nz-1);
+
+    if (i1 < i0 || j1 < j0 || k1 < k0) {
+        clear();
+        return;
+    }
+
+    short int *old = voxels;
+    qint64 oldRow = rowStride, oldSlice = sliceStride;
+    voxels = NULL; // So allocate doesn't free the old block
+    allocate(i1-i0+1, j1-j0+1, k1-k0+1);
+
+    if (voxels != NULL)
+        for (int k = 0; k < nz; k++)
+            for (int j = 0; j < ny; j++) {
+                memcpy(row(j, k), old+(k+k0)*oldSlice+(j+j0)*oldRow+i0, sizeof(short int)*nx);
+            }
+
+    qFreeAligned(old);
+}
+
+HUView HUVolume::view() const {
+    HUView v;
+    v.data = voxels;
+    v.nx = nx;
+    v.ny = ny;
+    v.nz = nz;
+    v.rowStride = rowStride;
+    v.sliceStride = sliceStride;
+    return v;
+}
+
+/***
+Function: setCentres
+--------------------
+Process: Saves the centre of every voxel between the given boundaries, they
+         are computed just as the phantom generators used to compute xMid
+***/
+void ScanlineRasterizer::setCentres(const QVector <double> &bounds) {
+    mid.resize(qMax(0, bounds.size()-1));
+    sorted = true;
+    for (int i = 0; i < mid.size(); i++) {
+        mid[i] = (bounds[i]+bounds[i+1])/2.0;
+        if (i > 0 && mid[i] < mid[i-1]) {
+            sorted = false;
+        }
+    }
+}
+
+/***
+Function: findCrossings
+-----------------------
+Process: Finds where every edge of poly crosses the line at y, closing the
+         polygon and skipping horizontal edges as containsPoint does
+***/
+void ScanlineRasterizer::findCrossings(const QPolygonF &poly, double y) {
+    crossings.resize(0);
+    if (poly.isEmpty()) {
+        return;
+    }
+
+    QPointF last = poly.at(0);
+    for (int i = 1; i < poly.size(); i++) {
+        addCrossing(last, poly.at(i), y);
+        last = poly.at(i);
+    }
+    if (last != poly.at(0)) {
+        addCrossing(last, poly.at(0), y);
+    }
+
+    std::sort(crossings.begin(), crossings.end());
+}
+
+void ScanlineRasterizer::addCrossing(const QPointF &a, const QPointF &b, double y) {
+    qreal x1 = a.x(), y1 = a.y(), x2 = b.x(), y2 = b.y();
+    if (qFuzzyCompare(y1, y2)) {
+        return;
+    }
+    if (y2 < y1) {
+        qSwap(x1, x2);
+        qSwap(y1, y2);
+    }
+
+    if (y >= y1 && y < y2) {
+        crossings.append(x1 + ((x2 - x1) / (y2 - y1)) * (y - y1));
+    }
+}
+
+/***
+Function: prepare
+-----------------
+Process: Keeps the cached runs if structPos and the x/y boundaries are exactly
+         the ones they were made from, otherwise starts over with an empty
+         entry for every contour
+Output:  true if the cache was kept
+***/
+bool ContourRunCache::prepare(const QVector <QVector <QPolygonF> > &newPos, const QVector <double> &newX, const QVector <double> &newY) {
+    bool same = x == newX && y == newY && structPos.size() == newPos.size();
+    for (int s = 0; same && s < newPos.size(); s++) {
+        same = structPos[s].size() == newPos[s].size();
+        for (int c = 0; same && c < newPos[s].size(); c++) {
+            const QPolygonF &a = structPos[s][c], &b = newPos[s][c];
+            same = a.size() == b.size() && (a.constData() == b.constData() ||
+                                            !memcmp(a.constData(), b.constData(), a.size()*sizeof(QPointF)));
+        }
+    }
+    if (same) {
+        return true;
+    }
+
+    structPos = newPos;
+    x = newX;
+    y = newY;
+    contours.resize(0);
+    contours.resize(structPos.size());
+    for (int s = 0; s < structPos.size(); s++) {
+        contours[s].resize(structPos[s].size());
+    }
+    return false;
+}
+
+/***
+Function: rasterize
+-------------------
+Process: Fills contour with the runs of voxels inside poly on every row whose
+         centre is within rect, exactly the rows and voxels the generators
+         used to test
+***/
+void ContourRunCache::rasterize(ContourRuns *contour, const QPolygonF &poly, const QRectF &rect) const {
+    ScanlineRasterizer raster;
+    raster.setCentres(x);
+    int ny = qMax(0, y.size()-1);
+
+    contour->runs.resize(0);
+    contour->rowStart.resize(ny+1);
+    for (int j = 0; j < ny; j++) {
+        contour->rowStart[j] = contour->runs.size();
+        double yMid = (y[j]+y[j+1])/2.0;
+        if (rect.top() <= yMid && yMid <= rect.bottom()) {
+            raster.fillRow(poly, yMid, rect.left(), rect.right(), [contour](int i0, int i1) {
+                contour->runs << i0 << i1;
+            });
+        }
+    }
+    contour->rowStart[ny] = contour->runs.size();
+    contour->done = true;
+}
+
+#ifdef __SSE2__
+// m*x+b for the four ints in x, clamped to the range of a short and then
+// truncated towards zero
+static inline __m128i rescaleQuad(__m128i x, __m128d m, __m128d b) {
+    const __m128d lo = _mm_set1_pd(-32768.0), hi = _mm_set1_pd(32767.0);
+    __m128d a = _mm_cvtepi32_pd(x);
+    __m128d c = _mm_cvtepi32_pd(_mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+    a = _mm_min_pd(_mm_max_pd(_mm_add_pd(_mm_mul_pd(a, m), b), lo), hi);
+    c = _mm_min_pd(_mm_max_pd(_mm_add_pd(_mm_mul_pd(c, m), b), lo), hi);
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(a), _mm_cvttpd_epi32(c));
+}
+#endif
+
+/***
+Function: decodePixelRow
+------------------------
+Process: Decodes n 16 bit pixels from src (in file byte order, no alignment
+         needed) into dst, which must be 16 byte aligned.  Rescaled values are
+         clamped to the range of a short and truncated towards zero.  Eight
+         pixels are done at a time with SSE2 when it is available.
+***/
+static void decodePixelRow(const unsigned char *src, short int *dst, int n, bool bigEndian, bool rescale, double m, double b) {
+    int s = 0;
+
+#ifdef __SSE2__
+    const __m128d vm = _mm_set1_pd(m), vb = _mm_set1_pd(b);
+    for (; s+8 <= n; s += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src+2*s));
+        if (bigEndian) {
+            v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        }
+
+        if (rescale) {
+            // Sign extend to ints, rescale, and pack back down
+            __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+            v = _mm_packs_epi32(rescaleQuad(lo, vm, vb), rescaleQuad(hi, vm, vb));
+        }
+
+        _mm_store_si128((__m128i *)(dst+s), v);
+    }
+#endif
+
+    short int temp;
+    for (; s < n; s++) {
+        if (bigEndian) {
+            temp = (short int)((src[2*s] << 8) | src[2*s+1]);
+        }
+        else {
+            temp = (short int)((src[2*s+1] << 8) | src[2*s]);
+        }
+
+        dst[s] = rescale ? (short int)qBound(-32768.0, m*temp+b, 32767.0) : temp;
+    }
+}
+
+/***
+Function: readGeometry
+----------------------
+Process: Reads the size, spacing, position and rescale of a parsed CT slice
+         into geometry, so that it can be indexed and decoded later without
+         going through data again.  The functional groups sequences of an
+         enhanced CT are returned through shared and perFrame when asked for.
+***/
+void DICOM::readGeometry(const Attribute **shared, const Attribute **perFrame) {
+    geometry = CTSlice();
+    geometry.source = this;
+    enhanced = false;
+    for (int j = 0; j < data.size(); j++) {
+        // Pixel Spacing (Decimal String), row spacing and then column spacing (in mm)
+        if (data[j]->tag[0] == 0x0028 && data[j]->tag[1] == 0x0030) {
+            geometry.hasSpacing = true;
+            data[j]->asDecimalArray(geometry.spacing, 2);
+        } // Slice Thickness (Decimal String, in mm)
+        else if (data[j]->tag[0] == 0x0018 && data[j]->tag[1] == 0x0050) {
+            geometry.hasThickness = true;
+            geometry.thickness = data[j]->asDecimal();
+        } // Image Position [x,y,z] (Decimal String, in mm)
+        else if (data[j]->tag[0] == 0x0020 && data[j]->tag[1] == 0x0032) {
+            geometry.hasPos = true;
+            data[j]->asDecimalArray(geometry.pos, 3);
+        } // Rows
+        else if (data[j]->tag[0] == 0x0028 && data[j]->tag[1] == 0x0010) {
+            geometry.hasRows = true;
+            geometry.rows = data[j]->asUS(isBigEndian);
+        } // Columns
+        else if (data[j]->tag[0] == 0x0028 && data[j]->tag[1] == 0x0011) {
+            geometry.hasCols = true;
+            geometry.cols = data[j]->asUS(isBigEndian);
+        } // Rescale HU slope (assuming type is HU)
+        else if (data[j]->tag[0] == 0x0028 && data[j]->tag[1] == 0x1053) {
+            geometry.hasSlope = true;
+            geometry.m = data[j]->asDecimal();
+        } // Rescale HU intercept (assuming type is HU)
+        else if (data[j]->tag[0] == 0x0028 && data[j]->tag[1] == 0x1052) {
+            geometry.hasIntercept = true;
+            geometry.b = data[j]->asDecimal();
+        } // Shared Functional Groups Sequence
+        else if (data[j]->tag[0] == 0x5200 && data[j]->tag[1] == 0x9229) {
+            if (shared != NULL) {
+                *shared = data[j];
+            }
+        } // Per-frame Functional Groups Sequence
+        else if (data[j]->tag[0] == 0x5200 && data[j]->tag[1] == 0x9230) {
+            enhanced = true;
+            if (perFrame != NULL) {
+                *perFrame = data[j];
+            }
+        }
+    }
+}
+
+/***
+Function: readFunctionalGroups
+------------------------------
+Process: Reads the Pixel Measures (0028,9110), Plane Position (0020,9113) and
+         Pixel Value Transformation (0028,9145) macros out of one item of the
+         shared or per-frame functional groups of an enhanced CT into slice,
+         replacing whatever slice already had, so the per-frame item should be
+         read after the shared one
+***/
+void DICOM::readFunctionalGroups(const SequenceItem *groups, CTSlice &slice) {
+    DataSetCursor group(this, groups);
+    while (group.next()) {
+        if (!group.is(0x0028, 0x9110) && !group.is(0x0020, 0x9113) && !group.is(0x0028, 0x9145)) {
+            continue;
+        }
+
+        SequenceCursor items = group.items();
+        if (!items.next()) {
+            continue;
+        }
+
+        DataSetCursor att = items.item();
+        while (att.next()) {
+            if (att.is(0x0028, 0x0030)) { // Pixel Spacing
+                slice.hasSpacing = true;
+                att.value().asDecimalArray(slice.spacing, 2);
+            }
+            else if (att.is(0x0018, 0x0050)) { // Slice Thickness
+                slice.hasThickness = true;
+                slice.thickness = att.value().asDecimal();
+            }
+            else if (att.is(0x0020, 0x0032)) { // Image Position
+                slice.hasPos = true;
+                att.value().asDecimalArray(slice.pos, 3);
+            }
+            else if (att.is(0x0028, 0x1053)) { // Rescale Slope
+                slice.hasSlope = true;
+                slice.m = att.value().asDecimal();
+            }
+            else if (att.is(0x0028, 0x1052)) { // Rescale Intercept
+                slice.hasIntercept = true;
+                slice.b = att.value().asDecimal();
+            }
+        }
+    }
+}
+
+/***
+Function: decodeSlice
+---------------------
+Process: Decodes the 16 bit pixel data of one CT slice into slice job.slice of
+         HU, applying the rescale slope and intercept if the slice had both.
+         Only touches its own slice so it is safe to run on the worker pool.
+***/
+void DICOM::decodeSlice(const PixelJob &job) {
+    unsigned long int n = qMin(job.length/2, (unsigned long int)job.nx*job.ny);
+
+    for (int j = 0; j < job.ny && (unsigned long int)j*job.nx < n; j++) {
+        unsigned long int start = (unsigned long int)j*job.nx;
+        decodePixelRow(job.pixels+2*start, HU.row(j, job.slice), qMin((unsigned long int)job.nx, n-start),
+                       job.bigEndian, job.rescale, job.m, job.b);
+    }
+}
+
+/***
+Function: waitForWorkers
+------------------------
+Process: Keeps the event loop going on the GUI thread until future is
+         finished, passing progress the increment earned by each item the
+         workers have counted in done
+***/
+void waitForWorkers(QFuture <void> future, std::atomic<int> *done, double increment,
+                    std::function<void(double)> progress) {
+    int reported = 0;
+    while (!future.isFinished()) {
+        int n = done->load();
+        if (n > reported) {
+            progress((n-reported)*increment);
+            reported = n;
+        }
+        else {
+            QApplication::processEvents();
+        }
+        QThread::msleep(10);
+    }
+    future.waitForFinished();
+
+    if (done->load() > reported) {
+        progress((done->load()-reported)*increment);
+    }
+}
+
+/***
+Function: waitForWorkers
+------------------------
+Process: Waits on future while moving the DICOM progress bar
+***/
+void DICOM::waitForWorkers(QFuture <void> future, std::atomic<int> *done, double increment) {
+    ::waitForWorkers(future, done, increment, [this](double n) {
+        updateProgress(n);
+    });
+}
+
+
 /***
 Function: loadCalib
 -------------------
@@ -3282,6 +3922,7 @@ bool Interface::readCalib() {
 
         if (HUMap.size() == denMap.size()) {
             readCalibFile = true;
+            compileDensityTable();
             return true;
         }
         else {
@@ -3299,30 +3940,154 @@ bool Interface::readCalib() {
 }
 
 /***
-Function: show_advanced_options
--------------------------------
-Process: opens the advanced options window
+Function: compileDensityTable
+-----------------------------
+Process: Converts every possible HU value to density with the calibration
+         curve once, searching HUMap and extrapolating past its ends exactly as
+         the voxel loops used to
 ***/
-void Interface::show_advanced_options() {
-    //this->setDisabled(true);
-    options->save_options_on_startup(egs_input->egsinp_path);
-    options->window->show();
-    QApplication::processEvents();
-    options->setEnabled(TRUE);
-
+void Interface::compileDensityTable() {
+    tables.density.resize(65536);
+    for (int h = -32768; h < 32768; h++) {
+        int n;
+        for (n = 0; n < HUMap.size()-1; n++)
+            if (HUMap[n] <= h && h < HUMap[n+1]) {
+                break;
+            }
+        if (h < HUMap[0]) {
+            n = 0;
+        }
+        if (h > HUMap[HUMap.size()-1]) {
+            n = HUMap.size() -2;
+        }
 
+        tables.density[h+32768] = interp(h,HUMap[n],HUMap[n+1],denMap[n],denMap[n+1]);
+    }
 }
 
 /***
-Function: show_trim_options
--------------------------------
-Process: opens the trim egsphant window
+Function: buildMediaMap
+-----------------------
+Process: Lists the media of the phantom, only tg43Medium (tissue[0] if
+         empty) for TG-43 or else every medium of the default and struct
+         tissue assignment schemes, and hands each one its egsphant character
+         in order of appearance
 ***/
-void Interface::show_trim_options() {
-    connect(trimEGS, SIGNAL(trimExisting()),
-            this, SLOT(trimExisitngEGS()));
-    connect(trimEGS, SIGNAL(trimNotExisting()),
-            this, SLOT(trimPhant_notAlreadyExisting()));
+void Interface::buildMediaMap(bool tg43, QMap <QString,unsigned char> &mediaMap, QString tg43Medium) {
+    mediaMap.clear();
+    phant.media.clear();
+
+    // Track the number of media, and create a lookup for media to ASCII character representation
+    int medNum = 0;
+    if (tg43) {
+        if (tg43Medium.isEmpty()) {
+            tg43Medium = tissue[0];
+        }
+        phant.media.append(tg43Medium);
+        mediaMap.insert(tg43Medium, 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
+        return;
+    }
+
+    for (int i = 0; i < medThreshold.size(); i++) {
+        if (!mediaMap.contains(medThreshold[i])) {
+            phant.media.append(medThreshold[i]);
+            mediaMap.insert(medThreshold[i], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
+            medNum++; // 49 is the ASCII value of '1', 7 jumps from ';' to 'A', 6 jumps from '[' to 'a'
+        }
+    }
+
+    for (int i = 0; i < get_data->structName.size(); i++) {
+        for (int j = 0; j < medThresholds[i].size(); j++)
+            if (!mediaMap.contains(medThresholds[i][j])) {
+                phant.media.append(medThresholds[i][j]);
+                mediaMap.insert(medThresholds[i][j], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
+                medNum++; // 49 is the ASCII value of '1', 7 jumps from ';' to 'A', 6 jumps from '[' to 'a'
+            }
+    }
+}
+
+/***
+Function: compileMediaTables
+----------------------------
+Process: Compiles the density thresholds of the default scheme and of every
+         struct into a media character for every HU, and each struct's row of
+         denThresholds into a flat array.  The media characters are only
+         handed out once the phantom's media list is built, so this is called
+         at the start of each generation.
+***/
+void Interface::compileMediaTables(const QMap <QString,unsigned char> &mediaMap) {
+    tables.structRow.resize(get_data->structReference.size());
+    for (int i = 0; i < tables.structRow.size(); i++) {
+        tables.structRow[i] = get_data->structLookup.value(get_data->structReference[i])+1;
+    }
+
+    tables.thresholds.resize(denThresholds.size()+1);
+    tables.codes.resize(denThresholds.size()+1);
+    tables.media.resize(denThresholds.size()+1);
+    for (int r = 0; r < tables.thresholds.size(); r++) {
+        tables.thresholds[r] = r == 0 ? denThreshold : denThresholds[r-1];
+        tables.codes[r].fill(0, qMax(1, tables.thresholds[r].size()));
+        for (int n = 0; n < tables.thresholds[r].size(); n++) {
+            if (r == 0) {
+                tables.codes[r][n] = 49 + n + (n>8?7:0) + (n>34?6:0);
+            }
+            else if (n < medThresholds[r-1].size()) {
+                tables.codes[r][n] = mediaMap.value(medThresholds[r-1][n]);
+            }
+        }
+        if (r == 0 && tables.thresholds[r].isEmpty()) {
+            tables.codes[r][0] = 49;
+        }
+
+        tables.media[r].resize(65536);
+        for (int h = 0; h < 65536; h++) {
+            double d = tables.density[h];
+            tables.media[r][h] = tables.mediaOf(r, d<=0?0.000001:d);
+        }
+    }
+}
+
+/***
+Function: mediaOf
+-----------------
+Process: Finds the media of density d with the thresholds of row, the first
+         threshold d is below (or the last one)
+***/
+char TissueTables::mediaOf(int row, double d) const {
+    const QVector <double> &t = thresholds[row];
+    int n;
+    for (n = 0; n < t.size()-1; n++)
+        if (d < t[n]) {
+            break;
+        }
+    return codes[row][n];
+}
+
+/***
+Function: show_advanced_options
+-------------------------------
+Process: opens the advanced options window
+***/
+void Interface::show_advanced_options() {
+    //this->setDisabled(true);
+    options->save_options_on_startup(egs_input->egsinp_path);
+    options->window->show();
+    QApplication::processEvents();
+    options->setEnabled(TRUE);
+
+
+}
+
+/***
+Function: show_trim_options
+-------------------------------
+Process: opens the trim egsphant window
+***/
+void Interface::show_trim_options() {
+    connect(trimEGS, SIGNAL(trimExisting()),
+            this, SLOT(trimExisitngEGS()));
+    connect(trimEGS, SIGNAL(trimNotExisting()),
+            this, SLOT(trimPhant_notAlreadyExisting()));
 
     trimEGS->save_options_on_startup("");
     trimEGS->egsphantPath = egs_input->egsphant_location;
@@ -3339,52 +4104,26 @@ Function: trimExisitngEGS
 Process: trims the egsphant if it has already been created
 ***/
 void Interface::trimExisitngEGS() {
-    //Delete density, media and contour indicies
-    for (int i = phant.nx - 1; i >= 0; i--) {
-        if (i < trimEGS->xMinIndex || i > trimEGS->xMaxIndex) {
-            phant.m.remove(i);
-            phant.d.remove(i);
-            phant.contour.remove(i);
-        }
-        else {
-            for (int j = phant.ny-1; j>= 0; j--) {
-                if (j < trimEGS->yMinIndex || j > trimEGS->yMaxIndex) {
-                    phant.m[i].remove(j);
-                    phant.d[i].remove(j);
-                    phant.contour[i].remove(j);
-                }
-                else {
-                    for (int k = phant.nz - 1; k >= 0; k--)
-                        if (k < trimEGS->zMinIndex || k > trimEGS->zMaxIndex) {
-                            phant.m[i][j].remove(k);
-                            phant.d[i][j].remove(k);
-                            phant.contour[i][j].remove(k);
-                        }
-                }
-            }
-        }
-    }
-
-    //Resize
-    for (int k = phant.nz; k >= 0; k--)
-        if (k < trimEGS->zMinIndex || k > trimEGS->zMaxIndex) {
-            phant.z.remove(k);
-        }
-
-    for (int k = phant.ny; k >= 0; k--)
-        if (k < trimEGS->yMinIndex || k > trimEGS->yMaxIndex) {
-            phant.y.remove(k);
-        }
-
-    for (int k = phant.nx ; k >= 0; k--)
-        if (k < trimEGS->xMinIndex || k > trimEGS->xMaxIndex) {
-            phant.x.remove(k);
-        }
-
-
-    phant.nx = phant.x.size() -1;
-    phant.ny = phant.y.size() -1;
-    phant.nz = phant.z.size() -1;
+    // The CT grid the next generation starts from, every boundary of a
+    // resampled phant is also one of its boundaries
+    QVector <double> ctX = ctPhant.nx > 0 ? ctPhant.x : phant.x;
+    QVector <double> ctY = ctPhant.nx > 0 ? ctPhant.y : phant.y;
+    QVector <double> ctZ = ctPhant.nx > 0 ? ctPhant.z : phant.z;
+
+    //Crop density, media and contour to the voxels within the trim boundaries
+    phant.crop(trimEGS->xMinIndex, trimEGS->xMaxIndex, trimEGS->yMinIndex,
+               trimEGS->yMaxIndex, trimEGS->zMinIndex, trimEGS->zMaxIndex);
+    membership = StructMembership(); // Made for the uncropped phantom
+
+    // Trim the CT grid and its HU data to the same boundaries, so the trim
+    // holds when the phantom is generated again
+    int i0 = ctX.indexOf(phant.x.first()), i1 = ctX.indexOf(phant.x.last());
+    int j0 = ctY.indexOf(phant.y.first()), j1 = ctY.indexOf(phant.y.last());
+    int k0 = ctZ.indexOf(phant.z.first()), k1 = ctZ.indexOf(phant.z.last());
+    if (ctPhant.nx > 0) {
+        ctPhant.crop(i0, i1, j0, j1, k0, k1);
+    }
+    get_data->HU.crop(i0, i1-1, j0, j1-1, k0, k1-1); // Inclusive voxel indices
 
     //Change the trim boundaries as data was deleted
     trimEGS->x = phant.x;
@@ -3393,13 +4132,9 @@ void Interface::trimExisitngEGS() {
     trimEGS->reset_bounds();
 
 
-    phant.saveEGSPhantFile(egs_input->egsphant_location);
-    QProcess *qzip = new QProcess();
-    qzip->setProcessChannelMode(QProcess::MergedChannels);
-    qzip->setReadChannel(QProcess::StandardOutput);
-    QString command = "gzip -f " + egs_input->egsphant_location;  //-f used if exisitng .gz file, -f forces the
-    qzip->execute(command);
-    std::cout << "Trimmed egsphant file successfully output." <<egs_input->egsphant_location.toStdString() <<".gz  \n";
+    if (phant.saveEGSPhantFile(egs_input->egsphant_location + ".gz")) {
+        std::cout << "Trimmed egsphant file successfully output." <<egs_input->egsphant_location.toStdString() <<".gz  \n";
+    }
 
     disconnect(trimEGS, SIGNAL(trimExisting()),
                this, SLOT(trimExisitngEGS()));
@@ -3415,25 +4150,8 @@ Process: trims the egsphant if it has NOT already been created
 ***/
 void Interface::trimPhant_notAlreadyExisting() {
     //Delete HU data
-    for (int k = phant.nz-1; k >= 0; k--) {
-        if (k < trimEGS->zMinIndex || k > trimEGS->zMaxIndex) {
-            get_data->HU.remove(k);
-        }
-        else {
-            for (int j = phant.ny-1; j>= 0; j--) {
-                if (j < trimEGS->yMinIndex || j > trimEGS->yMaxIndex) {
-                    get_data->HU[k].remove(j);
-                }
-                else {
-                    for (int i = phant.nx-1; i >= 0; i--) {
-                        if (i < trimEGS->xMinIndex || i > trimEGS->xMaxIndex) {
-                            get_data->HU[k][j].remove(i);
-                        }
-                    }
-                }
-            }
-        }
-    }
+    get_data->HU.crop(trimEGS->xMinIndex, trimEGS->xMaxIndex, trimEGS->yMinIndex, trimEGS->yMaxIndex,
+                      trimEGS->zMinIndex, trimEGS->zMaxIndex);
 
     //Delete phant bounds
     for (int k = phant.nz; k >= 0; k--)
@@ -3456,20 +4174,8 @@ void Interface::trimPhant_notAlreadyExisting() {
     phant.ny = phant.y.size() -1;
     phant.nz = phant.z.size() -1;
 
-    QVector <char> mz(phant.nz, 0);
-    QVector <QVector <char> > my(phant.ny, mz);
-    QVector <QVector <QVector <char> > > mx(phant.nx, my);
-    phant.m = mx;
-
-    QVector <double> dz(phant.nz, 0);
-    QVector <QVector <double> > dy(phant.ny, dz);
-    QVector <QVector <QVector <double> > > dx(phant.nx, dy);
-    phant.d = dx;
-
-    QVector <int> sz(phant.nz, 0);
-    QVector <QVector <int> > sy(phant.ny, sz);
-    QVector <QVector <QVector <int> > > sx(phant.nx, sy);
-    phant.contour = sx;
+    phant.allocate(true);
+    membership = StructMembership(); // Made for the untrimmed phantom
 
     //Change the trim boundaries as data was deleted
     trimEGS->x = phant.x;
@@ -3487,6 +4193,28 @@ void Interface::trimPhant_notAlreadyExisting() {
                this, SLOT(trimPhant_notAlreadyExisting()));
 }
 
+/***
+Function: phantomCachePath
+--------------------------
+Process: Where the binary copy of the phantom at path is kept, named after a
+         hash of its absolute path like the DICOM index cache
+***/
+static QString phantomCachePath(QString path) {
+    QString hash = QCryptographicHash::hash(QFileInfo(path).absoluteFilePath().toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/phantoms/" + hash + ".begsphant";
+}
+
+/***
+Function: phantomStamp
+----------------------
+Process: The size and modification time of the phantom at path, kept next to
+         its binary copy to tell whether the copy was made from this file
+***/
+static QByteArray phantomStamp(QString path) {
+    QFileInfo info(path);
+    return QByteArray::number(info.size()) + " " + QByteArray::number(info.lastModified().toMSecsSinceEpoch());
+}
+
 /***
 Function: trimExisitngEGS_Mid
 -------------------------------
@@ -3497,76 +4225,49 @@ QString Interface::trimExisitngEGS_Mid(QString phant_file) {
     double increment =  1000000000/(11);
     updateProgress(increment);
 
-    if (phant_file.endsWith(".egsphant.gz")) { //gunzip the file
-        updateProgress(increment);
-        QProcess *qzip = new QProcess();
-        qzip->setProcessChannelMode(QProcess::MergedChannels);
-        qzip->setReadChannel(QProcess::StandardOutput);
-
-        //Actual line of exectuion
-        QString command = "gunzip " + phant_file;
-        qzip->execute(command);
-        updateProgress(increment);
-
-        phant_file.chop(3); //remove the .gz from the sting file name
-        updateProgress(increment);
-    }
-    else {
-        updateProgress(3*increment);
-    }
-    updateProgress(increment);
+    updateProgress(4*increment);
 
+    // A .egsphant.gz is inflated as it is read, the file itself is left as is.
+    // Parsing the text is slow, so a binary copy is cached for the next trim
+    // and used while the file has the size and modification time it had then
     EGSPhant *selectedPhant= new EGSPhant;
-    selectedPhant->loadEGSPhantFilePlus(phant_file);
-    updateProgress(increment);
-
-    //Delete density, media and contour indicies
-    for (int i = selectedPhant->nx - 1; i >= 0; i--) {
-        if (i < trimEGSMid->xMinIndex || i > trimEGSMid->xMaxIndex) {
-            selectedPhant->m.remove(i);
-            selectedPhant->d.remove(i);
-        }
-        else {
-            for (int j = selectedPhant->ny-1; j>= 0; j--) {
-                if (j < trimEGSMid->yMinIndex || j > trimEGSMid->yMaxIndex) {
-                    selectedPhant->m[i].remove(j);
-                    selectedPhant->d[i].remove(j);
-                }
-                else {
-                    for (int k = selectedPhant->nz - 1; k >= 0; k--)
-                        if (k < trimEGSMid->zMinIndex || k > trimEGSMid->zMaxIndex) {
-                            selectedPhant->m[i][j].remove(k);
-                            selectedPhant->d[i][j].remove(k);
-                        }
-                }
-            }
-        }
-    }
-    updateProgress(increment);
-
-    //Resize
-    for (int k = selectedPhant->nz; k >= 0; k--)
-        if (k < trimEGSMid->zMinIndex || k > trimEGSMid->zMaxIndex) {
-            selectedPhant->z.remove(k);
-        }
+    QString cache = phantomCachePath(phant_file);
+    QFile stamp(cache + ".source");
+    QByteArray source = phantomStamp(phant_file);
+    bool cached = stamp.open(QIODevice::ReadOnly) && stamp.readAll() == source &&
+                  selectedPhant->loadbEGSPhantFilePlus(cache);
+    stamp.close();
+    if (!cached) {
+        if (!selectedPhant->loadEGSPhantFilePlus(phant_file)) {
+            delete selectedPhant;
+            progWin->hide();
+            progWin->close();
 
-    for (int k = selectedPhant->ny; k >= 0; k--)
-        if (k < trimEGSMid->yMinIndex || k > trimEGSMid->yMaxIndex) {
-            selectedPhant->y.remove(k);
+            QMessageBox msgBox;
+            msgBox.setText(tr("The egsphant file could not be read, it was not trimmed\n") + phant_file);
+            msgBox.setWindowTitle(tr("egs_brachy GUI"));
+            msgBox.exec();
+            return phant_file;
         }
 
-    for (int k = selectedPhant->nx ; k >= 0; k--)
-        if (k < trimEGSMid->xMinIndex || k > trimEGSMid->xMaxIndex) {
-            selectedPhant->x.remove(k);
+        // The stamp goes last, so a copy that failed to write is never used
+        stamp.remove();
+        QDir().mkpath(QFileInfo(cache).absolutePath());
+        if (selectedPhant->savebEGSPhantFile(cache) && stamp.open(QIODevice::WriteOnly)) {
+            stamp.write(source);
+            stamp.close();
         }
-
+    }
     updateProgress(increment);
 
-    selectedPhant->nx = selectedPhant->x.size() -1;
-    selectedPhant->ny = selectedPhant->y.size() -1;
-    selectedPhant->nz = selectedPhant->z.size() -1;
+    //Crop density and media to the voxels within the trim boundaries
+    selectedPhant->crop(trimEGSMid->xMinIndex, trimEGSMid->xMaxIndex, trimEGSMid->yMinIndex,
+                        trimEGSMid->yMaxIndex, trimEGSMid->zMinIndex, trimEGSMid->zMaxIndex);
+    updateProgress(3*increment);
 
-    updateProgress(increment);
+    if (phant_file.endsWith(".gz")) {
+        phant_file.chop(3); //remove the .gz from the sting file name
+    }
     if (phant_file.endsWith(".egsphant")) {
         phant_file.chop(9);
         phant_file.append("_modified.egsphant");
@@ -3576,18 +4277,15 @@ QString Interface::trimExisitngEGS_Mid(QString phant_file) {
     }
 
     updateProgress(increment);
-    selectedPhant->saveEGSPhantFile(phant_file);
-    QProcess *qzip = new QProcess();
-    qzip->setProcessChannelMode(QProcess::MergedChannels);
-    qzip->setReadChannel(QProcess::StandardOutput);
-    QString command = "gzip -f " + phant_file;  //-f used if exisitng .gz file, -f forces the
-    qzip->execute(command);
+    bool saved = selectedPhant->saveEGSPhantFile(phant_file + ".gz");
 
     updateProgress(increment);
     std::cout << "Egsphant has been trimmed (dimensions x: [" << selectedPhant->x[0] << "," << selectedPhant->x[selectedPhant->nx] << "], y:["
               << selectedPhant->y[0] << "," << selectedPhant->y[selectedPhant->ny] << "], z:["
               << selectedPhant->z[0] << "," << selectedPhant->z[selectedPhant->nz] << "]) \n";
-    std::cout << "Trimmed egsphant file successfully output." <<phant_file.toStdString() <<".gz  \n";
+    if (saved) {
+        std::cout << "Trimmed egsphant file successfully output." <<phant_file.toStdString() <<".gz  \n";
+    }
 
     progress->setValue(1000000000);
     progWin->hide();
@@ -3928,130 +4626,1121 @@ void Interface::set_tissue_selection() {
             //std::cout<<get_data->structName[i].toStdString() <<" " <<structUnique[i] <<"\n";
         }
     }
-    else {
-        for (int i=0; i<tas.size(); i++) {
-            bool foundStruct = false;
-            medThresholds.resize(medThresholds.size()+1);
-            denThresholds.resize(denThresholds.size()+1);
+    else {
+        for (int i=0; i<tas.size(); i++) {
+            bool foundStruct = false;
+            medThresholds.resize(medThresholds.size()+1);
+            denThresholds.resize(denThresholds.size()+1);
+
+            if (tas[i] == " " || tas[i].toLower() == "default") { //contains("Default",Qt::CaseInsensitive)){ //The dicom structure was unassigned
+                medThresholds.last() = medThreshold;
+                denThresholds.last() = denThreshold;
+                foundStruct = true;
+                structUnique[i] = false;
+            }
+            else {
+                for (int j=0; j<structure.size(); j++)
+                    if (tas[i] ==  structure[j]) {
+                        medThresholds.last() << tissue[j];
+                        denThresholds.last() << density_max[j];
+                        foundStruct = true;
+                        structUnique[i] = true;
+                    }
+            }
+            if (!foundStruct) {
+                medThresholds.last() = medThreshold;
+                denThresholds.last() = denThreshold;
+                structUnique[i] = false;
+            }
+            //std::cout<<get_data->structName[i].toStdString() <<" " <<structUnique[i] <<"\n";
+        }
+    }
+    setup_egsphant();
+
+}
+
+void Interface::setup_egsphant() {
+
+    if (!readCalibFile) { //Typically here if reading the default file
+        QString fileName;
+        if (!readCalib()) {
+            do {
+                QMessageBox msgBox;
+                msgBox.setText(tr("The CT calibration file could not be read. Please select a valid hu2rho file.\nThe user manual contains the hu2rho file specifications."));
+                msgBox.setWindowTitle(tr("egs_brachy GUI"));
+                msgBox.exec();
+
+                fileName = QFileDialog::getOpenFileName(
+                               this,
+                               tr("Select a valid CT calibration file"),
+                               working_path, "hu2rho (*.hu2rho)");
+
+                if (fileName.isEmpty() || fileName.isNull()) {
+                    return;
+                }
+                else {
+                    density = fileName;
+                    readCalib();
+                }
+
+            }
+            while (!readCalibFile);
+        }
+
+        if (readCalibFile) {
+            std::cout<<"Successfully read CT calibration file " <<density.toStdString() <<"\n";
+        }
+    }
+
+    // ---------------------------------------------------------- //
+    // SETUP EGSPHANT AND HU CONVERSION MAPS/THRESHOLDS           //
+    // ---------------------------------------------------------- //
+
+    // Generate on the CT grid again if the last phantom was resampled, this
+    // has to happen before STR writes its densities into phant.  Every other
+    // density is taken from the HU again with the current calibration.
+    if (ctPhant.nx > 0) {
+        phant.copyFrom(ctPhant);
+        ctPhant.nx = 0;
+    }
+    phant.d.fill(0);
+
+
+    this->setDisabled(true);
+    if (get_data->treatment_type == "LDR" || get_data->treatment_type == "MANUAL") {
+        if (structUnique.contains(true)) {
+            get_prio = new priority(this, get_data->structName, structUnique);
+
+            get_prio->window->show();
+            QApplication::processEvents();
+            get_prio->setEnabled(TRUE);
+
+            connect(get_prio, SIGNAL(closed()), this, SLOT(setup_MAR()));
+            connect(get_prio, SIGNAL(exit()), this, SLOT(stop_process()));
+
+            get_prio->setDisabled(TRUE);
+            QApplication::processEvents();
+
+        }
+        else {
+            setup_MAR();
+        }
+    }
+    else {
+        if (structUnique.contains(true)) {
+            get_prio = new priority(this, get_data->structName, structUnique);
+
+            get_prio->window->show();
+            QApplication::processEvents();
+            get_prio->setEnabled(TRUE);
+
+            if (extraOptionsFlag) {
+                connect(get_prio, SIGNAL(closed()), this, SLOT(ATcreate_egsphant()));
+                connect(get_prio, SIGNAL(exit()), this, SLOT(stop_process()));
+            }
+            else {
+                connect(get_prio, SIGNAL(closed()), this, SLOT(create_egsphant()));
+                connect(get_prio, SIGNAL(exit()), this, SLOT(stop_process()));
+            }
+
+            get_prio->setDisabled(TRUE);
+            QApplication::processEvents();
+
+        }
+        else {
+            if (extraOptionsFlag) {
+                ATcreate_egsphant();
+            }
+            else {
+                create_egsphant();
+            }
+        }
+    }
+    this->setEnabled(true);
+}
+
+/***
+Function: labelRow
+------------------
+Process: Finds the struct of every voxel of phantom row j from the cached runs
+         of the contours in yIndex.  A contour only takes a voxel from one of
+         lower priority, so the first contour found wins a tie.
+Output:  rowStruct holds the struct index plus one (0 for none) and rowPrio
+         its priority.  If given, members gets the runs of every struct on the
+         row by structName index, as phant.contour stores them.  scratch
+         holds the buffers of a supersampled row, if it's not given they are
+         made for this row only.
+***/
+void Interface::labelRow(const QList<QPoint> &yIndex, int j, QVector <int> &rowStruct, QVector <int> &rowPrio,
+                         QVector <MemberRun> *members, SampleRows *scratch) const {
+    if (superSample > 1) {
+        SampleRows local;
+        labelRowSampled(yIndex, j, rowStruct, rowPrio, members, scratch ? *scratch : local);
+        return;
+    }
+
+    rowStruct.fill(0);
+    rowPrio.fill(0);
+    if (members) {
+        members->clear();
+    }
+    for (QList<QPoint>::const_iterator p = yIndex.constBegin(); p != yIndex.constEnd(); p++) {
+        int s = p->x();
+        const ContourRuns &contour = runCache.at(s, p->y());
+        for (int r = contour.rowStart[j]; r < contour.rowStart[j+1]; r += 2) {
+            if (members) {
+                MemberRun run = {tables.structRow[s]-1, contour.runs[r], contour.runs[r+1]};
+                members->append(run);
+            }
+            for (int i = contour.runs[r]; i < contour.runs[r+1]; i++)
+                if (structPrio[s] > rowPrio[i]) {
+                    rowStruct[i] = s+1; // Inflate index for the next check
+                    rowPrio[i] = structPrio[s];
+                }
+        }
+    }
+    if (members) {
+        StructMembership::compactRow(*members);
+    }
+}
+
+// count[i] is how many of the planes rows of n labels have value at i
+static void countLabel(const int *label, int planes, int n, int value, int *count) {
+    int i = 0;
+#ifdef __SSE2__
+    const __m128i v = _mm_set1_epi32(value);
+    for (; i+4 <= n; i += 4) {
+        __m128i acc = _mm_setzero_si128();
+        for (int p = 0; p < planes; p++) { // Each match is -1, so take it away
+            acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(label+p*n+i)), v));
+        }
+        _mm_storeu_si128((__m128i *)(count+i), acc);
+    }
+#endif
+    for (; i < n; i++) {
+        count[i] = 0;
+        for (int p = 0; p < planes; p++) {
+            count[i] += label[p*n+i] == value;
+        }
+    }
+}
+
+// Where count beats best, best takes count and struct takes value
+static void keepBest(const int *count, int n, int value, int *best, int *structs) {
+    int i = 0;
+#ifdef __SSE2__
+    const __m128i v = _mm_set1_epi32(value);
+    for (; i+4 <= n; i += 4) {
+        __m128i c = _mm_loadu_si128((const __m128i *)(count+i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(best+i));
+        __m128i s = _mm_loadu_si128((const __m128i *)(structs+i));
+        __m128i more = _mm_cmpgt_epi32(c, b);
+        _mm_storeu_si128((__m128i *)(best+i), _mm_or_si128(_mm_and_si128(more, c), _mm_andnot_si128(more, b)));
+        _mm_storeu_si128((__m128i *)(structs+i), _mm_or_si128(_mm_and_si128(more, v), _mm_andnot_si128(more, s)));
+    }
+#endif
+    for (; i < n; i++)
+        if (count[i] > best[i]) {
+            best[i] = count[i];
+            structs[i] = value;
+        }
+}
+
+/***
+Function: labelRowSampled
+-------------------------
+Process: labelRow with superSample by superSample samples per voxel.  Every
+         sample is labelled by priority from the runs of the sub-rows of row
+         j, then each voxel takes the struct covering most of its samples, the
+         higher priority one on a tie, and is left out of every struct only if
+         more of its samples are outside them all.  A struct is in members
+         where it covers at least half of a voxel.
+***/
+void Interface::labelRowSampled(const QList<QPoint> &yIndex, int j, QVector <int> &rowStruct, QVector <int> &rowPrio,
+                                QVector <MemberRun> *members, SampleRows &scratch) const {
+    int k = superSample, planes = k*k, nx = rowStruct.size();
+
+    // Sample t of sub-row r of voxel i is at (r*k+t)*nx+i, so that each
+    // sample plane is a row of voxels.  hit is left all zero between rows.
+    if (scratch.label.size() != planes*nx) {
+        scratch.label.resize(planes*nx);
+        scratch.prio.resize(planes*nx);
+        scratch.hit.fill(0, planes*nx);
+        scratch.count.resize(nx);
+        scratch.best.resize(nx);
+    }
+    int *label = scratch.label.data(), *prio = scratch.prio.data();
+    char *hit = scratch.hit.data();
+    std::fill(label, label+planes*nx, 0);
+    std::fill(prio, prio+planes*nx, 0);
+    QVector <int> &candidates = scratch.candidates; // Structs (inflated) with samples on the row
+    candidates.clear();
+    if (members) {
+        members->clear();
+    }
+
+    // zIndex is built struct by struct, so the contours of a struct follow
+    // each other in yIndex.  The samples each struct covers are gathered in
+    // hit while labelling and made into its member runs after its last contour.
+    QList<QPoint>::const_iterator p = yIndex.constBegin();
+    while (p != yIndex.constEnd()) {
+        int s = p->x();
+        int lo = nx, hi = -1; // Voxels with a sample of s
+        for (; p != yIndex.constEnd() && p->x() == s; p++) {
+            const ContourRuns &contour = runCache.at(s, p->y());
+            for (int r = 0; r < k; r++) {
+                int row = j*k+r;
+                for (int n = contour.rowStart[row]; n < contour.rowStart[row+1]; n += 2) {
+                    // Step along the run a sample at a time, moving on to the
+                    // next voxel every k samples
+                    int c0 = contour.runs[n], c1 = contour.runs[n+1];
+                    int i = c0/k, t = c0-i*k;
+                    int at = (r*k+t)*nx+i;
+                    lo = qMin(lo, i);
+                    hi = qMax(hi, (c1-1)/k);
+                    for (int c = c0; c < c1; c++) {
+                        if (structPrio[s] > prio[at]) {
+                            label[at] = s+1; // Inflate index for the next check
+                            prio[at] = structPrio[s];
+                        }
+                        hit[at] = 1;
+                        if (++t == k) {
+                            t = 0;
+                            i++;
+                            at = r*k*nx+i;
+                        }
+                        else {
+                            at += nx;
+                        }
+                    }
+                }
+            }
+        }
+        if (hi < lo) {
+            continue;
+        }
+
+        if (!candidates.contains(s+1)) {
+            candidates << s+1;
+        }
+        for (int i = lo; i <= hi; i++) {
+            int cover = 0;
+            for (int q = 0; q < planes; q++) {
+                cover += hit[q*nx+i];
+                hit[q*nx+i] = 0;
+            }
+            if (members && 2*cover >= planes) {
+                MemberRun run = {tables.structRow[s]-1, i, i+1};
+                members->append(run);
+            }
+        }
+    }
+
+    // Highest priority first, so it keeps a tie
+    std::stable_sort(candidates.begin(), candidates.end(), [this](int a, int b) {
+        return structPrio[a-1] > structPrio[b-1];
+    });
+
+    int *count = scratch.count.data(), *best = scratch.best.data();
+    std::fill(best, best+nx, 0);
+    rowStruct.fill(0);
+    for (int c = 0; c < candidates.size(); c++) {
+        countLabel(label, planes, nx, candidates[c], count);
+        keepBest(count, nx, candidates[c], best, rowStruct.data());
+    }
+    countLabel(label, planes, nx, 0, count);
+    keepBest(count, nx, 0, best, rowStruct.data());
+    for (int i = 0; i < nx; i++) {
+        rowPrio[i] = rowStruct[i] ? structPrio[rowStruct[i]-1] : 0;
+    }
+
+    if (members) {
+        StructMembership::compactRow(*members);
+    }
+}
+
+/***
+Function: voxelizeSlab
+----------------------
+Process: Converts the HU of slices slab.k0 to slab.k1 into density, media,
+         contour and mask voxels of grid.phant.  TG43 gives everything the
+         first medium, MAR replaces low densities in the MAR contour and MASK
+         fills in the struct masks, each as its own instantiation so the loop
+         never tests them.  Each row's structs are found first, from the
+         contours or, with grid.sharedLabels, from a previous pass's labels.
+***/
+template <bool TG43, bool MAR, bool MASK>
+void Interface::voxelizeSlab(VoxelSlab &slab, const VoxelGrid &grid) const {
+    const EGSPhant &in = *grid.phant; // Only read through this, so nothing detaches
+    EGSPhant *out = grid.phant;
+    QList<QPoint> yIndex = slab.yIndex;
+    int carry = slab.inStruct; // Struct handed on to a row without contours
+
+    // Struct (inflated index) and priority of each voxel of the current row
+    QVector <int> rowStruct(in.nx, 0), rowPrio(in.nx, 0);
+    QVector <MemberRun> rowMembers; // Every struct on the current row
+    SampleRows scratch; // Reused by every row of the slab
+    if (yIndex.size() > 0 && !grid.sharedLabels) {
+        labelRow(yIndex, slab.yRow, rowStruct, rowPrio, &rowMembers, &scratch);
+    }
+
+    for (int k = slab.k0; k < slab.k1; k++) { // Z //
+        const QList<QPoint> &zIndex = grid.zIndex[k];
+        for (int j = 0; j < in.ny; j++) { // Y //
+            quint16 *rowLabel = grid.labels ? grid.labels+in.nx*(j+in.ny*k) : 0;
+
+            if (grid.sharedLabels && TG43) {
+                // Only the MAR contour matters, wherever it is and whatever
+                // won the voxel on priority
+                rowStruct.fill(0);
+                const QVector <MemberRun> &members = membership.rows[j+in.ny*k];
+                for (int r = 0; r < members.size(); r++)
+                    if (members[r].s == indexMARContour)
+                        for (int i = members[r].i0; i < members[r].i1; i++) {
+                            rowStruct[i] = grid.marStruct+1;
+                        }
+            }
+            else if (grid.sharedLabels) {
+                for (int i = 0; i < in.nx; i++) {
+                    rowStruct[i] = rowLabel[i];
+                }
+            }
+            else {
+                if (zIndex.size() > 0) {
+                    yIndex.clear(); // Reset lookup
+                    for (QList<QPoint>::const_iterator p = zIndex.constBegin(); p != zIndex.constEnd(); p++) {
+                        // If column p->y() of struct p->x() on the same column as slice k,j of the phantom
+                        if (grid.structRect[p->x()][p->y()].top() <= grid.rowHi[j] && grid.rowLo[j] <= grid.structRect[p->x()][p->y()].bottom()) {
+                            yIndex << *p;
+                        }
+                    }
+                    labelRow(yIndex, j, rowStruct, rowPrio, &rowMembers, &scratch);
+                }
+
+                if (yIndex.size() > 0) {
+                    grid.memberRows[j+in.ny*k] = rowMembers; // Shares rowMembers until it is relabelled
+                }
+                else {
+                    // A row without contours takes its struct from the voxel
+                    // before, one lower each time
+                    for (int i = 0; i < in.nx; i++) {
+                        rowStruct[i] = carry;
+                        carry = qMax(carry-1, 0);
+                    }
+                }
+                if (in.nx > 0) {
+                    carry = qMax(rowStruct[in.nx-1]-1, 0);
+                }
+
+                if (rowLabel)
+                    for (int i = 0; i < in.nx; i++) {
+                        rowLabel[i] = rowStruct[i];
+                    }
+            }
+
+            // The row is contiguous in each of the flat voxel arrays
+            qint64 row = out->index(0, j, k);
+            Density *rowD = out->d.data() + row;
+            char *rowM = out->m.data() + row;
+            quint16 *rowC = out->contour.data() + row;
+
+            for (int i = 0; i < in.nx; i++) { // X //
+                int tempHU = grid.hu(i, j, k);
+                double temp = tables.densityOf(tempHU);
+                temp = temp<=0?0.000001:temp; // Set min density to 0.000001
+
+                if (temp > slab.maxDensity) { // Track max density for images
+                    slab.maxDensity = temp;
+                }
+
+                //if in the selected contour, replace with low threshold value
+                Density &den = rowD[i];
+                bool fromHU = den == 0;
+                if (fromHU) {
+                    den = temp; //assign density
+                }
+                else {
+                    temp = den;
+                }
+
+                // get the right media
+                int inStruct = rowStruct[i];
+                if (inStruct) { // Deflate index again
+                    inStruct--;
+
+                    int r = tables.structRow[inStruct];
+                    int q = r-1; // get the structName index which matches denThresholds
+
+                    //Flag if in the selected contour for STR
+                    if (MAR && q == indexMARContour && den < low_threshold) {
+                        den = replacement;
+                    }
+
+                    if (TG43) {
+                        rowM[i] = 49;
+                    }
+                    else {
+                        rowM[i] = fromHU ? tables.mediaOfHU(r, tempHU) : tables.mediaOf(r, temp);
+                        rowC[i] = q;
+
+                        //To generate mask
+                        if (MASK && grid.structMask[inStruct] >= 0) {
+                            grid.masks[grid.structMask[inStruct]]->m[row+i] = 1;
+                        }
+                    }
+                }
+                else {
+                    rowM[i] = TG43 ? 49 : fromHU ? tables.mediaOfHU(0, tempHU) : tables.mediaOf(0, temp);
+                }
+            }
+            (*grid.rowsDone)++;
+        }
+    }
+}
+
+/***
+Function: voxelizePhantom
+-------------------------
+Process: Fills in phant from the HU data and the contours of every struct in
+         structUnique, on the thread pool, picking the voxelizeSlab kernel for
+         the current mode.  structMask holds the index in masks of each
+         struct's mask, or -1.  If labels is given it gets the struct of every
+         voxel, or with sharedLabels is read back instead of the contours so
+         another scenario can be built on the same labelling.
+***/
+void Interface::voxelizePhantom(bool tg43, const QVector <int> &structMask, double increment,
+                                quint16 *labels, bool sharedLabels) {
+    double zMid;
+    superSample = qMax(1, options->phantom_sub_samples);
+
+    // Get bounding rectangles over each struct
+    VoxelGrid grid;
+    for (int i = 0; i < get_data->structPos.size(); i++) {
+        grid.structRect.resize(i+1);
+        for (int j = 0; j < get_data->structPos[i].size(); j++) {
+            grid.structRect[i].resize(j+1);
+            grid.structRect[i][j] = get_data->structPos[i][j].boundingRect();
+        }
+    }
+
+    // Contours on the same plane as each slice of the phantom
+    grid.zIndex.resize(phant.nz);
+    if (get_data->structZ.size() > 0) {
+        for (int k = 0; k < phant.nz; k++) { // Z //
+            zMid = (phant.z[k]+phant.z[k+1])/2.0;
+            for (int l = 0; l < get_data->structZ.size(); l++)
+                if (structUnique[l])
+                    for (int m = 0; m < get_data->structZ[l].size(); m++) {
+                        // If slice j of struct i on the same plane as slice k of the phantom
+                        if (abs(get_data->structZ[l][m] - zMid) < (phant.z[k+1]-phant.z[k])/2.0) {
+                            grid.zIndex[k] << QPoint(l,m);    // Add it to lookup
+                        }
+                    }
+        }
+    }
+
+    // The y range of each row's sample centres, a contour is only looked up
+    // on the rows it reaches
+    grid.rowLo.resize(phant.ny);
+    grid.rowHi.resize(phant.ny);
+    for (int j = 0; j < phant.ny; j++) {
+        double dy = (phant.y[j+1]-phant.y[j])/superSample;
+        grid.rowLo[j] = superSample == 1 ? (phant.y[j]+phant.y[j+1])/2.0 : phant.y[j]+dy/2.0;
+        grid.rowHi[j] = superSample == 1 ? (phant.y[j]+phant.y[j+1])/2.0 : phant.y[j+1]-dy/2.0;
+    }
+
+    // Rasterize the contours that are needed and not already cached, each
+    // one on every row it spans.  With sub-samples the rows and columns are
+    // those of the sub-samples, superSample to each voxel side.
+    {
+        QVector <double> xs = phant.x, ys = phant.y;
+        if (superSample > 1) {
+            xs.resize(0);
+            ys.resize(0);
+            for (int i = 0; i < phant.nx; i++)
+                for (int t = 0; t < superSample; t++) {
+                    xs << phant.x[i]+(phant.x[i+1]-phant.x[i])*t/superSample;
+                }
+            xs << phant.x[phant.nx];
+            for (int j = 0; j < phant.ny; j++)
+                for (int t = 0; t < superSample; t++) {
+                    ys << phant.y[j]+(phant.y[j+1]-phant.y[j])*t/superSample;
+                }
+            ys << phant.y[phant.ny];
+        }
+        runCache.prepare(get_data->structPos, xs, ys);
+
+        // A contour is marked done as it is queued so that it is only queued
+        // once, it is filled in below before anything reads it
+        QVector <ContourRuns *> missing;
+        QVector <QPoint> which;
+        for (int k = 0; k < phant.nz; k++)
+            for (QList<QPoint>::const_iterator p = grid.zIndex[k].constBegin(); p != grid.zIndex[k].constEnd(); p++) {
+                ContourRuns *contour = runCache.entry(p->x(), p->y());
+                if (!contour->done) {
+                    contour->done = true;
+                    missing.append(contour);
+                    which.append(*p);
+                }
+            }
+
+        if (missing.size() > 0) {
+            ContourRuns **out = missing.data();
+            const QPoint *in = which.constData();
+            const ContourRunCache *cache = &runCache;
+            const QVector <QVector <QPolygonF> > &structPos = get_data->structPos;
+            const QVector <QVector <QRectF> > &structRect = grid.structRect;
+            QVector <int> task(missing.size());
+            for (int i = 0; i < task.size(); i++) {
+                task[i] = i;
+            }
+
+            std::atomic<int> done(0);
+            waitForWorkers(QtConcurrent::map(task, [&](int i) {
+                cache->rasterize(out[i], structPos[in[i].x()][in[i].y()], structRect[in[i].x()][in[i].y()]);
+                done++;
+            }), &done, 0);
+        }
+    }
+
+    // The slices are voxelized in z slabs on the thread pool.  A slice with no
+    // contours keeps using the contours of the row before it, and a row with
+    // none carries inStruct on from the voxel before it, so each slab starts
+    // from the state the serial loop would have had on reaching it.
+    QVector <VoxelSlab> slabs;
+    {
+        int slabSize = qMax(1, phant.nz/(4*QThread::idealThreadCount()));
+        QList<QPoint> yIndex, lastIndex; // Contours of the last row, and of the last row that had any
+        int yRow = 0, lastRow = 0;
+        qint64 after = 0; // Voxels since lastIndex's row
+        QVector <int> rowStruct(phant.nx, 0), rowPrio(phant.nx, 0);
+
+        for (int k = 0; k < phant.nz; k++) { // Z //
+            if (k%slabSize == 0) {
+                VoxelSlab slab;
+                slab.k0 = k;
+                slab.k1 = qMin(phant.nz, k+slabSize);
+                slab.yIndex = yIndex;
+                slab.yRow = yRow;
+                slab.inStruct = 0;
+                slab.maxDensity = phant.maxDensity;
+                if (!lastIndex.isEmpty() && phant.nx > 0) {
+                    labelRow(lastIndex, lastRow, rowStruct, rowPrio);
+                    slab.inStruct = qMax(qint64(0), rowStruct[phant.nx-1]-1-after);
+                }
+                slabs.append(slab);
+            }
+
+            for (int j = 0; j < phant.ny; j++) { // Y //
+                if (grid.zIndex[k].size() > 0) {
+                    yIndex.clear(); // Reset lookup
+                    yRow = j;
+                    for (QList<QPoint>::const_iterator p = grid.zIndex[k].constBegin(); p != grid.zIndex[k].constEnd(); p++)
+                        if (grid.structRect[p->x()][p->y()].top() <= grid.rowHi[j] && grid.rowLo[j] <= grid.structRect[p->x()][p->y()].bottom()) {
+                            yIndex << *p;
+                        }
+                }
+
+                if (yIndex.size() > 0) {
+                    lastIndex = yIndex;
+                    lastRow = yRow;
+                    after = 0;
+                }
+                else {
+                    after += phant.nx;
+                }
+            }
+        }
+    }
+
+    // The voxel arrays may still be shared with a copy of the phantom, give
+    // them their own storage so the slabs never detach one at the same time
+    bool mask = false;
+    for (int i = 0; i < structMask.size(); i++)
+        if (structMask[i] >= 0) {
+            mask = true;
+        }
+    phant.d.detach();
+    phant.m.detach();
+    phant.contour.detach();
+    if (mask)
+        for (int idx = 0; idx < masks.size(); idx++) {
+            masks[idx]->m.detach();
+        }
+
+    // Every struct of each row, the slabs each write their own rows
+    if (!sharedLabels) {
+        membership.reset(phant.nx, phant.ny, phant.nz);
+    }
+    grid.memberRows = membership.rows.data();
+    grid.labels = labels;
+    grid.sharedLabels = sharedLabels && labels;
+    grid.marStruct = -1;
+    for (int i = 0; i < tables.structRow.size(); i++)
+        if (indexMARContour != -1 && tables.structRow[i]-1 == indexMARContour) {
+            grid.marStruct = i;
+        }
+
+    std::atomic<int> rowsDone(0);
+    grid.phant = &phant;
+    grid.masks = masks;
+    grid.structMask = structMask;
+    grid.hu = get_data->HU.view();
+    grid.rowsDone = &rowsDone;
+
+    typedef void (Interface::*Kernel)(VoxelSlab &, const VoxelGrid &) const;
+    static const Kernel kernels[2][2][2] = {
+        {   {&Interface::voxelizeSlab<false, false, false>, &Interface::voxelizeSlab<false, false, true>},
+            {&Interface::voxelizeSlab<false, true, false>, &Interface::voxelizeSlab<false, true, true>}
+        },
+        {   {&Interface::voxelizeSlab<true, false, false>, &Interface::voxelizeSlab<true, false, true>},
+            {&Interface::voxelizeSlab<true, true, false>, &Interface::voxelizeSlab<true, true, true>}
+        }
+    };
+    Kernel kernel = kernels[tg43][setup_MAR_Flag][mask];
+
+    waitForWorkers(QtConcurrent::map(slabs, [this, kernel, &grid](VoxelSlab &slab) {
+        (this->*kernel)(slab, grid);
+    }), &rowsDone, increment);
+
+    for (int l = 0; l < slabs.size(); l++)
+        if (slabs[l].maxDensity > phant.maxDensity) {
+            phant.maxDensity = slabs[l].maxDensity;
+        }
+}
+
+/***
+Function: blockFactors
+----------------------
+Process: How many CT voxels along x, y and z come closest to size mm
+***/
+void Interface::blockFactors(double size, int f[3]) const {
+    f[0] = qMax(1, qRound(size/10.0/(phant.x[1]-phant.x[0])));
+    f[1] = qMax(1, qRound(size/10.0/(phant.y[1]-phant.y[0])));
+    f[2] = qMax(1, qRound(size/10.0/((phant.z[phant.nz]-phant.z[0])/phant.nz)));
+}
+
+/***
+Function: resamplePhantom
+-------------------------
+Process: Merges the voxels of phant into blocks of whole voxels as close to
+         size mm across as the CT spacing allows
+***/
+void Interface::resamplePhantom(double size, const quint16 *labels) {
+    int f[3];
+    blockFactors(size, f);
+    if (f[0] == 1 && f[1] == 1 && f[2] == 1) {
+        std::cout << "The phantom voxels are already " << size << " mm or less, not resampling.\n";
+        return;
+    }
+
+    QVector <QVector <int> > cuts(3);
+    int n[3] = {phant.nx, phant.ny, phant.nz};
+    for (int a = 0; a < 3; a++) {
+        for (int i = 0; i < n[a]; i += f[a]) {
+            cuts[a] << i;
+        }
+        cuts[a] << n[a];
+    }
+    mergeVoxels(cuts, labels);
+}
 
-            if (tas[i] == " " || tas[i].toLower() == "default") { //contains("Default",Qt::CaseInsensitive)){ //The dicom structure was unassigned
-                medThresholds.last() = medThreshold;
-                denThresholds.last() = denThreshold;
-                foundStruct = true;
-                structUnique[i] = false;
-            }
-            else {
-                for (int j=0; j<structure.size(); j++)
-                    if (tas[i] ==  structure[j]) {
-                        medThresholds.last() << tissue[j];
-                        denThresholds.last() << density_max[j];
-                        foundStruct = true;
-                        structUnique[i] = true;
+/***
+Function: adaptPhantom
+----------------------
+Process: Merges the voxels of phant into a grid that keeps the CT voxels
+         within radius mm of any seed or target (PTV, CTV or GTV) struct, and
+         past that grows coarser by one CT voxel per axis every radius mm, up
+         to blocks of size mm.  Each axis is cut on its own, from the distance
+         of each CT voxel's centre to the seeds and targets along that axis.
+***/
+void Interface::adaptPhantom(double size, double radius, const quint16 *labels) {
+    int f[3];
+    blockFactors(size, f);
+    radius /= 10.0;
+
+    // The stretch of each axis to keep fine, as (from, to) pairs
+    QVector <QVector <double> > fine(3);
+    for (int i = 0; i < get_data->all_seed_pos.size(); i++)
+        for (int j = 0; j < get_data->all_seed_pos[i].size(); j++) {
+            const coordinate &seed = get_data->all_seed_pos[i][j];
+            fine[0] << seed.x-radius << seed.x+radius;
+            fine[1] << seed.y-radius << seed.y+radius;
+            fine[2] << seed.z-radius << seed.z+radius;
+        }
+    for (int s = 0; s < get_data->structType.size() && s < get_data->structPos.size(); s++) {
+        QString type = get_data->structType[s];
+        if (type != "PTV" && type != "CTV" && type != "GTV") {
+            continue;
+        }
+        for (int c = 0; c < get_data->structPos[s].size(); c++) {
+            QRectF rect = get_data->structPos[s][c].boundingRect();
+            fine[0] << rect.left()-radius << rect.right()+radius;
+            fine[1] << rect.top()-radius << rect.bottom()+radius;
+            if (c < get_data->structZ[s].size()) {
+                fine[2] << get_data->structZ[s][c]-radius << get_data->structZ[s][c]+radius;
+            }
+        }
+    }
+
+    QVector <QVector <int> > cuts(3);
+    const QVector <double> *bounds[3] = {&phant.x, &phant.y, &phant.z};
+    for (int a = 0; a < 3; a++) {
+        const QVector <double> &b = *bounds[a];
+        int n = b.size()-1;
+
+        // Largest block each voxel may be part of
+        QVector <int> most(n, f[a]);
+        if (!fine[a].isEmpty())
+            for (int i = 0; i < n; i++) {
+                double c = (b[i]+b[i+1])/2.0, d = -1;
+                for (int l = 0; l < fine[a].size(); l += 2) {
+                    double dl = c < fine[a][l] ? fine[a][l]-c : c > fine[a][l+1] ? c-fine[a][l+1] : 0;
+                    if (d < 0 || dl < d) {
+                        d = dl;
                     }
+                }
+                most[i] = qMin(f[a], 1+int(d/radius));
             }
-            if (!foundStruct) {
-                medThresholds.last() = medThreshold;
-                denThresholds.last() = denThreshold;
-                structUnique[i] = false;
+
+        // Grow each block while every voxel in it allows one that big
+        for (int i = 0; i < n;) {
+            cuts[a] << i;
+            int len = 1, limit = most[i];
+            while (i+len < n && len < qMin(limit, most[i+len])) {
+                limit = qMin(limit, most[i+len]);
+                len++;
             }
-            //std::cout<<get_data->structName[i].toStdString() <<" " <<structUnique[i] <<"\n";
+            i += len;
         }
+        cuts[a] << n;
     }
-    setup_egsphant();
-
+    mergeVoxels(cuts, labels);
 }
 
-void Interface::setup_egsphant() {
+/***
+Function: mergeVoxels
+---------------------
+Process: Merges the voxels of phant (and of the masks) into the blocks between
+         cuts[0], cuts[1] and cuts[2], the first CT voxel of each block along
+         x, y and z, followed by the voxel count.  One slice of blocks is done
+         per task.  Each block gets the mean density of its voxels, and the
+         media and contour holding most of its volume.  If labels, the
+         inflated struct of every CT voxel from voxelizePhantom, is given each
+         voxel's vote is weighted by the priority of its struct.  The CT grid
+         phant is kept in ctPhant to generate from next time.
+***/
+void Interface::mergeVoxels(const QVector <QVector <int> > &cuts, const quint16 *labels) {
+    EGSPhant coarse;
+    coarse.nx = cuts[0].size()-1;
+    coarse.ny = cuts[1].size()-1;
+    coarse.nz = cuts[2].size()-1;
+    for (int i = 0; i <= coarse.nx; i++) {
+        coarse.x << phant.x[cuts[0][i]];
+    }
+    for (int j = 0; j <= coarse.ny; j++) {
+        coarse.y << phant.y[cuts[1][j]];
+    }
+    for (int k = 0; k <= coarse.nz; k++) {
+        coarse.z << phant.z[cuts[2][k]];
+    }
+    coarse.media = phant.media;
+    coarse.maxDensity = phant.maxDensity;
+    coarse.allocate(true);
 
-    if (!readCalibFile) { //Typically here if reading the default file
-        QString fileName;
-        if (!readCalib()) {
-            do {
-                QMessageBox msgBox;
-                msgBox.setText(tr("The CT calibration file could not be read. Please select a valid hu2rho file.\nThe user manual contains the hu2rho file specifications."));
-                msgBox.setWindowTitle(tr("egs_brachy GUI"));
-                msgBox.exec();
+    QVector <EGSPhant *> coarseMasks;
+    for (int idx = 0; idx < masks.size(); idx++) {
+        coarseMasks << new EGSPhant;
+        coarseMasks[idx]->makeMask(&coarse);
+    }
 
-                fileName = QFileDialog::getOpenFileName(
-                               this,
-                               tr("Select a valid CT calibration file"),
-                               working_path, "hu2rho (*.hu2rho)");
+    setup_progress_bar("Resampling the phantom", "");
+    double increment = 1000000000/(coarse.nz+1);
+    updateProgress(increment);
 
-                if (fileName.isEmpty() || fileName.isNull()) {
-                    return;
+    QVector <int> slices(coarse.nz);
+    for (int k = 0; k < slices.size(); k++) {
+        slices[k] = k;
+    }
+
+    const EGSPhant &fine = phant;
+    const QVector <EGSPhant *> &fineMasks = masks;
+    const QVector <int> &prio = structPrio;
+    const QVector <int> &structRow = tables.structRow;
+    EGSPhant *out = &coarse;
+    const QVector <EGSPhant *> &outMasks = coarseMasks;
+    std::atomic<int> done(0);
+
+    waitForWorkers(QtConcurrent::map(slices, [&](int K) {
+        // Weighted votes of the voxels of one block, there are few enough
+        // values in a block that a linear search is quickest
+        QVector <int> value;
+        QVector <double> weight;
+        auto vote = [&](int v, double w) {
+            int n = value.indexOf(v);
+            if (n == -1) {
+                value << v;
+                weight << w;
+            }
+            else {
+                weight[n] += w;
+            }
+        };
+        auto winner = [&]() {
+            int n = 0;
+            for (int l = 1; l < weight.size(); l++)
+                if (weight[l] > weight[n]) {
+                    n = l;
                 }
-                else {
-                    density = fileName;
-                    readCalib();
+            int v = value[n];
+            value.clear();
+            weight.clear();
+            return v;
+        };
+
+        int k0 = cuts[2][K], k1 = cuts[2][K+1];
+        for (int J = 0; J < out->ny; J++) {
+            int j0 = cuts[1][J], j1 = cuts[1][J+1];
+            for (int I = 0; I < out->nx; I++) {
+                int i0 = cuts[0][I], i1 = cuts[0][I+1];
+                qint64 block = out->index(I, J, K);
+
+                // Volume weighted mean density, and the medium with the most votes
+                double mass = 0, volume = 0;
+                for (int k = k0; k < k1; k++)
+                    for (int j = j0; j < j1; j++)
+                        for (int i = i0; i < i1; i++) {
+                            double v = (fine.x[i+1]-fine.x[i])*(fine.y[j+1]-fine.y[j])*(fine.z[k+1]-fine.z[k]);
+                            qint64 n = fine.index(i,j,k);
+                            int s = labels ? labels[n] : 0;
+                            mass += fine.d[n]*v;
+                            volume += v;
+                            vote(fine.m[n], s != 0 && s <= prio.size() ? v*(1+prio[s-1]) : v);
+                        }
+                out->d[block] = mass/volume;
+                out->m[block] = winner();
+
+                // With labels the structs vote, and the winner's contour index
+                // is taken from its media row, 0 being no struct
+                for (int k = k0; k < k1; k++)
+                    for (int j = j0; j < j1; j++)
+                        for (int i = i0; i < i1; i++) {
+                            double v = (fine.x[i+1]-fine.x[i])*(fine.y[j+1]-fine.y[j])*(fine.z[k+1]-fine.z[k]);
+                            qint64 n = fine.index(i,j,k);
+                            if (labels) {
+                                int s = labels[n];
+                                vote(s, s != 0 && s <= prio.size() ? v*(1+prio[s-1]) : v);
+                            }
+                            else {
+                                vote(fine.contour[n], v);
+                            }
+                        }
+                int c = winner();
+                if (labels) {
+                    c = c != 0 && c <= structRow.size() ? structRow[c-1]-1 : 0;
+                }
+                out->contour[block] = c;
+
+                for (int idx = 0; idx < fineMasks.size(); idx++) {
+                    const EGSPhant &mask = *fineMasks[idx];
+                    for (int k = k0; k < k1; k++)
+                        for (int j = j0; j < j1; j++)
+                            for (int i = i0; i < i1; i++) {
+                                vote(mask.m[mask.index(i,j,k)], (fine.x[i+1]-fine.x[i])*(fine.y[j+1]-fine.y[j])*(fine.z[k+1]-fine.z[k]));
+                            }
+                    outMasks[idx]->m[block] = winner();
                 }
-
             }
-            while (!readCalibFile);
         }
+        done++;
+    }), &done, increment);
 
-        if (readCalibFile) {
-            std::cout<<"Successfully read CT calibration file " <<density.toStdString() <<"\n";
-        }
+    std::cout << "Resampled the phantom from " << phant.nx << "x" << phant.ny << "x" << phant.nz << " to "
+              << coarse.nx << "x" << coarse.ny << "x" << coarse.nz << " voxels.\n";
+
+    ctPhant.copyFrom(phant);
+    phant.copyFrom(coarse);
+    for (int idx = 0; idx < masks.size(); idx++) {
+        delete masks[idx];
     }
+    masks = coarseMasks;
+    membership = StructMembership(); // Only holds for the CT grid
 
-    // ---------------------------------------------------------- //
-    // SETUP EGSPHANT AND HU CONVERSION MAPS/THRESHOLDS           //
-    // ---------------------------------------------------------- //
+    // The trim window indexes the boundaries of the new grid
+    trimEGS->x = phant.x;
+    trimEGS->y = phant.y;
+    trimEGS->z = phant.z;
+    trimEGS->reset_bounds();
 
+    progress->setValue(1000000000);
+    progWin->hide();
+    progWin->close();
+}
 
+/***
+Function: create_scenario_egsphants
+-----------------------------------
+Process: Builds one egsphant per scenario from the same CT and contours.  The
+         contours are rasterized and every voxel labelled once, and each
+         scenario only redoes the density and media of the voxels, as TG-43
+         or with the current tissue assignment scheme, and with its own MAR
+         setting.  Masks come from the first non TG-43 scenario.  The MAR
+         setting is put back at the end, and phant is left holding the first
+         scenario built.
+***/
+void Interface::create_scenario_egsphants(const QVector <PhantomScenario> &scenarios) {
+    if (scenarios.isEmpty()) {
+        return;
+    }
     this->setDisabled(true);
-    if (get_data->treatment_type == "LDR" || get_data->treatment_type == "MANUAL") {
-        if (structUnique.contains(true)) {
-            get_prio = new priority(this, get_data->structName, structUnique);
-
-            get_prio->window->show();
-            QApplication::processEvents();
-            get_prio->setEnabled(TRUE);
 
-            connect(get_prio, SIGNAL(closed()), this, SLOT(setup_MAR()));
-            connect(get_prio, SIGNAL(exit()), this, SLOT(stop_process()));
+    if (structUnique.contains(true)) {
+        structPrio = get_prio->structPrio;
+    }
+    std::clock_t start;
+    double duration;
+    start = std::clock();
 
-            get_prio->setDisabled(TRUE);
-            QApplication::processEvents();
+    //Assign enternal contours a default priority
+    for (int i = 0; i < get_data->structName.size(); i++) {
+        if (get_data->structType[i] ==  "EXTERNAL") {
+            structUnique[i] = true;
+            structPrio[i] = 1;
+            external[i] = true;
+        }
+    }
 
+    // Build the non TG-43 scenarios first, so the labelling is done with
+    // their priorities and the masks come from one of them
+    QVector <int> order;
+    for (int l = 0; l < scenarios.size(); l++)
+        if (!scenarios[l].tg43) {
+            order << l;
         }
-        else {
-            setup_MAR();
+    for (int l = 0; l < scenarios.size(); l++)
+        if (scenarios[l].tg43) {
+            order << l;
         }
-    }
-    else {
-        if (structUnique.contains(true)) {
-            get_prio = new priority(this, get_data->structName, structUnique);
 
-            get_prio->window->show();
-            QApplication::processEvents();
-            get_prio->setEnabled(TRUE);
+    // The setting each scenario may change
+    bool mar = setup_MAR_Flag;
 
-            if (extraOptionsFlag) {
-                connect(get_prio, SIGNAL(closed()), this, SLOT(ATcreate_egsphant()));
-                connect(get_prio, SIGNAL(exit()), this, SLOT(stop_process()));
-            }
-            else {
-                connect(get_prio, SIGNAL(closed()), this, SLOT(create_egsphant()));
-                connect(get_prio, SIGNAL(exit()), this, SLOT(stop_process()));
-            }
+    // phant may still hold the densities of the last phantom generated,
+    // every one of them is taken from the HU again.  The STR densities are
+    // put back per scenario as only some of the scenarios use MAR.
+    EGSPhant base, first;
+    base.copyFrom(phant);
+    base.d.fill(0);
+    QVector <quint16> labels(phant.nx*phant.ny*phant.nz, 0);
+    bool labelled = false;
+    QMap <QString,unsigned char> mediaMap;
 
-            get_prio->setDisabled(TRUE);
-            QApplication::processEvents();
+    setup_progress_bar("Generating the phantoms", "");
+    double increment = 1000000000/(double(phant.ny)*phant.nz*(scenarios.size()+1) +3);
+    updateProgress(increment);
 
-        }
-        else {
-            if (extraOptionsFlag) {
-                ATcreate_egsphant();
+    for (int l = 0; l < order.size(); l++) {
+        const PhantomScenario &scenario = scenarios[order[l]];
+        setup_MAR_Flag = scenario.mar;
+
+        phant.copyFrom(base);
+        buildMediaMap(scenario.tg43, mediaMap, scenario.medium);
+        compileMediaTables(mediaMap);
+        if (scenario.mar) {
+            replace_seed_densities();
+        }
+
+        if (!labelled) {
+            // Masks, which only depend on the labelling
+            QVector <int> structMask(genMask.size(), -1);
+            QVector <QString> maskName;
+            if (!scenario.tg43)
+                for (int i = 0; i < genMask.size() && i < get_data->structName.size(); i++)
+                    if (genMask[i]) {
+                        EGSPhant *temp = new EGSPhant;
+                        temp->makeMask(&phant);
+                        structMask[i] = masks.size();
+                        maskName.append(get_data->structName[i]);
+                        masks << temp;
+                    }
+
+            voxelizePhantom(scenario.tg43, structMask, increment, labels.data());
+            labelled = true;
+
+            for (int i = masks.size()-1; i >= 0; i--) {
+                masks[i]->saveEGSPhantFile(maskName[i]+"_mask.egsphant");
+                delete masks[i];
             }
-            else {
-                create_egsphant();
+            masks.clear();
+
+            // A TG-43 phantom only looks at the MAR contour, which the
+            // labelling may have given to a higher priority struct
+            if (scenario.tg43) {
+                phant.copyFrom(base);
+                if (scenario.mar) {
+                    replace_seed_densities();
+                }
+                voxelizePhantom(true, QVector <int>(), increment, labels.data(), true);
             }
         }
+        else {
+            voxelizePhantom(scenario.tg43, QVector <int>(), increment, labels.data(), true);
+        }
+
+        if (first.nx == 0) {
+            first.copyFrom(phant);
+            media = phant.media;
+        }
+
+        if (phant.saveEGSPhantFile(scenario.path + ".gz")) {
+            duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+            std::cout << "Egsphant file successfully output." << scenario.path.toStdString() << ".gz  Time elapsed is " << duration << " s.\n";
+        }
     }
+
+    // Put back the setting of the single phantom workflow
+    setup_MAR_Flag = mar;
+    phant.copyFrom(first.nx == 0 ? base : first);
+
+    progress->setValue(1000000000);
+    progWin->hide();
+    progWin->close();
+
     this->setEnabled(true);
 }
 
+/***
+Function: create_tg43_comparison
+--------------------------------
+Process: Writes a TG-43 phantom next to the egsphant last created, built by
+         create_scenario_egsphants on the CT grid with the same contours,
+         priorities and MAR setting.  The phantom the egsinp refers to is left
+         in phant afterwards.
+***/
+void Interface::create_tg43_comparison() {
+    QString path = egs_input->egsphant_location;
+    if (path.endsWith(".egsphant")) {
+        path.chop(9);
+    }
+
+    QVector <PhantomScenario> scenarios(1);
+    scenarios[0].path = path + "_tg43.egsphant";
+    scenarios[0].tg43 = true; // In WATER_0.998, not the medium of the clinical scheme
+    scenarios[0].mar = setup_MAR_Flag;
+
+    EGSPhant current;
+    current.copyFrom(phant);
+    QVector <QString> currentMedia = media;
+    if (ctPhant.nx > 0) { // Resampled, the labelling needs the CT grid
+        phant.copyFrom(ctPhant);
+    }
+
+    create_scenario_egsphants(scenarios);
+
+    phant.copyFrom(current);
+    media = currentMedia;
+}
+
 /***
 Function::create_egsphant
 ----------------------
@@ -4078,14 +5767,6 @@ void Interface::create_egsphant() {
     phant.media.clear();
 
     if (tg43Flag) {
-
-        // Track the number of media, and create a lookup for media to ASCII character representation
-        int medNum = 0;
-        phant.media.append(tissue[0]);
-        mediaMap.insert(tissue[0], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
-
-
-
         structUnique.resize(get_data->structName.size());
         structUnique.fill(false);
         structPrio.resize(get_data->structName.size());
@@ -4111,28 +5792,10 @@ void Interface::create_egsphant() {
                 external[i] = true;
             }
         }
-
-        // Track the number of media, and create a lookup for media to ASCII character representation
-        int medNum = 0;
-
-        for (int i = 0; i < medThreshold.size(); i++) {
-            if (!mediaMap.contains(medThreshold[i])) {
-                phant.media.append(medThreshold[i]);
-                mediaMap.insert(medThreshold[i], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
-                medNum++; // 49 is the ASCII value of '1', 7 jumps from ';' to 'A', 6 jumps from '[' to 'a'
-            }
-        }
-
-        for (int i = 0; i < get_data->structName.size(); i++) {
-            for (int j = 0; j < medThresholds[i].size(); j++)
-                if (!mediaMap.contains(medThresholds[i][j])) {
-                    phant.media.append(medThresholds[i][j]);
-                    mediaMap.insert(medThresholds[i][j], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
-                    medNum++; // 49 is the ASCII value of '1', 7 jumps from ';' to 'A', 6 jumps from '[' to 'a'
-                }
-        }
-
     }
+    buildMediaMap(tg43Flag, mediaMap);
+    compileMediaTables(mediaMap);
+
     // ---------------------------------------------------------- //
     // CONVERTING HU TO APPROPRIATE DENSITY AND MEDIUM            //
     // ---------------------------------------------------------- //
@@ -4141,172 +5804,46 @@ void Interface::create_egsphant() {
     double increment =  1000000000/(phant.nx*phant.nz +3);
 
     updateProgress(increment);
-    QVector<QString> maskName;
-    QMap <int, int> maskToStructMap;
-    media = phant.media;
-
-
-    // Get bounding rectangles over each struct
-    QVector <QVector <QRectF> > structRect;
-    for (int i = 0; i < get_data->structPos.size(); i++) {
-        structRect.resize(i+1);
-        for (int j = 0; j < get_data->structPos[i].size(); j++) {
-            structRect[i].resize(j+1);
-            structRect[i][j] = get_data->structPos[i][j].boundingRect();
-        }
-    }
-
-
-    updateProgress(increment);
-    int j=0;
-    // Setup masks
-    if (!get_data->structName.isEmpty()) {
-        for (int i = 0; i < get_data->structName.size(); i++) {
-            if (genMask[i]) {
-                EGSPhant *temp = new EGSPhant;
-                temp->makeMask(&phant);
-                maskName.append(get_data->structName[i]);
-                masks << temp;
-                maskToStructMap.insert(i,j); //i == key, j == value
-                j++;
-            }
-        }
-    }
-
-    updateProgress(increment);
-    // Arrays that hold the struct numbers and center voxel values to be used
-    QList<QPoint> zIndex, yIndex, zExtIndex, yExtIndex;
-    QList<QPoint>::iterator p;
-    QVector<int> zSliceNoStruct;
-    double zMid, yMid, xMid;
-    int tempHU = 0, n = 0, q = 0, inStruct = 0, prio = 0;
-
-    // Convert HU to density and media without masks
-    for (int k = 0; k < phant.nz; k++) { // Z //
-        if (get_data->structZ.size() > 0) {
-            zIndex.clear(); // Reset lookup
-            zMid = (phant.z[k]+phant.z[k+1])/2.0;
-            for (int l = 0; l < get_data->structZ.size(); l++)
-                if (structUnique[l])
-                    for (int m = 0; m < get_data->structZ[l].size(); m++) {
-                        // If slice j of struct i on the same plane as slice k of the phantom
-                        if (abs(get_data->structZ[l][m] - zMid) < (phant.z[k+1]-phant.z[k])/2.0) {
-                            zIndex << QPoint(l,m);    // Add it to lookup
-                        }
-                    }
-            //if(zIndex.size() == 0 && !tg43Flag) //slice has no contour data
-            //zSliceNoStruct.append(k);
-
-        }
-
-        for (int j = 0; j < phant.ny; j++) { // Y //
-            if (zIndex.size() > 0) {
-                yIndex.clear(); // Reset lookup
-                yMid = (phant.y[j]+phant.y[j+1])/2.0;
-                for (p = zIndex.begin(); p != zIndex.end(); p++) {
-                    // If column p->y() of struct p->x() on the same column as slice k,j of the phantom
-                    if (structRect[p->x()][p->y()].top() <= yMid && yMid <= structRect[p->x()][p->y()].bottom()) {
-                        yIndex << *p;
-                    }
-                }
-            }
-
-            for (int i = 0; i < phant.nx; i++) { // X //
-                tempHU = get_data->HU[k][j][i];
-                xMid = (phant.x[i]+phant.x[i+1])/2.0;
-
-                // Linear search because I don't think these arrays every get big
-                // get the right density
-                for (n = 0; n < HUMap.size()-1; n++)
-                    if (HUMap[n] <= tempHU && tempHU < HUMap[n+1]) {
-                        break;
-                    }
-                if (tempHU < HUMap[0]) {
-                    n = 0;
-                }
-                if (tempHU > HUMap[HUMap.size()-1]) {
-                    n = HUMap.size() -2;
-                }
-
-
-                double temp = interp(tempHU,HUMap[n],HUMap[n+1],denMap[n],denMap[n+1]);
-                temp = temp<=0?0.000001:temp; // Set min density to 0.000001
-
-                if (temp > phant.maxDensity) { // Track max density for images
-                    phant.maxDensity = temp;
-                }
-
-                //if in the selected contour, replace with low threshold value
-                if (phant.d[i][j][k] == 0) {
-                    phant.d[i][j][k] = temp; //assign density
-                }
-                else {
-                    temp = phant.d[i][j][k];
-                }
-
-                // get the right media
-                if (yIndex.size() > 0) {
-                    inStruct = 0;
-                    prio = 0;
-                    for (p = yIndex.begin(); p != yIndex.end(); p++) { // Check through each
-                        // If row p->y() of struct p->x() on the same row as slice k,j,i of the phantom
-                        if (structRect[p->x()][p->y()].left() <= xMid && xMid <= structRect[p->x()][p->y()].right())
-                            if (get_data->structPos[p->x()][p->y()].containsPoint(QPointF(xMid,yMid), Qt::OddEvenFill)) {
-                                if (structPrio[p->x()] > prio) {
-                                    inStruct = p->x()+1; // Inflate index for the next check
-                                    prio = structPrio[p->x()]; // Set priority at this struct's prio
-                                }
-                            }
-                    }
-                }
-
-                if (inStruct) { // Deflate index again
-                    inStruct--;
+    QVector<QString> maskName;
+    QMap <int, int> maskToStructMap;
+    media = phant.media;
 
-                    q = get_data->structLookup[get_data->structReference[inStruct]]; // get the structName index which matches denThresholds
 
-                    //Flag if in the selected contour for STR
-                    if (setup_MAR_Flag && q == indexMARContour && phant.d[i][j][k] < low_threshold) {
-                        phant.d[i][j][k] = replacement;
-                    }
-                    //Find the media of the voxel
-                    if (!tg43Flag) {
-                        for (n = 0; n < denThresholds[q].size()-1; n++)
-                            if (temp < denThresholds[q][n]) {
-                                break;
-                            }
+    updateProgress(increment);
+    int j=0;
+    // Setup masks
+    if (!get_data->structName.isEmpty()) {
+        for (int i = 0; i < get_data->structName.size(); i++) {
+            if (genMask[i]) {
+                EGSPhant *temp = new EGSPhant;
+                temp->makeMask(&phant);
+                maskName.append(get_data->structName[i]);
+                masks << temp;
+                maskToStructMap.insert(i,j); //i == key, j == value
+                j++;
+            }
+        }
+    }
 
-                        phant.m[i][j][k] = mediaMap[medThresholds[q][n]];
-                        phant.contour[i][j][k] = q;
+    updateProgress(increment);
+    // Arrays that hold the struct numbers and center voxel values to be used
+    QVector<int> zSliceNoStruct;
+    int n = 0;
 
-                        //To generate mask
-                        if (genMask[inStruct]) {
-                            if (maskToStructMap.contains(inStruct)) {
-                                int idx = maskToStructMap.value(inStruct);
-                                masks[idx]->m[i][j][k] = 1;
-                            }
-                        }
-                    }
-                    else if (tg43Flag) {
-                        phant.m[i][j][k] = 49;
-                    }
-                }
-                else {
-                    if (!tg43Flag) {
-                        for (n = 0; n < denThreshold.size()-1; n++)
-                            if (temp < denThreshold[n]) {
-                                break;
-                            }
-                        phant.m[i][j][k] = 49 + n + (n>8?7:0) + (n>34?6:0);
-                    }
-                    else if (tg43Flag) {
-                        phant.m[i][j][k] = 49;
-                    }
-                }
-            }
-            updateProgress(increment);
+    // The mask each struct's voxels also go in, if any
+    QVector <int> structMask(genMask.size(), -1);
+    for (int i = 0; i < structMask.size(); i++)
+        if (genMask[i] && maskToStructMap.contains(i)) {
+            structMask[i] = maskToStructMap.value(i);
         }
+
+    // The struct of every voxel is kept to weight the votes by priority if
+    // the phantom is resampled
+    QVector <quint16> labels;
+    if (options->phantom_voxel_size > 0 && options->priority_vote) {
+        labels.fill(0, phant.size());
     }
+    voxelizePhantom(tg43Flag, structMask, increment, labels.isEmpty() ? 0 : labels.data());
 
     //Interpolate the struct data using slice of previous index
     if (!zSliceNoStruct.isEmpty() && !tg43Flag) {
@@ -4323,44 +5860,47 @@ void Interface::create_egsphant() {
                     }
                 }
 
+                VoxelSlice <quint16> con = phant.slice(phant.contour, 2, 0), srcCon = phant.slice(phant.contour, 2, nextSlice);
+                VoxelSlice <Density> den = phant.slice(phant.d, 2, 0);
+                VoxelSlice <char> med = phant.slice(phant.m, 2, 0);
                 for (int j = 0; j < phant.ny; j++)
                     for (int i = 0; i < phant.nx; i++) {
-                        phant.contour[i][j][0] = phant.contour[i][j][nextSlice];
+                        con(i,j) = srcCon(i,j);
                         for (int idx = 0; idx<masks.size(); idx++) {
-                            masks[idx]->m[i][j][0] = masks[idx]->m[i][j][nextSlice];
+                            masks[idx]->m[masks[idx]->index(i,j,0)] = masks[idx]->m[masks[idx]->index(i,j,nextSlice)];
                         }
 
-                        if (phant.contour[i][j][0] != 0) {
+                        if (con(i,j) != 0) {
 
-                            if (setup_MAR_Flag && phant.contour[i][j][0] == indexMARContour && phant.d[i][j][0] < low_threshold) { //STR
-                                phant.d[i][j][0] = replacement;
+                            if (setup_MAR_Flag && con(i,j) == indexMARContour && den(i,j) < low_threshold) { //STR
+                                den(i,j) = replacement;
                             }
 
                             if (!tg43Flag) {
-                                for (n = 0; n < denThresholds[phant.contour[i][j][0]].size()-1; n++)
-                                    if (phant.d[i][j][0] < denThresholds[phant.contour[i][j][0]][n]) {
+                                for (n = 0; n < denThresholds[con(i,j)].size()-1; n++)
+                                    if (den(i,j) < denThresholds[con(i,j)][n]) {
                                         break;
                                     }
 
-                                phant.m[i][j][0] = mediaMap[medThresholds[phant.contour[i][j][0]][n]];
+                                med(i,j) = mediaMap[medThresholds[con(i,j)][n]];
 
                             }
                             else {
-                                phant.m[i][j][0] = 49;
+                                med(i,j) = 49;
                             }
 
                         }
                         else {
                             if (!tg43Flag) {
                                 for (n = 0; n < denThreshold.size()-1; n++)
-                                    if (phant.d[i][j][0] < denThreshold[n]) {
+                                    if (den(i,j) < denThreshold[n]) {
                                         break;
                                     }
 
-                                phant.m[i][j][0] = 49 + n + (n>8?7:0) + (n>34?6:0);
+                                med(i,j) = 49 + n + (n>8?7:0) + (n>34?6:0);
                             }
                             else {
-                                phant.m[i][j][0] = 49;
+                                med(i,j) = 49;
                             }
                         }
 
@@ -4369,44 +5909,47 @@ void Interface::create_egsphant() {
             else {
                 std::cout<<zSliceNoStruct[m] <<"\n";
                 int prevSlice = zSliceNoStruct[m]-1;
+                VoxelSlice <quint16> con = phant.slice(phant.contour, 2, zSliceNoStruct[m]), srcCon = phant.slice(phant.contour, 2, prevSlice);
+                VoxelSlice <Density> den = phant.slice(phant.d, 2, zSliceNoStruct[m]);
+                VoxelSlice <char> med = phant.slice(phant.m, 2, zSliceNoStruct[m]);
                 for (int j = 0; j < phant.ny; j++)
                     for (int i = 0; i < phant.nx; i++) {
-                        phant.contour[i][j][zSliceNoStruct[m]] = phant.contour[i][j][prevSlice];
+                        con(i,j) = srcCon(i,j);
                         for (int idx = 0; idx<masks.size(); idx++) {
-                            masks[idx]->m[i][j][zSliceNoStruct[m]] = masks[idx]->m[i][j][prevSlice];
+                            masks[idx]->m[masks[idx]->index(i,j,zSliceNoStruct[m])] = masks[idx]->m[masks[idx]->index(i,j,prevSlice)];
                         }
 
-                        if (phant.contour[i][j][zSliceNoStruct[m]] != 0) {
+                        if (con(i,j) != 0) {
 
-                            if (setup_MAR_Flag && phant.contour[i][j][zSliceNoStruct[m]] == indexMARContour && phant.d[i][j][zSliceNoStruct[m]] < low_threshold) { //STR
-                                phant.d[i][j][zSliceNoStruct[m]] = replacement;
+                            if (setup_MAR_Flag && con(i,j) == indexMARContour && den(i,j) < low_threshold) { //STR
+                                den(i,j) = replacement;
                             }
 
                             if (!tg43Flag) {
-                                for (n = 0; n < denThresholds[phant.contour[i][j][zSliceNoStruct[m]]].size()-1; n++)
-                                    if (phant.d[i][j][zSliceNoStruct[m]] < denThresholds[phant.contour[i][j][zSliceNoStruct[m]]][n]) {
+                                for (n = 0; n < denThresholds[con(i,j)].size()-1; n++)
+                                    if (den(i,j) < denThresholds[con(i,j)][n]) {
                                         break;
                                     }
 
-                                phant.m[i][j][zSliceNoStruct[m]] = mediaMap[medThresholds[phant.contour[i][j][zSliceNoStruct[m]]][n]];
+                                med(i,j) = mediaMap[medThresholds[con(i,j)][n]];
 
                             }
                             else {
-                                phant.m[i][j][zSliceNoStruct[m]] = 49;
+                                med(i,j) = 49;
                             }
 
                         }
                         else {
                             if (!tg43Flag) {
                                 for (n = 0; n < denThreshold.size()-1; n++)
-                                    if (phant.d[i][j][zSliceNoStruct[m]]  < denThreshold[n]) {
+                                    if (den(i,j)  < denThreshold[n]) {
                                         break;
                                     }
 
-                                phant.m[i][j][zSliceNoStruct[m]] = 49 + n + (n>8?7:0) + (n>34?6:0);
+                                med(i,j) = 49 + n + (n>8?7:0) + (n>34?6:0);
                             }
                             else {
-                                phant.m[i][j][zSliceNoStruct[m]] = 49;
+                                med(i,j) = 49;
                             }
                         }
                     }
@@ -4424,6 +5967,14 @@ void Interface::create_egsphant() {
     progWin->hide();
     progWin->close();
 
+    // Coarser voxels than the CT, if set in the advanced options
+    if (options->phantom_voxel_size > 0 && options->phantom_refine_radius > 0) {
+        adaptPhantom(options->phantom_voxel_size, options->phantom_refine_radius, labels.isEmpty() ? 0 : labels.constData());
+    }
+    else if (options->phantom_voxel_size > 0) {
+        resamplePhantom(options->phantom_voxel_size, labels.isEmpty() ? 0 : labels.constData());
+    }
+
 
     // ---------------------------------------------------------- //
     // OUTPUT IMAGES                                              //
@@ -4468,7 +6019,7 @@ void Interface::create_egsphant() {
             pen.setWidth(2);
             updateProgress(increment);
             for (int i = 0; i < phant.nz; i++) {
-                z = get_data->imagePos[i][2]/10.0;
+                z = phant.nz == get_data->numZ ? get_data->imagePos[i][2]/10.0 : (phant.z[i]+phant.z[i+1])/2.0;
                 phant.getEGSPhantPicDen("z axis", yi, yf, xi, xf, z, res).save(QString("Image/DenPic")+QString::number(i+1)+".png");
 
                 temp = phant.getEGSPhantPicMed("z axis", yi, yf, xi, xf, z, res);
@@ -4511,22 +6062,16 @@ void Interface::create_egsphant() {
     //std::cout<<"Saving the egsphant file as " <<egs_input->egsphant_location.toStdString() <<"\n";
 
     //Fix: change this file save location
-    phant.saveEGSPhantFile(egs_input->egsphant_location);
-
-    //std::cout<<"Reducing file size of the egsphant (using gzip) \n";
-
-    QProcess *qzip = new QProcess();
-    qzip->setProcessChannelMode(QProcess::MergedChannels);
-    qzip->setReadChannel(QProcess::StandardOutput);
-
-    //Actual line of exectuion
-    QString command = "gzip -f " + egs_input->egsphant_location;  //-f used if exisitng .gz file, -f forces the
-    //file to be created
-    qzip->execute(command);
-
-    //phant.savebEGSPhantFile("PrimaryOutput.begsphant");
-    duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
-    std::cout << "Egsphant file successfully output." <<egs_input->egsphant_location.toStdString() <<".gz  Time elapsed is " << duration << " s.\n";
+    if (!phant.saveEGSPhantFile(egs_input->egsphant_location + ".gz")) { // gzip compressed as it is written
+        QMessageBox msgBox;
+        msgBox.setText(tr("The egsphant file could not be written to\n") + egs_input->egsphant_location + ".gz");
+        msgBox.setWindowTitle(tr("egs_brachy GUI"));
+        msgBox.exec();
+    }
+    else {
+        duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+        std::cout << "Egsphant file successfully output." <<egs_input->egsphant_location.toStdString() <<".gz  Time elapsed is " << duration << " s.\n";
+    }
 
     trimEGS->generatedPhant = true;
     preview = new Preview(this, mediaMap);
@@ -4590,6 +6135,7 @@ void Interface::create_egsinp_files() {
     launchButton->setToolTip(tr("Launch egs_brachy and view metrics"));
     launchButton->setEnabled(1);
     PreviewButton->setEnabled(1);
+    tg43Button->setEnabled(!tg43Flag);
 
 
 
@@ -4952,6 +6498,17 @@ void Interface::updateProgress(double n) {
     *remainder -= floor(*remainder);
 }
 
+/***
+Function: waitForWorkers
+------------------------
+Process: Waits on future while moving the Interface progress bar
+***/
+void Interface::waitForWorkers(QFuture <void> future, std::atomic<int> *done, double increment) {
+    ::waitForWorkers(future, done, increment, [this](double n) {
+        updateProgress(n);
+    });
+}
+
 /***
 Function: updateProgress (from martin's interface.cpp 3ddose tools)
 -------------------------
@@ -5176,25 +6733,8 @@ void Interface::enable_midTab_trim(int row) {
 
             EGSPhant *selectedPhant= new EGSPhant;
 
-            if (phant_file.endsWith(".egsphant.gz")) { //gunzip the file
-                QProcess *qzip = new QProcess();
-                qzip->setProcessChannelMode(QProcess::MergedChannels);
-                qzip->setReadChannel(QProcess::StandardOutput);
-
-                //Actual line of exectuion
-                QString command = "gunzip " + phant_file;
-                qzip->execute(command);
-
-                phant_file.chop(3);
-                selectedPhant->loadEGSfirstlines(phant_file);
-
-                //zip back up
-                command = "gzip -f " + phant_file;  //-f used if exisitng .gz file, -f forces the
-                qzip->execute(command);
-            }
-            else {
-                selectedPhant->loadEGSfirstlines(phant_file);
-            }
+            // Only the header is read, a .egsphant.gz is inflated as far as needed
+            selectedPhant->loadEGSfirstlines(phant_file);
 
             trim_phantom_inputfiles->setEnabled(true);
             trim_phantom_inputfiles->setToolTip(tr("This button allows the user to change the egsphant boundaries, inscribe\n") +
@@ -5548,9 +7088,11 @@ void Interface::loadDICOMfile() {
         }
 
         get_data = new DICOM;
-        get_data ->extract(tempS2);
+        get_data ->extract(tempS2, dir_path);
 
         if (get_data->loadedct) {
+            ctPhant.nx = 0; // Nothing resampled from this CT yet
+
             // Assume first slice matches the rest and set x, y, and z boundaries
             phant.nx = get_data->xPix[0];
             phant.ny = get_data->yPix[0];
@@ -5559,20 +7101,8 @@ void Interface::loadDICOMfile() {
             phant.y.fill(0,phant.ny+1);
             phant.z.fill(0,phant.nz+1);
 
-            {
-                QVector <char> mz(phant.nz, 0);
-                QVector <QVector <char> > my(phant.ny, mz);
-                QVector <QVector <QVector <char> > > mx(phant.nx, my);
-                phant.m = mx;
-                QVector <double> dz(phant.nz, 0);
-                QVector <QVector <double> > dy(phant.ny, dz);
-                QVector <QVector <QVector <double> > > dx(phant.nx, dy);
-                phant.d = dx;
-                QVector <int> sz(phant.nz, 0);
-                QVector <QVector <int> > sy(phant.ny, sz);
-                QVector <QVector <QVector <int> > > sx(phant.nx, sy);
-                phant.contour = sx;
-            }
+            phant.allocate(true);
+            membership = StructMembership(); // Made for the previous phantom
 
             // Define xy bound values, still assuming first slice matches the rest
             for (int i = 0; i <= phant.nx; i++) {
@@ -5957,90 +7487,17 @@ void Interface::ATcreate_egsphant() {
     phant.media.clear();
 
     if (AT_tg43Flag) {
+        // Only the MAR contour is looked up, as in create_egsphant
+        structUnique.resize(get_data->structName.size());
+        structUnique.fill(false);
+        structPrio.resize(get_data->structName.size());
+        structPrio.fill(0);
 
-        // Track the number of media, and create a lookup for media to ASCII character representation
-        int medNum = 0;
-        phant.media.append(tissue[0]);
-        mediaMap.insert(tissue[0], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
-
-
-        // ---------------------------------------------------------- //
-        // CONVERTING HU TO APPROPRIATE DENSITY AND MEDIUM            //
-        // ---------------------------------------------------------- //
-        setup_progress_bar("Generating the phantom", "");
-
-        double increment =  1000000000/(phant.nx*phant.nz +3);
-
-        updateProgress(increment);
-        media = phant.media;
-
-        updateProgress(2*increment);
-
-        // Arrays that hold the struct numbers and center voxel values to be used
-        QList<QPoint> zIndex, yIndex, zExtIndex, yExtIndex;
-        QList<QPoint>::iterator p;
-        // double zMid, yMid, xMid; // unused
-        int tempHU = 0, n = 0, q = 0; // , inStruct = 0, prio = 0; // unused
-
-        // Convert HU to density and media without masks
-        for (int k = 0; k < phant.nz; k++) { // Z //
-            for (int j = 0; j < phant.ny; j++) { // Y //
-                for (int i = 0; i < phant.nx; i++) { // X //
-                    tempHU = get_data->HU[k][j][i];
-
-                    // Linear search because I don't think these arrays every get big
-                    // get the right density
-                    for (n = 0; n < HUMap.size()-1; n++)
-                        if (HUMap[n] <= tempHU && tempHU < HUMap[n+1]) {
-                            break;
-                        }
-                    if (tempHU < HUMap[0]) {
-                        n = 0;
-                    }
-                    if (tempHU > HUMap[HUMap.size()-1]) {
-                        n = HUMap.size() -2;
-                    }
-
-                    double temp = interp(tempHU,HUMap[n],HUMap[n+1],denMap[n],denMap[n+1]);
-                    temp = temp<=0?0.000001:temp; // Set min density to 0.000001
-
-                    if (temp > phant.maxDensity) { // Track max density for images
-                        phant.maxDensity = temp;
-                    }
-
-                    //STR//-------------------------------------------------------
-                    //if in the selected contour, replace with low threshold value
-                    if (phant.d[i][j][k] == 0) {
-                        phant.d[i][j][k] = temp;    //assign density
-                    }
-                    else {
-                        temp = phant.d[i][j][k];
-                    }
-
-                    if (setup_MAR_Flag && q == indexMARContour && phant.d[i][j][k] < low_threshold) {
-                        phant.d[i][j][k] = replacement;
-                    }
-                    //-------------------------------------------
-
-                    phant.m[i][j][k] = 49;
-
-                }
-            }
-            updateProgress(increment);
+        if (indexMARContour != -1) {
+            structUnique[indexMARContour] = true;
+            structPrio[indexMARContour] = 1;
         }
 
-
-
-        duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
-        std::cout << "Successfully generated egsphant (dimensions x: [" << phant.x[0] << "," << phant.x[phant.nx] << "], y:["
-                  << phant.y[0] << "," << phant.y[phant.ny] << "], z:["
-                  << phant.z[0] << "," << phant.z[phant.nz] << "]).  Time elapsed is " << duration << " s.\n";
-
-
-        progress->setValue(1000000000);
-        progWin->hide();
-        progWin->close();
-
     }
     else {
 
@@ -6052,196 +7509,60 @@ void Interface::ATcreate_egsphant() {
                 external[i] = true;
             }
         }
+    }
+    buildMediaMap(AT_tg43Flag, mediaMap);
+    compileMediaTables(mediaMap);
 
-        // Track the number of media, and create a lookup for media to ASCII character representation
-        int medNum = 0;
-
-        for (int i = 0; i < medThreshold.size(); i++) {
-            if (!mediaMap.contains(medThreshold[i])) {
-                phant.media.append(medThreshold[i]);
-                mediaMap.insert(medThreshold[i], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
-                medNum++; // 49 is the ASCII value of '1', 7 jumps from ';' to 'A', 6 jumps from '[' to 'a'
-            }
-        }
-
-        for (int i = 0; i < get_data->structName.size(); i++) {
-            for (int j = 0; j < medThresholds[i].size(); j++)
-                if (!mediaMap.contains(medThresholds[i][j])) {
-                    phant.media.append(medThresholds[i][j]);
-                    mediaMap.insert(medThresholds[i][j], 49 + medNum + (medNum>8?7:0) + (medNum>34?6:0));
-                    medNum++; // 49 is the ASCII value of '1', 7 jumps from ';' to 'A', 6 jumps from '[' to 'a'
-                }
-        }
-
-
-        // ---------------------------------------------------------- //
-        // CONVERTING HU TO APPROPRIATE DENSITY AND MEDIUM            //
-        // ---------------------------------------------------------- //
-        setup_progress_bar("Generating the phantom", "");
-
-        double increment =  1000000000/(phant.nx*phant.nz +3);
-
-        updateProgress(increment);
-        media = phant.media;
-
-
-        // Get bounding rectangles over each struct
-        QVector <QVector <QRectF> > structRect;
-        for (int i = 0; i < get_data->structPos.size(); i++) {
-            structRect.resize(i+1);
-            for (int j = 0; j < get_data->structPos[i].size(); j++) {
-                structRect[i].resize(j+1);
-                structRect[i][j] = get_data->structPos[i][j].boundingRect();
-            }
-        }
-
-
-        updateProgress(increment);
-
-
-        updateProgress(increment);
-        // Arrays that hold the struct numbers and center voxel values to be used
-        QList<QPoint> zIndex, yIndex, zExtIndex, yExtIndex;
-        QList<QPoint>::iterator p;
-        double zMid, yMid, xMid;
-        int tempHU = 0, n = 0, q = 0, inStruct = 0, prio = 0;
-
-        // Convert HU to density and media without masks
-        for (int k = 0; k < phant.nz; k++) { // Z //
-            if (get_data->structZ.size() > 0) {
-                zIndex.clear(); // Reset lookup
-                zMid = (phant.z[k]+phant.z[k+1])/2.0;
-                for (int l = 0; l < get_data->structZ.size(); l++)
-                    if (structUnique[l])
-                        for (int m = 0; m < get_data->structZ[l].size(); m++) {
-                            // If slice j of struct i on the same plane as slice k of the phantom
-                            if (abs(get_data->structZ[l][m] - zMid) < (phant.z[k+1]-phant.z[k])/2.0) {
-                                zIndex << QPoint(l,m);    // Add it to lookup
-                            }
-                        }
-            }
-
-            for (int j = 0; j < phant.ny; j++) { // Y //
-                if (zIndex.size() > 0) {
-                    yIndex.clear(); // Reset lookup
-                    yMid = (phant.y[j]+phant.y[j+1])/2.0;
-                    for (p = zIndex.begin(); p != zIndex.end(); p++) {
-                        // If column p->y() of struct p->x() on the same column as slice k,j of the phantom
-                        if (structRect[p->x()][p->y()].top() <= yMid && yMid <= structRect[p->x()][p->y()].bottom()) {
-                            yIndex << *p;
-                        }
-                    }
-                }
-
-                for (int i = 0; i < phant.nx; i++) { // X //
-                    tempHU = get_data->HU[k][j][i];
-                    xMid = (phant.x[i]+phant.x[i+1])/2.0;
-
-                    // Linear search because I don't think these arrays every get big
-                    // get the right density
-                    for (n = 0; n < HUMap.size()-1; n++)
-                        if (HUMap[n] <= tempHU && tempHU < HUMap[n+1]) {
-                            break;
-                        }
-                    if (tempHU < HUMap[0]) {
-                        n = 0;
-                    }
-                    if (tempHU > HUMap[HUMap.size()-1]) {
-                        n = HUMap.size() -2;
-                    }
-
-
-                    double temp = interp(tempHU,HUMap[n],HUMap[n+1],denMap[n],denMap[n+1]);
-                    temp = temp<=0?0.000001:temp; // Set min density to 0.000001
-
-                    if (temp > phant.maxDensity) { // Track max density for images
-                        phant.maxDensity = temp;
-                    }
-
-                    //if in the selected contour, replace with low threshold value
-                    if (phant.d[i][j][k] == 0) {
-                        phant.d[i][j][k] = temp; //assign density
-                    }
-                    else {
-                        temp = phant.d[i][j][k];
-                    }
-
-                    // get the right media
-                    if (yIndex.size() > 0) {
-                        inStruct = 0;
-                        prio = 0;
-                        for (p = yIndex.begin(); p != yIndex.end(); p++) { // Check through each
-                            // If row p->y() of struct p->x() on the same row as slice k,j,i of the phantom
-                            if (structRect[p->x()][p->y()].left() <= xMid && xMid <= structRect[p->x()][p->y()].right())
-                                if (get_data->structPos[p->x()][p->y()].containsPoint(QPointF(xMid,yMid), Qt::OddEvenFill)) {
-                                    if (structPrio[p->x()] > prio) {
-                                        inStruct = p->x()+1; // Inflate index for the next check
-                                        prio = structPrio[p->x()]; // Set priority at this struct's prio
-                                    }
-                                }
-                        }
-                    }
-
-                    if (inStruct) { // Deflate index again
-                        inStruct--;
-
-                        q = get_data->structLookup[get_data->structReference[inStruct]]; // get the structName index which matches denThresholds
-
-                        //Flag if in the selected contour for STR
-                        if (setup_MAR_Flag && q == indexMARContour && phant.d[i][j][k] < low_threshold) {
-                            phant.d[i][j][k] = replacement;
-                        }
+    // ---------------------------------------------------------- //
+    // CONVERTING HU TO APPROPRIATE DENSITY AND MEDIUM            //
+    // ---------------------------------------------------------- //
+    setup_progress_bar("Generating the phantom", "");
 
-                        //Find the media of the voxel
-                        for (n = 0; n < denThresholds[q].size()-1; n++)
-                            if (temp < denThresholds[q][n]) {
-                                break;
-                            }
+    double increment =  1000000000/(phant.nx*phant.nz +3);
 
-                        phant.m[i][j][k] = mediaMap[medThresholds[q][n]];
-                        phant.contour[i][j][k] = q;
+    updateProgress(increment);
+    media = phant.media;
 
-                    }
-                    else {
-                        for (n = 0; n < denThreshold.size()-1; n++)
-                            if (temp < denThreshold[n]) {
-                                break;
-                            }
-                        phant.m[i][j][k] = 49 + n + (n>8?7:0) + (n>34?6:0);
-                    }
-                }
-                updateProgress(increment);
-            }
-        }
+    updateProgress(2*increment);
 
+    // There are no masks in this tab
+    QVector <quint16> labels;
+    if (options->phantom_voxel_size > 0 && options->priority_vote) {
+        labels.fill(0, phant.size());
+    }
+    voxelizePhantom(AT_tg43Flag, QVector <int>(), increment, labels.isEmpty() ? 0 : labels.data());
 
-        duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
-        std::cout << "Successfully generated egsphant (dimensions x: [" << phant.x[0] << "," << phant.x[phant.nx] << "], y:["
-                  << phant.y[0] << "," << phant.y[phant.ny] << "], z:["
-                  << phant.z[0] << "," << phant.z[phant.nz] << "]).  Time elapsed is " << duration << " s.\n";
+    duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+    std::cout << "Successfully generated egsphant (dimensions x: [" << phant.x[0] << "," << phant.x[phant.nx] << "], y:["
+              << phant.y[0] << "," << phant.y[phant.ny] << "], z:["
+              << phant.z[0] << "," << phant.z[phant.nz] << "]).  Time elapsed is " << duration << " s.\n";
 
 
-        progress->setValue(1000000000);
-        progWin->hide();
-        progWin->close();
+    progress->setValue(1000000000);
+    progWin->hide();
+    progWin->close();
 
+    // Coarser voxels than the CT, if set in the advanced options
+    if (options->phantom_voxel_size > 0 && options->phantom_refine_radius > 0) {
+        adaptPhantom(options->phantom_voxel_size, options->phantom_refine_radius, labels.isEmpty() ? 0 : labels.constData());
+    }
+    else if (options->phantom_voxel_size > 0) {
+        resamplePhantom(options->phantom_voxel_size, labels.isEmpty() ? 0 : labels.constData());
     }
 
     //-----------------------------------------------------------------
     // Save egsphant file
     //-----------------------------------------------------------------
-    phant.saveEGSPhantFile(egs_input_file->egsphant_location);
-
-    //compress the egsphant file
-    QProcess *qzip = new QProcess();
-    qzip->setProcessChannelMode(QProcess::MergedChannels);
-    qzip->setReadChannel(QProcess::StandardOutput);
-    QString command = "gzip -f " + egs_input_file->egsphant_location;  //-f used if exisitng .gz file, -f forces the
-    qzip->execute(command);
-
-
-    duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
-    std::cout << "Egsphant file successfully output." <<egs_input_file->egsphant_location.toStdString() <<".gz  Time elapsed is " << duration << " s.\n";
+    if (!phant.saveEGSPhantFile(egs_input_file->egsphant_location + ".gz")) { // gzip compressed as it is written
+        QMessageBox msgBox;
+        msgBox.setText(tr("The egsphant file could not be written to\n") + egs_input_file->egsphant_location + ".gz");
+        msgBox.setWindowTitle(tr("egs_brachy GUI"));
+        msgBox.exec();
+    }
+    else {
+        duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+        std::cout << "Egsphant file successfully output." <<egs_input_file->egsphant_location.toStdString() <<".gz  Time elapsed is " << duration << " s.\n";
+    }
 
     //trimEGS->generatedPhant = true;
 
@@ -6397,54 +7718,65 @@ void Interface::apply_str_to_seed_locations() {
         }
 
 
-        int z_search_in_slices=2;
-        int count_values_replaced = 0;
-        double distance_from_seed;
-        double xy_search_in_cm = xy_search_in_mm/10.;
+        int count_values_replaced = replace_seed_densities();
+        std::cout<<"Applied STR. " <<count_values_replaced <<" values replaced. \n";
+        if (extraOptionsFlag) {
+            ATcreate_egsphant();    //If in the extra options tab, use this function
+        }
+        else {
+            create_egsphant();
+        }
+    }
+    STRwindow->setEnabled(true);
+}
 
-        int xy_search_in_voxels = ceil(xy_search_in_cm/fabs(phant.x[0]-phant.x[1]));
 
-        for (int i=0; i<get_data->all_seed_pos.size(); i++) {
-            for (int j=0; j<get_data->all_seed_pos[i].size(); j++) {
 
-                QVector <int> ijk = get_ijk_from_xyz(get_data->all_seed_pos[i][j].x, get_data->all_seed_pos[i][j].y, get_data->all_seed_pos[i][j].z);   //the seed location
-                if (ijk[0] == -1 || ijk[1] == -1 || ijk[2] == -1) {
-                    std::cout<<"ERROR: unable to apply STR to seed location. Seed index is outside of the phantom (x,y,z): (" <<get_data->all_seed_pos[i][j].x <<", " <<get_data->all_seed_pos[i][j].y <<", " <<get_data->all_seed_pos[i][j].z <<") \n";
-                }
-                else {
 
-                    for (int z = -z_search_in_slices; z < (z_search_in_slices+1); z++) {
-                        for (int y=-xy_search_in_voxels; y<= xy_search_in_voxels; y++) {
-                            for (int x=-xy_search_in_voxels; x<= xy_search_in_voxels; x++) {
 
-                                QVector<double> xyz = get_voxel_center_from_ijk(ijk[0]+x,ijk[1]+y,ijk[2] +z);
 
-                                distance_from_seed = sqrt(pow(fabs(get_data->all_seed_pos[i][j].x - xyz[0]),2) + pow(fabs(get_data->all_seed_pos[i][j].y - xyz[1]),2));
+/***
+Function: replace_seed_densities
+--------------------------------
+Process: The STR itself, sets every voxel of phant within the search radius
+         of a seed whose calibrated density is outside the low and high
+         thresholds to the replacement density
+Output:  Number of voxels replaced
+***/
+int Interface::replace_seed_densities() {
+    int z_search_in_slices=2;
+    int count_values_replaced = 0;
+    double distance_from_seed;
+    double xy_search_in_cm = xy_search_in_mm/10.;
 
-                                if (distance_from_seed < xy_search_in_cm) {
+    int xy_search_in_voxels = ceil(xy_search_in_cm/fabs(phant.x[0]-phant.x[1]));
+    const HUView hu = get_data->HU.view();
 
-                                    int tempHU = get_data->HU[ijk[2] +z][ijk[1]+y][ijk[0]+x];
-                                    int n=0;
+    for (int i=0; i<get_data->all_seed_pos.size(); i++) {
+        for (int j=0; j<get_data->all_seed_pos[i].size(); j++) {
 
-                                    for (n = 0; n < HUMap.size()-1; n++)
-                                        if (HUMap[n] <= tempHU && tempHU < HUMap[n+1]) {
-                                            break;
-                                        }
+            QVector <int> ijk = get_ijk_from_xyz(get_data->all_seed_pos[i][j].x, get_data->all_seed_pos[i][j].y, get_data->all_seed_pos[i][j].z);   //the seed location
+            if (ijk[0] == -1 || ijk[1] == -1 || ijk[2] == -1) {
+                std::cout<<"ERROR: unable to apply STR to seed location. Seed index is outside of the phantom (x,y,z): (" <<get_data->all_seed_pos[i][j].x <<", " <<get_data->all_seed_pos[i][j].y <<", " <<get_data->all_seed_pos[i][j].z <<") \n";
+            }
+            else {
 
+                for (int z = -z_search_in_slices; z < (z_search_in_slices+1); z++) {
+                    for (int y=-xy_search_in_voxels; y<= xy_search_in_voxels; y++) {
+                        for (int x=-xy_search_in_voxels; x<= xy_search_in_voxels; x++) {
 
-                                    if (tempHU < HUMap[0]) {
-                                        n = 0;
-                                    }
-                                    if (tempHU > HUMap[HUMap.size()-1]) {
-                                        n = HUMap.size() -2;
-                                    }
+                            QVector<double> xyz = get_voxel_center_from_ijk(ijk[0]+x,ijk[1]+y,ijk[2] +z);
 
-                                    double temp_density = interp(tempHU,HUMap[n],HUMap[n+1],denMap[n],denMap[n+1]);
+                            distance_from_seed = sqrt(pow(fabs(get_data->all_seed_pos[i][j].x - xyz[0]),2) + pow(fabs(get_data->all_seed_pos[i][j].y - xyz[1]),2));
 
-                                    if (temp_density > high_threshold || temp_density < low_threshold) {
-                                        phant.d[ijk[0]+x][ijk[1]+y][ijk[2] +z] = replacement;
-                                        count_values_replaced++;
-                                    }
+                            if (distance_from_seed < xy_search_in_cm) {
+
+                                int tempHU = hu(ijk[0]+x, ijk[1]+y, ijk[2]+z);
+                                double temp_density = tables.densityOf(tempHU);
+
+                                if (temp_density > high_threshold || temp_density < low_threshold) {
+                                    phant.d[phant.index(ijk[0]+x, ijk[1]+y, ijk[2]+z)] = replacement;
+                                    count_values_replaced++;
                                 }
                             }
                         }
@@ -6452,21 +7784,10 @@ void Interface::apply_str_to_seed_locations() {
                 }
             }
         }
-
-        std::cout<<"Applied STR. " <<count_values_replaced <<" values replaced. \n";
-        if (extraOptionsFlag) {
-            ATcreate_egsphant();    //If in the extra options tab, use this function
-        }
-        else {
-            create_egsphant();
-        }
     }
-    STRwindow->setEnabled(true);
-}
-
-
-
 
+    return count_values_replaced;
+}
 
 
 //--------------------------------------------------------------------------
@@ -6598,7 +7919,7 @@ void Interface::read_3ddose() {
                 // Show the metrics
                 calc_metrics_3ddose = new metrics;
                 //calculating the metrics
-                QVector <QVector <QVector <int> > >empty;
+                QVector <quint16> empty;
                 QMap <int, QString> empty_string;
                 calc_metrics_3ddose->get_data(dose->x, dose->y, dose->z, dose->cx, dose->cy, dose->cz, empty,
                                               dose->val, dose->err, empty_string);
@@ -6700,26 +8021,20 @@ void DICOM::create_3ddose(QString file_path, QString path_3ddose) {
     QVector<double> zbounds;
     QVector<QVector <double>> doseVals;
     QVector<QVector <double>> volVals;
-    QVector <Attribute *> *att;
-
-    QStringList pointData;
-    database dat;
-    DICOM *d = new DICOM(&dat);
+    DICOM *d = new DICOM();
     DICOM *dicomDose;
 
     if (d->parse(file_path)) {
         dicomDose = d;
         for (int j = 0; j < dicomDose->data.size(); j++) {
             if (dicomDose->data[j]->tag[0] == 0x0008 && dicomDose->data[j]->tag[1] == 0x0060) {
-                QString temp = "";
-                for (unsigned int s = 0; s < dicomDose->data[j]->vl; s++) {
-                    temp.append(dicomDose->data[j]->vf[s]);
-                }
+                QString temp = dicomDose->data[j]->asString();
 
                 temp = temp.trimmed();
 
                 if (temp !="RTDOSE") {
                     std::cout<<"The dicom file (" <<file_path.toStdString() <<") is not a dose file \n";
+                    delete d;
                     return;
                 }
             }
@@ -6730,14 +8045,8 @@ void DICOM::create_3ddose(QString file_path, QString path_3ddose) {
         for (int j = 0; j < dicomDose->data.size(); j++) {
             if (dicomDose->data[j]->tag[0] == 0x0020 && dicomDose->data[j]->tag[1] == 0x0032) { //Image Position Patient
 
-                QString temp = "";
-                for (unsigned int s = 0; s < dicomDose->data[j]->vl; s++) {
-                    temp.append(dicomDose->data[j]->vf[s]);
-                }
                 imagePos.resize(3);
-                imagePos[0] = (temp.split('\\',QString::SkipEmptyParts)[0]).toDouble();
-                imagePos[1] = (temp.split('\\',QString::SkipEmptyParts)[1]).toDouble();
-                imagePos[2] = (temp.split('\\',QString::SkipEmptyParts)[2]).toDouble();
+                dicomDose->data[j]->asDecimalArray(imagePos.data(), 3);
 
             }
             //else if (dicomDose->data[j]->tag[0] == 0x0028 && dicomDose->data[j]->tag[1] == 0x0008) {   //Number of Frames // unused
@@ -6751,64 +8060,33 @@ void DICOM::create_3ddose(QString file_path, QString path_3ddose) {
             //}                                                                                                             // unused
             else if (dicomDose->data[j]->tag[0] == 0x0028 && dicomDose->data[j]->tag[1] == 0x0010) {   //Number of Rows
 
-                if (dicomDose->isBigEndian)
-                    yPix = (unsigned short int)(((short int)(dicomDose->data[j]->vf[0]) << 8) +
-                                                (short int)(dicomDose->data[j]->vf[1]));
-                else
-                    yPix = (unsigned short int)(((short int)(dicomDose->data[j]->vf[1]) << 8) +
-                                                (short int)(dicomDose->data[j]->vf[0]));
+                yPix = dicomDose->data[j]->asUS(dicomDose->isBigEndian);
 
             }
             else if (dicomDose->data[j]->tag[0] == 0x0028 && dicomDose->data[j]->tag[1] == 0x0011) {   //Number of Columns
 
-                if (dicomDose->isBigEndian)
-                    xPix = (unsigned short int)(((short int)(dicomDose->data[j]->vf[0]) << 8) +
-                                                (short int)(dicomDose->data[j]->vf[1]));
-                else
-                    xPix = (unsigned short int)(((short int)(dicomDose->data[j]->vf[1]) << 8) +
-                                                (short int)(dicomDose->data[j]->vf[0]));
+                xPix = dicomDose->data[j]->asUS(dicomDose->isBigEndian);
             }
             else if (dicomDose->data[j]->tag[0] == 0x0028 && dicomDose->data[j]->tag[1] == 0x0030) {   //Pixel Spacing
 
-                QString temp = "";
-                for (unsigned int s = 0; s < dicomDose->data[j]->vl; s++) {
-                    temp.append(dicomDose->data[j]->vf[s]);
-                }
                 xySpacing.resize(2);
-                xySpacing[0] = (temp.split('\\',QString::SkipEmptyParts)[0]).toDouble();
-                xySpacing[1] = (temp.split('\\',QString::SkipEmptyParts)[1]).toDouble();
+                dicomDose->data[j]->asDecimalArray(xySpacing.data(), 2);
 
             }
             else if (dicomDose->data[j]->tag[0] == 0x0028 && dicomDose->data[j]->tag[1] == 0x0100) {   //Bits Allocated
 
-                if (dicomDose->isBigEndian)
-                    bits = (unsigned short int)(((short int)(dicomDose->data[j]->vf[0]) << 8) +
-                                                (short int)(dicomDose->data[j]->vf[1]));
-                else
-                    bits = (unsigned short int)(((short int)(dicomDose->data[j]->vf[1]) << 8) +
-                                                (short int)(dicomDose->data[j]->vf[0]));
+                bits = dicomDose->data[j]->asUS(dicomDose->isBigEndian);
 
             }
             else if (dicomDose->data[j]->tag[0] == 0x3004 && dicomDose->data[j]->tag[1] == 0x000c) {   //Grid Frame Offset
 
-                QString temp = "";
-                for (unsigned int s = 0; s < dicomDose->data[j]->vl; s++) {
-                    temp.append(dicomDose->data[j]->vf[s]);
-                }
-                //Long vector - do something like this
-                pointData = temp.split('\\');
-                for (int m = 0; m < pointData.size(); m++) {
-                    frame_offset.append(pointData[m].toDouble());
-                }
+                //Long vector, parsed straight into frame_offset
+                frame_offset += dicomDose->data[j]->asDecimalArray();
 
             }
             else if (dicomDose->data[j]->tag[0] == 0x3004 && dicomDose->data[j]->tag[1] == 0x000e) {   //Dose Grid Scaling
 
-                QString temp = "";
-                for (unsigned int s = 0; s < dicomDose->data[j]->vl; s++) {
-                    temp.append(dicomDose->data[j]->vf[s]);
-                }
-                doseScaling = temp.toDouble();
+                doseScaling = dicomDose->data[j]->asDecimal();
             }
             else if (dicomDose->data[j]->tag[0] == 0x7fe0 && dicomDose->data[j]->tag[1] == 0x0010) {    //Pixel Data
 
@@ -6857,40 +8135,25 @@ void DICOM::create_3ddose(QString file_path, QString path_3ddose) {
 
             }
             else if (dicomDose->data[j]->tag[0] == 0x3004 && dicomDose->data[j]->tag[1] == 0x0050) {   //DVH Sequence
-                QByteArray tempData;
                 for (int k = 0; k < dicomDose->data[j]->seq.items.size(); k++) {
-                    tempData = QByteArray((char *)dicomDose->data[j]->seq.items[k]->vf,dicomDose->data[j]->seq.items[k]->vl);
-                    QDataStream dataStream(tempData);
-
-                    att = new QVector <Attribute *>;
-                    if (!dicomDose->parseSequence(&dataStream, att)) {
-                        std::cout << "Failed to parse sequence data for tag (3004,0050)  \n";
-                    }
+                    DataSetCursor att(dicomDose, dicomDose->data[j]->seq.items[k]);
 
-                    for (int l = 0; l < att->size(); l++)
-                        if (att->at(l)->tag[0] == 0x3004 && att->at(l)->tag[1] == 0x0058) {
-                            QStringList DVHdata;
+                    while (att.next())
+                        if (att.is(0x3004, 0x0058)) {
                             doseVals.resize(doseVals.size()+1);
                             volVals.resize(volVals.size()+1);
-                            QString tempS = "";
-
-                            for (unsigned int s = 0; s < att->at(l)->vl; s++) {
-                                tempS.append(att->at(l)->vf[s]);
-                            }
 
-                            DVHdata = tempS.split('\\');
-
-                            for (int m = 0; m < DVHdata.size(); m+=2) {
-                                doseVals.last().append(DVHdata[m].toDouble());
-                                volVals.last().append(DVHdata[m+1].toDouble());
+                            QVector <double> DVHdata = att.value().asDecimalArray();
+                            doseVals.last().reserve(DVHdata.size()/2);
+                            volVals.last().reserve(DVHdata.size()/2);
+                            for (int m = 0; m+1 < DVHdata.size(); m+=2) {
+                                doseVals.last().append(DVHdata[m]);
+                                volVals.last().append(DVHdata[m+1]);
                             }
                         }
-
-
-                    for (int l = 0; l < att->size(); l++) {
-                        delete att->at(l);
+                    if (att.failed()) {
+                        std::cout << "Failed to parse sequence data for tag (3004,0050)  \n";
                     }
-                    delete att;
                 }
             }
             //updateProgress(increment);
@@ -7010,6 +8273,7 @@ void DICOM::create_3ddose(QString file_path, QString path_3ddose) {
         std::cout<<"Unable to parse " <<file_path.toStdString() <<"\n";
     }
 
+    delete d;
 }
 
 
@@ -42,6 +42,11 @@
 
 #include <QtGui>
 #include <QtWidgets>
+#include <QtConcurrent>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <new>
 #include <iostream>
 #include <math.h>
 #include <egsphant.h>
@@ -68,14 +73,285 @@ class Sequence;
 class SequenceItem;
 class Attribute;
 class DICOM;
+
+// Shared by DICOM and Interface, progress is called with the increment
+// earned by the items the workers have counted in done
+void waitForWorkers(QFuture <void> future, std::atomic<int> *done, double increment,
+                    std::function<void(double)> progress);
+
+// A CT slice whose pixel data still has to be decoded into DICOM::HU, the
+// pixels point into the mapped file of the slice's DICOM object
+struct PixelJob {
+    DICOM *source; // Unmapped once the slice is decoded
+    int slice; // Index of the slice (k) in HU
+    const unsigned char *pixels;
+    unsigned long int length;
+    unsigned short int nx, ny;
+    bool bigEndian;
+    bool rescale;
+    double m, b; // Rescale slope and intercept
+};
+
+// Where one CT slice is and how to decode it, either a whole single frame
+// file or one frame of an enhanced (multi-frame) CT, gathered for every slice
+// before they are put in order
+struct CTSlice {
+    DICOM *source = NULL;
+    int frame = 0; // Frame within source, 0 for a single frame file
+    double spacing[2] = {0, 0}, thickness = 0, pos[3] = {0, 0, 0};
+    unsigned short int rows = 0, cols = 0;
+    double m = 1, b = 0;
+    bool hasSpacing = false, hasThickness = false, hasPos = false;
+    bool hasRows = false, hasCols = false, hasSlope = false, hasIntercept = false;
+    const unsigned char *pixels = NULL; // Into source's mapping, NULL if it has no pixel data
+    unsigned long int length = 0;
+};
+
+// Read-only look at an HU volume, cheap to copy and index without going
+// through the DICOM object
+struct HUView {
+    const short int *data;
+    int nx, ny, nz;
+    qint64 rowStride, sliceStride; // In voxels
+
+    short int operator()(int i, int j, int k) const {
+        return data[k*sliceStride+j*rowStride+i];
+    }
+    const short int *row(int j, int k) const {
+        return data+k*sliceStride+j*rowStride;
+    }
+};
+
+// The CT data as a single aligned block of shorts, i (column) varies fastest,
+// then j (row) and then k (slice).  Rows are padded to a multiple of 32 bytes
+// so that every row starts aligned.
+class HUVolume {
+public:
+    int nx = 0, ny = 0, nz = 0;
+    qint64 rowStride = 0, sliceStride = 0; // In voxels
+
+    HUVolume() {}
+    ~HUVolume();
+
+    void allocate(int x, int y, int z); // Zero filled
+    void clear();
+    void crop(int i0, int i1, int j0, int j1, int k0, int k1); // Inclusive bounds
+    bool isEmpty() const {
+        return voxels == NULL;
+    }
+
+    short int *row(int j, int k) {
+        return voxels+k*sliceStride+j*rowStride;
+    }
+    HUView view() const;
+
+private:
+    short int *voxels = NULL;
+    Q_DISABLE_COPY(HUVolume)
+};
+
+// Finds the voxels of one phantom row that are inside a contour from a
+// single pass over the contour's edges, instead of testing every voxel.  A
+// voxel is inside exactly when QPolygonF::containsPoint(centre, OddEvenFill)
+// says it is, the crossings are computed the same way Qt does.
+class ScanlineRasterizer {
+public:
+    void setCentres(const QVector <double> &bounds); // Voxel boundaries along the row
+
+    // Calls fill(i0, i1) for each run of voxels [i0, i1) on row y whose centre
+    // is inside poly and within [left, right]
+    template <class F> void fillRow(const QPolygonF &poly, double y, double left, double right, F fill) {
+        findCrossings(poly, y);
+        const double *m = mid.constData();
+        const double *c = crossings.constData();
+        int n = mid.size(), nc = crossings.size();
+
+        if (!sorted) { // Can't search the centres, count the crossings left of each one
+            for (int i = 0; i < n; i++)
+                if (left <= m[i] && m[i] <= right && (std::upper_bound(c, c+nc, m[i])-c)%2) {
+                    fill(i, i+1);
+                }
+            return;
+        }
+
+        // A centre is inside between an odd crossing and the next one
+        int r0 = std::lower_bound(m, m+n, left)-m;
+        int r1 = std::upper_bound(m, m+n, right)-m;
+        for (int l = 0; l < nc; l += 2) {
+            int i0 = qMax(r0, int(std::lower_bound(m, m+n, c[l])-m));
+            int i1 = qMin(r1, l+1 < nc ? int(std::lower_bound(m, m+n, c[l+1])-m) : n);
+            if (i0 < i1) {
+                fill(i0, i1);
+            }
+        }
+    }
+
+private:
+    void findCrossings(const QPolygonF &poly, double y);
+    void addCrossing(const QPointF &a, const QPointF &b, double y);
+
+    QVector <double> mid; // Voxel centres
+    QVector <double> crossings; // Of the last row, sorted
+    bool sorted = true; // mid is non-decreasing
+};
+
+// The voxel runs of one contour on every row of the phantom
+struct ContourRuns {
+    bool done = false;
+    QVector <int> rowStart; // Row j's runs are runs[rowStart[j]] up to runs[rowStart[j+1]]
+    QVector <int> runs; // [i0, i1) pairs
+};
+
+// Which voxels every contour covers, kept between generations for as long as
+// the contours and the x/y grid don't change.  Changing the tissue assignment,
+// the priorities or the calibration then doesn't rasterize anything again.
+class ContourRunCache {
+public:
+    // Drops everything if the contours or grid aren't the ones cached
+    bool prepare(const QVector <QVector <QPolygonF> > &structPos, const QVector <double> &x, const QVector <double> &y);
+    void rasterize(ContourRuns *contour, const QPolygonF &poly, const QRectF &rect) const;
+
+    ContourRuns *entry(int s, int c) {
+        return &contours[s][c];
+    }
+    const ContourRuns &at(int s, int c) const {
+        return contours[s][c];
+    }
+
+private:
+    QVector <QVector <QPolygonF> > structPos; // Shared with the DICOM's copy until that changes
+    QVector <double> x, y;
+    QVector <QVector <ContourRuns> > contours;
+};
+
+// The calibration curve and tissue assignment scheme compiled into flat
+// tables indexed by HU+32768, so a voxel is assigned with a couple of loads
+class TissueTables {
+public:
+    QVector <double> density; // Calibrated density of each HU, not clamped
+    QVector <int> structRow; // Media row of each struct index, its denThresholds row plus one
+    QVector <QVector <double> > thresholds; // Row 0 is the default scheme, row q+1 is denThresholds[q]
+    QVector <QVector <char> > codes; // Media character of each threshold
+    QVector <QVector <char> > media; // Media character of each HU for each row
+
+    double densityOf(int hu) const {
+        return density[hu+32768];
+    }
+    char mediaOfHU(int row, int hu) const {
+        return media[row][hu+32768];
+    }
+    char mediaOf(int row, double d) const; // For a density that didn't come from HU
+};
+
+// Buffers of Interface::labelRowSampled, kept by each slab so that rows of
+// the same length reuse them
+struct SampleRows {
+    QVector <int> label, prio; // Sample planes of a row
+    QVector <char> hit; // Samples of the struct being gathered
+    QVector <int> count, best; // Per voxel
+    QVector <int> candidates;
+};
+
+// What every slab of a phantom being voxelized shares
+struct VoxelGrid {
+    EGSPhant *phant; // Each slab only writes its own slices
+    QVector <EGSPhant *> masks;
+    QVector <int> structMask; // Index in masks of each struct's mask, -1 for none
+    QVector <QList<QPoint> > zIndex; // Contours on the plane of each slice
+    QVector <QVector <QRectF> > structRect; // Bounding rectangle of each contour
+    QVector <double> rowLo, rowHi; // y of the first and last sample centres of each row
+    HUView hu;
+    QVector <MemberRun> *memberRows; // Every struct on each row j+ny*k, one writer per row
+    quint16 *labels; // Inflated struct of voxel i+nx*(j+ny*k), or 0 to not keep them
+    bool sharedLabels; // Take the structs from labels and the membership, not the contours
+    int marStruct; // Struct of the MAR contour, -1 for none
+    std::atomic<int> *rowsDone;
+};
+
+// One phantom of create_scenario_egsphants, all of them use the current
+// calibration and tissue assignment scheme
+struct PhantomScenario {
+    QString path; // egsphant to write, gzipped after
+    bool tg43 = false;
+    QString medium = "WATER_0.998"; // The only medium of a TG-43 phantom
+    bool mar = false;
+};
+
+// A run of slices voxelized by one task, with the lookup state the serial
+// loop would have had on reaching its first slice
+struct VoxelSlab {
+    int k0, k1;
+    QList<QPoint> yIndex;
+    int yRow; // The row yIndex was found for
+    int inStruct;
+    double maxDensity; // Of this slab only
+};
+
+// Bump allocator that every Attribute and SequenceItem of one DICOM file
+// comes from.  Nothing is freed on its own, clear() drops the whole tree at
+// once, so everything allocated here must not need its destructor run.
+class DicomArena {
+public:
+    DicomArena() {}
+    ~DicomArena();
+
+    void *allocate(size_t size, size_t align);
+    template <class T, class... Args> T *make(Args... args) {
+        return new (allocate(sizeof(T), alignof(T))) T(args...);
+    }
+    void clear();
+
+private:
+    struct Block {
+        Block *next;
+    };
+    static constexpr size_t blockSize = 64*1024;
+
+    Block *blocks = NULL;
+    char *cur = NULL, *limit = NULL;
+    Q_DISABLE_COPY(DicomArena)
+};
+
+// A growable array kept in a DicomArena, outgrown storage is simply left
+// behind until the arena is cleared
+template <class T> class ArenaArray {
+public:
+    int size() const {
+        return count;
+    }
+    T &operator[](int i) {
+        return values[i];
+    }
+    const T &operator[](int i) const {
+        return values[i];
+    }
+
+    void append(DicomArena &arena, T value) {
+        if (count == capacity) {
+            capacity = capacity ? 2*capacity : 4;
+            T *grown = (T *)arena.allocate(sizeof(T)*capacity, alignof(T));
+            if (count > 0) {
+                memcpy(grown, values, sizeof(T)*count);
+            }
+            values = grown;
+        }
+        values[count++] = value;
+    }
+
+private:
+    T *values = NULL;
+    int count = 0, capacity = 0;
+};
+
 // The following two classes are used to hold a sequence of items (and yes, you
 // can have nested sequences, cause, you know, why not?)
 class Sequence {
 public:
-    QVector <SequenceItem *> items;
-    ~Sequence();
+    ArenaArray <SequenceItem *> items;
 };
 
+// The items and attributes below live in their DICOM's arena and their value
+// fields point into its mapped file, so none of them free anything
 class SequenceItem {
 public:
     unsigned long int vl; // Value Length
@@ -83,47 +359,152 @@ public:
     Sequence seq; // Contains potential sequences
 
     SequenceItem(unsigned long int size, unsigned char *data);
-    SequenceItem(unsigned long int size, Attribute *data);
-    ~SequenceItem();
 };
 
 // Might as well be a struct, but I might want some methods in the future
 class Attribute {
 public:
     unsigned short int tag[2]; // Element Identifier
-    QString desc; // Desciption
-    unsigned short int vr; // Value Representation
+    const char *desc; // Desciption (points into the dictionary)
+    unsigned char vr; // Value Representation (a VRCode)
     unsigned long int vl; // Value Length
     unsigned char *vf; // Value Field
     Sequence seq; // Contains potential sequences
 
     Attribute();
-    ~Attribute();
+
+    // Typed reads straight from vf, multi-valued strings (DS, IS) are split on
+    // backslashes and anything that doesn't parse comes back as 0
+    QString asString() const;
+    int valueCount() const;
+    int asInt(int n = 0) const;
+    double asDecimal(int n = 0) const;
+    int asDecimalArray(double *out, int max) const;
+    QVector <double> asDecimalArray() const;
+    unsigned short int asUS(bool bigEndian) const;
+};
+
+// Value representations are stored as these codes rather than strings,
+// VR_NONE is used for items/delimiters and for anything unrecognized
+enum VRCode : unsigned char {
+    VR_NONE = 0,
+    VR_AE, VR_AS, VR_AT, VR_CS, VR_DA, VR_DS, VR_DT, VR_FD, VR_FL, VR_IS,
+    VR_LO, VR_LT, VR_OB, VR_OD, VR_OF, VR_OL, VR_OV, VR_OW, VR_PN, VR_SH,
+    VR_SL, VR_SQ, VR_SS, VR_ST, VR_SV, VR_TM, VR_UC, VR_UI, VR_UL, VR_UN,
+    VR_UR, VR_US, VR_UT, VR_UV
+};
+
+class DataSetCursor;
+
+// Walks the items of a sequence where they lie in the parent's buffer, it
+// doesn't allocate anything
+class SequenceCursor {
+public:
+    SequenceCursor(DICOM *owner, const unsigned char *begin, const unsigned char *end);
+
+    bool next(); // Moves to the next item, false once there are no more
+    bool failed() const {
+        return bad;
+    }
+    bool finished() const { // The sequence delimiter was reached
+        return done;
+    }
+    const unsigned char *position() const {
+        return pos;
+    }
+    DataSetCursor item() const; // The data elements of the current item
+
+private:
+    DICOM *owner;
+    const unsigned char *pos, *end;
+    const unsigned char *itemBegin = NULL;
+    unsigned long int itemLength = 0;
+    bool bad = false, done = false;
+};
+
+// Walks the data elements of a buffer (normally a sequence item) in place.
+// Nothing is copied, an element only becomes an Attribute when value() is
+// called, and nested sequences are only split into items if they are visited.
+class DataSetCursor {
+public:
+    DataSetCursor(DICOM *owner, const unsigned char *begin, unsigned long int n);
+    DataSetCursor(DICOM *owner, const SequenceItem *item);
+
+    bool next(); // Moves to the next element, false at the end or on bad data
+    bool find(unsigned short int group, unsigned short int element); // Calls next() until the tag is found
+    bool failed() const {
+        return bad;
+    }
+
+    bool is(unsigned short int group, unsigned short int element) const {
+        return tag[0] == group && tag[1] == element;
+    }
+    unsigned short int group() const {
+        return tag[0];
+    }
+    unsigned char vr() const {
+        return vrCode;
+    }
+    const Attribute &value(); // The current element, its vf points into the buffer
+    SequenceCursor items() const; // The items of the current element, if it is a sequence
+
+private:
+    DICOM *owner;
+    const unsigned char *pos, *end;
+    unsigned short int tag[2] = {0, 0};
+    unsigned char vrCode = VR_NONE;
+    const unsigned char *vf = NULL; // For a sequence, where its items start
+    const unsigned char *vfEnd = NULL;
+    bool bad = false;
+    Attribute current;
 };
 
 // These are all defined in database.cpp so as to save alot of recompiling
 // hassle
 struct Reference {
-    unsigned short int tag[2]; // Element Identifier
-    QString vr; // Element Identifier
-    QString title; // Title of element
+    unsigned int tag; // Element Identifier, group in the upper 16 bits
+    unsigned char vr; // Value Representation (a VRCode)
+    const char *title; // Title of element
 };
 
-class database : public QObject {
-    Q_OBJECT
-
+// The dictionary itself is a compile time table, so there is nothing to
+// construct and all of these can be called from any thread
+class database {
 public:
-    // Contains a list of known attribute entries
-    QVector <Reference *> lib;
-    // Contains all the acceptable value representations
-    QStringList validVR;
-    QStringList implicitVR;
+    static const Reference *find(unsigned short int one, unsigned short int two);
 
-    database();
-    ~database();
+    static unsigned char vrCode(unsigned char a, unsigned char b);
+    static bool validVR(unsigned char vr);
+    static bool implicitVR(unsigned char vr);
+};
 
-    Reference binSearch(unsigned short int one, unsigned short int two, int min,
-                        int max);
+// What is remembered about one file in a DICOM directory so that it doesn't
+// have to be parsed again while its size and modification time are unchanged
+struct DicomIndexEntry {
+    qint64 size = 0;
+    qint64 mtime = 0; // ms since epoch
+    bool isDicom = false; // Files that failed to parse are remembered too
+    QString modality;
+    QString seriesUID;
+    QString sopUID;
+    double z = std::nan("1");
+    qint64 pixelOffset = -1;
+    quint64 pixelLength = 0;
+    qint32 numFrames = 1;
+    bool bigEndian = false;
+    bool enhanced = false; // Has per-frame functional groups, always parsed
+    CTSlice geometry; // Everything needed to decode a CT slice, source and pixels unused
+};
+
+// The index is kept in the user's cache directory, one file per DICOM
+// directory, keyed by paths relative to that directory
+class DicomIndex {
+public:
+    static const char *fileName; // Where older versions kept it, in the DICOM directory
+
+    static QHash <QString, DicomIndexEntry> load(QString dir);
+    static bool save(QString dir, const QHash <QString, DicomIndexEntry> &entries);
+    static QString cachePath(QString dir);
 };
 
 class DICOM : public QWidget {
@@ -139,9 +520,6 @@ public:
     // Contains all the data read in from a dicom file sorted into attributes
     QVector <Attribute *> data;
 
-    // Pointer to precompiled DICOM library
-    database *lib;
-
     // Transfer syntax
     bool isImplicit, isBigEndian;
     bool loadedct = false;
@@ -154,18 +532,47 @@ public:
     // file location for later lookup
     QString path;
 
-    DICOM(database *);
+    // Saved while parsing so that files can be sorted without searching data
+    QString modality;
+    QString seriesUID;
+    QString sopUID;
+    qint64 pixelOffset = -1; // Offset of the pixel data (7FE0,0010) in the file
+    unsigned long int pixelLength = 0;
+    int numFrames = 1; // Number of Frames (0028,0008), more than 1 for an enhanced CT
+    bool enhanced = false; // Has a Per-frame Functional Groups Sequence (5200,9230)
+    CTSlice geometry; // Size, spacing, position and rescale of a CT slice
+    bool fromIndex = false; // The above came from the directory index, data is still empty
+
+    // The file is mapped (or read in one go if it can't be) and every value
+    // field in data points into it, so it must stay alive as long as data does
+    QFile *mapFile = NULL;
+    unsigned char *mapData = NULL;
+    qint64 mapSize = 0;
+    QByteArray mapBuffer;
+
+    // Every Attribute and SequenceItem in data comes from here
+    DicomArena arena;
+
     DICOM();
     ~DICOM();
 
-    int parse(QString p);
-    int readSequence(QDataStream *in, Attribute *att);
-    int readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n = 0);
+    bool openMapping();
+    void releaseMapping();
+    void releaseData();
 
-    int parseSequence(QDataStream *in, QVector <Attribute *> *att);
+    int parse(QString p, bool headerOnly = false);
+    bool readElementHeader(const unsigned char *&pos, const unsigned char *end, unsigned short int tag[2], unsigned char &vr, unsigned long int &vl);
+    bool readElement(const unsigned char *&pos, const unsigned char *end, Attribute *temp, bool &known);
+    int readSequence(const unsigned char *&pos, const unsigned char *end, Attribute *att);
+    int readDefinedSequence(const unsigned char *&pos, const unsigned char *end, Attribute *att, unsigned long int n = 0);
+    const unsigned char *findItemEnd(const unsigned char *start, const unsigned char *end);
 
-    void extract(QVector<QString> tempS2);
+    void extract(QVector<QString> tempS2, QString indexDir = "");
     void extract_data_for_dicomdose(DICOM *dicom);
+    void readGeometry(const Attribute **shared = NULL, const Attribute **perFrame = NULL);
+    void readFunctionalGroups(const SequenceItem *groups, CTSlice &slice);
+    void decodeSlice(const PixelJob &job);
+    void waitForWorkers(QFuture <void> future, std::atomic<int> *done, double increment);
 
     void submerge(QVector <DICOM *> &data, int i, int c, int f);
     void mergeSort(QVector <DICOM *> &data, int n);
@@ -191,7 +598,7 @@ public:
 
     // For CT data ---------------------------------- //
     double rescaleM = 1, rescaleB = 0, rescaleFlag;
-    QVector <QVector <QVector <short int> > > HU;
+    HUVolume HU;
     QVector <unsigned short int> xPix;
     QVector <unsigned short int> yPix;
     int numZ;
@@ -239,6 +646,13 @@ private:
     bool get_seed_from_user();          //Pop-up window to ask user to verity/select the brachytherapy seed
     bool select_air_kerma(QString seed);
     bool readCalib();
+    void compileDensityTable();
+    void buildMediaMap(bool tg43, QMap <QString,unsigned char> &mediaMap, QString tg43Medium = QString()); // tissue[0] by default
+    void blockFactors(double size, int f[3]) const;
+    void resamplePhantom(double size, const quint16 *labels = 0); // size in mm, labels to vote by priority
+    void adaptPhantom(double size, double radius, const quint16 *labels = 0); // both in mm
+    void mergeVoxels(const QVector <QVector <int> > &cuts, const quint16 *labels = 0);
+    void compileMediaTables(const QMap <QString,unsigned char> &mediaMap);
     QVector<QString> get_seedList();    //Retrieve list of possible seeds from egs_brachy (EGSnrc_with_egs_brachy/egs_home/egs_brachy/lib/geometry/sources/)
 
     QString getPath(QString path);  //Returns the path of an alias
@@ -303,6 +717,9 @@ private:
     QVector <double> HUMap, denMap;
     bool readCalibFile = false;
     QMap <QString,unsigned char> mediaMap;
+    TissueTables tables;
+    ContourRunCache runCache;
+    StructMembership membership; // All the structs of each voxel, for metrics on overlapping contours
 
     //Finctions and veriables for MAR/STR
     QVector<int> get_ijk_from_xyz(double x, double y, double z); // returns the (i,j,k) of the dose dist
@@ -318,8 +735,18 @@ private:
 
 
     QVector<double> get_voxel_center_from_ijk(double ii, double jj, double kk);
+    template <bool TG43, bool MAR, bool MASK> void voxelizeSlab(VoxelSlab &slab, const VoxelGrid &grid) const;
+    void voxelizePhantom(bool tg43, const QVector <int> &structMask, double increment,
+                         quint16 *labels = 0, bool sharedLabels = false);
+    void labelRow(const QList<QPoint> &yIndex, int j, QVector <int> &rowStruct, QVector <int> &rowPrio,
+                  QVector <MemberRun> *members = 0, SampleRows *scratch = 0) const;
+    void labelRowSampled(const QList<QPoint> &yIndex, int j, QVector <int> &rowStruct, QVector <int> &rowPrio,
+                         QVector <MemberRun> *members, SampleRows &scratch) const;
+    int superSample = 1; // Contour samples along each side of a voxel
+    void waitForWorkers(QFuture <void> future, std::atomic<int> *done, double increment);
 
     EGSPhant phant;
+    EGSPhant ctPhant; // The CT grid phant was resampled from, if nx > 0
     QVector <EGSPhant *> masks;
 
 public:
@@ -328,6 +755,8 @@ public:
 
     void setup_progress_bar(QString window_title, QString text);    //Creates the progress bar
     double interp(double x, double x1, double x2, double y1, double y2);
+    void create_scenario_egsphants(const QVector <PhantomScenario> &scenarios); //Builds several egsphants sharing one labelling
+    int replace_seed_densities();   //The STR of apply_str_to_seed_locations on phant
 
 
 public slots:
@@ -380,6 +809,7 @@ public slots:
 
     //MAR/STR slots
     void apply_str_to_seed_locations(); //applies STR
+    void create_tg43_comparison(); //Writes a TG-43 phantom on the labelling of the last one
 
     // void continue_egsphant();
     void setup_MAR();   //calls STR if treatment type == LDR
@@ -409,6 +839,7 @@ public:
 
     QPushButton *PreviewButton;
     QPushButton *launchButton;
+    QPushButton *tg43Button;
     QPushButton *options_button;
     QPushButton *trim_button;
     QPushButton *save_file_location_button;
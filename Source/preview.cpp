@@ -716,7 +716,7 @@ int Preview::getMedia(double px, double py, double pz) {
 
     // This is to ensure that no area outside the vectors is accessed
     if (ix < phant.nx && ix >= 0 && iy < phant.ny && iy >= 0 && iz < phant.nz && iz >= 0) {
-        return medCharMap[phant.m[ix][iy][iz]];
+        return medCharMap[phant.m[phant.index(ix,iy,iz)]];
     }
 
     return 0; // We are not within our bounds